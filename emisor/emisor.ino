@@ -14,9 +14,14 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266HTTPClient.h>
 #include <WiFiClient.h>
+#include <WiFiUdp.h>
+#include <espnow.h>
+#include <LittleFS.h>
+#include <time.h>
 #include <OneWire.h>
 #include <DallasTemperature.h>
 #include <ArduinoJson.h>
+#include "rift_protocol.h"
 
 // ============================================================================
 // CONFIGURACIÓN - MODIFICAR SEGÚN INSTALACIÓN
@@ -38,6 +43,31 @@ const char* RIFT_LOCATION = "Deposito Principal";
 // Intervalo de envío (milisegundos)
 const unsigned long SEND_INTERVAL = 30000; // 30 segundos
 
+// Protocolo de envío (ver rift_protocol.h)
+const bool USE_UDP = true;                    // false = solo HTTP/JSON (receptor viejo)
+const bool UDP_REQUEST_ACK = true;            // Pedir confirmación; sin ACK → reintento y HTTP
+const unsigned long UDP_ACK_TIMEOUT_MS = 300;
+const uint8_t UDP_MAX_RETRIES = 2;
+
+// ESP-NOW: enlace directo con el receptor, sigue andando si se cae el AP.
+// Con par emparejado es el transporte principal; si no, UDP/HTTP vía AP
+const bool USE_ESPNOW = true;
+const unsigned long ESPNOW_PAIR_HOP_MS = 250;     // Tiempo por canal al buscar el receptor
+const uint8_t ESPNOW_MAX_MISSES = 3;              // Lecturas seguidas sin ACK → re-emparejar
+const unsigned long WIFI_RETRY_ESPNOW_MS = 60000; // Reintento de AP más espaciado (cada scan saca la radio del canal)
+
+// Buffer persistente de lecturas no entregadas (LittleFS) y reenvío posterior
+const uint16_t RING_CAPACITY = 2880;              // 24 h a 30 seg por lectura
+const uint8_t BACKFILL_BATCH = 20;                // Lecturas por POST a /api/data/batch
+const unsigned long BACKFILL_INTERVAL_MS = 5000;  // Mínimo entre lotes
+const unsigned long BACKFILL_GUARD_MS = 3000;     // No arrancar un lote si se viene una lectura en vivo
+
+// Clave del sitio (16 bytes): IGUAL en emisor y receptor, cambiar en cada instalación
+const uint8_t RIFT_SITE_KEY[16] = {
+  0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x69,
+  0x63, 0x61, 0x6E, 0x2D, 0x52, 0x49, 0x46, 0x54
+};
+
 // ============================================================================
 // PINES
 // ============================================================================
@@ -74,6 +104,69 @@ unsigned long totalReadings = 0;
 unsigned long successfulSends = 0;
 unsigned long failedSends = 0;
 
+// UDP
+WiFiUDP udp;
+uint32_t frameSeq = 0;
+RiftFrame pendingFrame;
+bool ackPending = false;
+unsigned long frameSentAt = 0;
+uint8_t frameRetries = 0;
+unsigned long udpSent = 0;
+unsigned long udpAcked = 0;
+unsigned long httpFallbacks = 0;
+bool frameViaEspnow = false;       // Transporte del frame pendiente
+
+// ESP-NOW
+uint8_t BROADCAST_MAC[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+uint8_t selfMac[6];
+uint8_t receptorMac[6];
+bool espnowReady = false;
+bool espnowPaired = false;
+uint8_t espnowChannel = 1;
+uint8_t pairHopChannel = 1;
+uint32_t pairNonce = 0;
+unsigned long lastPairAttempt = 0;
+uint8_t espnowMisses = 0;
+unsigned long espnowSent = 0;
+unsigned long espnowAcked = 0;
+unsigned long espnowPairings = 0;
+volatile unsigned long espnowMacFails = 0;   // Sin ACK de capa MAC (send_cb)
+
+// Buffer de lecturas (archivo /ring.bin: cabecera + RING_CAPACITY registros)
+struct __attribute__((packed)) RingHeader {
+  uint32_t magic;
+  uint16_t capacity;
+  uint16_t boot;       // Se incrementa en cada arranque
+  uint16_t head;       // Registro más viejo
+  uint16_t count;
+  uint32_t dropped;    // Pisados por buffer lleno
+};
+
+struct __attribute__((packed)) BufferedReading {
+  uint32_t seq;
+  uint32_t ms;         // millis() al tomarla (vale solo dentro del mismo boot)
+  uint32_t epoch;      // Hora NTP si estaba sincronizada, si no 0
+  uint16_t boot;
+  int16_t  temp1, temp2, tempAvg;
+  uint8_t  flags;
+  uint8_t  sensorCount;
+  uint16_t doorOpenSec;
+};
+
+#define RING_MAGIC 0x52494E47   // "RING"
+File ringFile;
+RingHeader ringHdr;
+bool ringReady = false;
+unsigned long lastBackfill = 0;
+unsigned long lastLiveSuccess = 0;
+unsigned long backfilledReadings = 0;
+
+// Bandeja del callback de recepción (corre en contexto del SDK: solo copia)
+volatile bool espnowRxReady = false;
+uint8_t espnowRxMac[6];
+uint8_t espnowRxBuf[sizeof(RiftPair)];
+uint8_t espnowRxLen = 0;
+
 // ============================================================================
 // SETUP
 // ============================================================================
@@ -95,8 +188,14 @@ void setup() {
   // Inicializar sensores de temperatura
   initTemperatureSensors();
   
+  // Buffer de lecturas no entregadas
+  ringInit();
+  
   // Conectar WiFi
   connectWiFi();
+  configTime(0, 0, "pool.ntp.org");   // Hora UTC para fechar lo que quede en el buffer
+  udp.begin(RIFT_UDP_PORT);  // Los ACK vuelven a este puerto
+  if (USE_ESPNOW) initEspNow();
   
   // Leer estado inicial de puerta
   doorOpen = (digitalRead(DOOR_SENSOR_PIN) == HIGH);
@@ -125,6 +224,15 @@ void loop() {
     lastSendTime = millis();
   }
   
+  // Emparejamiento y ACKs por ESP-NOW
+  espnowLoop();
+  
+  // Confirmaciones del receptor (no bloqueante)
+  pollReceptorAck();
+  
+  // Reenvío de lo acumulado durante cortes (prioridad menor que en vivo)
+  backfillLoop();
+  
   // Parpadeo LED según estado
   updateStatusLED();
   
@@ -284,7 +392,9 @@ void connectWiFi() {
 }
 
 void reconnectWiFi() {
-  if (millis() - lastReconnectAttempt > 10000) {
+  // Con ESP-NOW entregando, el AP no es imprescindible: reintentar menos
+  unsigned long retryMs = espnowPaired ? WIFI_RETRY_ESPNOW_MS : 10000;
+  if (millis() - lastReconnectAttempt > retryMs) {
     Serial.println("[WIFI] Reconectando...");
     WiFi.disconnect();
     WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
@@ -293,13 +403,276 @@ void reconnectWiFi() {
 }
 
 void sendDataToReceptor() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("[ERROR] Sin conexión WiFi, no se puede enviar");
+  bool viaEspnow = USE_ESPNOW && espnowPaired;
+  
+  // Lectura anterior sin confirmar: la nueva la reemplaza y esa va al buffer
+  if (ackPending) {
+    Serial.println("[SEND] Frame " + String(pendingFrame.seq) + " sin ACK, al buffer");
+    ackPending = false;
+    failedSends++;
+    bufferReading(pendingFrame);
+  }
+  
+  // Por ESP-NOW siempre se pide ACK: es la forma de notar que el receptor
+  // reinició y perdió el par (la capa MAC confirma aunque no pueda descifrar)
+  bool requestAck = viaEspnow || UDP_REQUEST_ACK;
+  buildFrame(requestAck);
+  
+  if (!viaEspnow && WiFi.status() != WL_CONNECTED) {
+    Serial.println("[ERROR] Sin conexión WiFi, lectura al buffer");
+    failedSends++;
+    bufferReading(pendingFrame);
+    return;
+  }
+  
+  if (!viaEspnow && !USE_UDP) {
+    sendDataToReceptorHttp();
+    return;
+  }
+  
+  frameViaEspnow = viaEspnow;
+  if (!sendFrame()) {
+    sendFallback(viaEspnow ? "[ESPNOW] Error de envío" : "[UDP] Error de envío");
+    return;
+  }
+  
+  if (requestAck) {
+    ackPending = true;
+    frameRetries = 0;
+  } else {
+    successfulSends++;
+    lastLiveSuccess = millis();
+  }
+}
+
+// Arma pendingFrame con la lectura actual (un seq por lectura, sea cual sea el transporte)
+void buildFrame(bool requestAck) {
+  RiftFrame& f = pendingFrame;
+  memset(&f, 0, sizeof(f));
+  f.type = RIFT_TYPE_READING;
+  f.riftId = RIFT_ID;
+  f.seq = ++frameSeq;
+  f.senderMs = millis();
+  f.temp1 = riftEncodeTemp(temperature1);
+  f.temp2 = riftEncodeTemp(temperature2);
+  f.tempAvg = riftEncodeTemp(temperatureAvg);
+  f.flags = (doorOpen ? RIFT_FLAG_DOOR_OPEN : 0) | (requestAck ? RIFT_FLAG_ACK_REQ : 0);
+  f.sensorCount = sensorCount;
+  unsigned long openSec = doorOpen ? (millis() - doorOpenTime) / 1000 : 0;
+  f.doorOpenSec = openSec > 65535 ? 65535 : openSec;
+  f.rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+  f.uptimeSec = millis() / 1000;
+  f.sendFailures = failedSends > 65535 ? 65535 : failedSends;
+  riftFinalizeFrame(f);
+}
+
+bool sendFrame() {
+  if (frameViaEspnow) {
+    espnowTuneChannel();
+    if (esp_now_send(receptorMac, (uint8_t*)&pendingFrame, sizeof(pendingFrame)) != 0) return false;
+    espnowSent++;
+  } else {
+    if (!udp.beginPacket(RECEPTOR_IP, RIFT_UDP_PORT)) return false;
+    udp.write((const uint8_t*)&pendingFrame, sizeof(pendingFrame));
+    if (!udp.endPacket()) return false;
+    udpSent++;
+  }
+  frameSentAt = millis();
+  return true;
+}
+
+// La lectura no se pudo confirmar: HTTP si hay AP, si no al buffer
+void sendFallback(const char* reason) {
+  if (WiFi.status() == WL_CONNECTED) {
+    Serial.println(String(reason) + ", usando HTTP");
+    httpFallbacks++;
+    sendDataToReceptorHttp();
+  } else {
+    Serial.println(String(reason) + ", sin WiFi: lectura al buffer");
     failedSends++;
+    bufferReading(pendingFrame);
+  }
+}
+
+void handleReceptorAck(const RiftAck& ack, bool viaEspnow) {
+  if (!ackPending || ack.riftId != RIFT_ID || ack.seq != pendingFrame.seq) return;
+  ackPending = false;
+  successfulSends++;
+  lastLiveSuccess = millis();
+  if (viaEspnow) {
+    espnowAcked++;
+    espnowMisses = 0;
+  } else {
+    udpAcked++;
+  }
+  Serial.println(String(viaEspnow ? "[ESPNOW]" : "[UDP]") + " ✓ ACK seq " + String(ack.seq) +
+                 " en " + String(millis() - ack.senderMs) + " ms");
+}
+
+void pollReceptorAck() {
+  // Vaciar lo que haya llegado (ACKs, posibles viejos)
+  int len;
+  while ((len = udp.parsePacket()) > 0) {
+    uint8_t buf[sizeof(RiftAck)];
+    int n = udp.read(buf, sizeof(buf));
+    if (n != len || !riftFrameValid(buf, n, RIFT_TYPE_ACK)) continue;
+    
+    RiftAck ack;
+    memcpy(&ack, buf, sizeof(ack));
+    handleReceptorAck(ack, false);
+  }
+  
+  if (!ackPending || millis() - frameSentAt < UDP_ACK_TIMEOUT_MS) return;
+  
+  if (frameRetries < UDP_MAX_RETRIES && (frameViaEspnow || WiFi.status() == WL_CONNECTED)) {
+    // Mismo seq: si el primero sí llegó, el receptor lo ve como duplicado
+    frameRetries++;
+    pendingFrame.flags |= RIFT_FLAG_RETRY;
+    riftFinalizeFrame(pendingFrame);
+    sendFrame();
+    return;
+  }
+  
+  // Sin ACK tras los reintentos
+  ackPending = false;
+  if (frameViaEspnow && ++espnowMisses >= ESPNOW_MAX_MISSES) {
+    espnowUnpair("sin ACK en " + String(espnowMisses) + " lecturas");
+  }
+  sendFallback(frameViaEspnow ? "[ESPNOW] ✗ Sin ACK del receptor" : "[UDP] ✗ Sin ACK del receptor");
+}
+
+// ============================================================================
+// ESP-NOW
+// ============================================================================
+
+void onEspnowSent(uint8_t* mac, uint8_t status) {
+  if (status != 0) espnowMacFails++;
+}
+
+void onEspnowRecv(uint8_t* mac, uint8_t* data, uint8_t len) {
+  // Si el loop no vació el anterior se descarta (ACKs y PAIR_ACK son esporádicos)
+  if (espnowRxReady || len > sizeof(espnowRxBuf)) return;
+  memcpy(espnowRxMac, mac, 6);
+  memcpy(espnowRxBuf, data, len);
+  espnowRxLen = len;
+  espnowRxReady = true;
+}
+
+void initEspNow() {
+  // El SDK reconectando solo escanea todos los canales sin parar y ESP-NOW
+  // queda mudo; la reconexión la maneja reconnectWiFi()
+  WiFi.setAutoReconnect(false);
+  WiFi.macAddress(selfMac);
+  
+  if (esp_now_init() != 0) {
+    Serial.println("[ERROR] ESP-NOW no inicializó");
+    return;
+  }
+  esp_now_set_self_role(ESP_NOW_ROLE_COMBO);
+  esp_now_set_kok((uint8_t*)RIFT_SITE_KEY, 16);
+  esp_now_register_send_cb(onEspnowSent);
+  esp_now_register_recv_cb(onEspnowRecv);
+  esp_now_add_peer(BROADCAST_MAC, ESP_NOW_ROLE_COMBO, 0, NULL, 0);
+  
+  pairNonce = ESP.random();
+  espnowReady = true;
+  Serial.println("[OK] ESP-NOW listo, MAC " + WiFi.macAddress());
+}
+
+// Sin AP la radio puede haber quedado en otro canal (scan de reconexión)
+void espnowTuneChannel() {
+  if (WiFi.status() != WL_CONNECTED && wifi_get_channel() != espnowChannel) {
+    wifi_set_channel(espnowChannel);
+  }
+}
+
+void espnowUnpair(String reason) {
+  if (!espnowPaired) return;
+  esp_now_del_peer(receptorMac);
+  espnowPaired = false;
+  espnowMisses = 0;
+  pairNonce = ESP.random();
+  Serial.println("[ESPNOW] Par perdido (" + reason + "), buscando receptor...");
+}
+
+void sendPairRequest() {
+  uint8_t ch;
+  if (WiFi.status() == WL_CONNECTED) {
+    ch = WiFi.channel();   // Receptor en el mismo AP = mismo canal
+  } else {
+    ch = pairHopChannel;
+    pairHopChannel = pairHopChannel % 13 + 1;
+    wifi_set_channel(ch);
+  }
+  
+  RiftPair req;
+  memset(&req, 0, sizeof(req));
+  req.type = RIFT_TYPE_PAIR_REQ;
+  req.riftId = RIFT_ID;
+  req.nonce = pairNonce;
+  req.channel = ch;
+  riftFinalizePair(req, RIFT_SITE_KEY, selfMac);
+  esp_now_send(BROADCAST_MAC, (uint8_t*)&req, sizeof(req));
+}
+
+void handlePairAck(const uint8_t* mac, const RiftPair& p) {
+  if (p.riftId != RIFT_ID || p.nonce != pairNonce) return;
+  if (!riftPairAuthentic(p, RIFT_SITE_KEY, mac)) {
+    Serial.println("[ESPNOW] ✗ PAIR_ACK con firma inválida, ignorado");
+    return;
+  }
+  
+  uint8_t lmk[16];
+  riftDeriveLmk(RIFT_SITE_KEY, selfMac, lmk);
+  memcpy(receptorMac, mac, 6);
+  espnowChannel = p.channel;
+  if (esp_now_is_peer_exist(receptorMac)) esp_now_del_peer(receptorMac);
+  if (esp_now_add_peer(receptorMac, ESP_NOW_ROLE_COMBO, espnowChannel, lmk, 16) != 0) {
+    Serial.println("[ERROR] ESP-NOW: no se pudo registrar al receptor");
     return;
   }
   
-  Serial.println("\n[SEND] Enviando datos al receptor...");
+  espnowPaired = true;
+  espnowMisses = 0;
+  espnowPairings++;
+  pairNonce = ESP.random();   // Un PAIR_ACK repetido ya no aplica
+  espnowTuneChannel();
+  
+  char macStr[18];
+  snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  Serial.println("[ESPNOW] ✓ Emparejado con receptor " + String(macStr) + " (canal " + String(espnowChannel) + ")");
+}
+
+void espnowLoop() {
+  if (!espnowReady) return;
+  
+  if (espnowRxReady) {
+    if (espnowRxLen == sizeof(RiftPair) && riftFrameValid(espnowRxBuf, espnowRxLen, RIFT_TYPE_PAIR_ACK)) {
+      RiftPair p;
+      memcpy(&p, espnowRxBuf, sizeof(p));
+      handlePairAck(espnowRxMac, p);
+    } else if (espnowPaired && riftFrameValid(espnowRxBuf, espnowRxLen, RIFT_TYPE_ACK) &&
+               memcmp(espnowRxMac, receptorMac, 6) == 0) {
+      RiftAck ack;
+      memcpy(&ack, espnowRxBuf, sizeof(ack));
+      handleReceptorAck(ack, true);
+    }
+    espnowRxReady = false;
+  }
+  
+  if (espnowPaired) return;
+  
+  // Con AP se pregunta en su canal; sin AP se barren los 13 canales
+  unsigned long interval = WiFi.status() == WL_CONNECTED ? 1000 : ESPNOW_PAIR_HOP_MS;
+  if (millis() - lastPairAttempt >= interval) {
+    lastPairAttempt = millis();
+    sendPairRequest();
+  }
+}
+
+void sendDataToReceptorHttp() {
+  Serial.println("\n[SEND] Enviando datos al receptor (HTTP)...");
   
   // Crear JSON con los datos
   StaticJsonDocument<512> doc;
@@ -317,6 +690,9 @@ void sendDataToReceptor() {
   doc["uptime"] = millis() / 1000;
   doc["readings"] = totalReadings;
   doc["timestamp"] = millis();
+  // Mismo seq que el frame UDP/ESP-NOW que no se confirmó: el receptor descarta duplicados
+  doc["seq"] = pendingFrame.seq;
+  doc["sender_ms"] = pendingFrame.senderMs;
   
   String jsonString;
   serializeJson(doc, jsonString);
@@ -339,20 +715,233 @@ void sendDataToReceptor() {
       Serial.println("[OK] Datos enviados correctamente");
       Serial.println("[RESP] " + response);
       successfulSends++;
+      lastLiveSuccess = millis();
     } else {
       Serial.println("[ERROR] HTTP Code: " + String(httpCode));
       failedSends++;
+      bufferReading(pendingFrame);
     }
   } else {
     Serial.println("[ERROR] Fallo de conexión: " + http.errorToString(httpCode));
     failedSends++;
+    bufferReading(pendingFrame);
   }
   
   http.end();
   
   // Mostrar estadísticas
   Serial.println("[STATS] Enviados: " + String(successfulSends) + 
-                 " | Fallidos: " + String(failedSends));
+                 " | Fallidos: " + String(failedSends) +
+                 " | UDP: " + String(udpAcked) + "/" + String(udpSent) +
+                 " | ESP-NOW: " + String(espnowAcked) + "/" + String(espnowSent) +
+                 " (MAC fail " + String(espnowMacFails) + ")" +
+                 " | HTTP fallback: " + String(httpFallbacks) +
+                 " | Buffer: " + String(ringHdr.count) + " (reenviadas " + String(backfilledReadings) + ")");
+}
+
+// ============================================================================
+// BUFFER PERSISTENTE Y REENVÍO (BACKFILL)
+// ============================================================================
+
+size_t ringOffset(uint16_t slot) {
+  return sizeof(RingHeader) + (size_t)slot * sizeof(BufferedReading);
+}
+
+void ringWriteHeader() {
+  ringFile.seek(0, SeekSet);
+  ringFile.write((const uint8_t*)&ringHdr, sizeof(ringHdr));
+  ringFile.flush();
+}
+
+void ringInit() {
+  if (!LittleFS.begin()) {
+    Serial.println("[ERROR] LittleFS no disponible, sin buffer de lecturas");
+    return;
+  }
+  
+  bool valid = false;
+  if (LittleFS.exists("/ring.bin")) {
+    ringFile = LittleFS.open("/ring.bin", "r+");
+    valid = ringFile && ringFile.read((uint8_t*)&ringHdr, sizeof(ringHdr)) == sizeof(ringHdr) &&
+            ringHdr.magic == RING_MAGIC && ringHdr.capacity == RING_CAPACITY &&
+            ringHdr.head < RING_CAPACITY && ringHdr.count <= RING_CAPACITY;
+    if (!valid && ringFile) ringFile.close();
+  }
+  
+  if (!valid) {
+    // Archivo nuevo o de otra versión/capacidad: se descarta
+    ringFile = LittleFS.open("/ring.bin", "w+");
+    if (!ringFile) {
+      Serial.println("[ERROR] No se pudo crear /ring.bin");
+      return;
+    }
+    memset(&ringHdr, 0, sizeof(ringHdr));
+    ringHdr.magic = RING_MAGIC;
+    ringHdr.capacity = RING_CAPACITY;
+  }
+  
+  ringHdr.boot++;
+  ringWriteHeader();
+  ringReady = true;
+  Serial.println("[OK] Buffer de lecturas: " + String(ringHdr.count) + "/" + String(RING_CAPACITY) + " pendientes");
+}
+
+void bufferReading(const RiftFrame& f) {
+  if (!ringReady) return;
+  
+  BufferedReading r;
+  r.seq = f.seq;
+  r.ms = f.senderMs;
+  time_t now = time(nullptr);
+  r.epoch = now > 1600000000 ? now - (millis() - f.senderMs) / 1000 : 0;
+  r.boot = ringHdr.boot;
+  r.temp1 = f.temp1;
+  r.temp2 = f.temp2;
+  r.tempAvg = f.tempAvg;
+  r.flags = f.flags & RIFT_FLAG_DOOR_OPEN;
+  r.sensorCount = f.sensorCount;
+  r.doorOpenSec = f.doorOpenSec;
+  
+  uint16_t slot;
+  if (ringHdr.count < RING_CAPACITY) {
+    slot = (ringHdr.head + ringHdr.count) % RING_CAPACITY;
+    ringHdr.count++;
+  } else {
+    // Lleno: se pisa la más vieja
+    slot = ringHdr.head;
+    ringHdr.head = (ringHdr.head + 1) % RING_CAPACITY;
+    ringHdr.dropped++;
+  }
+  
+  // El slot siempre es el siguiente al último escrito: como mucho se posiciona
+  // en el fin del archivo (LittleFS no deja hacer seek más allá)
+  ringFile.seek(ringOffset(slot), SeekSet);
+  ringFile.write((const uint8_t*)&r, sizeof(r));
+  ringWriteHeader();
+}
+
+bool ringPeek(uint16_t i, BufferedReading& r) {
+  ringFile.seek(ringOffset((ringHdr.head + i) % RING_CAPACITY), SeekSet);
+  return ringFile.read((uint8_t*)&r, sizeof(r)) == sizeof(r);
+}
+
+void ringPop(uint16_t n) {
+  if (n > ringHdr.count) n = ringHdr.count;
+  ringHdr.head = (ringHdr.head + n) % RING_CAPACITY;
+  ringHdr.count -= n;
+  ringWriteHeader();
+}
+
+// Cuándo se tomó una lectura guardada: hora UTC (epoch, 0 si no se sabe)
+// y edad relativa si se puede calcular. false si no hay ninguna de las dos
+// (de un boot anterior y sin hora NTP al guardarla)
+bool bufferedWhen(const BufferedReading& r, uint32_t& epoch, bool& hasAge, uint32_t& ageMs) {
+  time_t now = time(nullptr);
+  bool ntp = now > 1600000000;
+  epoch = r.epoch;
+  hasAge = false;
+  if (r.boot == ringHdr.boot) {
+    ageMs = millis() - r.ms;
+    hasAge = true;
+    if (!epoch && ntp) epoch = now - ageMs / 1000;   // NTP llegó después de guardarla
+  } else if (epoch && ntp && now >= (time_t)epoch && now - epoch < 0xFFFFFFFFUL / 1000) {
+    ageMs = (uint32_t)(now - epoch) * 1000UL;
+    hasAge = true;
+  }
+  return epoch || hasAge;
+}
+
+// Cuántas lecturas del frente del buffer confirmó el receptor: las enviadas
+// tienen que tener respuesta "ok" / "old" / "invalid" una por una, en orden.
+// La primera sin confirmar ("full", faltante o lote sin respuesta) y las que
+// siguen quedan para el próximo lote. sentAt[i] = posición de la enviada i
+uint16_t backfillConfirmed(const String& response, const uint16_t* sentAt, uint8_t sent, uint16_t taken) {
+  DynamicJsonDocument doc(1024);
+  if (deserializeJson(doc, response)) return sentAt[0];
+  JsonArray results = doc["results"];
+  for (uint8_t i = 0; i < sent; i++) {
+    const char* res = i < results.size() ? results[i].as<const char*>() : nullptr;
+    if (!res || (strcmp(res, "ok") && strcmp(res, "old") && strcmp(res, "invalid"))) return sentAt[i];
+  }
+  return taken;
+}
+
+void backfillLoop() {
+  if (!ringReady || ringHdr.count == 0 || WiFi.status() != WL_CONNECTED) return;
+  
+  // Lo en vivo primero: nada en vuelo, lejos del próximo envío y con el
+  // receptor respondiendo (no insistir con POSTs contra un receptor caído)
+  if (ackPending) return;
+  if (millis() - lastSendTime > SEND_INTERVAL - BACKFILL_GUARD_MS) return;
+  if (lastLiveSuccess == 0 || millis() - lastLiveSuccess > SEND_INTERVAL * 2) return;
+  if (millis() - lastBackfill < BACKFILL_INTERVAL_MS) return;
+  lastBackfill = millis();
+  
+  DynamicJsonDocument doc(4096);
+  doc["rift_id"] = RIFT_ID;
+  JsonArray readings = doc.createNestedArray("readings");
+  
+  uint16_t taken = 0, undated = 0;
+  uint16_t sentAt[BACKFILL_BATCH];
+  while (taken < ringHdr.count && readings.size() < BACKFILL_BATCH) {
+    BufferedReading r;
+    if (!ringPeek(taken, r)) break;
+    
+    uint32_t epoch, ageMs;
+    bool hasAge;
+    if (!bufferedWhen(r, epoch, hasAge, ageMs)) {
+      taken++;
+      undated++;
+      continue;
+    }
+    sentAt[readings.size()] = taken++;
+    JsonObject o = readings.createNestedObject();
+    o["seq"] = r.seq;
+    // Con hora UTC el receptor la usa tal cual (y la sube así a Supabase);
+    // la edad queda para cuando el receptor no tiene NTP
+    if (epoch) o["epoch"] = epoch;
+    if (hasAge) o["age_ms"] = ageMs;
+    o["prev_boot"] = r.boot != ringHdr.boot;   // seq de otro boot: no sirve para deduplicar
+    o["temp1"] = riftDecodeTemp(r.temp1);
+    o["temp2"] = riftDecodeTemp(r.temp2);
+    o["temp_avg"] = riftDecodeTemp(r.tempAvg);
+    o["door_open"] = (r.flags & RIFT_FLAG_DOOR_OPEN) != 0;
+    o["door_open_since"] = r.doorOpenSec;
+    o["sensor_count"] = r.sensorCount;
+  }
+  
+  if (readings.size() == 0) {
+    ringPop(taken);
+    if (undated) Serial.println("[BACKFILL] " + String(undated) + " lecturas sin hora descartadas");
+    return;
+  }
+  
+  String body;
+  serializeJson(doc, body);
+  
+  WiFiClient client;
+  HTTPClient http;
+  http.begin(client, "http://" + String(RECEPTOR_IP) + ":" + String(RECEPTOR_PORT) + "/api/data/batch");
+  http.addHeader("Content-Type", "application/json");
+  http.setTimeout(3000);
+  int httpCode = http.POST(body);
+  // 503 (cola del receptor llena) también trae la respuesta por lectura
+  String response = httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_SERVICE_UNAVAILABLE ? http.getString() : "";
+  http.end();
+  
+  uint8_t sent = readings.size();
+  uint16_t done = response.length() ? backfillConfirmed(response, sentAt, sent, taken) : sentAt[0];
+  uint8_t confirmed = 0;
+  while (confirmed < sent && sentAt[confirmed] < done) confirmed++;
+  if (done) ringPop(done);
+  backfilledReadings += confirmed;
+  
+  if (confirmed == sent) {
+    Serial.println("[BACKFILL] ✓ " + String(sent) + " lecturas reenviadas, quedan " + String(ringHdr.count));
+  } else {
+    Serial.println("[BACKFILL] ✗ HTTP " + String(httpCode) + ", confirmadas " + String(confirmed) + "/" +
+                   String(sent) + ", se reintenta el resto");
+  }
 }
 
 // ============================================================================
@@ -365,8 +954,8 @@ void updateStatusLED() {
   
   unsigned long blinkInterval;
   
-  if (WiFi.status() != WL_CONNECTED) {
-    blinkInterval = 200; // Parpadeo rápido = sin WiFi
+  if (WiFi.status() != WL_CONNECTED && !espnowPaired) {
+    blinkInterval = 200; // Parpadeo rápido = sin WiFi ni ESP-NOW
   } else if (temperatureAvg == -999.0) {
     blinkInterval = 500; // Parpadeo medio = sin sensores
   } else {
@@ -0,0 +1,407 @@
+/*
+ * cloud_commands.h - Comandos remotos por push (Supabase Realtime)
+ * Sistema Monitoreo RIFT v2.0
+ *
+ * Reemplaza el polling de /rest/v1/commands por una suscripción
+ * persistente (websocket) a los INSERT de la tabla 'commands':
+ *
+ * - Canal Phoenix de Supabase Realtime filtrado por device_id
+ * - El comando se ejecuta apenas llega (latencia < 1 seg)
+ * - Los ACK se agrupan en un solo PATCH ?id=in.(...)
+ * - Si el websocket se cae: polling de respaldo hasta reconectar
+ * - Al (re)suscribirse se hace un GET de recuperación por si
+ *   llegaron comandos mientras estaba desconectado
+ *
+ * Con el websocket arriba el tráfico en reposo es solo el heartbeat.
+ *
+ * A lo sumo una ejecución por comando: el ACK se anota (y se guarda en
+ * flash) antes de ejecutar, y un comando sin lugar en el lote de ACKs no
+ * se ejecuta hasta que el lote salga. Los IDs con ACK pendiente cuentan
+ * como vistos, también después de un reinicio.
+ *
+ * REQUIERE: librería "WebSockets" (Markus Sattler / links2004)
+ * y la tabla en la publicación Realtime (ver supabase/schema_cloud.sql)
+ */
+
+#ifndef CLOUD_COMMANDS_H
+#define CLOUD_COMMANDS_H
+
+#include <WebSocketsClient.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include <Preferences.h>
+#include "config.h"
+
+extern void acknowledgeAlert();
+extern void setRelay(bool on);
+
+// ============================================
+// CONFIGURACIÓN
+// ============================================
+#define COMMAND_HEARTBEAT_MS       25000   // Heartbeat Phoenix (el server corta a los 60s)
+#define COMMAND_RECONNECT_MS       5000    // Reintento del websocket (y primer reintento del join)
+#define COMMAND_REJOIN_MAX_MS      300000  // Tope del backoff de resuscripción: 5 min
+#define COMMAND_POLL_FALLBACK_MS   10000   // Polling de respaldo sin websocket
+#define COMMAND_ACK_BATCH_MS       1000    // Ventana para agrupar ACKs
+#define COMMAND_ACK_BATCH_MAX      16      // ACKs por PATCH
+#define COMMAND_SEEN_SIZE          32      // IDs recientes (evita ejecutar dos veces)
+
+// ============================================
+// VARIABLES
+// ============================================
+WebSocketsClient realtimeSocket;
+
+struct CloudCommandState {
+  bool socketConnected;
+  bool channelJoined;
+  bool catchUpPending;              // GET de recuperación pendiente
+  bool joinPending;                 // phx_join enviado, sin respuesta
+  unsigned long nextJoinAt;         // Próximo phx_join tras un error
+  unsigned long joinBackoffMs;      // Se duplica con cada rechazo seguido
+  unsigned long lastHeartbeat;
+  unsigned long lastFallbackPoll;
+  unsigned long firstPendingAck;    // Inicio de la ventana de ACKs
+  uint32_t ref;                     // Contador de mensajes Phoenix
+  long ackIds[COMMAND_ACK_BATCH_MAX];
+  int ackCount;
+  long seenIds[COMMAND_SEEN_SIZE];
+  int seenIndex;
+
+  // Estadísticas
+  unsigned long pushCommands;
+  unsigned long polledCommands;
+  unsigned long ackRequests;
+  unsigned long pollRequests;
+  unsigned long deferredCommands;   // Sin lugar para su ACK: vuelven en el próximo poll
+  unsigned long joinErrors;         // Joins rechazados o canales cerrados por el server
+};
+
+CloudCommandState cloudCmd;
+
+// ============================================
+// ACKS PENDIENTES EN FLASH (sobreviven a un reinicio)
+// ============================================
+void saveCommandAcks() {
+  Preferences ackPrefs;
+  ackPrefs.begin("cloudcmd", false);
+  if (cloudCmd.ackCount > 0) {
+    ackPrefs.putBytes("acks", cloudCmd.ackIds, cloudCmd.ackCount * sizeof(long));
+  } else {
+    ackPrefs.remove("acks");
+  }
+  ackPrefs.end();
+}
+
+void loadCommandAcks() {
+  Preferences ackPrefs;
+  ackPrefs.begin("cloudcmd", true);
+  size_t bytes = ackPrefs.getBytes("acks", cloudCmd.ackIds, sizeof(cloudCmd.ackIds));
+  ackPrefs.end();
+  cloudCmd.ackCount = bytes / sizeof(long);
+  if (cloudCmd.ackCount > 0) {
+    cloudCmd.firstPendingAck = millis();
+    Serial.printf("[CLOUD] %d ACK(s) pendientes del arranque anterior\n", cloudCmd.ackCount);
+  }
+}
+
+// ============================================
+// DEDUPLICACIÓN (push y polling pueden traer el mismo ID)
+// ============================================
+bool commandAlreadySeen(long id) {
+  // Ejecutado y sin confirmar: el poll lo sigue trayendo hasta el ACK
+  for (int i = 0; i < cloudCmd.ackCount; i++) {
+    if (cloudCmd.ackIds[i] == id) return true;
+  }
+  for (int i = 0; i < COMMAND_SEEN_SIZE; i++) {
+    if (cloudCmd.seenIds[i] == id) return true;
+  }
+  return false;
+}
+
+void markCommandSeen(long id) {
+  cloudCmd.seenIds[cloudCmd.seenIndex] = id;
+  cloudCmd.seenIndex = (cloudCmd.seenIndex + 1) % COMMAND_SEEN_SIZE;
+}
+
+// ============================================
+// ACK EN LOTE: PATCH /commands?id=in.(1,2,3)
+// ============================================
+void flushCommandAcks() {
+  if (cloudCmd.ackCount == 0) return;
+
+  String url = String(SUPABASE_URL) + "/rest/v1/commands?id=in.(";
+  for (int i = 0; i < cloudCmd.ackCount; i++) {
+    if (i > 0) url += ",";
+    url += String(cloudCmd.ackIds[i]);
+  }
+  url += ")";
+
+  HTTPClient http;
+  http.begin(url);
+  http.addHeader("Content-Type", "application/json");
+  http.addHeader("apikey", SUPABASE_ANON_KEY);
+  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
+  http.addHeader("Prefer", "return=minimal");
+  int code = http.PATCH("{\"executed\":true}");
+  http.end();
+
+  cloudCmd.ackRequests++;
+
+  if (code == 200 || code == 204) {
+    Serial.printf("[CLOUD] ✓ %d comando(s) confirmados\n", cloudCmd.ackCount);
+    // Los confirmados siguen en el anillo de vistos (un push tardío no los repite)
+    for (int i = 0; i < cloudCmd.ackCount; i++) markCommandSeen(cloudCmd.ackIds[i]);
+    cloudCmd.ackCount = 0;
+    cloudCmd.firstPendingAck = 0;
+    saveCommandAcks();
+  } else {
+    // Se reintenta en la próxima ventana (los IDs quedan en el lote)
+    Serial.printf("[CLOUD] ✗ Error confirmando comandos: %d\n", code);
+    cloudCmd.firstPendingAck = millis();
+  }
+}
+
+// Anota el ACK antes de ejecutar. false si el lote sigue lleno después
+// de intentar mandarlo: el comando no se ejecuta todavía
+bool queueCommandAck(long id) {
+  if (cloudCmd.ackCount >= COMMAND_ACK_BATCH_MAX) {
+    // Un PATCH por ventana: con la red caída no se reintenta por cada comando
+    if (millis() - cloudCmd.firstPendingAck >= COMMAND_ACK_BATCH_MS) flushCommandAcks();
+    if (cloudCmd.ackCount >= COMMAND_ACK_BATCH_MAX) return false;
+  }
+  if (cloudCmd.ackCount == 0) cloudCmd.firstPendingAck = millis();
+  cloudCmd.ackIds[cloudCmd.ackCount++] = id;
+  saveCommandAcks();
+  return true;
+}
+
+// ============================================
+// EJECUTAR COMANDO
+// ============================================
+void executeCloudCommand(long id, const char* command) {
+  if (commandAlreadySeen(id)) return;
+
+  // Sin lugar para el ACK no se ejecuta: sigue executed=false en la tabla
+  // y vuelve con el próximo poll, cuando los ACK pendientes ya salieron
+  if (!queueCommandAck(id)) {
+    cloudCmd.deferredCommands++;
+    cloudCmd.catchUpPending = true;
+    Serial.printf("[CLOUD] Comando %ld diferido: %d ACK(s) sin confirmar\n", id, cloudCmd.ackCount);
+    return;
+  }
+
+  Serial.printf("[CLOUD] Comando recibido: %s (id %ld)\n", command, id);
+
+  if (strcmp(command, "stop_alert") == 0) {
+    acknowledgeAlert();
+  } else if (strcmp(command, "toggle_relay") == 0) {
+    setRelay(!state.relayState);
+  } else {
+    Serial.printf("[CLOUD] Comando desconocido: %s\n", command);
+  }
+}
+
+// ============================================
+// POLLING (respaldo y recuperación)
+// ============================================
+void pollCloudCommands() {
+  HTTPClient http;
+  String url = String(SUPABASE_URL) + "/rest/v1/commands?device_id=eq." + String(DEVICE_ID) +
+               "&executed=eq.false&select=id,command&order=created_at.asc&limit=" + String(COMMAND_ACK_BATCH_MAX);
+
+  http.begin(url);
+  http.addHeader("apikey", SUPABASE_ANON_KEY);
+  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
+
+  int code = http.GET();
+  cloudCmd.pollRequests++;
+
+  if (code == 200) {
+    StaticJsonDocument<1536> doc;
+    DeserializationError error = deserializeJson(doc, http.getStream());
+
+    if (!error) {
+      for (JsonObject cmd : doc.as<JsonArray>()) {
+        cloudCmd.polledCommands++;
+        executeCloudCommand(cmd["id"] | 0L, cmd["command"] | "");
+      }
+    }
+  }
+  http.end();
+}
+
+// ============================================
+// PROTOCOLO PHOENIX (Supabase Realtime)
+// ============================================
+void realtimeSend(const char* topic, const char* event, JsonObject payload) {
+  StaticJsonDocument<512> msg;
+  msg["topic"] = topic;
+  msg["event"] = event;
+  msg["payload"] = payload;
+  msg["ref"] = String(++cloudCmd.ref);
+
+  String out;
+  serializeJson(msg, out);
+  realtimeSocket.sendTXT(out);
+}
+
+void realtimeJoinChannel() {
+  StaticJsonDocument<384> payload;
+  JsonObject cfg = payload.createNestedObject("config");
+  JsonObject change = cfg.createNestedArray("postgres_changes").createNestedObject();
+  change["event"] = "INSERT";
+  change["schema"] = "public";
+  change["table"] = "commands";
+  change["filter"] = "device_id=eq." DEVICE_ID;
+  payload["access_token"] = SUPABASE_ANON_KEY;
+
+  realtimeSend("realtime:commands:" DEVICE_ID, "phx_join", payload.as<JsonObject>());
+  cloudCmd.joinPending = true;
+}
+
+// Canal rechazado o cerrado por el server: resuscribir con backoff
+// (mientras tanto sigue el polling de respaldo)
+void realtimeScheduleRejoin() {
+  cloudCmd.channelJoined = false;
+  cloudCmd.joinPending = false;
+  cloudCmd.joinErrors++;
+  cloudCmd.nextJoinAt = millis() + cloudCmd.joinBackoffMs;
+  Serial.printf("[CLOUD] Canal cerrado, resuscribiendo en %lu seg\n", cloudCmd.joinBackoffMs / 1000);
+  cloudCmd.joinBackoffMs = min(cloudCmd.joinBackoffMs * 2, (unsigned long)COMMAND_REJOIN_MAX_MS);
+}
+
+void realtimeHandleMessage(uint8_t* data, size_t len) {
+  StaticJsonDocument<256> filter;
+  filter["event"] = true;
+  filter["payload"]["status"] = true;
+  filter["payload"]["data"]["record"]["id"] = true;
+  filter["payload"]["data"]["record"]["command"] = true;
+  filter["payload"]["data"]["record"]["executed"] = true;
+
+  StaticJsonDocument<512> doc;
+  if (deserializeJson(doc, data, len, DeserializationOption::Filter(filter))) return;
+
+  const char* event = doc["event"] | "";
+
+  if (strcmp(event, "phx_reply") == 0) {
+    // Sin canal solo se espera la respuesta al join (el heartbeat va con canal)
+    if (cloudCmd.joinPending && strcmp(doc["payload"]["status"] | "", "ok") == 0) {
+      cloudCmd.channelJoined = true;
+      cloudCmd.joinPending = false;
+      cloudCmd.catchUpPending = true;
+      cloudCmd.joinBackoffMs = COMMAND_RECONNECT_MS;
+      Serial.println("[CLOUD] ✓ Suscripto a comandos (push)");
+    } else if (cloudCmd.joinPending) {
+      realtimeScheduleRejoin();
+    }
+  } else if (strcmp(event, "postgres_changes") == 0) {
+    JsonObject record = doc["payload"]["data"]["record"];
+    if (!(record["executed"] | false)) {
+      cloudCmd.pushCommands++;
+      executeCloudCommand(record["id"] | 0L, record["command"] | "");
+    }
+  } else if (strcmp(event, "phx_error") == 0 || strcmp(event, "phx_close") == 0) {
+    realtimeScheduleRejoin();
+  }
+}
+
+void realtimeEvent(WStype_t type, uint8_t* payload, size_t length) {
+  switch (type) {
+    case WStype_CONNECTED:
+      cloudCmd.socketConnected = true;
+      cloudCmd.lastHeartbeat = millis();
+      Serial.println("[CLOUD] Websocket conectado");   // El join sale desde cloudCommandsLoop
+      break;
+    case WStype_DISCONNECTED:
+      if (cloudCmd.socketConnected) {
+        Serial.println("[CLOUD] Websocket desconectado - polling de respaldo");
+      }
+      cloudCmd.socketConnected = false;
+      cloudCmd.channelJoined = false;
+      cloudCmd.joinPending = false;
+      break;
+    case WStype_TEXT:
+      realtimeHandleMessage(payload, length);
+      break;
+    default:
+      break;
+  }
+}
+
+// ============================================
+// INICIALIZACIÓN
+// ============================================
+void initCloudCommands() {
+  memset(&cloudCmd, 0, sizeof(cloudCmd));
+  for (int i = 0; i < COMMAND_SEEN_SIZE; i++) cloudCmd.seenIds[i] = -1;
+  cloudCmd.joinBackoffMs = COMMAND_RECONNECT_MS;
+  if (strlen(SUPABASE_URL) < 10) return;
+  loadCommandAcks();
+
+  // Separar esquema, host y puerto de SUPABASE_URL
+  // (http://IP:puerto sirve para el servidor local test-server/realtime-server.js)
+  String url = SUPABASE_URL;
+  bool secure = url.startsWith("https://");
+  String host = url.substring(url.indexOf("://") + 3);
+  uint16_t port = secure ? 443 : 80;
+  int colon = host.indexOf(':');
+  if (colon > 0) {
+    port = host.substring(colon + 1).toInt();
+    host = host.substring(0, colon);
+  }
+
+  String path = "/realtime/v1/websocket?apikey=" + String(SUPABASE_ANON_KEY) + "&vsn=1.0.0";
+
+  if (secure) {
+    realtimeSocket.beginSSL(host.c_str(), port, path.c_str());
+  } else {
+    realtimeSocket.begin(host.c_str(), port, path.c_str());
+  }
+  realtimeSocket.onEvent(realtimeEvent);
+  realtimeSocket.setReconnectInterval(COMMAND_RECONNECT_MS);
+
+  Serial.printf("[CLOUD] Realtime: %s:%d\n", host.c_str(), port);
+}
+
+// ============================================
+// LOOP (llamar en cada vuelta)
+// ============================================
+void cloudCommandsLoop() {
+  if (strlen(SUPABASE_URL) < 10) return;
+  if (!state.wifiConnected) return;
+
+  realtimeSocket.loop();
+  unsigned long now = millis();
+
+  // Join al conectar y tras un rechazo cuando vence el backoff (un socket
+  // nuevo no lo reinicia: solo un join aceptado)
+  if (cloudCmd.socketConnected && !cloudCmd.channelJoined && !cloudCmd.joinPending &&
+      (long)(now - cloudCmd.nextJoinAt) >= 0) {
+    realtimeJoinChannel();
+  }
+
+  if (cloudCmd.channelJoined) {
+    // Heartbeat Phoenix: único tráfico en reposo
+    if (now - cloudCmd.lastHeartbeat >= COMMAND_HEARTBEAT_MS) {
+      cloudCmd.lastHeartbeat = now;
+      StaticJsonDocument<16> empty;
+      realtimeSend("phoenix", "heartbeat", empty.to<JsonObject>());
+    }
+
+    // Recuperar comandos creados mientras no había suscripción (o
+    // diferidos), después de confirmar los ya ejecutados
+    if (cloudCmd.catchUpPending && cloudCmd.ackCount == 0 && state.internetAvailable) {
+      cloudCmd.catchUpPending = false;
+      pollCloudCommands();
+    }
+  } else if (state.internetAvailable && now - cloudCmd.lastFallbackPoll >= COMMAND_POLL_FALLBACK_MS) {
+    cloudCmd.lastFallbackPoll = now;
+    pollCloudCommands();
+  }
+
+  if (cloudCmd.ackCount > 0 && now - cloudCmd.firstPendingAck >= COMMAND_ACK_BATCH_MS) {
+    flushCommandAcks();
+  }
+}
+
+#endif
@@ -112,6 +112,7 @@ const int TELEGRAM_CHAT_COUNT = 1;  // Cantidad de chat IDs activos
 #define SENSOR_READ_INTERVAL_MS 5000     // Leer sensores cada 5 segundos
 #define INTERNET_CHECK_INTERVAL_MS 30000 // Verificar internet cada 30 seg
 #define HISTORY_MAX_POINTS 288           // Puntos de historial (24h a 5min c/u)
+#define WEB_ASSET_CACHE_CONTROL "public, max-age=3600"  // Dashboard: 1 h en caché, después revalida por ETag
 
 // ============================================
 // RELAY - Lógica invertida
@@ -24,6 +24,7 @@
 #include <time.h>
 
 #include "config.h"
+#include "web_assets.h"   // Dashboard gzip (tools/gen_web_assets.py)
 
 // ============================================
 // OBJETOS GLOBALES
@@ -125,6 +126,9 @@ unsigned long lastAndroidPing = 0;
 bool telegramAlertSent = false;
 bool manualAlert = false;  // Alertas manuales no se auto-desactivan
 
+// Comandos remotos por push (usa 'state', va después de las globales)
+#include "cloud_commands.h"
+
 // ============================================
 // SETUP
 // ============================================
@@ -142,6 +146,7 @@ void setup() {
   setupMDNS();
   setupWebServer();
   server.begin();
+  initCloudCommands();
   
   configTime(-3 * 3600, 0, "pool.ntp.org");
   
@@ -195,7 +200,7 @@ void loop() {
   }
   
   syncToSupabase();
-  checkCloudCommands();  // Verificar comandos desde la nube
+  cloudCommandsLoop();  // Comandos desde la nube (push + respaldo)
   updateOutputs();
   
   delay(10);
@@ -823,56 +828,13 @@ void sendAlertToSupabase(String severity, String message) {
   http.end();
 }
 
-// Verificar comandos pendientes desde la nube
-void checkCloudCommands() {
-  if (!state.internetAvailable) return;
-  if (strlen(SUPABASE_URL) < 10) return;
-  
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/commands?device_id=eq." + String(DEVICE_ID) + "&executed=eq.false&order=created_at.asc&limit=1";
-  
-  http.begin(url);
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  
-  int code = http.GET();
-  if (code == 200) {
-    String response = http.getString();
-    
-    StaticJsonDocument<512> doc;
-    DeserializationError error = deserializeJson(doc, response);
-    
-    if (!error && doc.size() > 0) {
-      JsonObject cmd = doc[0];
-      String command = cmd["command"].as<String>();
-      int cmdId = cmd["id"];
-      
-      Serial.printf("[CLOUD] Comando recibido: %s\n", command.c_str());
-      
-      // Ejecutar comando
-      if (command == "stop_alert") {
-        acknowledgeAlert();
-      } else if (command == "toggle_relay") {
-        setRelay(!state.relayState);
-      }
-      
-      // Marcar como ejecutado
-      http.end();
-      url = String(SUPABASE_URL) + "/rest/v1/commands?id=eq." + String(cmdId);
-      http.begin(url);
-      http.addHeader("Content-Type", "application/json");
-      http.addHeader("apikey", SUPABASE_ANON_KEY);
-      http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-      http.PATCH("{\"executed\":true}");
-    }
-  }
-  http.end();
-}
-
 // ============================================
 // WEB SERVER
 // ============================================
 void setupWebServer() {
+  const char* assetHeaders[] = {"If-None-Match"};
+  server.collectHeaders(assetHeaders, 1);
+
   server.on("/", HTTP_GET, handleRoot);
   server.on("/api/status", HTTP_GET, handleApiStatus);
   server.on("/api/config", HTTP_GET, handleApiGetConfig);
@@ -892,14 +854,17 @@ void setupWebServer() {
   Serial.println("[OK] Web server configurado");
 }
 
+// data/index.html va embebido en web_assets.h: gzip directo desde flash,
+// sin copia en heap ni SPIFFS. Con el ETag el navegador revalida y recibe 304.
 void handleRoot() {
-  if (SPIFFS.exists("/index.html")) {
-    File file = SPIFFS.open("/index.html", "r");
-    server.streamFile(file, "text/html");
-    file.close();
-  } else {
-    server.send(200, "text/html", getEmbeddedHTML());
+  server.sendHeader("ETag", WEB_INDEX_ETAG);
+  server.sendHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
+  if (server.header("If-None-Match") == WEB_INDEX_ETAG) {
+    server.send(304);
+    return;
   }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, WEB_INDEX_MIME, (PGM_P)WEB_INDEX_GZ, WEB_INDEX_GZ_LEN);
 }
 
 void handleApiStatus() {
@@ -1146,393 +1111,3 @@ void handleNotFound() {
     server.send(404, "text/plain", "Not Found");
   }
 }
-
-// ============================================
-// HTML EMBEBIDO PRO - Panel de Control Completo
-// ============================================
-String getEmbeddedHTML() {
-  return R"rawliteral(
-<!DOCTYPE html>
-<html lang="es">
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>Reefer Monitor Pro</title>
-  <style>
-    *{box-sizing:border-box;margin:0;padding:0}
-    body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Roboto,sans-serif;background:linear-gradient(135deg,#0f172a 0%,#1e293b 100%);min-height:100vh;color:#fff;padding:16px}
-    .container{max-width:900px;margin:0 auto}
-    h1{text-align:center;margin-bottom:8px;font-size:2em}
-    h1 span{background:linear-gradient(90deg,#60a5fa,#a78bfa);-webkit-background-clip:text;-webkit-text-fill-color:transparent}
-    .subtitle{text-align:center;color:#64748b;margin-bottom:24px}
-    .card{background:rgba(30,41,59,0.8);border-radius:16px;padding:20px;margin-bottom:16px;border:1px solid rgba(255,255,255,0.1)}
-    .card h2{margin-bottom:16px;color:#f1f5f9;font-size:1.1em;display:flex;align-items:center;gap:8px;flex-wrap:wrap}
-    .status-grid{display:grid;grid-template-columns:repeat(4,1fr);gap:12px}
-    @media(max-width:600px){.status-grid{grid-template-columns:repeat(2,1fr)}}
-    .status-item{background:rgba(0,0,0,0.3);padding:16px;border-radius:12px;text-align:center}
-    .status-item .value{font-size:1.8em;font-weight:bold;margin:8px 0}
-    .status-item .label{color:#94a3b8;font-size:0.75em;text-transform:uppercase}
-    .temp-ok{color:#22d3ee;text-shadow:0 0 15px rgba(34,211,238,0.4)}
-    .temp-warn{color:#fbbf24;text-shadow:0 0 15px rgba(251,191,36,0.4);animation:pulse 1s infinite}
-    .temp-crit{color:#ef4444;text-shadow:0 0 15px rgba(239,68,68,0.4);animation:pulse .5s infinite}
-    @keyframes pulse{0%,100%{opacity:1}50%{opacity:.7}}
-    .controls{display:grid;grid-template-columns:repeat(2,1fr);gap:10px;margin-top:12px}
-    @media(max-width:500px){.controls{grid-template-columns:1fr}}
-    button{padding:14px;border:none;border-radius:12px;font-size:.95em;font-weight:600;cursor:pointer;transition:all .2s}
-    button:active{transform:scale(.98)}
-    button:disabled{opacity:0.5;cursor:not-allowed}
-    .btn-cyan{background:linear-gradient(135deg,#22d3ee,#06b6d4);color:#0f172a}
-    .btn-yellow{background:linear-gradient(135deg,#fbbf24,#f59e0b);color:#0f172a}
-    .btn-red{background:linear-gradient(135deg,#ef4444,#dc2626);color:#fff}
-    .btn-green{background:linear-gradient(135deg,#22c55e,#16a34a);color:#fff}
-    .btn-purple{background:linear-gradient(135deg,#8b5cf6,#7c3aed);color:#fff}
-    .btn-gray{background:linear-gradient(135deg,#475569,#334155);color:#fff}
-    .btn-blue{background:linear-gradient(135deg,#3b82f6,#2563eb);color:#fff}
-    .btn-orange{background:linear-gradient(135deg,#f97316,#ea580c);color:#fff}
-    .slider-container{margin:16px 0}
-    .slider-value{text-align:center;font-size:2.5em;font-weight:bold;margin:8px 0}
-    input[type="range"]{width:100%;height:10px;border-radius:5px;background:linear-gradient(90deg,#22d3ee 0%,#fbbf24 50%,#ef4444 100%);-webkit-appearance:none;cursor:pointer}
-    input[type="range"]::-webkit-slider-thumb{-webkit-appearance:none;width:24px;height:24px;border-radius:50%;background:#fff;box-shadow:0 2px 8px rgba(0,0,0,.3)}
-    .alert-banner{background:linear-gradient(90deg,#ef4444,#dc2626);padding:16px;border-radius:12px;text-align:center;margin-bottom:16px;display:none;animation:alert-pulse .5s infinite alternate}
-    .alert-banner.active{display:block}
-    .alert-banner h3{margin-bottom:8px}
-    @keyframes alert-pulse{0%{box-shadow:0 0 20px rgba(239,68,68,.5)}100%{box-shadow:0 0 40px rgba(239,68,68,.8)}}
-    .badge{display:inline-block;padding:3px 10px;border-radius:12px;font-size:.7em;font-weight:bold;margin-left:8px}
-    .badge-online{background:#22c55e}
-    .badge-sim{background:#8b5cf6}
-    .badge-real{background:#3b82f6}
-    .two-cols{display:grid;grid-template-columns:1fr 1fr;gap:16px}
-    @media(max-width:600px){.two-cols{grid-template-columns:1fr}}
-    .mode-btns{display:flex;gap:10px;margin-bottom:16px}
-    .mode-btns button{flex:1;padding:12px}
-    .mode-btn-active{box-shadow:0 0 0 3px rgba(255,255,255,0.5)}
-    .toggle-row{display:flex;align-items:center;justify-content:space-between;padding:12px;background:rgba(0,0,0,0.2);border-radius:10px;margin-bottom:8px}
-    .toggle-row .label{font-weight:500}
-    .toggle{width:50px;height:28px;background:#475569;border-radius:14px;position:relative;cursor:pointer;transition:background .3s}
-    .toggle.on{background:#22c55e}
-    .toggle::after{content:'';position:absolute;width:22px;height:22px;background:#fff;border-radius:50%;top:3px;left:3px;transition:left .3s}
-    .toggle.on::after{left:25px}
-    .info-box{background:rgba(59,130,246,.15);padding:16px;border-radius:12px;border:1px solid rgba(59,130,246,.3)}
-    .info-box code{background:rgba(0,0,0,.3);padding:6px 12px;border-radius:6px;font-weight:bold;color:#60a5fa}
-    .input-row{margin-bottom:16px}
-    .input-row label{display:block;margin-bottom:8px;color:#94a3b8;font-size:.9em}
-    .input-group{display:flex;align-items:center;gap:8px}
-    .input-group input{flex:1;padding:12px;border-radius:8px;border:1px solid rgba(255,255,255,.2);background:rgba(0,0,0,.3);color:#fff;font-size:1.1em;font-weight:bold}
-    .input-group span{color:#64748b;min-width:40px}
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>❄️ Reefer <span>Monitor Pro</span></h1>
-    <p class="subtitle">Campamento Parametican Silver</p>
-    
-    <div class="alert-banner" id="alertBanner">
-      <h3>🚨 ¡ALERTA ACTIVA!</h3>
-      <div id="alertMsg">Temperatura fuera de rango</div>
-      <button class="btn-green" onclick="stopAlert()" style="margin-top:12px;font-size:1.1em;padding:16px 32px">🛑 DETENER ALERTA</button>
-    </div>
-    
-    <div class="card">
-      <h2>⚙️ Modo de Operación</h2>
-      <div class="mode-btns">
-        <button id="btnModoReal" class="btn-blue" onclick="setMode(false)">📡 MODO REAL</button>
-        <button id="btnModoSim" class="btn-purple" onclick="setMode(true)">🧪 MODO SIMULACIÓN</button>
-      </div>
-    </div>
-    
-    <div class="card">
-      <h2>📊 Estado en Tiempo Real <span class="badge badge-online">ONLINE</span><span class="badge" id="modeBadge">REAL</span></h2>
-      <div class="status-grid">
-        <div class="status-item">
-          <div class="label">Temperatura</div>
-          <div class="value temp-ok" id="temp">-22.5°C</div>
-        </div>
-        <div class="status-item">
-          <div class="label">Puerta</div>
-          <div class="value" id="door">🔒</div>
-          <div class="label" id="doorText">Cerrada</div>
-        </div>
-        <div class="status-item">
-          <div class="label">Sirena</div>
-          <div class="value" id="relay">⚫</div>
-          <div class="label" id="relayText">Apagada</div>
-        </div>
-        <div class="status-item">
-          <div class="label">Uptime</div>
-          <div class="value" id="uptime" style="font-size:1.3em">0:00</div>
-        </div>
-      </div>
-    </div>
-    
-    <div class="two-cols">
-      <div class="card" id="simControls">
-        <h2>🌡️ Control de Temperatura</h2>
-        <div class="slider-container">
-          <div class="slider-value temp-ok" id="sliderValue">-22.5°C</div>
-          <input type="range" id="tempSlider" min="-40" max="10" step="0.5" value="-22.5">
-          <div style="display:flex;justify-content:space-between;color:#64748b;font-size:.75em;margin-top:4px">
-            <span>-40°C</span><span>-18°C (límite)</span><span>+10°C</span>
-          </div>
-        </div>
-        <div class="controls">
-          <button class="btn-cyan" onclick="setTemp(-25)">❄️ -25°C</button>
-          <button class="btn-yellow" onclick="setTemp(-15)">⚠️ -15°C</button>
-          <button class="btn-red" onclick="setTemp(-5)">🔥 -5°C</button>
-          <button class="btn-gray" onclick="setTemp(-22)">🔄 Normal</button>
-        </div>
-      </div>
-      
-      <div class="card">
-        <h2>🎛️ Controles</h2>
-        <div class="controls" style="grid-template-columns:1fr">
-          <button class="btn-purple" id="btnDoor" onclick="toggleDoor()">🚪 Puerta: CERRADA</button>
-          <button class="btn-red" id="btnAlert" onclick="toggleAlert()">🚨 Activar Alerta</button>
-          <button class="btn-gray" onclick="toggleRelay()">🔔 Toggle Sirena</button>
-        </div>
-      </div>
-    </div>
-    
-    <div class="card">
-      <h2>🔧 Configuración de Sensores</h2>
-      <div class="toggle-row">
-        <span class="label">🌡️ Sensor Temperatura 1 (DS18B20)</span>
-        <div class="toggle" id="togSensor1" onclick="toggleSensor('sensor1')"></div>
-      </div>
-      <div class="toggle-row">
-        <span class="label">🌡️ Sensor Temperatura 2 (DS18B20)</span>
-        <div class="toggle" id="togSensor2" onclick="toggleSensor('sensor2')"></div>
-      </div>
-      <div class="toggle-row">
-        <span class="label">🚪 Sensor Magnético de Puerta</span>
-        <div class="toggle" id="togDoor" onclick="toggleSensor('door')"></div>
-      </div>
-      <p style="color:#64748b;font-size:.8em;margin-top:12px">⚠️ Desactiva los sensores que NO tengas conectados para evitar falsas alarmas</p>
-    </div>
-    
-    <div class="card">
-      <h2>🎚️ Umbrales de Alerta</h2>
-      <div class="input-row">
-        <label>🌡️ Temperatura máxima (alertar si supera)</label>
-        <div class="input-group">
-          <input type="number" id="inTempMax" value="-18" step="0.5" min="-40" max="10">
-          <span>°C</span>
-        </div>
-      </div>
-      <div class="input-row">
-        <label>🚪 Tiempo máximo puerta abierta</label>
-        <div class="input-group">
-          <input type="number" id="inDoorMax" value="180" step="10" min="10" max="600">
-          <span>seg</span>
-        </div>
-      </div>
-      <div class="input-row">
-        <label>⏱️ Tiempo antes de alertar (anti falsos positivos)</label>
-        <div class="input-group">
-          <input type="number" id="inAlertDelay" value="300" step="30" min="30" max="900">
-          <span>seg</span>
-        </div>
-      </div>
-      <button class="btn-blue" onclick="saveThresholds()" style="width:100%;margin-top:16px">💾 Guardar Umbrales</button>
-      <p style="color:#64748b;font-size:.8em;margin-top:12px">Ejemplo: Si pones -20°C, la alerta saltará cuando la temperatura suba de -20°C</p>
-    </div>
-    
-    <div class="card">
-      <h2>📱 Telegram y WiFi</h2>
-      <div class="controls">
-        <button class="btn-blue" onclick="testTelegram()">📲 Probar Telegram</button>
-        <button class="btn-red" onclick="resetWifi()">📡 Reset WiFi</button>
-      </div>
-    </div>
-    
-    <div class="card">
-      <h2>📱 Apps Android Conectadas</h2>
-      <div class="status-grid" style="grid-template-columns:repeat(2,1fr)">
-        <div class="status-item">
-          <div class="label">Conexiones Totales</div>
-          <div class="value" id="androidCount" style="color:#22c55e">0</div>
-        </div>
-        <div class="status-item">
-          <div class="label">Último Ping</div>
-          <div class="value" id="lastPing" style="font-size:1em">--</div>
-        </div>
-      </div>
-    </div>
-    
-    <div class="card">
-      <h2>ℹ️ Información del Dispositivo</h2>
-      <div class="info-box">
-        <p><strong>ID:</strong> <code id="deviceId">REEFER-01</code></p>
-        <p style="margin-top:8px"><strong>IP:</strong> <code id="deviceIp">--</code></p>
-        <p style="margin-top:8px"><strong>mDNS:</strong> <code id="deviceMdns">reefer.local</code></p>
-        <p style="margin-top:8px"><strong>WiFi:</strong> <span id="wifiRssi">--</span> dBm</p>
-        <p style="margin-top:8px"><strong>Internet:</strong> <span id="internetStatus">--</span></p>
-      </div>
-    </div>
-    
-    <div style="text-align:center;padding:16px;color:#475569;font-size:.75em">
-      <div>Última actualización: <span id="lastUpdate">--</span></div>
-    </div>
-  </div>
-  
-  <script>
-    let relayState=false,simMode=false,alertActive=false,doorOpen=false;
-    let sensor1En=true,sensor2En=false,doorEn=false;
-    
-    async function fetchStatus(){
-      try{
-        const res=await fetch('/api/status');
-        const d=await res.json();
-        const t=d.sensor.temp_avg.toFixed(1);
-        const tempEl=document.getElementById('temp');
-        const sliderVal=document.getElementById('sliderValue');
-        tempEl.textContent=t+'°C';
-        sliderVal.textContent=t+'°C';
-        tempEl.className='value';sliderVal.className='slider-value';
-        if(parseFloat(t)>-10){tempEl.classList.add('temp-crit');sliderVal.classList.add('temp-crit');}
-        else if(parseFloat(t)>-18){tempEl.classList.add('temp-warn');sliderVal.classList.add('temp-warn');}
-        else{tempEl.classList.add('temp-ok');sliderVal.classList.add('temp-ok');}
-        
-        doorOpen=d.sensor.door_open;
-        document.getElementById('door').textContent=doorOpen?'🔓':'🔒';
-        document.getElementById('doorText').textContent=doorOpen?'ABIERTA':'Cerrada';
-        document.getElementById('doorText').style.color=doorOpen?'#fbbf24':'#94a3b8';
-        document.getElementById('btnDoor').textContent=doorOpen?'🚪 Puerta: ABIERTA':'🚪 Puerta: CERRADA';
-        document.getElementById('btnDoor').className=doorOpen?'btn-orange':'btn-purple';
-        
-        document.getElementById('relay').textContent=d.system.relay_on?'🔴':'⚫';
-        document.getElementById('relayText').textContent=d.system.relay_on?'ACTIVA':'Apagada';
-        document.getElementById('relayText').style.color=d.system.relay_on?'#ef4444':'#94a3b8';
-        document.getElementById('uptime').textContent=formatUptime(d.system.uptime_sec);
-        document.getElementById('tempSlider').value=t;
-        
-        simMode=d.system.simulation_mode;
-        const modeBadge=document.getElementById('modeBadge');
-        modeBadge.textContent=simMode?'SIMULACIÓN':'REAL';
-        modeBadge.className=simMode?'badge badge-sim':'badge badge-real';
-        document.getElementById('btnModoReal').className=simMode?'btn-blue':'btn-blue mode-btn-active';
-        document.getElementById('btnModoSim').className=simMode?'btn-purple mode-btn-active':'btn-purple';
-        
-        alertActive=d.system.alert_active;
-        document.getElementById('btnAlert').textContent=alertActive?'🔕 Desactivar Alerta':'🚨 Activar Alerta';
-        document.getElementById('btnAlert').className=alertActive?'btn-green':'btn-red';
-        
-        sensor1En=d.system.sensor1_enabled;
-        sensor2En=d.system.sensor2_enabled;
-        doorEn=d.system.door_enabled;
-        document.getElementById('togSensor1').className=sensor1En?'toggle on':'toggle';
-        document.getElementById('togSensor2').className=sensor2En?'toggle on':'toggle';
-        document.getElementById('togDoor').className=doorEn?'toggle on':'toggle';
-        
-        document.getElementById('deviceId').textContent=d.device.id;
-        document.getElementById('deviceIp').textContent=d.device.ip;
-        document.getElementById('deviceMdns').textContent=d.device.mdns;
-        document.getElementById('wifiRssi').textContent=d.system.wifi_rssi;
-        document.getElementById('internetStatus').textContent=d.system.internet?'✓ Online':'✗ Offline';
-        document.getElementById('internetStatus').style.color=d.system.internet?'#22c55e':'#ef4444';
-        document.getElementById('lastUpdate').textContent=new Date().toLocaleTimeString();
-        
-        // Android connections
-        document.getElementById('androidCount').textContent=d.system.android_connections||0;
-        const lastPing=d.system.last_android_ping;
-        document.getElementById('lastPing').textContent=lastPing>=0?formatUptime(lastPing)+' atrás':'Sin conexiones';
-        
-        const banner=document.getElementById('alertBanner');
-        if(alertActive){banner.classList.add('active');document.getElementById('alertMsg').textContent=d.system.alert_message||'Alerta activa';}
-        else{banner.classList.remove('active');}
-        relayState=d.system.relay_on;
-      }catch(e){console.error(e);}
-    }
-    
-    function formatUptime(s){
-      const h=Math.floor(s/3600),m=Math.floor((s%3600)/60);
-      if(h>0)return h+'h '+m+'m';
-      if(m>0)return m+'m '+(s%60)+'s';
-      return s+'s';
-    }
-    
-    async function setMode(sim){
-      await fetch('/api/config',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify({simulation_mode:sim})});
-      fetchStatus();
-    }
-    
-    document.getElementById('tempSlider').addEventListener('input',async(e)=>{
-      document.getElementById('sliderValue').textContent=e.target.value+'°C';
-      await fetch('/api/simulation',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify({enabled:true,temp1:parseFloat(e.target.value),temp2:parseFloat(e.target.value)})});
-    });
-    
-    async function setTemp(t){
-      document.getElementById('tempSlider').value=t;
-      document.getElementById('sliderValue').textContent=t+'°C';
-      await fetch('/api/simulation',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify({enabled:true,temp1:t,temp2:t})});
-    }
-    
-    async function toggleDoor(){
-      document.getElementById('btnDoor').textContent='⏳ Cambiando...';
-      await fetch('/api/door/toggle',{method:'POST'});
-      await fetchStatus();
-    }
-    
-    async function toggleAlert(){
-      document.getElementById('btnAlert').textContent='⏳ Procesando...';
-      if(alertActive){await fetch('/api/alert/ack',{method:'POST'});}
-      else{await fetch('/api/alert/test',{method:'POST'});}
-      await fetchStatus();
-    }
-    
-    async function stopAlert(){
-      document.getElementById('alertBanner').style.opacity='0.5';
-      await fetch('/api/alert/ack',{method:'POST'});
-      alertActive=false;
-      document.getElementById('alertBanner').classList.remove('active');
-      document.getElementById('btnAlert').textContent='🚨 Activar Alerta';
-      document.getElementById('btnAlert').className='btn-red';
-      await fetchStatus();
-    }
-    
-    async function toggleRelay(){await fetch('/api/relay',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify({state:!relayState})});await fetchStatus();}
-    
-    async function toggleSensor(which){
-      let body={};
-      if(which==='sensor1'){body.sensor1_enabled=!sensor1En;document.getElementById('togSensor1').className=!sensor1En?'toggle on':'toggle';}
-      if(which==='sensor2'){body.sensor2_enabled=!sensor2En;document.getElementById('togSensor2').className=!sensor2En?'toggle on':'toggle';}
-      if(which==='door'){body.door_enabled=!doorEn;document.getElementById('togDoor').className=!doorEn?'toggle on':'toggle';}
-      await fetch('/api/config',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)});
-      await fetchStatus();
-    }
-    
-    async function saveThresholds(){
-      const tempMax=parseFloat(document.getElementById('inTempMax').value);
-      const doorMax=parseInt(document.getElementById('inDoorMax').value);
-      const alertDelay=parseInt(document.getElementById('inAlertDelay').value);
-      await fetch('/api/config',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify({temp_max:tempMax,door_open_max_sec:doorMax,alert_delay_sec:alertDelay})});
-      alert('✅ Umbrales guardados!\n\nTemp máx: '+tempMax+'°C\nPuerta máx: '+doorMax+' seg\nDelay alerta: '+alertDelay+' seg');
-    }
-    
-    async function loadConfig(){
-      try{
-        const r=await fetch('/api/config');
-        const c=await r.json();
-        document.getElementById('inTempMax').value=c.temp_max;
-        document.getElementById('inDoorMax').value=c.door_open_max_sec;
-        document.getElementById('inAlertDelay').value=c.alert_delay_sec;
-      }catch(e){}
-    }
-    
-    async function testTelegram(){
-      const r=await fetch('/api/telegram/test',{method:'POST'});
-      alert(r.ok?'✅ Mensaje enviado a Telegram':'❌ Error: Sin internet');
-    }
-    async function resetWifi(){
-      if(confirm('¿Resetear configuración WiFi? El dispositivo se reiniciará en modo AP.')){
-        await fetch('/api/wifi/reset',{method:'POST'});
-      }
-    }
-    
-    setInterval(fetchStatus,1000);
-    fetchStatus();
-    loadConfig();
-  </script>
-</body>
-</html>
-)rawliteral";
-}
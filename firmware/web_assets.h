@@ -0,0 +1,442 @@
+/*
+ * WEB_ASSETS.H - Páginas web comprimidas (GENERADO, no editar)
+ *
+ * Regenerar con: python3 tools/gen_web_assets.py
+ *
+ *   WEB_INDEX  firmware/data/index.html      35927 →  6745 bytes gzip
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+#define WEB_INDEX_MIME "text/html"
+#define WEB_INDEX_ETAG "\"4c936b1d014a9823\""
+#define WEB_INDEX_GZ_LEN 6745
+const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3d, 0x5d, 0x8f, 0xe3, 0xc6,
+  0x91, 0xef, 0xfe, 0x15, 0x9d, 0x71, 0x1c, 0x49, 0xce, 0x50, 0xa2, 0xbe, 0x66, 0xb5, 0xf3, 0xe5,
+  0x8c, 0x67, 0x77, 0x93, 0x39, 0xec, 0xda, 0x8b, 0x9d, 0xb1, 0x73, 0x41, 0x90, 0x5b, 0xb7, 0xc8,
+  0x96, 0xc4, 0x0c, 0x45, 0x2a, 0x24, 0x35, 0x1f, 0xbb, 0x59, 0xe0, 0x1e, 0xee, 0x70, 0x40, 0x90,
+  0x83, 0x81, 0xc4, 0x40, 0x70, 0x41, 0x02, 0x23, 0xf7, 0x70, 0x77, 0x08, 0x10, 0x20, 0xc1, 0xbd,
+  0xdc, 0xd3, 0x3d, 0xc4, 0xff, 0xc4, 0x7f, 0xe0, 0xfc, 0x13, 0xae, 0xaa, 0x9b, 0xa4, 0xc8, 0x66,
+  0x37, 0x45, 0x8e, 0xb4, 0x5e, 0x67, 0xec, 0xd9, 0x11, 0xc9, 0xee, 0xea, 0xea, 0xea, 0xfa, 0xea,
+  0xaa, 0x6a, 0xea, 0xf0, 0x5b, 0x0f, 0x3e, 0x3c, 0xbd, 0xf8, 0xd1, 0xd3, 0x87, 0x64, 0x16, 0xcd,
+  0xdd, 0xe3, 0xb7, 0x0e, 0xf1, 0x0f, 0x71, 0xa9, 0x37, 0x3d, 0xda, 0x61, 0xe1, 0x0e, 0xde, 0x60,
+  0xd4, 0x3e, 0x7e, 0x8b, 0xc0, 0xcf, 0xe1, 0x9c, 0x45, 0x94, 0x58, 0x33, 0x1a, 0x84, 0x2c, 0x3a,
+  0xda, 0xf9, 0xe8, 0xe2, 0x91, 0x31, 0xda, 0xc9, 0x3e, 0xf2, 0xe8, 0x9c, 0x1d, 0xed, 0x5c, 0x39,
+  0xec, 0x7a, 0xe1, 0x07, 0xd1, 0x0e, 0xb1, 0x7c, 0x2f, 0x62, 0x1e, 0x34, 0xbd, 0x76, 0xec, 0x68,
+  0x76, 0x64, 0xb3, 0x2b, 0xc7, 0x62, 0x06, 0xbf, 0xd8, 0x25, 0x8e, 0xe7, 0x44, 0x0e, 0x75, 0x8d,
+  0xd0, 0xa2, 0x2e, 0x3b, 0xea, 0xb6, 0xcd, 0x5d, 0x32, 0xa7, 0x37, 0xce, 0x7c, 0x39, 0xcf, 0xde,
+  0x5a, 0x86, 0x2c, 0xe0, 0xd7, 0x74, 0x0c, 0xb7, 0x3c, 0x5f, 0x31, 0x5e, 0x34, 0x63, 0x73, 0x66,
+  0x58, 0xbe, 0xeb, 0x07, 0x99, 0x21, 0xdf, 0x36, 0x27, 0xdd, 0x7b, 0x3d, 0xaa, 0x68, 0x4f, 0x17,
+  0x0b, 0x97, 0x19, 0x73, 0x7f, 0xec, 0xc0, 0x9f, 0x6b, 0x36, 0x36, 0xe0, 0x86, 0x61, 0xd1, 0x05,
+  0x8e, 0x90, 0x01, 0x70, 0xcb, 0xa7, 0xcf, 0x3b, 0x47, 0x4e, 0xe4, 0xb2, 0xe3, 0x67, 0x67, 0x8f,
+  0x2e, 0xc8, 0x13, 0x1f, 0xd0, 0xf6, 0x03, 0x62, 0x90, 0xa7, 0x34, 0x00, 0x70, 0x91, 0x63, 0x51,
+  0x8f, 0x9c, 0x3b, 0xee, 0x15, 0x0b, 0x0e, 0x3b, 0xa2, 0xa1, 0xe8, 0xe4, 0x3a, 0xde, 0x25, 0x09,
+  0x98, 0x7b, 0xb4, 0xb3, 0x08, 0x18, 0x40, 0xf5, 0x98, 0x05, 0x24, 0x99, 0x05, 0x6c, 0x72, 0xb4,
+  0x33, 0x8b, 0xa2, 0x45, 0xb8, 0xdf, 0xe9, 0x4c, 0x60, 0xb0, 0xb0, 0x3d, 0xf5, 0xfd, 0xa9, 0xcb,
+  0xe8, 0xc2, 0x09, 0xdb, 0x96, 0x3f, 0xdf, 0xc9, 0xf6, 0x5f, 0xdf, 0xbc, 0x63, 0x85, 0x61, 0xef,
+  0xbd, 0x09, 0x9d, 0x3b, 0xee, 0xed, 0xd1, 0x19, 0xe0, 0x1e, 0xec, 0x5f, 0x4f, 0x67, 0xd1, 0xf7,
+  0x06, 0xa6, 0x79, 0x30, 0x84, 0xdf, 0x3d, 0xf8, 0xbd, 0x07, 0xbf, 0x23, 0xd3, 0xfc, 0x8e, 0xed,
+  0x84, 0x0b, 0x97, 0xde, 0x1e, 0x85, 0xd7, 0x74, 0xb1, 0x23, 0x70, 0x0b, 0xa3, 0x5b, 0x97, 0x85,
+  0x33, 0xc6, 0xa2, 0x64, 0x5c, 0x7e, 0x47, 0x7c, 0xc6, 0x9f, 0xfd, 0xc0, 0xf7, 0x23, 0xf2, 0x32,
+  0xbd, 0xc6, 0x1f, 0xc3, 0x18, 0x4f, 0x8d, 0x45, 0xe0, 0xcc, 0x69, 0x70, 0xbb, 0x4f, 0x62, 0x4a,
+  0x1f, 0x14, 0x9b, 0x84, 0x38, 0x6f, 0x5b, 0x34, 0xea, 0xb2, 0xde, 0xfd, 0xfe, 0x58, 0xd1, 0xc8,
+  0xa2, 0x81, 0x5d, 0xf6, 0x7c, 0xe6, 0x03, 0x69, 0xa1, 0x41, 0xbf, 0x3f, 0xe8, 0x0e, 0x87, 0x72,
+  0x83, 0x88, 0xdd, 0x44, 0x19, 0x54, 0x26, 0xa3, 0x09, 0x9d, 0x58, 0xca, 0x46, 0x59, 0x64, 0xee,
+  0x0f, 0x68, 0x7f, 0x3c, 0x52, 0x36, 0x9b, 0x2f, 0x23, 0x86, 0xf8, 0xec, 0x0d, 0xee, 0x0d, 0x46,
+  0x05, 0x7c, 0xa8, 0x65, 0x01, 0x73, 0x18, 0x63, 0x77, 0xc9, 0x10, 0xa5, 0xf1, 0xa8, 0x37, 0xd9,
+  0xd3, 0xb4, 0x59, 0x2c, 0x03, 0xe0, 0x33, 0x68, 0x35, 0x1a, 0x0f, 0x2d, 0x6d, 0x2b, 0xeb, 0x96,
+  0x7a, 0x48, 0xc2, 0xbd, 0xf1, 0x9e, 0x3d, 0x90, 0xdb, 0x84, 0x4b, 0x68, 0x14, 0x86, 0xf0, 0xbc,
+  0xd7, 0xb3, 0x86, 0x43, 0x26, 0x3f, 0xbf, 0xa6, 0x81, 0xe7, 0x78, 0x53, 0x9c, 0xf7, 0xf0, 0x3e,
+  0x33, 0x0b, 0xd8, 0xda, 0x20, 0xc6, 0x9c, 0x76, 0x6c, 0x32, 0x80, 0x9f, 0x02, 0x71, 0xfd, 0xc0,
+  0x2e, 0x21, 0x6d, 0x38, 0xa3, 0xb6, 0x7f, 0xbd, 0x4f, 0x4c, 0xd2, 0x1b, 0x2e, 0x6e, 0xc8, 0xd0,
+  0x84, 0x7f, 0x8c, 0x6e, 0x0f, 0xfe, 0x0d, 0xa6, 0x63, 0xda, 0x04, 0xe1, 0x8c, 0xff, 0x6f, 0x0f,
+  0x5b, 0x72, 0xdf, 0x80, 0xda, 0xce, 0x12, 0x10, 0xef, 0xee, 0x2d, 0x6e, 0xd4, 0xcf, 0x8c, 0x70,
+  0xbe, 0x4f, 0x46, 0xd9, 0xa7, 0xaf, 0xde, 0x4a, 0x3f, 0xbe, 0x2b, 0x31, 0x1c, 0xac, 0xee, 0xd4,
+  0x01, 0x3a, 0x99, 0x79, 0x58, 0x0b, 0x6a, 0xdb, 0x7c, 0xfe, 0xd2, 0xfd, 0xb1, 0x7f, 0x63, 0x84,
+  0xce, 0x0b, 0xfe, 0x48, 0x4c, 0x12, 0xe6, 0xaa, 0x1e, 0x69, 0xec, 0xdb, 0xb7, 0xd2, 0x60, 0x28,
+  0x65, 0x86, 0x10, 0xa8, 0x7d, 0xd2, 0xe0, 0x22, 0xd5, 0xd8, 0x25, 0x86, 0x50, 0x1b, 0xe1, 0x6d,
+  0x18, 0xb1, 0xf9, 0x2e, 0x79, 0x1f, 0xc5, 0xf3, 0x09, 0xb5, 0xce, 0xf9, 0xf5, 0x23, 0xe8, 0xb2,
+  0x4b, 0x42, 0xea, 0xc1, 0xb4, 0x58, 0xe0, 0x4c, 0x24, 0x74, 0xa8, 0x75, 0x39, 0x0d, 0xfc, 0xa5,
+  0x07, 0x7c, 0x75, 0x45, 0x83, 0x66, 0x56, 0x7c, 0x24, 0xca, 0x71, 0x2d, 0x96, 0xb4, 0xca, 0xf2,
+  0xb6, 0xd4, 0x6e, 0xee, 0x78, 0xc6, 0x8c, 0x39, 0x20, 0xe8, 0x40, 0x63, 0xd3, 0xbc, 0x9a, 0xe5,
+  0x1f, 0x03, 0x72, 0x6c, 0xf5, 0xbc, 0x3d, 0x54, 0x4e, 0xbd, 0xf3, 0x2e, 0xf9, 0x01, 0xe8, 0x76,
+  0x16, 0x90, 0x77, 0x3b, 0xe9, 0xcd, 0xf6, 0x4c, 0xdc, 0x7a, 0xa9, 0x9d, 0x01, 0xc2, 0xa6, 0x81,
+  0x31, 0xc5, 0x65, 0x04, 0x0e, 0x6e, 0x76, 0xfb, 0x43, 0x9b, 0x4d, 0x77, 0x63, 0x9c, 0x33, 0x02,
+  0xd2, 0x22, 0xe6, 0x3b, 0xd2, 0x6d, 0x21, 0x13, 0x2d, 0x44, 0xf9, 0x9d, 0x96, 0x66, 0x2d, 0x7b,
+  0x03, 0xe0, 0xb0, 0x9e, 0x29, 0xf3, 0xcd, 0xc2, 0x0f, 0xc1, 0x5e, 0xf8, 0xc0, 0x04, 0x21, 0xe8,
+  0xdc, 0xcb, 0xdb, 0xfc, 0xd3, 0xc8, 0x5f, 0x14, 0xb8, 0xe0, 0x85, 0xe1, 0x78, 0x36, 0xbb, 0xe1,
+  0x04, 0x52, 0xf0, 0x47, 0xcc, 0xdd, 0x02, 0x3f, 0x71, 0xd5, 0x52, 0xd2, 0x29, 0x26, 0x89, 0x11,
+  0x5b, 0x86, 0x02, 0x6b, 0xde, 0x08, 0x8b, 0x06, 0xe3, 0xf4, 0xcc, 0x02, 0xda, 0x29, 0xe7, 0x12,
+  0xba, 0x8c, 0xfc, 0xfc, 0xb3, 0x58, 0x1d, 0xef, 0x93, 0x89, 0xcb, 0xa4, 0x6e, 0x3f, 0x5d, 0xc2,
+  0x2c, 0x27, 0xb7, 0xc9, 0x98, 0x30, 0xe9, 0x05, 0x05, 0xd3, 0x39, 0x66, 0xd1, 0x35, 0x63, 0x5e,
+  0xbe, 0x2d, 0x75, 0x9d, 0xa9, 0x67, 0x38, 0xc0, 0x86, 0x20, 0x70, 0x48, 0x66, 0x16, 0xa8, 0xe7,
+  0xe1, 0xfa, 0x53, 0x5f, 0xc2, 0xbe, 0x04, 0x85, 0x52, 0xb0, 0xf8, 0x33, 0xa5, 0x0b, 0x9c, 0xb3,
+  0x46, 0x84, 0xf9, 0x68, 0x86, 0x03, 0x13, 0x90, 0x86, 0x8c, 0x89, 0x35, 0x18, 0xc9, 0xa4, 0x4a,
+  0xf8, 0xb5, 0xf8, 0x24, 0xcb, 0x7e, 0x5c, 0xf7, 0xf4, 0x86, 0xc3, 0xdd, 0xe4, 0xd7, 0x6c, 0xf7,
+  0x5a, 0xf2, 0xf2, 0x72, 0x91, 0x4f, 0x75, 0x50, 0x4f, 0x86, 0xb7, 0xc9, 0xac, 0x0b, 0x2b, 0xa3,
+  0x6a, 0xc4, 0x55, 0x08, 0x68, 0x20, 0x26, 0xd8, 0xb9, 0x84, 0x40, 0x28, 0xe3, 0x64, 0xd6, 0x55,
+  0xa9, 0x20, 0xd1, 0xbf, 0xdb, 0xee, 0x0d, 0x03, 0x36, 0x57, 0xc0, 0xbf, 0x8e, 0xe9, 0x75, 0x4f,
+  0x66, 0x6f, 0x97, 0x45, 0x11, 0x7a, 0x4d, 0xc0, 0x32, 0x5c, 0xa2, 0x0c, 0xd0, 0xd0, 0xeb, 0x91,
+  0x80, 0xe6, 0x9e, 0x1e, 0x0d, 0xb3, 0x7d, 0xaf, 0x88, 0x86, 0x8f, 0x23, 0x44, 0xb7, 0xf8, 0x74,
+  0x54, 0x2a, 0x3a, 0x61, 0x44, 0xa3, 0x65, 0xb8, 0x6d, 0xde, 0xab, 0xcb, 0x27, 0xdd, 0xa1, 0x4e,
+  0xe7, 0x00, 0x24, 0x85, 0xa9, 0x92, 0xf9, 0xa8, 0x28, 0xdd, 0x39, 0x02, 0x8d, 0x24, 0x0a, 0x65,
+  0xe9, 0x20, 0x08, 0x60, 0xd8, 0x05, 0x57, 0x2a, 0x51, 0x1d, 0xa6, 0x4e, 0x1a, 0x8a, 0x4f, 0x24,
+  0xb4, 0x86, 0xe6, 0x3b, 0xeb, 0xcc, 0x4d, 0xec, 0x47, 0x48, 0xb3, 0xa7, 0x1e, 0x58, 0x16, 0xa1,
+  0x52, 0x17, 0x4b, 0x37, 0x64, 0xa4, 0x17, 0x82, 0x53, 0x3e, 0x41, 0xbf, 0x9c, 0xad, 0x9b, 0x45,
+  0xdb, 0x9f, 0x4c, 0xd0, 0x10, 0x90, 0x97, 0x8a, 0xe1, 0x84, 0xdb, 0xd1, 0x3a, 0xc8, 0x8e, 0xe0,
+  0xf9, 0x1e, 0x3b, 0x00, 0x60, 0x2a, 0x58, 0xb1, 0x1b, 0xa3, 0x84, 0x15, 0x3f, 0x6b, 0x1d, 0x64,
+  0x11, 0xf9, 0xde, 0x25, 0xbb, 0x9d, 0xa0, 0xf7, 0x1d, 0xc6, 0x98, 0xe7, 0x69, 0x8a, 0x66, 0x07,
+  0x2d, 0x0c, 0x00, 0x4c, 0x39, 0xb4, 0x7b, 0x40, 0xa2, 0x00, 0xec, 0xf3, 0xc4, 0x0f, 0xc0, 0xef,
+  0xe0, 0x1b, 0x8c, 0x66, 0xb7, 0x95, 0xc5, 0x08, 0x7f, 0x86, 0xf9, 0x4e, 0x66, 0x7b, 0x4f, 0xd1,
+  0xcd, 0x6c, 0xdf, 0xcf, 0x75, 0xcc, 0x9b, 0xd4, 0x27, 0xd4, 0xf1, 0xc8, 0x29, 0xf0, 0x05, 0xfc,
+  0x95, 0x4c, 0xab, 0x95, 0xde, 0xdd, 0x9a, 0x09, 0xc9, 0x5b, 0xcd, 0x3c, 0x0b, 0xe7, 0xf1, 0x3a,
+  0x71, 0x59, 0x10, 0x91, 0xf7, 0xa9, 0x27, 0x63, 0x45, 0xf1, 0x81, 0x31, 0x16, 0x0f, 0x34, 0x12,
+  0xca, 0x57, 0xef, 0x8e, 0x1e, 0x41, 0xcc, 0x0d, 0x7c, 0x55, 0xde, 0x1e, 0xdf, 0xef, 0x5a, 0x5d,
+  0x4b, 0x65, 0xff, 0x25, 0xae, 0x16, 0x7d, 0xc5, 0x55, 0x99, 0xa7, 0xa0, 0x22, 0x15, 0x38, 0x7b,
+  0x51, 0xe4, 0xcf, 0x55, 0x0d, 0x32, 0x1c, 0xc9, 0xe7, 0xfd, 0x94, 0xb3, 0x4f, 0x57, 0xc5, 0xf8,
+  0xb2, 0xa3, 0x60, 0xc2, 0x7f, 0x7b, 0x66, 0xe2, 0xfd, 0xf6, 0xfa, 0xf7, 0x77, 0xc9, 0xde, 0x48,
+  0xfc, 0x9a, 0xed, 0x81, 0xc6, 0x75, 0xc8, 0x12, 0xb7, 0x4d, 0xad, 0xc8, 0xb9, 0x42, 0x91, 0x49,
+  0xe9, 0x3a, 0x76, 0x7d, 0xeb, 0x52, 0xc7, 0xda, 0x19, 0x04, 0xb5, 0xfc, 0x5d, 0x99, 0xa7, 0x8b,
+  0x0d, 0xdb, 0x66, 0x57, 0xc7, 0xc6, 0x31, 0xda, 0x6a, 0x87, 0x67, 0x63, 0xb5, 0x9d, 0xf7, 0xed,
+  0x8a, 0xc3, 0x2a, 0x7c, 0x86, 0x8c, 0x9e, 0x2d, 0x7a, 0x07, 0x99, 0x35, 0x85, 0xb5, 0xba, 0x64,
+  0xb8, 0x21, 0x59, 0xa3, 0xc9, 0x32, 0x54, 0x16, 0x5d, 0xaa, 0x10, 0x38, 0xf0, 0x41, 0x65, 0x81,
+  0xf8, 0x03, 0x6f, 0x17, 0x88, 0xdc, 0x1b, 0xaa, 0x1b, 0x1b, 0x5d, 0x65, 0xf3, 0x7b, 0x9a, 0xe6,
+  0xc5, 0xd6, 0x45, 0xf2, 0x08, 0x8f, 0xa1, 0x57, 0xe6, 0x31, 0xd4, 0x75, 0x18, 0x24, 0xb1, 0x19,
+  0x94, 0xaf, 0x0f, 0x47, 0x60, 0x21, 0x8d, 0x9f, 0xd1, 0x99, 0xf7, 0xcb, 0x3a, 0xa3, 0x0c, 0xf8,
+  0x5e, 0xa8, 0xdc, 0xdf, 0x19, 0x2e, 0x9b, 0x00, 0x7a, 0x79, 0x2d, 0x97, 0x05, 0x31, 0x8e, 0x3c,
+  0x98, 0xa3, 0xcb, 0x3c, 0x8b, 0x95, 0x6c, 0x50, 0x2a, 0x7b, 0x88, 0xc0, 0x8a, 0x20, 0xce, 0xa1,
+  0xef, 0x3a, 0xb6, 0xaa, 0xd3, 0x40, 0xbd, 0x37, 0xbb, 0x9e, 0x15, 0xd4, 0x44, 0xaa, 0x91, 0xf8,
+  0xee, 0xb8, 0xa8, 0x75, 0x4a, 0x74, 0x1b, 0x6c, 0x83, 0x5b, 0x25, 0x4b, 0xb5, 0x27, 0x2f, 0x95,
+  0xb5, 0x0c, 0x42, 0xc4, 0x62, 0xe1, 0x3b, 0x45, 0xf1, 0xe2, 0x0c, 0xe5, 0x24, 0xea, 0xcd, 0x85,
+  0xb5, 0xe8, 0x85, 0x6b, 0x29, 0xb9, 0xcf, 0x03, 0x2c, 0xf5, 0xe8, 0xd9, 0x6f, 0x29, 0x06, 0x96,
+  0xb4, 0xcb, 0xb0, 0xa5, 0x33, 0x45, 0xdf, 0x0f, 0x80, 0xe0, 0x8f, 0xe9, 0xad, 0xbf, 0x8c, 0x72,
+  0x96, 0x68, 0x8a, 0xf7, 0x35, 0xca, 0x06, 0x9f, 0x49, 0xba, 0x04, 0xee, 0x00, 0x2f, 0xce, 0xe1,
+  0x79, 0xc4, 0xc3, 0x7f, 0xcb, 0xb9, 0x07, 0xc4, 0x0d, 0xd8, 0x82, 0xd1, 0xa8, 0x89, 0x4c, 0x64,
+  0x4c, 0x1c, 0xd8, 0x95, 0xc3, 0x56, 0x19, 0x0c, 0x6c, 0xb3, 0x8f, 0x86, 0x15, 0xc4, 0x7a, 0x12,
+  0xb4, 0x5a, 0xb5, 0x94, 0x12, 0x1f, 0x67, 0xb2, 0x04, 0x72, 0xbe, 0x2c, 0x8e, 0x2f, 0x86, 0x85,
+  0x85, 0x27, 0x1d, 0x62, 0x74, 0x75, 0x13, 0x3e, 0xa5, 0x81, 0x1d, 0xe6, 0x5d, 0x01, 0xb8, 0x53,
+  0x42, 0xf2, 0x34, 0x4a, 0x80, 0xed, 0xee, 0x6c, 0x28, 0x13, 0x2e, 0xef, 0xa6, 0x5c, 0x1e, 0xc3,
+  0xe5, 0xf7, 0xa5, 0xc6, 0xc8, 0x04, 0x13, 0x17, 0x0d, 0xdd, 0xcc, 0xb1, 0x6d, 0x79, 0x8f, 0x99,
+  0xe5, 0xac, 0x74, 0xb1, 0x39, 0x7f, 0xed, 0x66, 0x8c, 0x64, 0x09, 0xc3, 0xf1, 0x28, 0x9f, 0x8a,
+  0xd3, 0x32, 0xac, 0xc3, 0x3f, 0xe2, 0x6a, 0xfe, 0xa8, 0x69, 0x80, 0x20, 0xb5, 0x36, 0xda, 0xb4,
+  0xe3, 0x80, 0x86, 0x32, 0x98, 0xb1, 0x92, 0xd6, 0x3d, 0x65, 0xa4, 0x21, 0x8d, 0x18, 0x09, 0x6d,
+  0x58, 0x89, 0x7a, 0x5f, 0xf7, 0x56, 0x9e, 0xcf, 0x8e, 0x47, 0x9b, 0xcb, 0xb6, 0x6c, 0xa3, 0x7b,
+  0x6b, 0x2c, 0x41, 0x51, 0xbd, 0x14, 0xe2, 0x4f, 0x69, 0xd8, 0x54, 0x16, 0x79, 0x7c, 0x98, 0x59,
+  0xbc, 0xe5, 0x62, 0xc1, 0x02, 0x8b, 0x86, 0xac, 0x7c, 0x2f, 0x2a, 0x6d, 0x45, 0xb7, 0xbf, 0x0f,
+  0x2c, 0x50, 0x49, 0x11, 0xe1, 0x5b, 0x79, 0x90, 0xa6, 0xde, 0x61, 0xbe, 0x00, 0xd5, 0xc2, 0x02,
+  0xd8, 0xa4, 0x04, 0x8c, 0x3c, 0x10, 0x28, 0xe6, 0x44, 0x18, 0x55, 0x8f, 0x11, 0xe3, 0x2e, 0xf3,
+  0x34, 0xd2, 0x86, 0xe3, 0xae, 0xc6, 0x3a, 0x1d, 0x7f, 0x60, 0x16, 0x38, 0x30, 0x8b, 0x3f, 0x1f,
+  0xe2, 0x8a, 0xba, 0xcb, 0x92, 0x55, 0x5e, 0xb3, 0xc2, 0xa3, 0xb5, 0xc1, 0x81, 0x82, 0xb5, 0xca,
+  0x07, 0x0f, 0xef, 0xea, 0xf6, 0x27, 0x7b, 0xce, 0x62, 0x10, 0x10, 0x43, 0xde, 0xca, 0x10, 0x20,
+  0x26, 0x63, 0x2e, 0x1d, 0x74, 0x97, 0x93, 0x41, 0x0c, 0xcb, 0x75, 0x60, 0x81, 0x91, 0x9e, 0xea,
+  0xa6, 0x9c, 0xd2, 0x13, 0xc7, 0x75, 0x8d, 0x98, 0x73, 0x39, 0x47, 0x2e, 0x68, 0x00, 0x03, 0xe9,
+  0x30, 0x57, 0x02, 0x55, 0x93, 0x7d, 0xb5, 0x35, 0xbd, 0x23, 0x15, 0x92, 0xed, 0xab, 0xd8, 0xfd,
+  0x30, 0x3a, 0x1c, 0x99, 0xd6, 0x86, 0x53, 0xbf, 0xdb, 0x44, 0xac, 0xc0, 0xc1, 0x54, 0x95, 0x7b,
+  0xe7, 0x99, 0x54, 0xdc, 0xc6, 0x6d, 0x6f, 0x22, 0x92, 0x6b, 0x8f, 0x73, 0x11, 0x9b, 0xa1, 0x5a,
+  0xee, 0xfd, 0xaa, 0x5b, 0xa5, 0x18, 0xc1, 0x9a, 0x70, 0xc0, 0x3d, 0x9d, 0x6b, 0xce, 0x29, 0xed,
+  0xd2, 0x31, 0x73, 0x4b, 0xfc, 0xf2, 0x82, 0xa4, 0x56, 0xd7, 0xb6, 0xb1, 0x83, 0xcc, 0xc3, 0xdc,
+  0xa3, 0x52, 0x75, 0x11, 0x32, 0x0f, 0x1c, 0xc4, 0x1a, 0xb1, 0xb6, 0x4a, 0x01, 0x4d, 0xe1, 0x23,
+  0xe9, 0xf6, 0xdb, 0x1c, 0x2d, 0x45, 0xc8, 0x5e, 0xa8, 0x39, 0xdd, 0xe3, 0xd8, 0xce, 0xf2, 0xa7,
+  0x6b, 0x8d, 0x6c, 0x2e, 0x0c, 0xc5, 0xa7, 0xc8, 0xcd, 0x42, 0x0d, 0xc5, 0xab, 0x80, 0xb0, 0x46,
+  0xb5, 0xd6, 0xdf, 0x48, 0x55, 0x49, 0xdf, 0x28, 0xf0, 0x58, 0xc3, 0x38, 0xca, 0xd8, 0x6b, 0x71,
+  0x28, 0x9e, 0xb9, 0xd4, 0x3a, 0xdd, 0x0f, 0x7c, 0x3f, 0x20, 0xe7, 0x22, 0x0e, 0x9b, 0x35, 0x63,
+  0x36, 0xdc, 0x7f, 0x4d, 0xf1, 0xd9, 0x62, 0x44, 0x75, 0xbd, 0xe1, 0x15, 0xf8, 0xe8, 0xd3, 0x06,
+  0x7b, 0x03, 0x5d, 0xa0, 0x74, 0x6f, 0xdd, 0xb6, 0xab, 0x88, 0xce, 0xd7, 0x99, 0x07, 0xe8, 0x17,
+  0xb2, 0x10, 0xc5, 0xdd, 0x5a, 0x3f, 0x5c, 0x43, 0x93, 0xb6, 0xe5, 0xfa, 0x21, 0xb3, 0xef, 0xac,
+  0xc4, 0x13, 0xa3, 0x0c, 0x2a, 0xbc, 0xbb, 0x47, 0xfb, 0x03, 0xda, 0x5a, 0x37, 0xa0, 0xbf, 0x60,
+  0xde, 0xc6, 0xd6, 0x2f, 0x35, 0x7d, 0xfa, 0x08, 0x34, 0x8e, 0x58, 0x12, 0x8c, 0x53, 0x2b, 0xf7,
+  0x55, 0xa7, 0xd7, 0x12, 0x20, 0xd3, 0xc7, 0xc7, 0x04, 0x7d, 0xbc, 0x89, 0x4f, 0x66, 0xfd, 0x4d,
+  0x52, 0x37, 0x39, 0xff, 0x5b, 0x3d, 0x80, 0x1c, 0x68, 0xa9, 0x6e, 0x33, 0xaa, 0x26, 0x27, 0x40,
+  0x39, 0xa0, 0x5e, 0x08, 0xc5, 0xbe, 0x3c, 0xab, 0x1b, 0x50, 0x2d, 0x84, 0xc6, 0x36, 0xb7, 0xe5,
+  0x3d, 0xb1, 0x03, 0xaf, 0x95, 0x48, 0x44, 0x2c, 0x54, 0xca, 0xbe, 0x46, 0x5a, 0xbd, 0x56, 0x00,
+  0x26, 0xb7, 0x3f, 0x3c, 0xb8, 0x9b, 0x7d, 0x41, 0x94, 0x5f, 0xaf, 0x75, 0xc9, 0x3a, 0xd3, 0x25,
+  0x48, 0xbc, 0x1e, 0xd3, 0x22, 0xdb, 0xfe, 0x81, 0x7e, 0x1b, 0xf5, 0x84, 0x2e, 0x72, 0x3c, 0x35,
+  0xa7, 0x0b, 0x43, 0x97, 0x08, 0x49, 0x54, 0xb9, 0x22, 0x09, 0x52, 0x6b, 0x05, 0xcb, 0x63, 0x19,
+  0xab, 0x4a, 0x82, 0x80, 0x01, 0x93, 0x3a, 0x57, 0x9a, 0x6c, 0x57, 0x1e, 0x53, 0x87, 0xeb, 0x1c,
+  0x5d, 0xf6, 0x4e, 0xce, 0xc1, 0x65, 0x6a, 0x33, 0xde, 0x51, 0x07, 0x65, 0x8a, 0x29, 0x15, 0xd8,
+  0xc6, 0x60, 0xf5, 0x16, 0x48, 0x10, 0xbd, 0x15, 0x2a, 0xa8, 0x0f, 0xee, 0x35, 0x2f, 0x48, 0x0b,
+  0x68, 0x18, 0x09, 0x85, 0xa4, 0xc5, 0x14, 0xe7, 0x5c, 0xdc, 0x89, 0xae, 0xe6, 0x4a, 0xc7, 0xe0,
+  0x5f, 0x2d, 0x8b, 0x09, 0x8e, 0x38, 0xc8, 0x51, 0xb0, 0x4e, 0x22, 0x16, 0x5b, 0xbc, 0x5f, 0x88,
+  0x0c, 0x76, 0x87, 0xbb, 0xa4, 0xd7, 0xdf, 0x25, 0x83, 0x1e, 0x26, 0x42, 0xee, 0x97, 0xa6, 0x58,
+  0x7b, 0x9b, 0x47, 0x46, 0x35, 0x7c, 0x2b, 0x05, 0xdc, 0x7c, 0xb0, 0x20, 0x53, 0xf2, 0x08, 0x83,
+  0x54, 0x52, 0x06, 0x0e, 0xee, 0x1b, 0x3c, 0x78, 0x55, 0xd9, 0xd9, 0xc1, 0x3b, 0xb0, 0xd1, 0x0f,
+  0x98, 0x25, 0x28, 0x29, 0x74, 0xda, 0x5a, 0x7f, 0x27, 0xbb, 0x40, 0x38, 0xa0, 0x81, 0x54, 0x5b,
+  0xbc, 0x86, 0x61, 0xab, 0x8c, 0xba, 0x56, 0x0d, 0xac, 0x0d, 0x15, 0x0d, 0xef, 0x16, 0x2a, 0xd2,
+  0xe0, 0xe3, 0x78, 0x8b, 0x65, 0xb4, 0x9b, 0xbb, 0x15, 0x32, 0x17, 0xa6, 0xba, 0xa9, 0x8e, 0xaf,
+  0x18, 0xaf, 0xbb, 0xa3, 0x41, 0xe8, 0x29, 0xeb, 0x04, 0xaa, 0x16, 0x6d, 0x95, 0xee, 0x05, 0xb3,
+  0xde, 0x60, 0x8c, 0x1d, 0x87, 0x5b, 0x12, 0x53, 0x95, 0xe9, 0xb9, 0x3f, 0xf1, 0xad, 0x65, 0xa8,
+  0xa2, 0xaa, 0x78, 0x22, 0xa7, 0x6c, 0x96, 0x11, 0xba, 0x6f, 0xca, 0xec, 0x6e, 0x06, 0x81, 0x7d,
+  0x45, 0x65, 0x57, 0x09, 0x3e, 0x81, 0x7f, 0xbd, 0xb1, 0xb3, 0x00, 0x2e, 0x02, 0xfe, 0xd6, 0xf2,
+  0x12, 0x22, 0x7f, 0x3a, 0x75, 0x59, 0x5d, 0x21, 0xdb, 0x5a, 0x70, 0xb6, 0xc8, 0x27, 0xe6, 0x66,
+  0x51, 0x65, 0xc5, 0xdc, 0x6a, 0x0b, 0x71, 0x11, 0x46, 0xdd, 0x5a, 0xac, 0x5e, 0x69, 0x8d, 0x4d,
+  0x3d, 0xaf, 0xab, 0x3b, 0xd0, 0xd7, 0xf4, 0x15, 0x2d, 0x71, 0xad, 0x64, 0xd7, 0x0a, 0xa9, 0x12,
+  0x71, 0x11, 0x14, 0x48, 0xb3, 0xf0, 0x6b, 0x66, 0xb5, 0x9e, 0xdd, 0x05, 0xbc, 0xfd, 0x7d, 0x3a,
+  0x89, 0x0a, 0x9e, 0x4c, 0xca, 0x4f, 0x8d, 0xc6, 0x41, 0x2d, 0x83, 0x1c, 0xaf, 0x48, 0xaf, 0xa7,
+  0x5d, 0x91, 0x52, 0x8b, 0xac, 0x48, 0x4e, 0xae, 0x2b, 0x17, 0xe2, 0x0e, 0x5c, 0x5f, 0x6d, 0xfe,
+  0xfb, 0x65, 0x7b, 0xd6, 0x7c, 0x1e, 0xa8, 0x02, 0xcd, 0xd5, 0xa4, 0x52, 0x25, 0x80, 0xfe, 0xbe,
+  0x89, 0x01, 0x02, 0x6d, 0x2c, 0xe3, 0xfd, 0x25, 0x08, 0x91, 0x97, 0x8f, 0x63, 0x8c, 0x23, 0x4f,
+  0x9b, 0xe7, 0x19, 0x6c, 0x29, 0x2b, 0xbb, 0x41, 0x5e, 0xe5, 0xee, 0x69, 0xdb, 0x72, 0xa7, 0x31,
+  0xd5, 0x6d, 0x8e, 0xc7, 0xe3, 0xf6, 0xaf, 0x2b, 0x92, 0x51, 0x9e, 0x68, 0xc1, 0x74, 0x72, 0xac,
+  0x03, 0xb6, 0x52, 0x39, 0xac, 0x2e, 0x1b, 0xae, 0x94, 0x8f, 0xd7, 0xa0, 0xb5, 0xbd, 0xdc, 0xa3,
+  0xc9, 0x4b, 0xf2, 0x78, 0x04, 0x4b, 0x38, 0xc0, 0xc3, 0xfb, 0xb0, 0xa9, 0xed, 0x9b, 0xe0, 0x05,
+  0x0f, 0xf6, 0xd0, 0x05, 0xee, 0xb7, 0x4a, 0x72, 0xee, 0x22, 0x00, 0xf3, 0x5a, 0x02, 0x38, 0xd5,
+  0x69, 0x22, 0x62, 0xf9, 0x9b, 0xa6, 0x02, 0xd2, 0x3c, 0xc0, 0x9d, 0x70, 0x88, 0xbd, 0x8f, 0x12,
+  0x24, 0xf4, 0xa9, 0x9c, 0x3a, 0x9e, 0x5e, 0xdd, 0x90, 0x6c, 0x06, 0xb7, 0xb5, 0x95, 0x11, 0xa9,
+  0xfd, 0xe3, 0x0d, 0x4b, 0x00, 0xf2, 0x3a, 0xaf, 0x2a, 0x7b, 0x47, 0xa9, 0x3c, 0xdf, 0x09, 0x23,
+  0x1f, 0x44, 0xea, 0x74, 0x46, 0x83, 0x7c, 0xa9, 0x04, 0x1e, 0xc2, 0x8a, 0xee, 0xb2, 0x8f, 0xae,
+  0xba, 0xf9, 0x15, 0x03, 0x80, 0x6a, 0xb1, 0xd8, 0xcc, 0x77, 0x6d, 0x7d, 0x69, 0xe0, 0xeb, 0x52,
+  0x38, 0xfa, 0x1d, 0x74, 0xdd, 0xc8, 0xf7, 0x05, 0x58, 0xda, 0x7c, 0xe6, 0x16, 0x6f, 0x54, 0x9e,
+  0x0e, 0xd7, 0x7c, 0x83, 0x0d, 0xdc, 0xa0, 0x55, 0xb6, 0x77, 0x23, 0x0b, 0x24, 0xd7, 0x36, 0xea,
+  0xb3, 0xc6, 0x74, 0x2c, 0x3b, 0x89, 0x2e, 0x3f, 0x06, 0xa1, 0xf3, 0x56, 0xcd, 0x3a, 0x61, 0x2e,
+  0x05, 0xde, 0xc5, 0x0d, 0x51, 0x99, 0xb5, 0xfb, 0x5a, 0xb6, 0x9d, 0xf5, 0xaa, 0xa1, 0x80, 0x62,
+  0x9b, 0xb9, 0x85, 0xd5, 0xd4, 0x1e, 0x0c, 0x23, 0x54, 0xca, 0xbe, 0xe7, 0x47, 0xcd, 0x78, 0xc4,
+  0xd6, 0x86, 0xfa, 0x05, 0x18, 0xfc, 0x91, 0xef, 0x47, 0x52, 0x51, 0xef, 0x44, 0xdc, 0xba, 0x63,
+  0x59, 0x42, 0xd1, 0x57, 0xaa, 0x16, 0x12, 0xac, 0x1e, 0xa0, 0x39, 0x49, 0x22, 0xff, 0x79, 0xc9,
+  0x9c, 0x50, 0x9b, 0x19, 0x8e, 0xec, 0xc8, 0x65, 0xd2, 0x04, 0xd8, 0xe0, 0xcc, 0xe3, 0xa9, 0x12,
+  0xc2, 0x68, 0xc8, 0x50, 0x55, 0xaf, 0xcb, 0x12, 0xc4, 0x7d, 0x24, 0x91, 0x08, 0xfc, 0x79, 0x2e,
+  0xb7, 0x7b, 0xa0, 0xf1, 0x06, 0xba, 0xdc, 0x11, 0x95, 0x52, 0x06, 0x91, 0xaf, 0xaf, 0x2d, 0xcf,
+  0xf4, 0x35, 0x4b, 0xea, 0xc4, 0x9f, 0xb1, 0x70, 0x01, 0xd3, 0x47, 0x9e, 0xcb, 0x50, 0xe0, 0x7b,
+  0x73, 0x66, 0x3b, 0x94, 0x34, 0x33, 0x25, 0xe1, 0x7b, 0x58, 0x24, 0x22, 0x73, 0x49, 0xf9, 0x99,
+  0xa4, 0xaa, 0xe1, 0x23, 0xcd, 0xb6, 0x5a, 0x42, 0xb6, 0xbc, 0x14, 0x45, 0x2e, 0xcf, 0x2d, 0x88,
+  0xb3, 0x0c, 0xa9, 0xac, 0xb6, 0xb8, 0x0e, 0xe2, 0xeb, 0xb8, 0x59, 0x3d, 0xae, 0xba, 0xfe, 0xb4,
+  0x50, 0x83, 0x6a, 0x1e, 0xe8, 0x9e, 0x8b, 0x74, 0xf5, 0xde, 0x3a, 0x7a, 0x69, 0x62, 0x21, 0xe5,
+  0x41, 0x0f, 0x19, 0xa4, 0x86, 0x73, 0xf0, 0x1c, 0x32, 0x96, 0x14, 0xae, 0xa4, 0x28, 0x27, 0x44,
+  0x81, 0x33, 0x89, 0x8c, 0x2b, 0x27, 0x5c, 0x16, 0xaa, 0x3d, 0xd6, 0xed, 0xb7, 0x53, 0x9b, 0xab,
+  0x48, 0xd6, 0x97, 0x79, 0x87, 0x23, 0x93, 0x7b, 0x87, 0x6f, 0x77, 0x59, 0x9f, 0x0e, 0x27, 0xa2,
+  0x44, 0x44, 0x1c, 0x0a, 0xae, 0x59, 0xe9, 0x5f, 0x37, 0x94, 0x2f, 0xd9, 0x44, 0x7d, 0x00, 0x96,
+  0xd3, 0x04, 0xbc, 0xf8, 0x3b, 0x86, 0xc7, 0x8b, 0xf4, 0x10, 0x6c, 0x52, 0xdc, 0x4c, 0x2b, 0x37,
+  0xb3, 0xc6, 0xb0, 0x40, 0x84, 0x58, 0xb8, 0x47, 0xda, 0x73, 0x3f, 0x7b, 0xf5, 0x96, 0x20, 0x76,
+  0xd0, 0xdf, 0x1e, 0xdc, 0x1b, 0x0e, 0xf7, 0x60, 0x43, 0x12, 0x9f, 0xe9, 0x2d, 0x27, 0xfd, 0x48,
+  0xed, 0x90, 0x64, 0xeb, 0xa2, 0x0b, 0xe7, 0xa0, 0x0b, 0x54, 0xc5, 0x54, 0x65, 0x4d, 0xb2, 0x72,
+  0x19, 0x1a, 0x6a, 0x48, 0x2a, 0xdf, 0x0e, 0x62, 0x47, 0xa0, 0x88, 0xab, 0x58, 0x9b, 0x61, 0x19,
+  0x9d, 0x94, 0xc7, 0xca, 0x25, 0x2a, 0x0c, 0x94, 0x41, 0x0e, 0x2e, 0xc0, 0x3e, 0x0c, 0x8e, 0x47,
+  0x6f, 0x10, 0x35, 0xa5, 0x92, 0xd1, 0xc5, 0x43, 0x86, 0xc2, 0x3c, 0xad, 0x21, 0x9b, 0x2a, 0xbb,
+  0x9e, 0xe1, 0xa0, 0x05, 0x0b, 0xc2, 0x05, 0xe3, 0x5e, 0x42, 0x93, 0x1f, 0x3e, 0x6b, 0xc5, 0xe7,
+  0x04, 0x60, 0x8f, 0x3a, 0x18, 0xf2, 0x93, 0x02, 0x7a, 0xf8, 0xa0, 0x57, 0xec, 0x3b, 0x72, 0xbb,
+  0xa9, 0x5a, 0x17, 0x53, 0xb9, 0x2a, 0xa6, 0x9a, 0x79, 0xfb, 0xb5, 0x98, 0x57, 0x68, 0x0f, 0xbe,
+  0x97, 0x86, 0x0d, 0x74, 0x77, 0xd4, 0x83, 0xad, 0x74, 0xb7, 0x27, 0xb6, 0xd2, 0x5c, 0x99, 0x64,
+  0x76, 0x82, 0xb2, 0x42, 0xc9, 0x25, 0x3c, 0x3d, 0xff, 0x7a, 0xe2, 0xd2, 0x4b, 0x16, 0xde, 0x85,
+  0x1f, 0xef, 0x3e, 0x6b, 0x0d, 0xdd, 0xf4, 0xaa, 0x4b, 0x89, 0x74, 0x4d, 0x9c, 0x63, 0x8f, 0x4c,
+  0x51, 0x9c, 0xbf, 0x57, 0x92, 0x76, 0xe8, 0x95, 0x1c, 0x9e, 0x99, 0xa0, 0x93, 0x2c, 0xd6, 0xa6,
+  0x72, 0x05, 0x06, 0xef, 0x23, 0x17, 0x5f, 0xe4, 0xab, 0x29, 0x72, 0x91, 0x95, 0x0c, 0x13, 0x27,
+  0x07, 0x69, 0xf4, 0xe5, 0x77, 0xc5, 0x12, 0x8e, 0xac, 0x5f, 0x96, 0x83, 0xd5, 0xdf, 0x93, 0xa1,
+  0x99, 0x79, 0xd7, 0x0b, 0xff, 0x3d, 0xec, 0xc4, 0xef, 0xb6, 0x38, 0xec, 0x88, 0x97, 0x9a, 0x1c,
+  0x62, 0x6d, 0x70, 0xfc, 0xda, 0x8b, 0x6f, 0x19, 0x46, 0x72, 0x1c, 0xde, 0x30, 0xe2, 0x7b, 0x71,
+  0xf9, 0xb8, 0xe5, 0xd2, 0x30, 0x3c, 0xda, 0x11, 0x57, 0x3b, 0xab, 0x57, 0x63, 0x1c, 0xda, 0xce,
+  0x55, 0xfe, 0x61, 0xe2, 0xd6, 0x64, 0x1a, 0xc9, 0x0d, 0xf1, 0xc0, 0xad, 0xf4, 0x58, 0xd5, 0x84,
+  0x57, 0xdf, 0xec, 0x1c, 0x7f, 0xf5, 0xf9, 0xa7, 0x9f, 0xfd, 0xdf, 0xff, 0x7c, 0x7a, 0xd8, 0x81,
+  0xc7, 0x15, 0x3a, 0xa1, 0x4f, 0xa4, 0x00, 0x2e, 0x26, 0xd3, 0x3d, 0x7e, 0x7a, 0xf2, 0xec, 0xe4,
+  0xc9, 0xc3, 0x8b, 0xb3, 0xd3, 0x93, 0x0f, 0xc8, 0xf9, 0xd9, 0xe3, 0x8f, 0x1f, 0x3e, 0x03, 0x4a,
+  0x74, 0x35, 0xed, 0xf1, 0x3c, 0xf0, 0xf1, 0xb9, 0x83, 0xaf, 0x37, 0xa0, 0xc4, 0x66, 0xc9, 0x9b,
+  0x4f, 0x98, 0xcf, 0x1d, 0x10, 0xa0, 0x25, 0x3e, 0x2f, 0xa2, 0x54, 0xc4, 0x54, 0x75, 0xab, 0x48,
+  0x39, 0x51, 0x82, 0xb6, 0x86, 0x32, 0xab, 0x43, 0xa3, 0x3b, 0xc4, 0xb1, 0x93, 0xeb, 0x07, 0x70,
+  0x79, 0xac, 0x23, 0x11, 0x3f, 0xd6, 0xbc, 0x6a, 0x7b, 0xc1, 0x29, 0x74, 0xea, 0xe3, 0xdb, 0x58,
+  0xa8, 0x67, 0xfb, 0xed, 0x76, 0x5b, 0x35, 0x15, 0x09, 0x5a, 0xe6, 0x52, 0xf0, 0x0e, 0x0b, 0x8e,
+  0xdf, 0x5a, 0xf1, 0x4d, 0xee, 0x6c, 0x65, 0xca, 0x3d, 0x19, 0xbc, 0xd3, 0x40, 0x8d, 0x86, 0x7b,
+  0xb2, 0xc7, 0x04, 0xc5, 0xcc, 0xf8, 0x1d, 0x01, 0xb1, 0x84, 0x99, 0x72, 0xbe, 0xf4, 0x1a, 0xda,
+  0xad, 0x0e, 0xd7, 0x21, 0x5b, 0xfd, 0xf6, 0xbf, 0x2a, 0xf0, 0xd4, 0xea, 0xbc, 0x97, 0x96, 0xa9,
+  0x7a, 0xc7, 0x27, 0x8f, 0x1f, 0x3e, 0xbb, 0x38, 0x21, 0x27, 0xa7, 0x17, 0x67, 0x1f, 0x9f, 0x00,
+  0x75, 0x7a, 0x9a, 0xa6, 0x8b, 0xd5, 0xbc, 0x9e, 0xb0, 0x30, 0xa4, 0x53, 0xb6, 0x73, 0xbc, 0xaa,
+  0xb1, 0xa7, 0x64, 0xb2, 0x84, 0x4f, 0xc8, 0x68, 0x20, 0xe3, 0x53, 0xff, 0xb0, 0xb3, 0xa8, 0xc4,
+  0x5c, 0x6a, 0x94, 0x63, 0x2f, 0x5f, 0x87, 0xf5, 0x98, 0xe7, 0x0f, 0x92, 0x2e, 0x99, 0xb3, 0x50,
+  0x3b, 0xc4, 0xf7, 0x2c, 0xd7, 0xb1, 0x2e, 0x01, 0x90, 0x75, 0x09, 0x9a, 0xd9, 0x65, 0xf6, 0x94,
+  0xf1, 0xe5, 0x6d, 0xb6, 0x34, 0xd0, 0xf0, 0xe7, 0xab, 0xcf, 0x3f, 0xfb, 0x17, 0x94, 0xa8, 0x87,
+  0x1f, 0x9c, 0x9e, 0x9d, 0x3c, 0x53, 0x0f, 0xda, 0x11, 0xa3, 0xde, 0x45, 0x64, 0x72, 0xec, 0xc7,
+  0x3f, 0xae, 0x78, 0x2f, 0x3d, 0x6f, 0x8c, 0xc6, 0x31, 0xe5, 0xbd, 0x39, 0xde, 0xad, 0xc8, 0x7c,
+  0xb8, 0x1f, 0x91, 0x79, 0x0c, 0x21, 0x67, 0x0f, 0x40, 0xf0, 0xed, 0x46, 0x02, 0x5d, 0x05, 0x84,
+  0x1f, 0x68, 0x8a, 0xb7, 0xef, 0x6b, 0x18, 0x31, 0x73, 0x32, 0x47, 0xb7, 0x40, 0x72, 0x6b, 0x7e,
+  0xd2, 0xa5, 0x84, 0xfe, 0x42, 0x59, 0x7d, 0xf5, 0xf9, 0x2f, 0xff, 0xc0, 0x95, 0x25, 0xbf, 0xca,
+  0xe0, 0x4f, 0x35, 0x2b, 0xa2, 0xe4, 0xa6, 0xbc, 0xd6, 0xc0, 0x7d, 0x9a, 0xa8, 0x9a, 0xdd, 0x21,
+  0xdc, 0x7a, 0x20, 0x3d, 0x33, 0xb1, 0x90, 0xf4, 0x68, 0xbd, 0x2a, 0xf8, 0xb1, 0x73, 0xfc, 0xe5,
+  0x6f, 0x3e, 0x25, 0x1f, 0x80, 0xe9, 0xa2, 0x6e, 0x0d, 0x85, 0xa9, 0x24, 0x01, 0x9a, 0xaa, 0x0a,
+  0xe4, 0xca, 0x9e, 0x4a, 0x29, 0x23, 0x98, 0xdc, 0x85, 0x6f, 0xed, 0x77, 0xd2, 0x29, 0x7f, 0xcc,
+  0x2f, 0x8f, 0x0d, 0xa3, 0x84, 0x48, 0x4a, 0x38, 0x3c, 0x47, 0x9d, 0x17, 0xec, 0xa7, 0x81, 0x8f,
+  0x51, 0x0d, 0xbf, 0x2e, 0xa8, 0xb8, 0x92, 0xbd, 0x64, 0x16, 0x05, 0xf3, 0xb0, 0x2a, 0x0c, 0x5f,
+  0xd3, 0x4b, 0xd3, 0x53, 0xa2, 0x42, 0xb7, 0x02, 0x05, 0x4a, 0xa0, 0xc5, 0xb4, 0x38, 0xe7, 0x57,
+  0xa4, 0x5b, 0x01, 0x50, 0x95, 0x26, 0xaf, 0x71, 0xbe, 0xbd, 0x6d, 0xce, 0xb7, 0xb7, 0xf9, 0x7c,
+  0xcb, 0x24, 0x54, 0x23, 0x36, 0x5a, 0x5d, 0x5a, 0xd4, 0x6f, 0x3c, 0x8e, 0xf2, 0xb1, 0x88, 0x93,
+  0xfc, 0x8d, 0xe8, 0xb7, 0x5f, 0xff, 0x47, 0xa2, 0xdc, 0x10, 0x79, 0xc3, 0xec, 0xde, 0x5d, 0xb1,
+  0xe1, 0x26, 0x71, 0x43, 0xc5, 0xf6, 0x21, 0x4f, 0x39, 0x7f, 0x4d, 0x8a, 0x2d, 0x13, 0xd5, 0xaa,
+  0xa8, 0xd7, 0x56, 0xdb, 0xc1, 0xd8, 0x59, 0x5c, 0x5d, 0x1f, 0xd7, 0xd0, 0x45, 0xe9, 0x6e, 0xba,
+  0x7e, 0xaf, 0xb1, 0x7f, 0x53, 0x43, 0x7b, 0xa5, 0x61, 0x81, 0x9d, 0x74, 0x81, 0xf0, 0xd0, 0xc6,
+  0xfa, 0x61, 0x6b, 0x4b, 0x89, 0x3c, 0x72, 0xe6, 0x0c, 0x48, 0x45, 0xda, 0xae, 0x4e, 0x69, 0x88,
+  0x13, 0x09, 0x02, 0x65, 0xbc, 0x7b, 0x96, 0x38, 0x98, 0x7f, 0xac, 0x41, 0xad, 0xb4, 0xdc, 0x7d,
+  0x1d, 0xb9, 0x66, 0xfd, 0x74, 0x20, 0xe1, 0xc9, 0x3f, 0x05, 0xaf, 0x31, 0xa2, 0xe4, 0x94, 0x05,
+  0x01, 0xb5, 0x29, 0xb8, 0x9f, 0xfd, 0x35, 0x10, 0x16, 0x2b, 0x00, 0xce, 0x3c, 0x36, 0x71, 0x8b,
+  0x37, 0xa5, 0x82, 0x44, 0xdd, 0xfd, 0xdf, 0x8a, 0xf2, 0xf9, 0x45, 0xa2, 0x7c, 0x1e, 0x02, 0xaf,
+  0xd8, 0x3e, 0xf8, 0xea, 0x2e, 0x89, 0x37, 0x88, 0x1b, 0x12, 0x68, 0x13, 0xc5, 0xb0, 0x3a, 0xa4,
+  0x50, 0x55, 0x2f, 0x24, 0xe7, 0x09, 0xea, 0x78, 0x16, 0x69, 0x41, 0xff, 0x6a, 0xe3, 0xf9, 0xd1,
+  0x22, 0x4a, 0x39, 0xa8, 0x9e, 0xd9, 0x4e, 0x0b, 0xf3, 0x77, 0x8e, 0x05, 0x90, 0xbb, 0x4b, 0xf8,
+  0xeb, 0x9a, 0x1c, 0xdf, 0xf3, 0x80, 0x36, 0x30, 0x37, 0x98, 0x1b, 0x87, 0x41, 0x43, 0x72, 0xe1,
+  0x47, 0xb0, 0x2d, 0x0b, 0xbf, 0x79, 0x93, 0xfc, 0xa1, 0x33, 0x71, 0x36, 0x5c, 0xbf, 0x73, 0xf6,
+  0xc5, 0x5f, 0xc0, 0x7f, 0xf8, 0xa1, 0xf3, 0xc8, 0xf9, 0xe6, 0xcd, 0x8f, 0xbf, 0xbb, 0xd2, 0xc3,
+  0x57, 0xbb, 0x6e, 0x34, 0xc7, 0x04, 0xcc, 0x1b, 0xf5, 0xd6, 0x1e, 0xfb, 0x96, 0x48, 0x75, 0xfd,
+  0xad, 0x68, 0xcb, 0x7f, 0x4d, 0xb4, 0xe5, 0x47, 0x63, 0xc7, 0xa2, 0x96, 0xf3, 0xc5, 0x7f, 0x7b,
+  0x6f, 0x50, 0x4b, 0xe6, 0x0e, 0xb3, 0x94, 0xa1, 0x1f, 0x9f, 0x73, 0x09, 0x03, 0x6b, 0xf5, 0xde,
+  0xe1, 0xeb, 0xeb, 0x6b, 0x9e, 0xaa, 0x08, 0xa3, 0x80, 0xb1, 0x08, 0x40, 0xb5, 0xfd, 0x60, 0xda,
+  0x61, 0x37, 0xf8, 0x96, 0xe7, 0x0e, 0x9b, 0x8f, 0x99, 0xdd, 0xc6, 0xd7, 0x46, 0xbf, 0x37, 0x06,
+  0x87, 0xe7, 0xc8, 0xd8, 0xdb, 0x6b, 0xef, 0x8d, 0x76, 0x8d, 0xc1, 0xa8, 0xdd, 0x1d, 0xee, 0xf2,
+  0xab, 0x9e, 0xb8, 0xea, 0x7e, 0x07, 0x36, 0xa5, 0x2c, 0x38, 0x02, 0x00, 0x9e, 0x73, 0xf9, 0x9d,
+  0x39, 0x0d, 0x2e, 0xe1, 0x8a, 0x3f, 0xea, 0x9b, 0x83, 0xfe, 0x48, 0x34, 0x1e, 0xf6, 0x46, 0xf7,
+  0x87, 0xe8, 0xf4, 0x08, 0x4c, 0xaa, 0x49, 0x4c, 0xe6, 0x04, 0xcc, 0x3a, 0x99, 0x81, 0x49, 0xf8,
+  0xde, 0xf4, 0x18, 0x3d, 0x06, 0x9f, 0x3c, 0xf1, 0x03, 0x1f, 0xc3, 0xc2, 0xfc, 0xd6, 0xe1, 0x38,
+  0x28, 0xef, 0x7b, 0x4e, 0x3d, 0xf4, 0x35, 0x82, 0xe5, 0x8b, 0x5d, 0x72, 0x12, 0x4c, 0x99, 0x17,
+  0x39, 0x1e, 0x7d, 0x43, 0xf2, 0x10, 0x1f, 0x71, 0xa9, 0x25, 0x0d, 0x24, 0x7d, 0x97, 0xcd, 0x9b,
+  0x92, 0x8b, 0x2f, 0x7f, 0xfb, 0x6f, 0x99, 0x08, 0x8d, 0x98, 0xc3, 0x32, 0x78, 0xe3, 0xd2, 0x81,
+  0x15, 0x61, 0x55, 0xa3, 0x25, 0x74, 0x4c, 0x44, 0xe5, 0x4e, 0x26, 0x58, 0x18, 0xce, 0xfc, 0xeb,
+  0x0b, 0x3a, 0x6e, 0x36, 0x96, 0xf3, 0x71, 0x80, 0xb6, 0xae, 0xd1, 0x02, 0xd3, 0x1e, 0x7f, 0xae,
+  0x13, 0xf7, 0xa0, 0x63, 0x15, 0x54, 0x2a, 0x0c, 0x29, 0x02, 0x8d, 0x6d, 0xea, 0x16, 0x60, 0x5a,
+  0x16, 0x68, 0x53, 0x81, 0xe9, 0x49, 0xfc, 0x79, 0x3d, 0xc7, 0xea, 0x29, 0xc9, 0x63, 0x08, 0x74,
+  0x9c, 0x4c, 0x7a, 0x27, 0x13, 0x7d, 0x4c, 0x8e, 0x5c, 0x55, 0xa4, 0x70, 0x52, 0x3a, 0x51, 0xc3,
+  0xf8, 0xad, 0x0e, 0xbc, 0x54, 0x89, 0x83, 0x70, 0xb3, 0x96, 0x0b, 0x51, 0x3d, 0xf9, 0xe2, 0x0f,
+  0x37, 0xce, 0x9c, 0x92, 0xe6, 0x5f, 0xff, 0x7c, 0xda, 0x3a, 0xec, 0x88, 0x06, 0xeb, 0x01, 0xf1,
+  0x53, 0x37, 0x24, 0xba, 0x5d, 0xc0, 0xe6, 0xd9, 0x83, 0xa5, 0x4f, 0x82, 0xf7, 0xd6, 0x64, 0x8a,
+  0xd0, 0x9f, 0xd0, 0x9b, 0x1d, 0xc2, 0x4d, 0xf2, 0xd1, 0x8e, 0xd1, 0x1d, 0xe1, 0x3e, 0x9b, 0x2d,
+  0x8e, 0x76, 0xcc, 0xf6, 0x70, 0x67, 0xab, 0x61, 0xa0, 0x4d, 0x67, 0x7f, 0x1a, 0x7c, 0xf1, 0x27,
+  0x7c, 0x39, 0xc8, 0x96, 0xa7, 0x7f, 0x1a, 0x38, 0x51, 0x66, 0xfe, 0xe6, 0xd6, 0xe6, 0x5f, 0x83,
+  0xf9, 0xbf, 0x26, 0x5e, 0x7a, 0xc0, 0xf0, 0xe8, 0xa5, 0x90, 0x4d, 0xd2, 0x0c, 0xd9, 0x74, 0xe9,
+  0xd9, 0x7e, 0xb8, 0x1d, 0x52, 0x72, 0xa8, 0x7c, 0x80, 0x94, 0x98, 0x7d, 0xd3, 0x7c, 0xf3, 0x1c,
+  0x84, 0x32, 0xd3, 0x26, 0xf1, 0xfe, 0xfb, 0x64, 0xec, 0xa4, 0x73, 0xdf, 0xce, 0xb4, 0x31, 0xf4,
+  0x91, 0x15, 0xa0, 0xee, 0xc8, 0x7c, 0xbd, 0x5c, 0x53, 0x48, 0x0a, 0x91, 0xec, 0xa9, 0x86, 0xb4,
+  0x8a, 0x3b, 0xab, 0x4b, 0xe9, 0x15, 0x13, 0x26, 0xac, 0x34, 0x39, 0x24, 0x12, 0x44, 0xbf, 0xfa,
+  0x5f, 0xf2, 0xfd, 0x25, 0x98, 0x24, 0x1a, 0x54, 0x31, 0x7b, 0xe5, 0x19, 0xa3, 0x3a, 0x0a, 0x39,
+  0x36, 0x18, 0x4a, 0x7d, 0x9c, 0x04, 0xfe, 0x92, 0xea, 0x67, 0x3c, 0x5e, 0x52, 0xd5, 0x0c, 0x66,
+  0x8e, 0xdb, 0xad, 0xf5, 0xb8, 0x30, 0xe6, 0x98, 0xef, 0x17, 0xef, 0x2c, 0xbe, 0xfa, 0xfc, 0xb3,
+  0xcf, 0xc8, 0x33, 0x2e, 0x3c, 0xcd, 0x73, 0x27, 0x60, 0x1e, 0xed, 0x3c, 0x5e, 0xbe, 0x68, 0xe9,
+  0x42, 0x8a, 0xe5, 0xc8, 0xa4, 0x66, 0x99, 0xcf, 0x9c, 0xdf, 0x7a, 0x26, 0xc4, 0x26, 0x5d, 0x31,
+  0x71, 0xf7, 0x9c, 0x45, 0xe0, 0xb8, 0x4d, 0x9b, 0x0d, 0xac, 0x82, 0xbb, 0x45, 0x03, 0xb8, 0x3d,
+  0x85, 0xb3, 0x35, 0xba, 0xfc, 0x82, 0xbc, 0xbf, 0x7c, 0xf1, 0x02, 0xbf, 0x54, 0x64, 0x4b, 0xb4,
+  0x10, 0xe0, 0xf4, 0xc4, 0x18, 0xf3, 0xe7, 0xdf, 0x4c, 0x6a, 0xfc, 0xfa, 0x2f, 0xe4, 0x82, 0xb9,
+  0x6c, 0x0a, 0x1b, 0x82, 0xad, 0xd1, 0x23, 0x01, 0xa8, 0xa7, 0x48, 0x14, 0xb7, 0xd8, 0x8c, 0x26,
+  0x95, 0x05, 0x35, 0x76, 0xc2, 0xb6, 0x22, 0xa9, 0x6a, 0x65, 0x96, 0x9c, 0xb9, 0x51, 0x29, 0xb3,
+  0x88, 0x85, 0xd1, 0xfa, 0x44, 0xb7, 0xd0, 0x65, 0xff, 0xf9, 0x47, 0x4c, 0xea, 0x8d, 0x41, 0x95,
+  0x09, 0xed, 0x72, 0x47, 0x15, 0x76, 0x57, 0x4c, 0x57, 0xa2, 0x5d, 0x45, 0xef, 0xfe, 0x81, 0x5c,
+  0x08, 0x16, 0x10, 0x7a, 0xe6, 0x09, 0xf5, 0x96, 0xd4, 0xdd, 0x3e, 0xc6, 0xf1, 0x99, 0x2a, 0x15,
+  0xc2, 0xb5, 0x4a, 0x09, 0x56, 0xe5, 0x04, 0xbc, 0x24, 0xc1, 0xe1, 0x44, 0xa6, 0x01, 0x38, 0xa7,
+  0x27, 0xc8, 0xc2, 0x74, 0x33, 0x73, 0xb1, 0x61, 0xed, 0x01, 0x96, 0x15, 0x64, 0x8b, 0x0f, 0xe2,
+  0x93, 0x07, 0x69, 0xd9, 0x41, 0x7c, 0xec, 0x20, 0xf5, 0x2a, 0xf0, 0x2a, 0x5b, 0x75, 0xb0, 0x38,
+  0x3e, 0xa5, 0xf3, 0x05, 0xec, 0xea, 0xbd, 0xc8, 0x57, 0x7c, 0x81, 0x12, 0xf9, 0xf2, 0x1f, 0xff,
+  0x9d, 0xac, 0x36, 0xe6, 0xbb, 0x99, 0x0d, 0x77, 0x2e, 0x48, 0x0f, 0x70, 0xb4, 0x85, 0x49, 0xe4,
+  0xaa, 0xdb, 0x36, 0xd3, 0xd6, 0x87, 0x1d, 0x81, 0x44, 0x82, 0x74, 0x68, 0x05, 0xce, 0x22, 0x5a,
+  0x41, 0xea, 0x74, 0x92, 0x60, 0x36, 0xac, 0x59, 0x86, 0x2d, 0x5c, 0x16, 0x11, 0x21, 0x7f, 0xe4,
+  0x88, 0xbc, 0x7c, 0x75, 0x90, 0x7b, 0x00, 0xb3, 0x8b, 0x1e, 0x50, 0x40, 0xec, 0x88, 0x78, 0xb0,
+  0x97, 0x3e, 0x78, 0x2b, 0x0b, 0xee, 0xcc, 0x73, 0x60, 0xd1, 0x5c, 0xe7, 0x85, 0x64, 0xdd, 0x6d,
+  0xdf, 0x5a, 0xe2, 0xbc, 0xdb, 0xd4, 0xb6, 0x1f, 0x5e, 0xc1, 0x87, 0xc7, 0x38, 0x03, 0x8f, 0x05,
+  0xcd, 0xc6, 0x83, 0x0f, 0x9f, 0xc4, 0x05, 0x1c, 0x8f, 0x7d, 0xd8, 0x72, 0xdb, 0x8d, 0x5d, 0xd2,
+  0x6c, 0x91, 0xa3, 0x63, 0xf9, 0x4c, 0x71, 0xc0, 0x68, 0xc4, 0xce, 0xd3, 0x2c, 0x56, 0x53, 0xae,
+  0xf3, 0x63, 0x91, 0x35, 0x13, 0x29, 0x3d, 0xe5, 0xa3, 0xc4, 0x55, 0xc9, 0x3f, 0x0a, 0x99, 0x08,
+  0x13, 0x82, 0x9b, 0xd5, 0xcc, 0x40, 0xd8, 0xc5, 0x93, 0x37, 0x66, 0xb6, 0xd0, 0xb2, 0x95, 0x9f,
+  0xe7, 0x69, 0x80, 0x75, 0x82, 0x96, 0xbf, 0xf0, 0x43, 0x5c, 0x04, 0xcf, 0x61, 0x57, 0x4c, 0x54,
+  0x13, 0x82, 0xe7, 0x9b, 0x36, 0x9c, 0x2c, 0x3d, 0x5e, 0x8a, 0xa3, 0x40, 0xbe, 0x78, 0x62, 0x3a,
+  0xe4, 0x34, 0x8f, 0x4f, 0xb4, 0x1d, 0xad, 0x28, 0x36, 0x65, 0xd1, 0x43, 0x97, 0xe1, 0xc7, 0xf7,
+  0x6f, 0xcf, 0xec, 0x66, 0x63, 0x95, 0xc8, 0x6b, 0x14, 0x4a, 0x1d, 0x03, 0xd2, 0xc4, 0x25, 0x72,
+  0xa0, 0xbf, 0x79, 0x00, 0x7f, 0x0e, 0x49, 0x77, 0x08, 0x7f, 0xbf, 0xfb, 0xdd, 0x96, 0xa2, 0x12,
+  0x5f, 0x8c, 0x29, 0xaa, 0x2f, 0x33, 0xe3, 0x09, 0x5c, 0xe3, 0x21, 0x9b, 0x0d, 0xe0, 0x7f, 0x79,
+  0x1c, 0x3e, 0x16, 0x76, 0x6b, 0x73, 0x56, 0xff, 0x00, 0x23, 0x66, 0x47, 0x64, 0x85, 0x58, 0x43,
+  0xd7, 0xdc, 0xc1, 0x82, 0xae, 0x1f, 0x5c, 0x3c, 0x79, 0x8c, 0xcd, 0xbf, 0xfc, 0xfd, 0x3f, 0x69,
+  0x1b, 0x72, 0x7d, 0xdf, 0xe6, 0x75, 0xc7, 0x47, 0xa0, 0xb3, 0xa2, 0x59, 0x3b, 0xc0, 0x72, 0xb5,
+  0x39, 0xd0, 0xed, 0x5d, 0x2c, 0x8c, 0x24, 0xdf, 0x25, 0x8d, 0x77, 0xd6, 0xf4, 0x4e, 0x6b, 0x3b,
+  0x1f, 0x80, 0xaf, 0xc9, 0x57, 0xe1, 0x88, 0x34, 0x7b, 0xd0, 0x53, 0x86, 0xd7, 0x6f, 0x21, 0xb8,
+  0xb0, 0x32, 0x38, 0xae, 0x48, 0x8b, 0x68, 0xf5, 0x75, 0x50, 0xd2, 0x55, 0x6d, 0xd3, 0xc5, 0x82,
+  0x79, 0xf6, 0xe9, 0xcc, 0x71, 0xed, 0x26, 0x87, 0xdd, 0xaa, 0x72, 0xe6, 0xa1, 0x43, 0x1e, 0x21,
+  0x67, 0x92, 0xf8, 0x35, 0x75, 0x98, 0x77, 0x7a, 0x78, 0xfe, 0xb4, 0xdf, 0x4b, 0x5b, 0xd0, 0xf0,
+  0xd6, 0xb3, 0x56, 0xcc, 0x96, 0x93, 0x84, 0x42, 0x7d, 0xf5, 0xad, 0x96, 0x13, 0x02, 0x71, 0x26,
+  0x07, 0xd7, 0x92, 0x5e, 0x53, 0x27, 0x12, 0x80, 0x9a, 0x8d, 0x0e, 0x5d, 0x38, 0x1d, 0x31, 0xb8,
+  0x8a, 0x13, 0x44, 0x67, 0x5b, 0x68, 0x04, 0xd1, 0x31, 0x81, 0xd4, 0xfe, 0x69, 0xe8, 0x7b, 0x4d,
+  0x45, 0x9f, 0x8c, 0x0e, 0xc1, 0x8e, 0xc5, 0x06, 0xcb, 0x05, 0xdc, 0x67, 0x1f, 0x9d, 0x35, 0xf1,
+  0xb1, 0x02, 0x40, 0xe1, 0x86, 0x5e, 0x5c, 0x92, 0x22, 0xc9, 0x46, 0x4b, 0x62, 0xd7, 0xb4, 0x9a,
+  0x52, 0xb1, 0x66, 0x6b, 0xc0, 0x61, 0xf6, 0x15, 0xe0, 0x61, 0x6d, 0x60, 0x52, 0x7c, 0x06, 0x10,
+  0xe3, 0xba, 0x4a, 0xdb, 0x97, 0x00, 0xbe, 0x22, 0x16, 0xc5, 0x05, 0x6c, 0xa2, 0x6e, 0x0f, 0x54,
+  0xa2, 0xb8, 0x09, 0xf6, 0x24, 0xfe, 0x32, 0x92, 0x6d, 0xcd, 0xe2, 0x1c, 0x6b, 0xe7, 0x60, 0x26,
+  0x37, 0xa8, 0xc0, 0x1b, 0xd5, 0x18, 0x14, 0x8c, 0xf3, 0x92, 0x6b, 0xfd, 0x80, 0x7c, 0x74, 0x86,
+  0xbd, 0x71, 0x59, 0x55, 0x8a, 0x30, 0xbf, 0xae, 0x4a, 0x25, 0x28, 0xca, 0x69, 0x62, 0xce, 0x88,
+  0xdf, 0x11, 0x79, 0xa0, 0x6a, 0xc7, 0xbf, 0x7b, 0x2c, 0x6d, 0xc7, 0xaf, 0x0e, 0xf2, 0x8e, 0x26,
+  0x60, 0xa6, 0x2b, 0x83, 0x13, 0x30, 0xb0, 0xec, 0x07, 0x20, 0x88, 0x41, 0xf8, 0x29, 0xaf, 0xe7,
+  0xf4, 0x6a, 0x7a, 0xa0, 0x69, 0xf9, 0xd0, 0x2d, 0xd3, 0xcb, 0x69, 0xe1, 0x58, 0xa3, 0xf0, 0xae,
+  0x68, 0xec, 0x2a, 0x91, 0x19, 0x6f, 0xb6, 0x23, 0xff, 0x91, 0x73, 0xc3, 0xec, 0x66, 0x97, 0x6b,
+  0xa0, 0xbf, 0xfe, 0x59, 0xa2, 0xb6, 0x0a, 0x4a, 0x8e, 0x09, 0x56, 0xb5, 0x6b, 0x52, 0x4f, 0x67,
+  0x42, 0x9a, 0x7c, 0x6e, 0xc7, 0xc4, 0xe8, 0x9a, 0x2a, 0x8e, 0xcb, 0x82, 0x43, 0x5b, 0x8c, 0x86,
+  0xb9, 0xd9, 0x48, 0xde, 0x93, 0xab, 0x92, 0xf3, 0xd2, 0x89, 0x9f, 0xc7, 0xea, 0x41, 0x52, 0xf1,
+  0xbf, 0xf9, 0x34, 0x09, 0xaf, 0xf9, 0x8d, 0xbb, 0x42, 0x14, 0xea, 0x57, 0xbc, 0x0d, 0x08, 0x60,
+  0xe6, 0x0e, 0xe1, 0x17, 0x04, 0x8d, 0xe1, 0xeb, 0x10, 0x73, 0xb3, 0x1f, 0x55, 0x9f, 0x7d, 0xfc,
+  0xc2, 0xc6, 0x2d, 0x4e, 0xfe, 0xc4, 0x06, 0xbf, 0x2e, 0xe2, 0x8e, 0xec, 0x76, 0xe7, 0x9f, 0xbc,
+  0x5b, 0x52, 0x4d, 0x80, 0x97, 0xdb, 0xc2, 0x5f, 0x14, 0x6f, 0x6e, 0x17, 0xf5, 0xa4, 0xb4, 0xaa,
+  0x51, 0x7a, 0x84, 0xb0, 0x74, 0x80, 0x6e, 0x41, 0x6b, 0x65, 0x24, 0xb8, 0x2b, 0x98, 0xde, 0x24,
+  0xef, 0xe5, 0xee, 0x16, 0x85, 0x8d, 0xec, 0x93, 0x86, 0x61, 0x48, 0x68, 0x94, 0x8e, 0xdb, 0x2b,
+  0x1b, 0xb7, 0xa7, 0x1c, 0xb7, 0x57, 0x32, 0xae, 0xac, 0xab, 0x44, 0x34, 0x51, 0xa1, 0x7c, 0xb0,
+  0x5e, 0xe7, 0x43, 0x3c, 0x2c, 0x95, 0x0e, 0x88, 0x77, 0x9e, 0x63, 0x52, 0xf2, 0x40, 0xd3, 0x1c,
+  0x0b, 0x91, 0xca, 0xb4, 0x55, 0xd2, 0xa6, 0xd1, 0xd2, 0x41, 0x40, 0xeb, 0xb0, 0x0e, 0x82, 0xb0,
+  0x20, 0x5a, 0x08, 0xce, 0x9c, 0xad, 0x85, 0x00, 0x6d, 0xd4, 0x10, 0x92, 0x0a, 0xb0, 0x32, 0x08,
+  0x49, 0x9b, 0x46, 0x4b, 0xa2, 0x26, 0xaa, 0x80, 0x84, 0x6a, 0x6a, 0x83, 0x2b, 0xa6, 0x9f, 0xd7,
+  0xa7, 0xab, 0xba, 0x2e, 0x24, 0xad, 0x92, 0xed, 0xe3, 0x6e, 0x92, 0xcd, 0xc4, 0x82, 0x2f, 0x4d,
+  0x73, 0x24, 0x91, 0xdc, 0x3c, 0x1f, 0x36, 0xd6, 0x75, 0x04, 0xca, 0x48, 0x1d, 0x3f, 0xf9, 0x01,
+  0xb5, 0x18, 0xf9, 0xf6, 0x4b, 0x99, 0x09, 0x9e, 0x87, 0xcc, 0x7a, 0x45, 0x92, 0xc0, 0xfb, 0x27,
+  0x45, 0x78, 0x09, 0x9d, 0x64, 0x8d, 0xc7, 0xa7, 0xd9, 0xaa, 0xac, 0x43, 0xca, 0x69, 0x26, 0x6a,
+  0xe1, 0x6a, 0x51, 0xed, 0xb3, 0x5f, 0xd5, 0xa7, 0x5a, 0x5c, 0xec, 0x56, 0x9d, 0x6a, 0x8d, 0x13,
+  0xa4, 0x8c, 0xa6, 0x8f, 0x82, 0x32, 0x01, 0x9b, 0xfb, 0x57, 0x4c, 0x43, 0x9c, 0x82, 0xd0, 0xf2,
+  0x22, 0x36, 0x05, 0xfb, 0x2e, 0x79, 0x69, 0x13, 0x4a, 0x2c, 0xf7, 0x4c, 0xda, 0xe2, 0x1a, 0x57,
+  0x4a, 0xc5, 0xec, 0x33, 0x7f, 0x19, 0x84, 0xc9, 0xa6, 0x62, 0xe2, 0x02, 0x42, 0xcd, 0x18, 0x40,
+  0x87, 0xf4, 0xf7, 0x72, 0x5b, 0xd1, 0x55, 0xa7, 0xb9, 0xe3, 0x49, 0x7d, 0x92, 0x4e, 0xef, 0x88,
+  0x4e, 0xd0, 0x79, 0x4f, 0xee, 0x5a, 0xea, 0x13, 0x8a, 0x7a, 0xac, 0x82, 0x96, 0xfb, 0xe4, 0xdb,
+  0x2f, 0x39, 0x82, 0xaf, 0x66, 0xc0, 0x7c, 0x38, 0xea, 0xab, 0xf9, 0x27, 0x35, 0xa0, 0x8a, 0x6a,
+  0xaa, 0xa2, 0xee, 0x14, 0x84, 0x89, 0xb0, 0x3e, 0xea, 0x39, 0x4f, 0xf2, 0x86, 0x35, 0x80, 0x62,
+  0xf5, 0x92, 0x0e, 0xe4, 0x35, 0x3c, 0x7b, 0x1e, 0x84, 0xa1, 0x83, 0x1a, 0x97, 0xd8, 0xef, 0xcf,
+  0x1b, 0x35, 0x00, 0x27, 0xf5, 0x3e, 0x3a, 0xe0, 0x4e, 0xfc, 0x1c, 0xf4, 0x7c, 0xe3, 0xcb, 0xdf,
+  0xfd, 0x9a, 0x9c, 0x7f, 0xf1, 0x27, 0xae, 0xd2, 0xbf, 0xfc, 0xdd, 0x6f, 0xc0, 0x5e, 0x2a, 0xd4,
+  0xba, 0x22, 0x4a, 0x28, 0xd6, 0x2f, 0x73, 0xca, 0xa9, 0x4c, 0xc9, 0x65, 0x9a, 0xc9, 0xec, 0x88,
+  0x6a, 0x2e, 0x46, 0x8b, 0xb7, 0x7a, 0xae, 0x7e, 0xab, 0x06, 0xdf, 0x24, 0xae, 0xa0, 0xc8, 0x5a,
+  0x40, 0x74, 0xaa, 0xe5, 0xf6, 0x64, 0x0f, 0x32, 0xe9, 0x08, 0x25, 0x30, 0x9a, 0x8b, 0x46, 0x15,
+  0x75, 0x8c, 0x1a, 0xcb, 0x44, 0x22, 0xd5, 0x88, 0x96, 0xef, 0x9a, 0x2d, 0x75, 0xba, 0x49, 0xb5,
+  0x67, 0x4e, 0x42, 0x44, 0xdb, 0xda, 0x33, 0x8b, 0xa1, 0x35, 0x7b, 0x66, 0x11, 0x5c, 0xab, 0xb8,
+  0x5f, 0xae, 0xbe, 0x30, 0xab, 0xe4, 0x3b, 0x2c, 0x8b, 0x78, 0x63, 0xc5, 0x51, 0x3c, 0x9c, 0xd8,
+  0xdf, 0xcc, 0xe9, 0xcd, 0x41, 0x6d, 0x70, 0x98, 0xcc, 0xd6, 0xc0, 0x4b, 0xb6, 0x0c, 0xf5, 0x80,
+  0xae, 0xd2, 0xba, 0x45, 0xb0, 0x82, 0x6f, 0x6c, 0x7c, 0x58, 0x54, 0x97, 0xeb, 0x00, 0xc7, 0x89,
+  0xd3, 0x22, 0xd4, 0x95, 0xb1, 0x04, 0x0a, 0xa8, 0xe1, 0x6a, 0xa2, 0x10, 0x22, 0x80, 0x0e, 0x1e,
+  0xe0, 0x2a, 0xf2, 0xde, 0xd8, 0x4d, 0xc0, 0xf2, 0x24, 0xda, 0x73, 0xe6, 0xd1, 0xb1, 0x5b, 0x78,
+  0x21, 0x8c, 0x0e, 0x84, 0xc8, 0x45, 0xad, 0x60, 0x88, 0xdc, 0x53, 0x4d, 0x20, 0x49, 0x02, 0x67,
+  0x05, 0x26, 0x49, 0xd8, 0x68, 0x00, 0xad, 0x8f, 0x42, 0x20, 0x4b, 0xfb, 0xe0, 0xb0, 0xf3, 0x06,
+  0xcd, 0xc6, 0x43, 0xfc, 0x23, 0x18, 0x1a, 0xbf, 0x04, 0x46, 0x8c, 0xb2, 0x0f, 0xe3, 0x09, 0x00,
+  0xd5, 0x84, 0x30, 0xc9, 0xfa, 0x56, 0x13, 0xc3, 0x6c, 0x4e, 0x59, 0x19, 0x1c, 0xf0, 0xd8, 0xf5,
+  0x69, 0x1a, 0x98, 0x56, 0x6e, 0xeb, 0x70, 0x79, 0xf7, 0xc9, 0x82, 0x06, 0x21, 0x7b, 0xe4, 0xfa,
+  0x34, 0x6a, 0xd6, 0x10, 0x95, 0xd6, 0xae, 0x1a, 0x64, 0xc2, 0xe3, 0xb5, 0xe0, 0x66, 0x65, 0x46,
+  0x01, 0x58, 0xe2, 0xf2, 0x18, 0x34, 0x18, 0x9f, 0x66, 0x3d, 0xb9, 0x51, 0x80, 0x2e, 0xb0, 0x7a,
+  0x45, 0xe0, 0x92, 0xec, 0xb4, 0xf2, 0x0b, 0x2c, 0x19, 0x36, 0xb5, 0x56, 0xd4, 0x2a, 0xc1, 0x5d,
+  0x45, 0x63, 0xfc, 0x99, 0xb3, 0x68, 0xe6, 0xdb, 0x60, 0x3e, 0x9f, 0x7e, 0x78, 0x7e, 0xd1, 0xd8,
+  0x55, 0xb6, 0x11, 0xa5, 0x78, 0xe1, 0x3e, 0x79, 0xc9, 0x63, 0x6c, 0x68, 0x65, 0x8c, 0x8b, 0xdb,
+  0x05, 0x6b, 0x40, 0x37, 0xfc, 0x5e, 0x7a, 0x47, 0xd4, 0xc6, 0x76, 0x50, 0x7b, 0x36, 0xc8, 0x2b,
+  0x35, 0x10, 0xac, 0x85, 0xdb, 0x27, 0x7f, 0x77, 0xfe, 0xe1, 0x07, 0xb0, 0x2d, 0x0d, 0x80, 0xa1,
+  0x9d, 0xc9, 0x6d, 0x33, 0x65, 0xa7, 0x56, 0xa1, 0xcf, 0x2b, 0x85, 0x1c, 0xf2, 0x35, 0x6b, 0x82,
+  0xa5, 0xff, 0x67, 0xa9, 0x8a, 0x81, 0x4c, 0x39, 0x9b, 0x83, 0x87, 0x59, 0x5b, 0xe8, 0x12, 0x98,
+  0xbf, 0xff, 0x25, 0x11, 0x02, 0x47, 0xdd, 0x18, 0x5a, 0x50, 0xd5, 0xd0, 0xc5, 0x19, 0xbe, 0x50,
+  0x64, 0x6e, 0x15, 0x51, 0xb7, 0x7c, 0x66, 0x37, 0x6e, 0xa7, 0x16, 0x30, 0xd1, 0xf4, 0xcc, 0xe6,
+  0xe1, 0x25, 0xfe, 0xb9, 0x01, 0x4e, 0x54, 0xdc, 0x85, 0xbf, 0x17, 0xef, 0x24, 0x6a, 0x9a, 0x60,
+  0xf1, 0xfd, 0x8f, 0xf0, 0x2b, 0xcf, 0x4e, 0x69, 0xc8, 0x9a, 0xad, 0x4c, 0x8b, 0x10, 0x56, 0x83,
+  0x7f, 0xcd, 0x84, 0x16, 0x76, 0x89, 0xab, 0x93, 0x0c, 0xae, 0xec, 0xed, 0x84, 0x27, 0xe2, 0x25,
+  0x65, 0x47, 0x31, 0xa0, 0x8c, 0x83, 0x10, 0xc5, 0xaa, 0x51, 0xed, 0x20, 0x28, 0x80, 0x5d, 0xb2,
+  0x5b, 0xbe, 0x99, 0xe6, 0x48, 0xa3, 0x97, 0x98, 0x28, 0xcd, 0x86, 0x22, 0x75, 0xb4, 0x9e, 0x93,
+  0xd7, 0x71, 0xf1, 0xc6, 0x1c, 0xac, 0xe4, 0xde, 0x97, 0xe4, 0xc7, 0x30, 0x8f, 0x9f, 0xec, 0xaf,
+  0x48, 0xf3, 0x4a, 0x92, 0x59, 0xf5, 0xab, 0x42, 0xa4, 0x68, 0x6c, 0x6c, 0x57, 0x1c, 0x7b, 0x57,
+  0x54, 0x1b, 0x95, 0x31, 0x46, 0xc9, 0xe2, 0x39, 0xb6, 0xc2, 0x39, 0x55, 0x02, 0xe4, 0xea, 0x43,
+  0x5e, 0xc2, 0x12, 0x4f, 0x54, 0xeb, 0x2d, 0x16, 0x80, 0xdc, 0xcd, 0x51, 0xc4, 0x57, 0x24, 0x16,
+  0x89, 0x93, 0xd4, 0x8a, 0x46, 0x74, 0x2c, 0x4f, 0x20, 0x25, 0xc1, 0xcf, 0x60, 0x4b, 0x7a, 0x7b,
+  0xce, 0x5f, 0x32, 0xee, 0x07, 0x27, 0xae, 0xdb, 0x6c, 0x88, 0xd7, 0x2b, 0xe2, 0xbf, 0xa0, 0x46,
+  0x27, 0x7e, 0xf0, 0x90, 0x02, 0xff, 0x44, 0x98, 0xce, 0x8c, 0x4a, 0xf0, 0xd4, 0xed, 0xd1, 0x8a,
+  0xf0, 0x7f, 0xec, 0xd8, 0xff, 0x20, 0xaa, 0x5a, 0x7f, 0x52, 0x1c, 0x40, 0xc4, 0xdb, 0x92, 0x6f,
+  0xe5, 0x03, 0x09, 0xc6, 0x42, 0x89, 0x52, 0x69, 0x60, 0x98, 0x8b, 0x05, 0x6c, 0x03, 0x58, 0xcc,
+  0x6a, 0x8b, 0xa1, 0x0f, 0x90, 0xc1, 0x94, 0x41, 0x92, 0xf0, 0x6d, 0x82, 0x7a, 0x35, 0x81, 0x4f,
+  0x13, 0x15, 0xd1, 0x2a, 0xe2, 0x8b, 0x6f, 0x3f, 0x6b, 0x1c, 0x68, 0x93, 0x0c, 0xa2, 0x44, 0x44,
+  0xe7, 0x3c, 0x14, 0x0b, 0x0d, 0xe4, 0x37, 0xe9, 0x15, 0x8c, 0x13, 0x57, 0xbe, 0x1d, 0xe8, 0x88,
+  0x52, 0x2d, 0x49, 0x71, 0xc1, 0x02, 0x68, 0x32, 0xcc, 0x19, 0x24, 0x25, 0x84, 0x32, 0x45, 0x25,
+  0x15, 0x31, 0xc1, 0x1e, 0xaf, 0x07, 0x95, 0x6c, 0xd5, 0x88, 0x3a, 0xf7, 0xbc, 0x0c, 0xf0, 0x0d,
+  0x43, 0x08, 0x14, 0xa5, 0x3c, 0xc9, 0xd0, 0xbd, 0x17, 0x67, 0x56, 0xde, 0x8b, 0x3d, 0x5d, 0x80,
+  0xf5, 0xf3, 0x9f, 0xe3, 0x8b, 0x6f, 0xe4, 0xaf, 0xba, 0x2c, 0x4e, 0x29, 0x88, 0x3d, 0xe5, 0x6f,
+  0x8e, 0xba, 0xc4, 0xf7, 0xfc, 0x7c, 0x2b, 0x37, 0xd1, 0x12, 0x85, 0x59, 0x4a, 0x67, 0x51, 0x5d,
+  0x91, 0xd4, 0x53, 0x1c, 0x76, 0xc4, 0xab, 0x74, 0x0e, 0x3b, 0x78, 0x10, 0xe4, 0xf8, 0xad, 0xff,
+  0x07, 0x88, 0xc6, 0x7b, 0x3d, 0x57, 0x8c, 0x00, 0x00,
+};
+
+#endif
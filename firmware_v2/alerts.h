@@ -17,6 +17,7 @@
 
 #include "config.h"
 #include "types.h"
+#include "log.h"
 
 extern Config config;
 extern SensorData sensorData;
@@ -24,8 +25,11 @@ extern SystemState state;
 
 extern void setRelay(int relayIndex, bool on);
 extern void sendTelegramAlert(String message);
+extern void sendTelegramAlert(const char* key, uint8_t priority, String message);
 extern void sendAlertToSupabase(String alertType, String severity, String message);
+extern void transportSendAlert(String alertType, String severity, String message);
 extern void changeState(SystemStateEnum newState, const char* reason);
+extern void statusNotify();
 
 // Variables de tracking de alertas
 static unsigned long highTempAccumulatedSec = 0;
@@ -48,9 +52,9 @@ void triggerAlert(String message, bool critical = true) {
     state.totalAlerts++;
     state.alertAcknowledged = false;
     
-    Serial.println("🚨 ════════════════════════════════════════");
-    Serial.println("🚨 [ALERTA] " + message);
-    Serial.println("🚨 ════════════════════════════════════════");
+    LOG_W("🚨 ════════════════════════════════════════");
+    LOG_W("🚨 [ALERTA] %s", message.c_str());
+    LOG_W("🚨 ════════════════════════════════════════");
     
     // Activar sirena (relé 1)
     if (config.relayEnabled) {
@@ -62,24 +66,20 @@ void triggerAlert(String message, bool critical = true) {
         digitalWrite(PIN_BUZZER, HIGH);
     }
     
-    // Enviar a Telegram (con rate limit de 5 minutos)
-    if (config.telegramEnabled && state.internetAvailable) {
-        unsigned long now = millis();
-        if (now - state.lastTelegramAlert > 300000) {
-            String telegramMsg = "🚨 *ALERTA " + String(critical ? "CRÍTICA" : "WARNING") + "*\n\n";
-            telegramMsg += "📍 *Dispositivo:* " + String(DEVICE_ID) + "\n";
-            telegramMsg += "📝 " + message + "\n";
-            telegramMsg += "🌡️ *Temp actual:* " + String(sensorData.tempAvg, 1) + "°C";
-            
-            sendTelegramAlert(telegramMsg);
-            state.lastTelegramAlert = now;
-        }
+    // Enviar a Telegram (la cola coalesce repetidas y reintenta sin internet)
+    if (config.telegramEnabled) {
+        String telegramMsg = "🚨 *ALERTA " + String(critical ? "CRÍTICA" : "WARNING") + "*\n\n";
+        telegramMsg += "📍 *Dispositivo:* " + String(DEVICE_ID) + "\n";
+        telegramMsg += "📝 " + message + "\n";
+        telegramMsg += "🌡️ *Temp actual:* " + String(sensorData.tempAvg, 1) + "°C";
+        
+        sendTelegramAlert("temperature", critical ? TG_PRIO_CRITICAL : TG_PRIO_NORMAL, telegramMsg);
+        state.lastTelegramAlert = millis();
     }
     
-    // Enviar a Supabase
-    if (config.supabaseEnabled && state.internetAvailable) {
-        sendAlertToSupabase("temperature", critical ? "critical" : "warning", message);
-    }
+    // Enviar a Supabase / broker MQTT (según config.transport)
+    transportSendAlert("temperature", critical ? "critical" : "warning", message);
+    statusNotify();
 }
 
 // ============================================================================
@@ -100,7 +100,8 @@ void clearAlert() {
     // Volver a estado NORMAL
     changeState(STATE_NORMAL, "Alerta resuelta");
     
-    Serial.println("✅ [ALERTA] Alerta desactivada - Condiciones normalizadas");
+    LOG_I("✅ [ALERTA] Alerta desactivada - Condiciones normalizadas");
+    statusNotify();
 }
 
 // ============================================================================
@@ -115,7 +116,8 @@ void acknowledgeAlert() {
     setRelay(0, false);
     digitalWrite(PIN_BUZZER, LOW);
     
-    Serial.println("🔕 [ALERTA] Alerta reconocida - Sirena silenciada");
+    LOG_I("🔕 [ALERTA] Alerta reconocida - Sirena silenciada");
+    statusNotify();
 }
 
 // ============================================================================
@@ -185,16 +187,16 @@ void checkDoorAlerts() {
                     msg += " (máximo: " + String(config.doorOpenMaxSec / 60) + " min)";
                     
                     // Enviar a Telegram
-                    if (config.telegramEnabled && state.internetAvailable) {
-                        sendTelegramAlert("⚠️ *ALERTA PUERTA*\n\n" + msg);
+                    if (config.telegramEnabled) {
+                        char key[12];
+                        snprintf(key, sizeof(key), "door_%d", i + 1);
+                        sendTelegramAlert(key, TG_PRIO_HIGH, "⚠️ *ALERTA PUERTA*\n\n" + msg);
                     }
                     
-                    // Enviar a Supabase
-                    if (config.supabaseEnabled && state.internetAvailable) {
-                        sendAlertToSupabase("door", "warning", msg);
-                    }
+                    // Enviar a Supabase / broker MQTT
+                    transportSendAlert("door", "warning", msg);
                     
-                    Serial.println("⚠️ [PUERTA] " + msg);
+                    LOG_W("⚠️ [PUERTA] %s", msg.c_str());
                 }
             }
         } else {
@@ -214,11 +216,11 @@ void checkAlerts() {
         static unsigned long lastSuspendedLog = 0;
         if (millis() - lastSuspendedLog > 30000) {
             lastSuspendedLog = millis();
-            Serial.printf("[ALERTS] Monitoreo suspendido - Estado: %s\n", state.stateName);
+            LOG_D("[ALERTS] Monitoreo suspendido - Estado: %s", state.stateName);
             
             if (state.currentState == STATE_COOLDOWN) {
-                Serial.printf("[ALERTS] Cooldown restante: %d segundos\n", 
-                              state.cooldownRemainingSeconds);
+                LOG_D("[ALERTS] Cooldown restante: %d segundos",
+                      state.cooldownRemainingSeconds);
             }
         }
         return;
@@ -0,0 +1,152 @@
+/*
+ * ============================================================================
+ * API_FORMAT.H - PROYECCIÓN (?fields=) Y MESSAGEPACK EN LA API LOCAL v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * Las apps móviles solo miran temperatura, puerta y alerta, pero
+ * /api/status trae sistema, red, config y estadísticas en cada poll.
+ * En /api/status, /api/config y /api/history se puede pedir:
+ *
+ *   ?fields=sensor.temp_avg,sensor.door_open,system.alert_active
+ *       → solo esos campos: "grupo" entero o "grupo.campo". En
+ *         /api/history son campos de cada punto (?fields=temp,door_open)
+ *   Accept: application/msgpack   (también x-msgpack / vnd.msgpack)
+ *       → el mismo documento en MessagePack en vez de JSON
+ *
+ * Sin ninguno de los dos se sirve el JSON ya armado tal cual, sin parsear.
+ * Con alguno, el handler parsea ese JSON con un filtro de ArduinoJson
+ * (el documento solo guarda los campos pedidos) y lo vuelve a escribir en
+ * el formato pedido directo en la respuesta. Los campos que no existen se
+ * ignoran. /api/status conserva siempre "version" (?since= y ETag).
+ *
+ * CBOR no: MessagePack ya viene en ArduinoJson, sin otra librería.
+ *
+ * ============================================================================
+ */
+
+#ifndef API_FORMAT_H
+#define API_FORMAT_H
+
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+#include "config.h"
+#include "json_writer.h"
+
+#define API_MSGPACK_MIME "application/msgpack"
+
+// ============================================================================
+// ESTRUCTURAS
+// ============================================================================
+struct ApiFormat {
+    bool msgpack;
+    bool projected;
+    char fields[API_FIELDS_MAX_LEN + 1];
+};
+
+struct ApiFormatStats {
+    uint32_t projected;
+    uint32_t msgpack;
+    uint32_t errors;                // ?fields= muy largo o documento que no entra
+    uint32_t lastBytes;             // Última respuesta proyectada / MessagePack
+};
+
+ApiFormatStats apiFormatStats = {};
+
+// ============================================================================
+// PEDIDO (tarea AsyncTCP)
+// ============================================================================
+// Lee ?fields= y Accept. Devuelve false si ?fields= es demasiado largo.
+bool apiParseFormat(AsyncWebServerRequest* request, ApiFormat& fmt) {
+    fmt.msgpack = false;
+    fmt.projected = false;
+    fmt.fields[0] = '\0';
+
+    if (request->hasHeader("Accept")) {
+        // application/msgpack, application/x-msgpack, application/vnd.msgpack
+        fmt.msgpack = request->header("Accept").indexOf("msgpack") >= 0;
+    }
+    if (request->hasParam("fields")) {
+        const String& fields = request->getParam("fields")->value();
+        if (fields.length() > API_FIELDS_MAX_LEN) {
+            apiFormatStats.errors++;
+            return false;
+        }
+        strlcpy(fmt.fields, fields.c_str(), sizeof(fmt.fields));
+        fmt.projected = fmt.fields[0] != '\0';
+    }
+    return true;
+}
+
+// Sin proyección ni MessagePack: se copia el JSON ya armado
+bool apiIsPlain(const ApiFormat& fmt) {
+    return !fmt.msgpack && !fmt.projected;
+}
+
+// ============================================================================
+// FILTRO
+// ============================================================================
+// Agrega a node los campos de la lista ("grupo" o "grupo.campo"). Las
+// claves son char*: ArduinoJson las copia al documento del filtro.
+void apiAddFields(JsonObject node, const char* fields) {
+    char list[API_FIELDS_MAX_LEN + 1];
+    strlcpy(list, fields, sizeof(list));
+
+    char* save = nullptr;
+    for (char* item = strtok_r(list, ",", &save); item; item = strtok_r(nullptr, ",", &save)) {
+        while (*item == ' ') item++;
+        if (!*item) continue;
+
+        char* dot = strchr(item, '.');
+        if (!dot) {
+            node[item] = true;
+            continue;
+        }
+        *dot = '\0';
+        char* field = dot + 1;
+        if (!*item || !*field) continue;
+
+        JsonVariant group = node[item];
+        if (group.is<bool>()) continue;             // Ya va el grupo entero
+        JsonObject obj = group.is<JsonObject>() ? group.as<JsonObject>()
+                                                : node.createNestedObject(item);
+        obj[field] = true;
+    }
+}
+
+// ============================================================================
+// SALIDA
+// ============================================================================
+// Parsea json (lo modifica: el documento apunta a sus claves y textos, sin
+// copiarlos) con el filtro, si hay, y lo escribe en out en el formato
+// pedido. Devuelve los bytes escritos; 0 si no entra en docBytes.
+size_t apiRender(char* json, size_t len, JsonDocument* filter, const ApiFormat& fmt,
+                 size_t docBytes, Print& out) {
+    DynamicJsonDocument doc(docBytes);
+    DeserializationError err = filter
+        ? deserializeJson(doc, json, len, DeserializationOption::Filter(*filter))
+        : deserializeJson(doc, json, len);
+    if (err) {
+        apiFormatStats.errors++;
+        Serial.printf("[API] ✗ Proyección: %s (%u bytes de documento)\n", err.c_str(), (unsigned)docBytes);
+        return 0;
+    }
+
+    size_t n = fmt.msgpack ? serializeMsgPack(doc, out) : serializeJson(doc, out);
+    if (fmt.projected) apiFormatStats.projected++;
+    if (fmt.msgpack) apiFormatStats.msgpack++;
+    apiFormatStats.lastBytes = n;
+    return n;
+}
+
+// ============================================================================
+// JSON DE ESTADÍSTICAS (para /api/status → web)
+// ============================================================================
+void writeApiFormatStatsJSON(JsonWriter& w) {
+    w.field(JK(projected), apiFormatStats.projected);
+    w.field(JK(msgpack), apiFormatStats.msgpack);
+    w.field(JK(format_errors), apiFormatStats.errors);
+    w.field(JK(format_last_bytes), apiFormatStats.lastBytes);
+}
+
+#endif
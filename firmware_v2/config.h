@@ -45,6 +45,20 @@
 #define AP_PASSWORD         "reefer1234"
 #define AP_TIMEOUT          180
 
+// Redes WiFi conocidas, en orden de preferencia (ver wifi_utils.h).
+// La red guardada por el portal de WiFiManager va siempre primera;
+// estas son las alternativas si no está o se oye mal.
+struct WiFiNetwork {
+    const char* ssid;
+    const char* password;
+};
+
+const WiFiNetwork WIFI_NETWORKS[] = {
+    // {"Reefer-AP-Galpon", "clave1"},
+    // {"Campamento-Admin", "clave2"},
+    {nullptr, nullptr}              // Fin de lista
+};
+
 // mDNS - Acceso por nombre
 #define MDNS_NAME           "reefer"
 
@@ -52,10 +66,54 @@
 #define TELEGRAM_BOT_TOKEN  "8175168657:AAE5HJBnp4Hx6LOECBh7Ps3utw35WMRdGnI"
 #define TELEGRAM_CHAT_ID    "7713503644"
 
+// Destinatarios de alertas (máximo 8, ver telegram.h)
+const char* TELEGRAM_CHAT_IDS[] = {
+    TELEGRAM_CHAT_ID,
+};
+const int TELEGRAM_CHAT_COUNT = 1;
+
 // Supabase
 #define SUPABASE_URL        "https://xhdeacnwdzvkivfjzard.supabase.co"
 #define SUPABASE_ANON_KEY   "sb_publishable_JhTUv1X2LHMBVILUaysJ3g_Ho11zu-Q"
 
+// Compresión gzip de los bodies subidos (ahorra datos en GPRS/enlaces medidos)
+// Requiere que el gateway acepte "Content-Encoding: gzip" en requests
+#define SUPABASE_GZIP_ENABLED   false
+#define SUPABASE_GZIP_MIN_BYTES 256     // No comprimir bodies más chicos
+#define SUPABASE_GZIP_MAX_BYTES 2048    // Buffer de salida comprimida
+
+// MQTT - Broker del sitio (alternativa a HTTP/PostgREST por lectura)
+// Tópicos: MQTT_TOPIC_PREFIX/DEVICE_ID/{readings,events,status,cmd}
+#define MQTT_BROKER_HOST    "192.168.1.10"
+#define MQTT_BROKER_PORT    1883
+#define MQTT_USER           ""
+#define MQTT_PASSWORD       ""
+#define MQTT_TOPIC_PREFIX   "reefer"
+
+// Transporte de lecturas y eventos (se cambia en runtime desde /api/config)
+typedef enum {
+    TRANSPORT_HTTP = 0,             // Supabase REST (PostgREST)
+    TRANSPORT_MQTT                  // Broker MQTT, QoS1, sesión persistente
+} TransportType;
+
+#define DEFAULT_TRANSPORT   TRANSPORT_HTTP
+
+// SIM800L - Módem GSM (sim800.h): SMS de emergencia y, con GPRS_ENABLED,
+// respaldo de subidas. GPRS_ENABLED lo enciende aunque esto quede en false.
+// ATENCIÓN: sim800.h usa GPIO16/17 (UART2), los mismos que PIN_DOOR_3 y
+// PIN_DOOR_2. Con el módem habilitado esas puertas deben ir a otros pines.
+#define SIM800_ENABLED      false
+
+// GPRS - Respaldo por SIM800 cuando se cae el WiFi (ver gprs_uploader.h)
+#define GPRS_ENABLED        false
+#define GPRS_APN            "internet"      // APN del operador
+#define GPRS_APN_USER       ""
+#define GPRS_APN_PASSWORD   ""
+#define GPRS_UPLOAD_URL     SUPABASE_URL    // O un relay HTTP si el TLS del módem no alcanza
+
+#define GPRS_MONTHLY_BUDGET_BYTES   (10UL * 1024 * 1024)  // Plan de datos: 10 MB/mes
+#define GPRS_READINGS_BUDGET_PCT    80      // Desde acá solo se suben eventos
+
 // ============================================================================
 // SECCIÓN 3: MAPA DE PINES ESP32-WROOM-32 (38 pines)
 // ============================================================================
@@ -285,10 +343,19 @@ typedef enum {
 #define INTERVAL_STATUS_PRINT_MS    5000    // Imprimir status cada 5 seg
 #define INTERVAL_DEFROST_CHECK_MS   500     // Verificar defrost cada 500ms
 #define INTERVAL_ALERT_CHECK_MS     1000    // Verificar alertas cada 1 seg
-#define INTERVAL_INTERNET_CHECK_MS  30000   // Verificar internet cada 30 seg
+#define INTERVAL_WIFI_RSSI_CHECK_MS 10000   // Revisar RSSI del AP actual cada 10 seg
+#define NET_PROBE_BASE_MS           15000   // Primera sonda con circuito abierto (x2 por falla)
+#define NET_PROBE_MAX_MS            300000  // Tope del backoff de sondas: 5 min
+#define NET_PROBE_TIMEOUT_MS        2000    // TCP connect de la sonda
+#define NET_DNS_TTL_MS              600000  // Caché DNS por endpoint: 10 min
+#define NET_TRIAL_TIMEOUT_MS        30000   // HALF_OPEN: prueba sin informar, se habilita otra
 #define INTERVAL_SUPABASE_SYNC_MS   5000    // Sincronizar Supabase cada 5 seg
 #define INTERVAL_HISTORY_UPDATE_MS  60000   // Actualizar historial cada 1 min
 #define INTERVAL_DEVICE_STATUS_MS   60000   // Actualizar estado dispositivo cada 1 min
+#define INTERVAL_MQTT_PUBLISH_MS    5000    // Publicar lectura MQTT cada 5 seg
+#define INTERVAL_MQTT_RECONNECT_MS  5000    // Reintentar broker cada 5 seg
+#define GPRS_FAILOVER_DELAY_MS      30000   // WiFi caído 30 seg antes de abrir GPRS
+#define GPRS_READING_INTERVAL_MS    300000  // Por GPRS, una lectura cada 5 min
 
 // ============================================================================
 // SECCIÓN 7: LÍMITES DEL SISTEMA
@@ -296,8 +363,68 @@ typedef enum {
 
 #define HISTORY_SIZE                60      // Puntos de historial (1 hora a 1/min)
 #define MAX_ALERTS_QUEUE            10      // Cola de alertas pendientes
-#define JSON_BUFFER_SIZE            2048    // Buffer para JSON
 #define MAX_WIFI_RETRIES            3       // Reintentos de conexión WiFi
+#define NET_FAILURE_THRESHOLD       3       // Fallas seguidas que abren el circuito
+
+// Reconexión WiFi (wifi_utils.h)
+#define WIFI_FAST_TIMEOUT_MS        1500    // Reconexión rápida (BSSID + canal + IP cacheados)
+#define WIFI_CONNECT_TIMEOUT_MS     10000   // Conexión completa con DHCP
+#define WIFI_DHCP_RENEW_DELAY_MS    5000    // Tras la rápida (IP cacheada): pasar a DHCP para renovar la concesión
+#define WIFI_BACKOFF_MAX_MS         30000   // Tope de espera entre escaneos fallidos
+#define WIFI_MAX_NETWORKS           6       // Red de WiFiManager + WIFI_NETWORKS
+#define WIFI_RSSI_FAILOVER_DBM      -78     // Por debajo se buscan alternativas...
+#define WIFI_RSSI_WEAK_CHECKS       3       // ...si se sostiene N chequeos seguidos
+#define WIFI_RSSI_HYSTERESIS_DB     8       // La alternativa debe ser al menos así de mejor
+#define MQTT_OFFLINE_SLOTS          32      // Mensajes guardados sin broker
+#define MQTT_MSG_MAX_BYTES          192     // Tamaño máximo de un mensaje MQTT
+#define MQTT_CMD_SLOTS              8       // Comandos recibidos en una vuelta de mqtt.loop() (backlog de la sesión)
+
+// Servidor web asíncrono (web_api.h)
+#define WEB_MAX_CONNECTIONS         8       // Requests en curso (3 apps + dashboard + margen)
+#define WEB_MAX_BODY_BYTES          1024    // Cuerpo máximo de un POST
+#define WEB_MIN_FREE_HEAP           24576   // Debajo de esto se rechaza con 503
+#define WEB_CMD_QUEUE_LEN           8       // Mutaciones esperando al loop
+#define WEB_SNAPSHOT_INTERVAL_MS    5000    // Refresco sin cambios (uptime, RSSI); los cambios publican al instante
+#define WEB_CONFIG_BYTES            768     // JSON de /api/config
+#define WEB_STREAM_CHUNK            1460    // Buffer inicial de respuestas escritas en streaming (1 MSS)
+#define WEB_ASSET_CACHE_CONTROL     "public, max-age=3600"  // Página: 1 h en caché, después revalida por ETag
+
+// Caché versionado de /api/status (status_cache.h)
+#define STATUS_CACHE_BYTES          4096    // Por buffer (hay 2); con network completo ronda 3 KB
+#define STATUS_LONGPOLL_MAX         4       // ?since= esperando a la vez (cuentan en WEB_MAX_CONNECTIONS)
+#define STATUS_LONGPOLL_MS          25000   // Espera máxima de un ?since=
+#define STATUS_OVERFLOW_LOG_MS      60000   // Un aviso de JSON que no entra por minuto como mucho
+
+// ?fields= y MessagePack en la API (api_format.h)
+#define API_FIELDS_MAX_LEN          128     // Largo máximo de ?fields=
+#define API_FILTER_BYTES            512     // Filtro armado desde ?fields=
+#define API_DOC_BYTES               4096    // /api/status o /api/config parseado (sin copiar textos, heap)
+#define API_HISTORY_BYTES           6144    // JSON de /api/history antes de proyectar (heap)
+#define API_HISTORY_DOC_BYTES       6144    // /api/history parseado: 60 puntos de 5 campos (heap)
+
+// Métricas /metrics (metrics.h)
+#define METRICS_SAMPLE_MS           1000    // Muestreo de colas de subida
+
+// Log serial (log.h)
+#define LOG_BAUD                    115200
+#define LOG_LEVEL                   3       // 0 nada, 1 errores, 2 +advertencias, 3 +info, 4 +depuración
+#define LOG_TX_BUFFER_BYTES         8192    // Ring TX de la UART (~0.7 s a 115200)
+#define LOG_LINE_MAX                192     // Línea formateada (en el stack)
+#define LOG_STATUS_BYTES            6144    // printStatusJSON armado entero antes de escribir (estático, compacto ~4 KB)
+#define STATUS_JSON_DOC_BYTES       6144    // Documento de printStatusJSON: ~230 miembros con todo habilitado (estático)
+
+// Tramas binarias por serial (serial_frame.h)
+#define SERIAL_FRAME_MAX_HZ         50      // Tope de muestras por segundo
+#define SERIAL_FRAME_MAX_PAYLOAD    250     // Payload máximo de una trama (stack)
+#define SERIAL_FRAME_IDLE_MS        10000   // Sin tramas del host: vuelve a texto
+
+// Stream en vivo /api/stream (live_stream.h)
+#define STREAM_MAX_CLIENTS          4       // Conexiones SSE abiertas a la vez
+#define STREAM_HISTORY              32      // Deltas guardados para retomar con Last-Event-ID
+#define STREAM_KEEPALIVE_MS         15000   // Keepalive (uptime/RSSI) sin cambios
+#define STREAM_DOC_BYTES            6144    // /api/status parseado (claves y textos copiados, ~3 KB de JSON); hay 3 (estáticos)
+#define STREAM_ERROR_LOG_MS         60000   // Un LOG_E por minuto como mucho si no se puede parsear o armar el delta
+#define STREAM_RETRY_MS             1000    // Reintento que se le indica al navegador
 
 // ============================================================================
 // SECCIÓN 8: CONFIGURACIÓN DE SIMULACIÓN (para testing)
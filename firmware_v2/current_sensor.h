@@ -185,6 +185,13 @@ void currentSensorCheck() {
   // (esto requiere lógica adicional basada en temperatura)
 }
 
+// ============================================
+// ÚLTIMA CORRIENTE RMS (tramas SAMPLE de serial_frame.h)
+// ============================================
+float currentSensorRms() {
+  return currentState.currentAmps;
+}
+
 // ============================================
 // OBTENER HORAS DE FUNCIONAMIENTO
 // ============================================
@@ -7,15 +7,30 @@
  * ARQUITECTURA MODULAR:
  * - config.h        : Configuración centralizada (device_id, pines, umbrales)
  * - types.h         : Estructuras de datos y enums
+ * - log.h           : Log serial no bloqueante con niveles (LOG_E/W/I/D)
+ * - serial_frame.h  : Telemetría binaria por serial (COBS + CRC16, hasta 50 Hz)
  * - state_machine.h : Máquina de estados del sistema
  * - sensors.h       : Lectura de sensores (temp, puertas, DHT22)
  * - storage.h       : Almacenamiento en flash (Preferences)
  * - alerts.h        : Lógica de alertas y alarmas
  * - telegram.h      : Notificaciones Telegram
  * - supabase.h      : Integración con Supabase
+ * - gzip_stream.h   : Compresión gzip de uploads
+ * - mqtt_transport.h: Transporte MQTT (alternativa a Supabase REST)
+ * - sim800.h        : Motor AT no bloqueante del módem SIM800L
+ * - gprs_uploader.h : Subidas por GPRS cuando se cae el WiFi (GPRS_ENABLED)
  * - wifi_utils.h    : Gestión de WiFi
+ * - net_health.h    : Salud de conectividad por endpoint (circuit breaker)
  * - web_api.h       : Servidor web y API REST
- * - html_ui.h       : Página HTML embebida
+ * - serial_api.h    : Tabla de comandos (Serial, tramas COMMAND, /api/command)
+ * - json_writer.h   : Escritor JSON en streaming para las respuestas de la API
+ * - api_format.h    : ?fields= y MessagePack en /api/status, /api/config, /api/history
+ * - status_cache.h  : Snapshot versionado de /api/status (ETag, long-poll)
+ * - live_stream.h   : Stream en vivo por SSE (/api/stream)
+ * - metrics.h       : Métricas internas en formato Prometheus (/metrics)
+ * - profiler.h      : Perfil del loop por subsistema (PROFILE, /api/profile)
+ * - html_ui.h       : Página HTML (fuente de web_assets.h, no se compila)
+ * - web_assets.h    : html_ui.h en gzip + ETag (tools/gen_web_assets.py)
  * 
  * ESTADOS DEL SISTEMA:
  * - NORMAL: Operación normal, monitoreando
@@ -44,7 +59,8 @@
 #include <WiFiManager.h>
 #include <WiFiUdp.h>
 #include <ESPmDNS.h>
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 #include <OneWire.h>
@@ -61,7 +77,7 @@
 // ============================================================================
 // OBJETOS GLOBALES
 // ============================================================================
-WebServer server(80);
+AsyncWebServer server(80);
 WiFiManager wifiManager;
 WiFiUDP udpDiscovery;
 Preferences prefs;
@@ -87,7 +103,9 @@ int historyIndex = 0;
 void setRelay(int relayIndex, bool on);
 void setRelayAll(bool on);
 void sendTelegramAlert(String message);
+void sendTelegramAlert(const char* key, uint8_t priority, String message);
 void sendAlertToSupabase(String alertType, String severity, String message);
+void transportSendAlert(String alertType, String severity, String message);
 void supabaseSendDefrostStart(float tempAtStart, const char* triggeredBy);
 void supabaseSendDefrostEnd(float tempAtEnd, unsigned long durationMin);
 void acknowledgeAlert();
@@ -97,20 +115,32 @@ void saveConfig();
 void loadConfig();
 bool testTelegram();
 void resetWiFi();
-String getEmbeddedHTML();
+void statusNotify();
 
 // ============================================================================
 // INCLUIR MÓDULOS
 // ============================================================================
+#include "log.h"
+#include "serial_frame.h"
+#include "metrics.h"
+#include "profiler.h"
 #include "state_machine.h"
-#include "html_ui.h"
 #include "storage.h"
+#include "net_health.h"
 #include "telegram.h"
 #include "supabase.h"
+#if SIM800_ENABLED || GPRS_ENABLED
+#include "sim800.h"
+#endif
+#if GPRS_ENABLED
+#include "gprs_uploader.h"
+#endif
+#include "mqtt_transport.h"
 #include "sensors.h"
 #include "alerts.h"
 #include "wifi_utils.h"
 #include "web_api.h"
+#include "serial_api.h"
 
 // ============================================================================
 // CONTROL DE RELÉS
@@ -210,8 +240,35 @@ void updateHistory() {
 // ============================================================================
 // IMPRIMIR ESTADO COMPLETO POR SERIAL (JSON)
 // ============================================================================
+// Estado armado que espera lugar en el ring TX (lo reintenta statusFlush)
+char statusText[LOG_STATUS_BYTES];
+size_t statusPendingLen = 0;
+uint32_t statusDropped = 0;         // Estados reemplazados por el siguiente sin haber salido
+
+// Saca el estado pendiente si ya entra en el ring TX (en cada vuelta del loop)
+void statusFlush() {
+    if (!statusPendingLen) return;
+    if (serialFrameActive()) {
+        statusPendingLen = 0;
+        return;
+    }
+    if (logWriteIfRoom(statusText, statusPendingLen)) statusPendingLen = 0;
+}
+
 void printStatusJSON() {
-    StaticJsonDocument<JSON_BUFFER_SIZE> doc;
+    // En modo tramas el host lee SAMPLE: el JSON solo le quitaría ancho de banda
+    if (serialFrameActive()) return;
+    
+    // El anterior no encontró lugar en todo el período: se pierde
+    if (statusPendingLen) {
+        statusDropped++;
+        logCountDrop(statusPendingLen);
+        statusPendingLen = 0;
+    }
+    
+    // Estático: con WiFi, endpoints, MQTT y GPRS pasa de 4 KB y no va en el stack del loop
+    static StaticJsonDocument<STATUS_JSON_DOC_BYTES> doc;
+    doc.clear();
     
     // Identificación del dispositivo
     doc["device_id"] = DEVICE_ID;
@@ -242,6 +299,8 @@ void printStatusJSON() {
     system["free_heap"] = ESP.getFreeHeap();
     system["total_alerts"] = state.totalAlerts;
     system["simulation_mode"] = config.simulationMode;
+    system["log_dropped"] = logStats.dropped;
+    system["status_dropped"] = statusDropped;
     
     // Conectividad
     JsonObject network = doc.createNestedObject("network");
@@ -250,11 +309,55 @@ void printStatusJSON() {
     network["internet_available"] = state.internetAvailable;
     network["supabase_enabled"] = config.supabaseEnabled;
     network["last_supabase_sync_sec"] = (millis() - state.lastSupabaseSync) / 1000;
+    JsonObject telegramObj = network.createNestedObject("telegram");
+    getTelegramJSON(telegramObj);
+    JsonObject wifiObj = network.createNestedObject("wifi");
+    getWiFiJSON(wifiObj);
+    JsonArray endpoints = network.createNestedArray("endpoints");
+    getNetHealthJSON(endpoints);
+    network["transport"] = config.transport == TRANSPORT_MQTT ? "mqtt" : "http";
+    if (config.transport == TRANSPORT_MQTT) {
+        JsonObject mqttObj = network.createNestedObject("mqtt");
+        getMqttJSON(mqttObj);
+    }
     
-    // Imprimir JSON
-    Serial.println("\n===== STATUS JSON =====");
-    serializeJsonPretty(doc, Serial);
-    Serial.println("\n=======================\n");
+    #if GPRS_ENABLED
+    // Respaldo GPRS: bearer, cola y consumo del plan de datos
+    JsonObject gprsObj = network.createNestedObject("gprs");
+    getGprsJSON(gprsObj);
+    #endif
+    
+    #if SUPABASE_GZIP_ENABLED
+    // Compresión de uploads: ratio acumulado y costo de CPU
+    JsonObject gzip = network.createNestedObject("gzip");
+    gzip["bodies"] = gzipStats.streams;
+    gzip["bytes_in"] = gzipStats.bytesIn;
+    gzip["bytes_out"] = gzipStats.bytesOut;
+    gzip["ratio"] = gzipStats.ratio();
+    gzip["us_per_kb"] = gzipStats.microsPerKB();
+    #endif
+    
+    if (doc.overflowed()) {
+        // Faltan campos: mejor no imprimir un estado a medias
+        LOG_W("[STATUS] ✗ Documento de más de %u bytes, no se imprime", (unsigned)STATUS_JSON_DOC_BYTES);
+        return;
+    }
+    
+    // Imprimir JSON: se arma entero y entra al ring TX de una vez, para no
+    // esperar a la UART en el medio del loop. Con el ring ocupado queda
+    // pendiente hasta que haya lugar. Compacto: con sangría duplica el
+    // tamaño y no entraría en el ring
+    static_assert(LOG_STATUS_BYTES <= LOG_TX_BUFFER_BYTES, "printStatusJSON tiene que entrar en el ring TX");
+    JsonBufferPrint out(statusText, sizeof(statusText));
+    out.print("\n===== STATUS JSON =====\n");
+    serializeJson(doc, out);
+    out.print("\n=======================\n\n");
+    if (out.overflow()) {
+        LOG_W("[STATUS] ✗ JSON de más de %u bytes, no se imprime", (unsigned)sizeof(statusText));
+        return;
+    }
+    statusPendingLen = out.length();
+    statusFlush();
 }
 
 // ============================================================================
@@ -317,7 +420,7 @@ void checkWiFiResetButton() {
 // SETUP
 // ============================================================================
 void setup() {
-    Serial.begin(115200);
+    logInit();
     delay(100);
     
     Serial.println("\n");
@@ -356,12 +459,22 @@ void setup() {
     initPins();
     
     // Conectar WiFi
+    netHealthInit();
     connectWiFi();
+    netHealthLoop();
     
     // Inicializar sensores
     Serial.println("\n[SENSORES] Inicializando...");
     initSensors();
     
+    #if SIM800_ENABLED || GPRS_ENABLED
+    // Módem GSM (arranque no bloqueante)
+    sim800Init();
+    #endif
+    #if GPRS_ENABLED
+    gprsUploaderInit();         // Respaldo de subidas
+    #endif
+    
     // Configurar mDNS
     setupMDNS();
     
@@ -385,12 +498,16 @@ void setup() {
     // Cambiar a estado NORMAL
     changeState(STATE_NORMAL, "Inicialización completa");
     
+    // Perfil del loop desde cero (sin el setup)
+    profReset();
+    
     Serial.println("\n[SISTEMA] ════════════════════════════════════════");
     Serial.println("[SISTEMA] ✓ INICIALIZACIÓN COMPLETA");
     Serial.printf("[SISTEMA] IP: %s\n", state.localIP.c_str());
     Serial.printf("[SISTEMA] mDNS: http://%s.local\n", MDNS_NAME);
     Serial.printf("[SISTEMA] Device ID: %s\n", DEVICE_ID);
     Serial.printf("[SISTEMA] Supabase: %s\n", config.supabaseEnabled ? "HABILITADO" : "DESHABILITADO");
+    Serial.printf("[SISTEMA] Transporte: %s\n", config.transport == TRANSPORT_MQTT ? "MQTT" : "HTTP");
     Serial.println("[SISTEMA] ════════════════════════════════════════\n");
 }
 
@@ -398,17 +515,26 @@ void setup() {
 // LOOP PRINCIPAL (100% NO BLOQUEANTE)
 // ============================================================================
 void loop() {
-    // Manejar peticiones web
-    server.handleClient();
+    uint32_t loopStart = micros();
+    // Perfil por etapa (profiler.h): cada marca cierra la etapa anterior
+    uint32_t profLoop = profStart();
+    uint32_t t = profLoop;
+    
+    // API web: aplicar mutaciones encoladas y refrescar snapshots
+    // (los requests se atienden en la tarea de AsyncTCP, no acá)
+    webApiLoop();
+    t = profMark(PROF_WEB_API, t);
     
     // Máquina de estados (verifica defrost, cooldown, config)
     stateMachineLoop();
+    t = profMark(PROF_STATE_MACHINE, t);
     
     // Leer sensores (no bloqueante)
     static unsigned long lastSensorRead = 0;
     if (millis() - lastSensorRead >= INTERVAL_SENSOR_READ_MS) {
         lastSensorRead = millis();
         readSensors();
+        t = profMark(PROF_SENSORS, t);
     }
     
     // Verificar alertas (solo si estamos monitoreando)
@@ -417,6 +543,7 @@ void loop() {
         lastAlertCheck = millis();
         if (isStateMonitoring(state.currentState)) {
             checkAlerts();
+            t = profMark(PROF_ALERTS, t);
         }
     }
     
@@ -426,21 +553,60 @@ void loop() {
         lastStatusPrint = millis();
         printStatusJSON();
     }
+    statusFlush();
+    t = profMark(PROF_STATUS_PRINT, t);
+    
+    // Reconexión WiFi (caché RTC, varias redes, failover por RSSI)
+    wifiConnectionLoop();
+    t = profMark(PROF_WIFI, t);
     
-    // Verificar conexión a internet
-    checkInternet();
+    // Salud de conectividad (pasiva; solo sondea endpoints caídos)
+    netHealthLoop();
+    t = profMark(PROF_NET_HEALTH, t);
     
     // Actualizar historial
     updateHistory();
+    t = profMark(PROF_HISTORY, t);
     
-    // Sincronizar con Supabase
-    supabaseSync();
+    // Procesar cola de notificaciones Telegram
+    telegramLoop();
+    t = profMark(PROF_TELEGRAM, t);
+    
+    #if SIM800_ENABLED || GPRS_ENABLED
+    // Motor AT del módem (SMS y comandos de gprs_uploader.h)
+    sim800Loop();
+    t = profMark(PROF_SIM800, t);
+    #endif
+    #if GPRS_ENABLED
+    // Subidas por GPRS (solo actúa con el WiFi caído)
+    gprsUploaderLoop();
+    t = profMark(PROF_GPRS, t);
+    #endif
+    
+    // Sincronizar lecturas (Supabase o MQTT según config.transport)
+    transportSync();
+    t = profMark(PROF_TRANSPORT, t);
     
     // Actualizar LED de estado
     updateStatusLED();
+    t = profMark(PROF_LED, t);
     
     // Verificar botón de reset WiFi
     checkWiFiResetButton();
+    t = profMark(PROF_RESET_BUTTON, t);
+    
+    // Stream en vivo: deltas de lo que cambió en esta vuelta
+    streamLoop();
+    t = profMark(PROF_STREAM, t);
+    
+    // Serial: comandos de texto o tramas y muestras binarias (serial_frame.h)
+    serialFrameLoop();
+    t = profMark(PROF_SERIAL_FRAME, t);
+    
+    // Métricas: duración de esta vuelta y colas de subida
+    metricsLoop(loopStart);
+    t = profMark(PROF_METRICS, t);
+    profRecord(PROF_LOOP, t - profLoop);
     
     // Pequeña pausa para estabilidad
     delay(10);
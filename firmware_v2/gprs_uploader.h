@@ -0,0 +1,714 @@
+/*
+ * ============================================================================
+ * GPRS_UPLOADER.H - SUBIDAS A SUPABASE POR GPRS (RESPALDO DE WIFI) v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * Cuando el WiFi/internet del sitio se cae, las inserciones de supabase.h
+ * siguen saliendo por el SIM800 usando su stack HTTP (AT+HTTP*):
+ *
+ * - Failover: el bearer GPRS se abre recién cuando el enlace WiFi lleva
+ *   GPRS_FAILOVER_DELAY_MS caído (evita abrirlo por cortes de segundos)
+ *   y se cierra (AT+SAPBR=0,1) apenas vuelve internet por WiFi
+ * - Cola chica de subidas: los eventos (alertas, puertas, cortes) pasan
+ *   antes que las lecturas y, si la cola se llena, se desaloja una lectura.
+ *   Lo que quede pendiente al volver el WiFi sale por HTTPClient
+ * - Por GPRS las lecturas se limitan a una cada GPRS_READING_INTERVAL_MS
+ * - Presupuesto mensual de datos (bytes de body + overhead estimado por
+ *   request), persistido en Preferences "gprs":
+ *     >= GPRS_READINGS_BUDGET_PCT  → solo eventos
+ *     >= 100%                      → nada (hasta el mes siguiente)
+ *   El mes sale del reloj del sistema o, sin NTP, del reloj de red (AT+CCLK)
+ *
+ * Cada paso AT se encadena desde el callback del anterior; nada bloquea.
+ * Secuencia de una subida:
+ *   HTTPTERM (sesión vieja) → HTTPINIT → HTTPPARA CID/URL → HTTPSSL →
+ *   HTTPPARA CONTENT/USERDATA → HTTPDATA (body tras DOWNLOAD) →
+ *   HTTPACTION=1 → URC +HTTPACTION: 1,<status>,<len> → HTTPTERM
+ *
+ * NOTA: el TLS del SIM800 es viejo (muchos firmwares no negocian TLS 1.2).
+ * Si el handshake falla (status 605/606) apuntar GPRS_UPLOAD_URL a un
+ * relay HTTP propio que reenvíe a Supabase.
+ *
+ * REQUIERE: sim800.h (motor AT no bloqueante); incluir después de supabase.h
+ *
+ * ============================================================================
+ */
+
+#ifndef GPRS_UPLOADER_H
+#define GPRS_UPLOADER_H
+
+#include <WiFi.h>
+#include <Preferences.h>
+#include <ArduinoJson.h>
+#include <time.h>
+#include "config.h"
+#include "types.h"
+#include "metrics.h"
+#include "json_writer.h"
+#include "sim800.h"
+
+extern Config config;
+extern SystemState state;
+extern Preferences prefs;
+
+// ============================================================================
+// LÍMITES INTERNOS
+// ============================================================================
+
+#define GPRS_QUEUE_SIZE             4       // Subidas pendientes
+#define GPRS_PATH_MAX               48      // "/rest/v1/defrost_sessions?id=eq.X"
+#define GPRS_BODY_MAX               768     // Una lectura completa entra holgada
+#define GPRS_REQUEST_OVERHEAD       600     // Bytes estimados por request (TCP, headers, respuesta)
+#define GPRS_UPLOAD_TIMEOUT_MS      90000   // Subida completa (incluye HTTPACTION)
+#define GPRS_BEARER_RETRY_MS        60000   // Reintento si no se pudo abrir el bearer
+#define GPRS_RETRY_BASE_MS          10000   // Backoff por subida fallida
+#define GPRS_MAX_ATTEMPTS           5       // Las lecturas se descartan antes (ver abajo)
+#define GPRS_USAGE_SAVE_BYTES       8192    // Persistir el contador cada 8 KB...
+#define GPRS_USAGE_SAVE_MS          600000  // ...o cada 10 min (cuida la flash)
+#define GPRS_CLOCK_POLL_MS          3600000 // Releer AT+CCLK cada hora
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+typedef enum {
+    GPRS_BEARER_DOWN = 0,
+    GPRS_BEARER_OPENING,
+    GPRS_BEARER_UP,
+    GPRS_BEARER_CLOSING
+} GprsBearerState;
+
+typedef enum {
+    GPRS_STEP_IDLE = 0,
+    GPRS_STEP_TERM_OLD,         // HTTPTERM por si quedó una sesión abierta (error ignorado)
+    GPRS_STEP_INIT,
+    GPRS_STEP_CID,
+    GPRS_STEP_URL,
+    GPRS_STEP_SSL,
+    GPRS_STEP_CONTENT,
+    GPRS_STEP_HEADERS,
+    GPRS_STEP_DATA,
+    GPRS_STEP_ACTION,
+    GPRS_STEP_WAIT_RESULT,      // OK de HTTPACTION recibido, esperando el URC
+    GPRS_STEP_TERM
+} GprsStep;
+
+struct GprsUpload {
+    bool used;
+    uint8_t priority;           // UPLOAD_PRIO_READING / UPLOAD_PRIO_EVENT
+    uint8_t attempts;
+    uint16_t length;
+    unsigned long queuedAt;
+    unsigned long nextAttempt;
+    char path[GPRS_PATH_MAX];
+    char body[GPRS_BODY_MAX];
+};
+
+struct GprsUploaderState {
+    GprsBearerState bearer;
+    unsigned long uplinkDownSince;  // 0 = WiFi/internet OK
+    unsigned long bearerRetryAt;
+    bool clockConfigured;
+    unsigned long lastClockPoll;
+    uint32_t modemMonth;            // AAAAMM del reloj de red, 0 = desconocido
+
+    // Subida en curso
+    GprsStep step;
+    int8_t current;                 // Slot de la cola, -1 = ninguno
+    unsigned long startedAt;
+    int httpStatus;
+    uint32_t responseLen;
+    unsigned long lastReadingAccepted;
+
+    // Comandos AT de la subida todavía en la cola del motor. Al abortar,
+    // el que estaba en vuelo igual completa más tarde (OK, ERROR o timeout):
+    // staleSteps los cuenta para que no hagan avanzar a la subida siguiente
+    bool stepInFlight;
+    uint8_t staleSteps;
+};
+
+struct GprsUsage {
+    uint32_t month;                 // AAAAMM, 0 = sin reloj todavía
+    uint32_t bytes;
+    uint32_t unsaved;
+    unsigned long lastSave;
+};
+
+struct GprsStats {
+    unsigned long uploadsOk;
+    unsigned long uploadsFailed;
+    unsigned long droppedRate;
+    unsigned long droppedBudget;
+    unsigned long droppedQueue;
+    unsigned long droppedRejected;  // 4xx permanente (no 408/429): reintentar no lo arregla
+    unsigned long bearerOpens;
+};
+
+// ============================================================================
+// VARIABLES
+// ============================================================================
+
+GprsUpload gprsQueue[GPRS_QUEUE_SIZE];
+GprsUploaderState gprsState = {GPRS_BEARER_DOWN, 0, 0, false, 0, 0, GPRS_STEP_IDLE, -1, 0, 0, 0, 0, false, 0};
+GprsUsage gprsUsage;
+GprsStats gprsStats;
+
+void gprsRunStep();
+
+// ============================================================================
+// PRESUPUESTO MENSUAL
+// ============================================================================
+
+void gprsSaveUsage() {
+    uint32_t start = micros();
+    prefs.begin("gprs", false);
+    prefs.putUInt("month", gprsUsage.month);
+    prefs.putUInt("bytes", gprsUsage.bytes);
+    prefs.end();
+    metricObserve(metrics.nvsWrite, micros() - start);
+    gprsUsage.unsaved = 0;
+    gprsUsage.lastSave = millis();
+}
+
+uint32_t gprsCurrentMonth() {
+    time_t now = time(nullptr);
+    if (now > 1600000000) {
+        struct tm t;
+        localtime_r(&now, &t);
+        return (t.tm_year + 1900) * 100 + t.tm_mon + 1;
+    }
+    return gprsState.modemMonth;
+}
+
+void gprsCheckMonth() {
+    uint32_t month = gprsCurrentMonth();
+    if (month == 0 || month == gprsUsage.month) return;
+
+    if (gprsUsage.month != 0) {
+        Serial.printf("[GPRS] Mes nuevo (%lu): contador de datos en cero (mes anterior: %lu bytes)\n",
+                      (unsigned long)month, (unsigned long)gprsUsage.bytes);
+        gprsUsage.bytes = 0;
+    }
+    gprsUsage.month = month;
+    gprsSaveUsage();
+}
+
+void gprsAddUsage(uint32_t bytes) {
+    gprsUsage.bytes += bytes;
+    gprsUsage.unsaved += bytes;
+    if (gprsUsage.unsaved >= GPRS_USAGE_SAVE_BYTES ||
+        millis() - gprsUsage.lastSave >= GPRS_USAGE_SAVE_MS) {
+        gprsSaveUsage();
+    }
+}
+
+uint8_t gprsBudgetPercent() {
+    uint32_t pct = (uint64_t)gprsUsage.bytes * 100 / GPRS_MONTHLY_BUDGET_BYTES;
+    return pct > 255 ? 255 : pct;
+}
+
+// Reloj de red: +CCLK: "24/05/10,14:03:22-12"
+void gprsOnClock(const char* line) {
+    const char* q = strchr(line, '"');
+    if (!q) return;
+    int yy = atoi(q + 1);
+    int mm = atoi(q + 4);
+    if (yy >= 20 && mm >= 1 && mm <= 12) {  // El módulo arranca en 04/01/01 sin hora de red
+        gprsState.modemMonth = (2000 + yy) * 100 + mm;
+    }
+}
+
+// ============================================================================
+// COLA DE SUBIDAS
+// ============================================================================
+
+// 2xx = entregado. 408, 429, 5xx o sin respuesta (<= 0) se reintentan con
+// backoff; el resto de los 4xx es definitivo
+bool gprsStatusPermanent(int status) {
+    return status >= 400 && status < 500 && status != 408 && status != 429;
+}
+
+void gprsFreeSlot(int i) {
+    gprsQueue[i].used = false;
+    gprsQueue[i].length = 0;
+}
+
+// Elegir la próxima: eventos antes que lecturas, a igual prioridad la más vieja
+int gprsNextSlot() {
+    unsigned long now = millis();
+    int next = -1;
+    for (int i = 0; i < GPRS_QUEUE_SIZE; i++) {
+        GprsUpload& u = gprsQueue[i];
+        if (!u.used || (long)(u.nextAttempt - now) > 0) continue;
+        if (next < 0 || u.priority > gprsQueue[next].priority ||
+            (u.priority == gprsQueue[next].priority && u.queuedAt < gprsQueue[next].queuedAt)) {
+            next = i;
+        }
+    }
+    return next;
+}
+
+// Slot para una subida nueva; si está llena se desaloja la lectura más vieja
+int gprsAllocSlot(uint8_t priority) {
+    for (int i = 0; i < GPRS_QUEUE_SIZE; i++) {
+        if (!gprsQueue[i].used) return i;
+    }
+    int victim = -1;
+    for (int i = 0; i < GPRS_QUEUE_SIZE; i++) {
+        if (i == gprsState.current) continue;   // El body en curso lo está leyendo el módem
+        GprsUpload& u = gprsQueue[i];
+        if (u.priority > priority || u.priority != UPLOAD_PRIO_READING) continue;
+        if (victim < 0 || u.queuedAt < gprsQueue[victim].queuedAt) victim = i;
+    }
+    return victim;
+}
+
+bool gprsUploaderAvailable() {
+    if (!GPRS_ENABLED || !sim800IsRegistered()) return false;
+    if (gprsState.bearer == GPRS_BEARER_UP || gprsState.bearer == GPRS_BEARER_OPENING) return true;
+    return gprsState.uplinkDownSince != 0 &&
+           millis() - gprsState.uplinkDownSince >= GPRS_FAILOVER_DELAY_MS;
+}
+
+bool gprsUploaderPost(const char* path, const String& body, uint8_t priority) {
+    uint8_t pct = gprsBudgetPercent();
+    if (pct >= 100 || (priority == UPLOAD_PRIO_READING && pct >= GPRS_READINGS_BUDGET_PCT)) {
+        gprsStats.droppedBudget++;
+        return false;
+    }
+
+    if (priority == UPLOAD_PRIO_READING) {
+        if (gprsState.lastReadingAccepted != 0 &&
+            millis() - gprsState.lastReadingAccepted < GPRS_READING_INTERVAL_MS) {
+            gprsStats.droppedRate++;
+            return false;
+        }
+    }
+
+    if (body.length() >= GPRS_BODY_MAX || strlen(path) >= GPRS_PATH_MAX) {
+        Serial.printf("[GPRS] ✗ Body demasiado grande para GPRS (%u bytes)\n", body.length());
+        gprsStats.droppedQueue++;
+        return false;
+    }
+
+    int slot = gprsAllocSlot(priority);
+    if (slot < 0) {
+        gprsStats.droppedQueue++;
+        Serial.printf("[GPRS] ✗ Cola llena, descartado %s\n", path);
+        return false;
+    }
+    if (gprsQueue[slot].used) {
+        gprsStats.droppedQueue++;
+        Serial.printf("[GPRS] Cola llena, desalojada lectura de %lu seg\n",
+                      (millis() - gprsQueue[slot].queuedAt) / 1000);
+    }
+
+    GprsUpload& u = gprsQueue[slot];
+    u.used = true;
+    u.priority = priority;
+    u.attempts = 0;
+    u.length = body.length();
+    u.queuedAt = millis();
+    u.nextAttempt = u.queuedAt;
+    strlcpy(u.path, path, sizeof(u.path));
+    memcpy(u.body, body.c_str(), u.length);
+    u.body[u.length] = '\0';
+
+    if (priority == UPLOAD_PRIO_READING) gprsState.lastReadingAccepted = u.queuedAt;
+    Serial.printf("[GPRS] Encolado %s (%u bytes)\n", path, u.length);
+    return true;
+}
+
+// ============================================================================
+// BEARER (AT+SAPBR)
+// ============================================================================
+
+void gprsOnBearerQuery(const char* line) {
+    // +SAPBR: 1,1,"10.1.2.3"  (estado 1 = conectado)
+    if (strncmp(line, "+SAPBR:", 7) != 0) return;
+    const char* comma = strchr(line, ',');
+    if (comma && atoi(comma + 1) == 1) gprsState.bearer = GPRS_BEARER_UP;
+}
+
+void gprsOnBearerQueryDone(Sim800Result result) {
+    if (gprsState.bearer == GPRS_BEARER_UP) {
+        Serial.println("[GPRS] ✓ Bearer ya estaba abierto");
+        return;
+    }
+    gprsState.bearer = GPRS_BEARER_DOWN;
+    gprsState.bearerRetryAt = millis() + GPRS_BEARER_RETRY_MS;
+    Serial.println("[GPRS] ✗ No se pudo abrir el bearer, reintento en 60 seg");
+}
+
+void gprsOnBearerOpen(Sim800Result result) {
+    if (result == SIM800_RESULT_OK) {
+        gprsState.bearer = GPRS_BEARER_UP;
+        gprsStats.bearerOpens++;
+        Serial.println("[GPRS] ✓ Bearer abierto, subidas por GPRS");
+        sim800Queue("AT+CCLK?", SIM800_CMD_TIMEOUT_MS, gprsOnClock);
+        return;
+    }
+    // ERROR también aparece si ya estaba abierto: consultar antes de rendirse
+    sim800Queue("AT+SAPBR=2,1", SIM800_CMD_TIMEOUT_MS, gprsOnBearerQuery, gprsOnBearerQueryDone);
+}
+
+void gprsOpenBearer() {
+    char cmd[SIM800_CMD_MAX_LEN];
+    gprsState.bearer = GPRS_BEARER_OPENING;
+    Serial.printf("[GPRS] Enlace WiFi caído hace %lu seg, abriendo bearer (APN %s)\n",
+                  (millis() - gprsState.uplinkDownSince) / 1000, GPRS_APN);
+
+    sim800Queue("AT+SAPBR=3,1,\"Contype\",\"GPRS\"");
+    snprintf(cmd, sizeof(cmd), "AT+SAPBR=3,1,\"APN\",\"%s\"", GPRS_APN);
+    sim800Queue(cmd);
+    if (strlen(GPRS_APN_USER) > 0) {
+        snprintf(cmd, sizeof(cmd), "AT+SAPBR=3,1,\"USER\",\"%s\"", GPRS_APN_USER);
+        sim800Queue(cmd);
+        snprintf(cmd, sizeof(cmd), "AT+SAPBR=3,1,\"PWD\",\"%s\"", GPRS_APN_PASSWORD);
+        sim800Queue(cmd);
+    }
+    // La activación puede tardar (el módem contesta hasta en ~85 seg)
+    if (!sim800Queue("AT+SAPBR=1,1", 65000, nullptr, gprsOnBearerOpen)) {
+        gprsState.bearer = GPRS_BEARER_DOWN;
+        gprsState.bearerRetryAt = millis() + GPRS_BEARER_RETRY_MS;
+    }
+}
+
+void gprsOnBearerClosed(Sim800Result result) {
+    gprsState.bearer = GPRS_BEARER_DOWN;
+    Serial.println("[GPRS] Bearer cerrado, WiFi de vuelta");
+    gprsSaveUsage();
+}
+
+void gprsCloseBearer() {
+    gprsState.bearer = GPRS_BEARER_CLOSING;
+    if (!sim800Queue("AT+SAPBR=0,1", 65000, nullptr, gprsOnBearerClosed)) {
+        gprsState.bearer = GPRS_BEARER_UP;  // Se reintenta en la próxima vuelta
+    }
+}
+
+// ============================================================================
+// SUBIDA EN CURSO
+// ============================================================================
+
+void gprsFinishUpload() {
+    int i = gprsState.current;
+    gprsState.step = GPRS_STEP_IDLE;
+    gprsState.current = -1;
+    if (i < 0) return;
+
+    GprsUpload& u = gprsQueue[i];
+    int status = gprsState.httpStatus;
+
+    // Se cobra aunque falle: los bytes ya salieron por el aire
+    gprsAddUsage(u.length + GPRS_REQUEST_OVERHEAD + gprsState.responseLen);
+
+    if (status >= 200 && status < 300) {
+        gprsStats.uploadsOk++;
+        Serial.printf("[GPRS] ✓ %s → %d (%lu seg en cola)\n", u.path, status,
+                      (millis() - u.queuedAt) / 1000);
+        gprsFreeSlot(i);
+        return;
+    }
+
+    gprsStats.uploadsFailed++;
+    u.attempts++;
+    // 4xx definitivo no se arregla reintentando; las lecturas viejas no valen el costo
+    bool rejected = gprsStatusPermanent(status);
+    bool drop = rejected || u.attempts >= GPRS_MAX_ATTEMPTS ||
+                (u.priority == UPLOAD_PRIO_READING && u.attempts >= 2);
+    if (rejected) gprsStats.droppedRejected++;
+    Serial.printf("[GPRS] ✗ %s → %d (intento %u)%s\n", u.path, status, u.attempts,
+                  drop ? ", descartado" : "");
+    if (drop) {
+        gprsFreeSlot(i);
+    } else {
+        u.nextAttempt = millis() + (GPRS_RETRY_BASE_MS << u.attempts);
+    }
+}
+
+void gprsOnStepDone(Sim800Result result) {
+    // La cola AT es FIFO: los completados de subidas abortadas llegan primero
+    if (gprsState.staleSteps > 0) {
+        gprsState.staleSteps--;
+        return;
+    }
+    gprsState.stepInFlight = false;
+    if (gprsState.step == GPRS_STEP_IDLE) return;
+
+    switch (gprsState.step) {
+        case GPRS_STEP_TERM_OLD:
+            gprsState.step = GPRS_STEP_INIT;     // Sin sesión previa da ERROR: normal
+            break;
+        case GPRS_STEP_TERM:
+            gprsFinishUpload();
+            return;
+        case GPRS_STEP_ACTION:
+            if (result == SIM800_RESULT_OK) {
+                gprsState.step = GPRS_STEP_WAIT_RESULT;
+                return;                          // Sigue en gprsOnUrc()
+            }
+            // fall through
+        default:
+            if (result != SIM800_RESULT_OK) {
+                gprsState.httpStatus = -1;
+                gprsState.step = GPRS_STEP_TERM;
+            } else {
+                gprsState.step = (GprsStep)(gprsState.step + 1);
+            }
+            break;
+    }
+    gprsRunStep();
+}
+
+void gprsRunStep() {
+    GprsUpload& u = gprsQueue[gprsState.current];
+    char cmd[SIM800_CMD_MAX_LEN];
+    bool queued = true;
+
+    switch (gprsState.step) {
+        case GPRS_STEP_TERM_OLD:
+        case GPRS_STEP_TERM:
+            queued = sim800Queue("AT+HTTPTERM", SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        case GPRS_STEP_INIT:
+            queued = sim800Queue("AT+HTTPINIT", SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        case GPRS_STEP_CID:
+            queued = sim800Queue("AT+HTTPPARA=\"CID\",1", SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        case GPRS_STEP_URL:
+            snprintf(cmd, sizeof(cmd), "AT+HTTPPARA=\"URL\",\"%s%s\"", GPRS_UPLOAD_URL, u.path);
+            queued = sim800Queue(cmd, SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        case GPRS_STEP_SSL:
+            queued = sim800Queue(strncmp(GPRS_UPLOAD_URL, "https", 5) == 0 ? "AT+HTTPSSL=1" : "AT+HTTPSSL=0",
+                                 SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        case GPRS_STEP_CONTENT:
+            queued = sim800Queue("AT+HTTPPARA=\"CONTENT\",\"application/json\"",
+                                 SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        case GPRS_STEP_HEADERS: {
+            // Headers extra separados por \r\n literal (el módem los expande)
+            int n = snprintf(cmd, sizeof(cmd),
+                             "AT+HTTPPARA=\"USERDATA\",\"apikey: %s\\r\\nAuthorization: Bearer %s\\r\\nPrefer: return=minimal\"",
+                             SUPABASE_ANON_KEY, SUPABASE_ANON_KEY);
+            if (n >= (int)sizeof(cmd)) {
+                // Claves JWT largas no entran en un comando AT: usar un relay que agregue los headers
+                Serial.println("[GPRS] ✗ Headers demasiado largos para USERDATA");
+                gprsState.httpStatus = -1;
+                gprsState.step = GPRS_STEP_TERM;
+                gprsRunStep();
+                return;
+            }
+            queued = sim800Queue(cmd, SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        }
+        case GPRS_STEP_DATA:
+            snprintf(cmd, sizeof(cmd), "AT+HTTPDATA=%u,10000", u.length);
+            queued = sim800Queue(cmd, 12000, nullptr, gprsOnStepDone, u.body, u.length);
+            break;
+        case GPRS_STEP_ACTION:
+            queued = sim800Queue("AT+HTTPACTION=1", SIM800_CMD_TIMEOUT_MS, nullptr, gprsOnStepDone);
+            break;
+        default:
+            return;
+    }
+
+    // Cola AT llena (SMS, consultas): el watchdog da la subida por fallida
+    if (!queued) Serial.println("[GPRS] ✗ Cola AT llena durante la subida");
+    gprsState.stepInFlight = queued;
+}
+
+void gprsStartUpload(int slot) {
+    gprsState.current = slot;
+    gprsState.step = GPRS_STEP_TERM_OLD;
+    gprsState.startedAt = millis();
+    gprsState.httpStatus = 0;
+    gprsState.responseLen = 0;
+    gprsRunStep();
+}
+
+void gprsAbortUpload(const char* reason) {
+    Serial.printf("[GPRS] ✗ Subida abortada: %s\n", reason);
+    if (gprsState.stepInFlight) {
+        gprsState.stepInFlight = false;
+        gprsState.staleSteps++;
+    }
+    gprsState.httpStatus = -1;
+    gprsFinishUpload();
+}
+
+// ============================================================================
+// URCs DEL MÓDEM
+// ============================================================================
+
+bool gprsOnUrc(const char* line) {
+    if (strncmp(line, "+HTTPACTION:", 12) == 0) {
+        // +HTTPACTION: 1,201,0  (método, status, largo de la respuesta)
+        int method = 0, status = 0;
+        unsigned long len = 0;
+        sscanf(line + 12, "%d,%d,%lu", &method, &status, &len);
+        if (gprsState.step == GPRS_STEP_WAIT_RESULT) {
+            gprsState.httpStatus = status;
+            gprsState.responseLen = len;
+            gprsState.step = GPRS_STEP_TERM;
+            gprsRunStep();
+        }
+        return true;
+    }
+    if (strncmp(line, "+SAPBR", 6) == 0 && strstr(line, "DEACT")) {
+        // "+SAPBR 1: DEACT": la red cerró el contexto PDP
+        Serial.println("[GPRS] ⚠️ La red cerró el bearer");
+        gprsState.bearer = GPRS_BEARER_DOWN;
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// INICIALIZACIÓN Y LOOP
+// ============================================================================
+
+void gprsUploaderInit() {
+    prefs.begin("gprs", true);
+    gprsUsage.month = prefs.getUInt("month", 0);
+    gprsUsage.bytes = prefs.getUInt("bytes", 0);
+    prefs.end();
+    gprsUsage.unsaved = 0;
+    gprsUsage.lastSave = millis();
+
+    memset(gprsQueue, 0, sizeof(gprsQueue));
+    sim800UrcHook = gprsOnUrc;
+
+    Serial.printf("[GPRS] Respaldo habilitado (APN %s), uso del mes: %lu / %lu bytes\n",
+                  GPRS_APN, (unsigned long)gprsUsage.bytes, (unsigned long)GPRS_MONTHLY_BUDGET_BYTES);
+}
+
+void gprsUploaderLoop() {
+    unsigned long now = millis();
+
+    // ¿Está caído el enlace principal?
+    bool uplinkOk = state.internetAvailable && WiFi.status() == WL_CONNECTED;
+    if (uplinkOk) {
+        gprsState.uplinkDownSince = 0;
+    } else if (gprsState.uplinkDownSince == 0) {
+        gprsState.uplinkDownSince = now;
+    }
+
+    // Módem reiniciado: los comandos en vuelo se perdieron
+    if (!sim800Ready()) {
+        if (gprsState.step != GPRS_STEP_IDLE) gprsAbortUpload("módem reiniciado");
+        gprsState.staleSteps = 0;    // El motor vacía su cola antes de volver a READY
+        gprsState.bearer = GPRS_BEARER_DOWN;
+        gprsState.clockConfigured = false;
+        return;
+    }
+
+    // Hora de red para el presupuesto mensual (CLTS rige desde el próximo arranque del módem)
+    // (con la cola AT ocupada, p.ej. durante el arranque, se espera otra vuelta)
+    if (sim800QueueFree() > 2) {
+        if (!gprsState.clockConfigured) {
+            gprsState.clockConfigured = sim800Queue("AT+CLTS=1;&W");
+            gprsState.lastClockPoll = now - GPRS_CLOCK_POLL_MS;  // Leer el reloj enseguida
+        } else if (now - gprsState.lastClockPoll >= GPRS_CLOCK_POLL_MS) {
+            gprsState.lastClockPoll = now;
+            sim800Queue("AT+CCLK?", SIM800_CMD_TIMEOUT_MS, gprsOnClock);
+        }
+    }
+    gprsCheckMonth();
+
+    if (gprsState.step != GPRS_STEP_IDLE) {
+        if (now - gprsState.startedAt >= GPRS_UPLOAD_TIMEOUT_MS) gprsAbortUpload("timeout");
+        return;
+    }
+
+    // Volvió el WiFi con subidas pendientes: salen por HTTPClient, una por vuelta.
+    // Solo un 2xx libera el slot; sin costo de datos no se descartan por
+    // intentos, salvo un 4xx definitivo
+    if (uplinkOk) {
+        int next = gprsNextSlot();
+        if (next >= 0) {
+            GprsUpload& u = gprsQueue[next];
+            int code = supabaseUpload(u.path, String(u.body), u.priority);
+            Serial.printf("[GPRS] Pendiente %s reenviado por WiFi → %d\n", u.path, code);
+            if (code >= 200 && code < 300) {
+                gprsStats.uploadsOk++;
+                gprsFreeSlot(next);
+            } else if (gprsStatusPermanent(code)) {
+                gprsStats.droppedRejected++;
+                gprsFreeSlot(next);
+            } else {
+                if (u.attempts < GPRS_MAX_ATTEMPTS) u.attempts++;
+                u.nextAttempt = now + (GPRS_RETRY_BASE_MS << u.attempts);
+            }
+        }
+    }
+
+    switch (gprsState.bearer) {
+        case GPRS_BEARER_DOWN:
+            if (gprsUploaderAvailable() && (long)(now - gprsState.bearerRetryAt) >= 0) {
+                gprsOpenBearer();
+            }
+            break;
+        case GPRS_BEARER_UP:
+            if (uplinkOk) {
+                gprsCloseBearer();
+            } else {
+                int next = gprsNextSlot();
+                if (next >= 0) gprsStartUpload(next);
+            }
+            break;
+        default:
+            break;  // Abriendo / cerrando: esperar el callback
+    }
+}
+
+int gprsQueueLength() {
+    int n = 0;
+    for (int i = 0; i < GPRS_QUEUE_SIZE; i++) {
+        if (gprsQueue[i].used) n++;
+    }
+    return n;
+}
+
+void getGprsJSON(JsonObject& obj) {
+    static const char* bearerNames[] = {"down", "opening", "up", "closing"};
+    obj["bearer"] = bearerNames[gprsState.bearer];
+    obj["registered"] = sim800IsRegistered();
+    obj["signal"] = sim800GetSignal();
+    obj["queued"] = gprsQueueLength();
+    obj["uploads_ok"] = gprsStats.uploadsOk;
+    obj["uploads_failed"] = gprsStats.uploadsFailed;
+    obj["dropped_rate"] = gprsStats.droppedRate;
+    obj["dropped_budget"] = gprsStats.droppedBudget;
+    obj["dropped_queue"] = gprsStats.droppedQueue;
+    obj["dropped_rejected"] = gprsStats.droppedRejected;
+    obj["month"] = gprsUsage.month;
+    obj["bytes_used"] = gprsUsage.bytes;
+    obj["budget_bytes"] = (uint32_t)GPRS_MONTHLY_BUDGET_BYTES;
+    obj["budget_pct"] = gprsBudgetPercent();
+}
+
+// Mismos campos en streaming, para /api/status (web_api.h)
+void writeGprsJSON(JsonWriter& w) {
+    static const char* bearerNames[] = {"down", "opening", "up", "closing"};
+    w.field(JK(bearer), bearerNames[gprsState.bearer]);
+    w.field(JK(registered), sim800IsRegistered());
+    w.field(JK(signal), sim800GetSignal());
+    w.field(JK(queued), gprsQueueLength());
+    w.field(JK(uploads_ok), gprsStats.uploadsOk);
+    w.field(JK(uploads_failed), gprsStats.uploadsFailed);
+    w.field(JK(dropped_rate), gprsStats.droppedRate);
+    w.field(JK(dropped_budget), gprsStats.droppedBudget);
+    w.field(JK(dropped_queue), gprsStats.droppedQueue);
+    w.field(JK(dropped_rejected), gprsStats.droppedRejected);
+    w.field(JK(month), (unsigned long)gprsUsage.month);
+    w.field(JK(bytes_used), (unsigned long)gprsUsage.bytes);
+    w.field(JK(budget_bytes), (unsigned long)GPRS_MONTHLY_BUDGET_BYTES);
+    w.field(JK(budget_pct), gprsBudgetPercent());
+}
+
+#endif // GPRS_UPLOADER_H
@@ -0,0 +1,356 @@
+/*
+ * ============================================================================
+ * GZIP_STREAM.H - COMPRESIÓN GZIP EN STREAMING v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * Compresor deflate (RFC 1951) con envoltorio gzip (RFC 1952) pensado para
+ * comprimir los bodies que se suben a Supabase por enlaces medidos (GPRS).
+ *
+ * - Huffman fijo (BTYPE=01): sin tablas dinámicas, sin malloc
+ * - LZ77 con ventana fija de GZIP_WINDOW_SIZE bytes
+ * - Entrada en streaming: write() se puede llamar N veces
+ * - Salida por bloques de GZIP_OUT_CHUNK bytes hacia un sink
+ *
+ * Memoria fija (ventana 1 KB): ~6.7 KB en .bss, una sola instancia.
+ * Los JSON de lecturas repiten device_id y nombres de campos en cada fila,
+ * así que una ventana de 1 KB ya alcanza para ver la fila anterior.
+ *
+ * ============================================================================
+ */
+
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// PARÁMETROS
+// ============================================================================
+#define GZIP_WINDOW_BITS    10
+#define GZIP_WINDOW_SIZE    (1 << GZIP_WINDOW_BITS)     // 1024 bytes
+#define GZIP_BUF_SIZE       (GZIP_WINDOW_SIZE * 2)      // historial + lookahead
+#define GZIP_HASH_BITS      9
+#define GZIP_HASH_SIZE      (1 << GZIP_HASH_BITS)
+#define GZIP_MIN_MATCH      3
+#define GZIP_MAX_MATCH      258
+#define GZIP_MAX_CHAIN      8                           // candidatos por posición
+#define GZIP_OUT_CHUNK      128
+#define GZIP_NIL            0xFFFF
+
+// Callback de salida: recibe bloques de datos comprimidos
+typedef void (*GzipSink)(const uint8_t* data, size_t len, void* ctx);
+
+// ============================================================================
+// ESTADÍSTICAS ACUMULADAS (ratio y costo de CPU)
+// ============================================================================
+struct GzipStats {
+    uint32_t streams;               // Bodies comprimidos
+    uint32_t bytesIn;               // Bytes sin comprimir
+    uint32_t bytesOut;              // Bytes comprimidos (incluye header gzip)
+    uint32_t cpuMicros;             // Tiempo total de CPU comprimiendo
+
+    float ratio() const {
+        return bytesIn > 0 ? (float)bytesOut / bytesIn : 1.0f;
+    }
+
+    float microsPerKB() const {
+        return bytesIn > 0 ? cpuMicros * 1024.0f / bytesIn : 0.0f;
+    }
+};
+
+GzipStats gzipStats = {0, 0, 0, 0};
+
+// ============================================================================
+// TABLAS DEFLATE (RFC 1951, sección 3.2.5)
+// ============================================================================
+static const uint16_t GZ_LEN_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t GZ_LEN_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t GZ_DIST_BASE[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577
+};
+static const uint8_t GZ_DIST_EXTRA[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// CRC32 con tabla de nibbles (64 bytes en vez de 1 KB)
+static const uint32_t GZ_CRC_NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+// ============================================================================
+// CLASE: Compresor gzip en streaming
+// ============================================================================
+class GzipStream {
+public:
+    void begin(GzipSink sink, void* ctx) {
+        _sink = sink;
+        _ctx = ctx;
+        _bufLen = 0;
+        _pos = 0;
+        _bitBuf = 0;
+        _bitCount = 0;
+        _outLen = 0;
+        _crc = 0xFFFFFFFF;
+        _inTotal = 0;
+        _outTotal = 0;
+        _cpuMicros = 0;
+        for (int i = 0; i < GZIP_HASH_SIZE; i++) _head[i] = GZIP_NIL;
+
+        unsigned long t0 = micros();
+
+        // Header gzip: ID1 ID2 CM FLG MTIME(4) XFL OS
+        static const uint8_t header[10] = {0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF};
+        for (int i = 0; i < 10; i++) putByte(header[i]);
+
+        // Un único bloque final con Huffman fijo: BFINAL=1, BTYPE=01
+        putBits(1, 1);
+        putBits(1, 2);
+
+        _cpuMicros += micros() - t0;
+    }
+
+    void write(const uint8_t* data, size_t len) {
+        unsigned long t0 = micros();
+        _inTotal += len;
+
+        while (len > 0) {
+            size_t room = GZIP_BUF_SIZE - _bufLen;
+            size_t n = len < room ? len : room;
+
+            memcpy(_buf + _bufLen, data, n);
+            updateCrc(data, n);
+            _bufLen += n;
+            data += n;
+            len -= n;
+
+            compress(false);
+            if (_bufLen == GZIP_BUF_SIZE) slide();
+        }
+
+        _cpuMicros += micros() - t0;
+    }
+
+    void write(const char* str) {
+        write((const uint8_t*)str, strlen(str));
+    }
+
+    void finish() {
+        unsigned long t0 = micros();
+
+        compress(true);
+        putSymbol(256);             // Fin de bloque
+        if (_bitCount > 0) {
+            putByte(_bitBuf & 0xFF);
+            _bitBuf = 0;
+            _bitCount = 0;
+        }
+
+        uint32_t crc = _crc ^ 0xFFFFFFFF;
+        for (int i = 0; i < 4; i++) putByte((crc >> (8 * i)) & 0xFF);
+        for (int i = 0; i < 4; i++) putByte((_inTotal >> (8 * i)) & 0xFF);
+        flushOut();
+
+        _cpuMicros += micros() - t0;
+
+        gzipStats.streams++;
+        gzipStats.bytesIn += _inTotal;
+        gzipStats.bytesOut += _outTotal;
+        gzipStats.cpuMicros += _cpuMicros;
+    }
+
+    uint32_t bytesIn() const { return _inTotal; }
+    uint32_t bytesOut() const { return _outTotal; }
+    uint32_t cpuMicros() const { return _cpuMicros; }
+
+private:
+    GzipSink _sink;
+    void* _ctx;
+
+    uint8_t _buf[GZIP_BUF_SIZE];
+    uint16_t _head[GZIP_HASH_SIZE];
+    uint16_t _prev[GZIP_BUF_SIZE];
+    size_t _bufLen;
+    size_t _pos;
+
+    uint32_t _bitBuf;
+    int _bitCount;
+    uint8_t _out[GZIP_OUT_CHUNK];
+    size_t _outLen;
+
+    uint32_t _crc;
+    uint32_t _inTotal;
+    uint32_t _outTotal;
+    uint32_t _cpuMicros;
+
+    // ------------------------------------------------------------------------
+    // Salida de bits (LSB primero, como exige deflate)
+    // ------------------------------------------------------------------------
+    void putByte(uint8_t b) {
+        _out[_outLen++] = b;
+        _outTotal++;
+        if (_outLen == GZIP_OUT_CHUNK) flushOut();
+    }
+
+    void flushOut() {
+        if (_outLen > 0 && _sink) _sink(_out, _outLen, _ctx);
+        _outLen = 0;
+    }
+
+    void putBits(uint32_t value, int count) {
+        _bitBuf |= value << _bitCount;
+        _bitCount += count;
+        while (_bitCount >= 8) {
+            putByte(_bitBuf & 0xFF);
+            _bitBuf >>= 8;
+            _bitCount -= 8;
+        }
+    }
+
+    // Los códigos Huffman se empaquetan MSB primero → invertir
+    void putCode(uint32_t code, int len) {
+        uint32_t rev = 0;
+        for (int i = 0; i < len; i++) {
+            rev = (rev << 1) | (code & 1);
+            code >>= 1;
+        }
+        putBits(rev, len);
+    }
+
+    // Símbolo literal/longitud con la tabla Huffman fija
+    void putSymbol(int sym) {
+        if (sym < 144)      putCode(0x30 + sym, 8);
+        else if (sym < 256) putCode(0x190 + (sym - 144), 9);
+        else if (sym < 280) putCode(sym - 256, 7);
+        else                putCode(0xC0 + (sym - 280), 8);
+    }
+
+    void putMatch(int len, int dist) {
+        int lc = 28;
+        while (GZ_LEN_BASE[lc] > len) lc--;
+        putSymbol(257 + lc);
+        if (GZ_LEN_EXTRA[lc]) putBits(len - GZ_LEN_BASE[lc], GZ_LEN_EXTRA[lc]);
+
+        int dc = 29;
+        while (GZ_DIST_BASE[dc] > dist) dc--;
+        putCode(dc, 5);
+        if (GZ_DIST_EXTRA[dc]) putBits(dist - GZ_DIST_BASE[dc], GZ_DIST_EXTRA[dc]);
+    }
+
+    void updateCrc(const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            _crc ^= data[i];
+            _crc = (_crc >> 4) ^ GZ_CRC_NIBBLE[_crc & 0x0F];
+            _crc = (_crc >> 4) ^ GZ_CRC_NIBBLE[_crc & 0x0F];
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // LZ77
+    // ------------------------------------------------------------------------
+    uint16_t hashAt(size_t p) const {
+        uint32_t h = (_buf[p] << 10) ^ (_buf[p + 1] << 5) ^ _buf[p + 2];
+        return (h * 2654435761u) >> (32 - GZIP_HASH_BITS);
+    }
+
+    void insertHash(size_t p) {
+        if (p + GZIP_MIN_MATCH > _bufLen) return;
+        uint16_t h = hashAt(p);
+        _prev[p] = _head[h];
+        _head[h] = (uint16_t)p;
+    }
+
+    // Comprime mientras haya lookahead suficiente (o todo si flush)
+    void compress(bool flush) {
+        while (_pos < _bufLen) {
+            size_t avail = _bufLen - _pos;
+            if (!flush && avail < GZIP_MAX_MATCH) return;
+
+            int bestLen = 0;
+            int bestDist = 0;
+
+            if (avail >= GZIP_MIN_MATCH) {
+                size_t maxLen = avail < GZIP_MAX_MATCH ? avail : GZIP_MAX_MATCH;
+                uint16_t cand = _head[hashAt(_pos)];
+                int chain = GZIP_MAX_CHAIN;
+
+                while (cand != GZIP_NIL && chain-- > 0) {
+                    size_t dist = _pos - cand;
+                    if (cand >= _pos || dist > GZIP_WINDOW_SIZE) break;
+
+                    size_t n = 0;
+                    while (n < maxLen && _buf[cand + n] == _buf[_pos + n]) n++;
+                    if ((int)n > bestLen) {
+                        bestLen = n;
+                        bestDist = dist;
+                        if (n == maxLen) break;
+                    }
+                    cand = _prev[cand];
+                }
+            }
+
+            if (bestLen >= GZIP_MIN_MATCH) {
+                putMatch(bestLen, bestDist);
+                for (int i = 0; i < bestLen; i++) insertHash(_pos + i);
+                _pos += bestLen;
+            } else {
+                putSymbol(_buf[_pos]);
+                insertHash(_pos);
+                _pos++;
+            }
+        }
+    }
+
+    // Descartar la mitad vieja del buffer (ya fuera de la ventana)
+    void slide() {
+        if (_pos < GZIP_WINDOW_SIZE) return;
+
+        memmove(_buf, _buf + GZIP_WINDOW_SIZE, _bufLen - GZIP_WINDOW_SIZE);
+        memmove(_prev, _prev + GZIP_WINDOW_SIZE, (_bufLen - GZIP_WINDOW_SIZE) * sizeof(uint16_t));
+        _bufLen -= GZIP_WINDOW_SIZE;
+        _pos -= GZIP_WINDOW_SIZE;
+
+        for (int i = 0; i < GZIP_HASH_SIZE; i++) {
+            _head[i] = (_head[i] != GZIP_NIL && _head[i] >= GZIP_WINDOW_SIZE) ?
+                       _head[i] - GZIP_WINDOW_SIZE : GZIP_NIL;
+        }
+        for (size_t i = 0; i < _bufLen; i++) {
+            _prev[i] = (_prev[i] != GZIP_NIL && _prev[i] >= GZIP_WINDOW_SIZE) ?
+                       _prev[i] - GZIP_WINDOW_SIZE : GZIP_NIL;
+        }
+    }
+};
+
+// ============================================================================
+// SINK A BUFFER FIJO (para armar el body completo antes del POST)
+// ============================================================================
+struct GzipBufferSink {
+    uint8_t* data;
+    size_t capacity;
+    size_t length;
+    bool overflow;
+};
+
+void gzipBufferSinkWrite(const uint8_t* data, size_t len, void* ctx) {
+    GzipBufferSink* s = (GzipBufferSink*)ctx;
+    if (s->length + len > s->capacity) {
+        s->overflow = true;
+        return;
+    }
+    memcpy(s->data + s->length, data, len);
+    s->length += len;
+}
+
+#endif // GZIP_STREAM_H
@@ -1,6 +1,10 @@
 /*
  * html_ui.h - Página HTML embebida
  * Sistema Monitoreo Reefer v3.0
+ *
+ * Fuente de la página: el firmware no incluye este archivo, sirve la
+ * versión comprimida de web_assets.h. Después de editarlo, correr
+ * python3 tools/gen_web_assets.py
  */
 
 #ifndef HTML_UI_H
@@ -120,11 +124,18 @@ String getEmbeddedHTML() {
   
   <script>
     let alertActive=false,defrostMode=false;
+    let st=null,es=null,pollTimer=null;
     
     async function fetchStatus(){
       try{
         const r=await fetch('/api/status');
-        const d=await r.json();
+        st=await r.json();
+        render(st);
+      }catch(e){console.error(e);}
+    }
+    
+    function render(d){
+      try{
         const t=d.sensor.temp_avg.toFixed(1);
         const tempEl=document.getElementById('temp');
         tempEl.textContent=t+'°C';
@@ -198,7 +209,29 @@ String getEmbeddedHTML() {
       }
     }
     
-    setInterval(fetchStatus,2000);
+    // Stream en vivo (/api/stream): snapshot al conectar y después solo deltas.
+    // Polling cada 2 seg únicamente si no hay EventSource o el stream se cae.
+    function merge(a,b){
+      for(const k in b){
+        if(b[k]!==null&&typeof b[k]==='object')a[k]=merge(a[k]||{},b[k]);
+        else a[k]=b[k];
+      }
+      return a;
+    }
+    function startPolling(){if(!pollTimer){pollTimer=setInterval(fetchStatus,2000);fetchStatus();}}
+    function stopPolling(){if(pollTimer){clearInterval(pollTimer);pollTimer=null;}}
+    function startStream(){
+      if(!window.EventSource){startPolling();return;}
+      es=new EventSource('/api/stream');
+      const apply=e=>{if(st){merge(st,JSON.parse(e.data));render(st);}};
+      es.addEventListener('snapshot',e=>{st=JSON.parse(e.data);render(st);});
+      es.addEventListener('delta',apply);
+      es.addEventListener('ka',apply);
+      es.onopen=stopPolling;
+      es.onerror=startPolling;   // EventSource reintenta solo (retry del servidor)
+    }
+    
+    startStream();
     fetchStatus();
     loadConfig();
   </script>
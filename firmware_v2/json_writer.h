@@ -0,0 +1,186 @@
+/*
+ * ============================================================================
+ * JSON_WRITER.H - ESCRITOR JSON EN STREAMING (SIN HEAP) v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * Escribe JSON directo sobre cualquier Print: el buffer de envío de una
+ * respuesta (AsyncResponseStream), un buffer fijo (JsonBufferPrint) o el
+ * Serial. No arma documento ni String intermedio: cero allocs propios.
+ *
+ * Las claves se arman en compilación con JK(nombre): el literal ya trae
+ * comillas y dos puntos ("\"temp_avg\":") y su largo sale de sizeof, así
+ * que escribir una clave es un solo write() sin strlen ni escape.
+ *
+ *   JsonWriter w(out);
+ *   w.beginObject();
+ *   w.field(JK(temp_avg), sensorData.tempAvg);
+ *   w.beginArray(JK(sensors));
+ *   ...
+ *   w.endArray();
+ *   w.endObject();
+ *
+ * Sin validación de estructura: el que escribe cierra lo que abre (hasta
+ * 32 niveles). Los float NaN/Inf salen como null.
+ *
+ * ============================================================================
+ */
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// CLAVES EN COMPILACIÓN
+// ============================================================================
+struct JsonKey {
+    const char* text;               // "\"nombre\":"
+    uint8_t len;
+};
+
+#define JK(name) (JsonKey{"\"" #name "\":", sizeof("\"" #name "\":") - 1})
+
+// ============================================================================
+// DESTINO: BUFFER FIJO
+// ============================================================================
+// Si no entra, corta y marca overflow() (el resto se descarta)
+class JsonBufferPrint : public Print {
+public:
+    JsonBufferPrint(char* buf, size_t size) : _buf(buf), _size(size) {}
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* data, size_t n) override {
+        if (_len + n >= _size) {            // Deja lugar para el '\0'
+            _overflow = true;
+            return 0;
+        }
+        memcpy(_buf + _len, data, n);
+        _len += n;
+        _buf[_len] = '\0';
+        return n;
+    }
+
+    size_t length() const { return _len; }
+    bool overflow() const { return _overflow; }
+
+private:
+    char* _buf;
+    size_t _size;
+    size_t _len = 0;
+    bool _overflow = false;
+};
+
+// ============================================================================
+// ESCRITOR
+// ============================================================================
+class JsonWriter {
+public:
+    explicit JsonWriter(Print& out) : _out(out) {}
+
+    // Contenedores (sueltos, como valor de array o raíz)
+    void beginObject() { _beforeValue(); _out.write('{'); _push(); }
+    void endObject() { _depth--; _out.write('}'); }
+    void beginArray() { _beforeValue(); _out.write('['); _push(); }
+    void endArray() { _depth--; _out.write(']'); }
+
+    // Contenedores como miembro
+    void beginObject(const JsonKey& k) { key(k); beginObject(); }
+    void beginArray(const JsonKey& k) { key(k); beginArray(); }
+
+    void key(const JsonKey& k) {
+        _comma();
+        _out.write((const uint8_t*)k.text, k.len);
+        _afterKey = true;
+    }
+
+    // Miembro clave: valor
+    template <typename T>
+    void field(const JsonKey& k, const T& v) { key(k); value(v); }
+    void field(const JsonKey& k, double v, uint8_t decimals) { key(k); value(v, decimals); }
+
+    // Valores
+    void value(bool b) {
+        _beforeValue();
+        if (b) _out.write((const uint8_t*)"true", 4);
+        else _out.write((const uint8_t*)"false", 5);
+    }
+    void value(int v) { _beforeValue(); _out.print(v); }
+    void value(unsigned int v) { _beforeValue(); _out.print(v); }
+    void value(long v) { _beforeValue(); _out.print(v); }
+    void value(unsigned long v) { _beforeValue(); _out.print(v); }
+    void value(double v, uint8_t decimals = 2) {
+        _beforeValue();
+        if (isnan(v) || isinf(v)) _out.write((const uint8_t*)"null", 4);
+        else _out.print(v, decimals);
+    }
+    void value(const String& s) { value(s.c_str()); }
+    void value(const char* s) {
+        _beforeValue();
+        if (!s) {
+            _out.write((const uint8_t*)"null", 4);
+            return;
+        }
+        _out.write('"');
+        _escaped(s);
+        _out.write('"');
+    }
+    void null() { _beforeValue(); _out.write((const uint8_t*)"null", 4); }
+
+    // JSON ya armado (otro snapshot), se copia tal cual
+    void raw(const char* json, size_t len) {
+        _beforeValue();
+        _out.write((const uint8_t*)json, len);
+    }
+
+private:
+    Print& _out;
+    uint32_t _hasItems = 0;         // Bit por nivel: ya hay un elemento → coma
+    uint8_t _depth = 0;
+    bool _afterKey = false;
+
+    void _push() {
+        _depth++;
+        _hasItems &= ~(1UL << _depth);
+    }
+
+    void _comma() {
+        uint32_t bit = 1UL << _depth;
+        if (_hasItems & bit) _out.write(',');
+        else _hasItems |= bit;
+    }
+
+    void _beforeValue() {
+        if (_afterKey) _afterKey = false;
+        else _comma();
+    }
+
+    // Copia por tramos los caracteres que no necesitan escape
+    void _escaped(const char* s) {
+        const char* run = s;
+        for (; *s; s++) {
+            uint8_t c = (uint8_t)*s;
+            if (c >= 0x20 && c != '"' && c != '\\') continue;
+            if (s > run) _out.write((const uint8_t*)run, s - run);
+            run = s + 1;
+            switch (c) {
+                case '"':  _out.write((const uint8_t*)"\\\"", 2); break;
+                case '\\': _out.write((const uint8_t*)"\\\\", 2); break;
+                case '\n': _out.write((const uint8_t*)"\\n", 2); break;
+                case '\r': _out.write((const uint8_t*)"\\r", 2); break;
+                case '\t': _out.write((const uint8_t*)"\\t", 2); break;
+                default: {
+                    char esc[7];
+                    snprintf(esc, sizeof(esc), "\\u%04x", c);
+                    _out.write((const uint8_t*)esc, 6);
+                }
+            }
+        }
+        if (s > run) _out.write((const uint8_t*)run, s - run);
+    }
+};
+
+#endif
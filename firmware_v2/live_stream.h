@@ -0,0 +1,263 @@
+/*
+ * ============================================================================
+ * LIVE_STREAM.H - STREAM EN VIVO POR SERVER-SENT EVENTS v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * GET /api/stream (text/event-stream) reemplaza el polling de /api/status
+ * cada 2 seg: el dashboard recibe solo lo que cambió, apenas cambia.
+ *
+ * Eventos:
+ *   snapshot → /api/status completo (al conectar o si no se puede retomar)
+ *   delta    → solo los campos cambiados, con la misma forma que
+ *              /api/status: {"sensor":{"temp_avg":-19.8},"system":{...}}
+ *   ka       → keepalive cada STREAM_KEEPALIVE_MS con los contadores que
+ *              cambian siempre (uptime, RSSI), que no generan deltas
+ *
+ * Cada snapshot/delta lleva un id creciente. Si el navegador se reconecta
+ * con Last-Event-ID y los eventos que le faltan siguen en el anillo
+ * (STREAM_HISTORY), se le reenvían; si no, recibe un snapshot nuevo.
+ *
+ * Disparo: readSensors(), changeState(), las alertas y los comandos web
+ * llaman a statusNotify() y el loop publica una versión nueva del
+ * snapshot de /api/status (status_cache.h). streamLoop() parsea esa
+ * versión, la compara contra la última enviada y emite el delta en la
+ * misma vuelta del loop. Una sola lista de campos para los dos.
+ *
+ * Memoria: el snapshot se parsea copiando claves y textos (viene de un
+ * buffer que el loop reescribe), así que cada documento ocupa bastante
+ * más que el JSON: STREAM_DOC_BYTES para el anterior, el actual y el
+ * delta (un delta puede ser el snapshot entero, p. ej. tras un cambio de
+ * estado). Si aun así algo no entra, el evento lleva el snapshot completo
+ * (valores absolutos, se aplica igual que un delta) y se cuenta en
+ * /api/status → stream.errors.
+ *
+ * ============================================================================
+ */
+
+#ifndef LIVE_STREAM_H
+#define LIVE_STREAM_H
+
+#include <WiFi.h>
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+#include "config.h"
+#include "types.h"
+#include "status_cache.h"
+#include "log.h"
+
+extern SystemState state;
+
+// ============================================================================
+// ESTADO DEL STREAM
+// ============================================================================
+struct StreamEvent {
+    uint32_t id;
+    String data;
+};
+
+struct StreamStats {
+    uint32_t deltas;
+    uint32_t snapshots;             // Enviados al conectar
+    uint32_t resumed;               // Reconexiones retomadas desde el anillo
+    uint32_t rejected;              // Cerradas por STREAM_MAX_CLIENTS
+    uint32_t full;                  // Enviados como snapshot completo (delta no entró)
+    uint32_t errors;                // Snapshot que no se pudo parsear o delta que no entró
+    uint32_t lastDeltaBytes;
+};
+
+AsyncEventSource streamEvents("/api/stream");
+SemaphoreHandle_t streamMutex = nullptr;
+
+StaticJsonDocument<STREAM_DOC_BYTES> streamPrev;    // Último estado enviado
+bool streamPrevValid = false;               // streamPrev parseado entero
+StreamEvent streamRing[STREAM_HISTORY];
+uint32_t streamSeq = 0;                     // id del último evento
+uint32_t streamVersion = 0;                 // Versión de status_cache ya comparada
+StreamStats streamStats = {};
+
+// ============================================================================
+// DIFERENCIA ENTRE ESTADOS
+// ============================================================================
+// Cambian en cada lectura: viajan en el keepalive, no en los deltas
+bool streamSkipKey(const char* group, const char* key) {
+    if (strcmp(group, "web") == 0 || strcmp(group, "stream") == 0 ||
+        strcmp(group, "cache") == 0) return true;
+    return strcmp(key, "uptime_sec") == 0 || strcmp(key, "wifi_rssi") == 0;
+}
+
+// Copia a out los campos de cur que no están o difieren en prev
+bool streamDiff(JsonObjectConst prev, JsonObjectConst cur, JsonObject out) {
+    bool changed = false;
+    for (JsonPairConst group : cur) {
+        JsonObjectConst curGroup = group.value().as<JsonObjectConst>();
+        if (curGroup.isNull()) continue;
+        const char* groupKey = group.key().c_str();
+        JsonObjectConst prevGroup = prev[groupKey].as<JsonObjectConst>();
+
+        JsonObject outGroup;
+        for (JsonPairConst kv : curGroup) {
+            const char* key = kv.key().c_str();
+            if (streamSkipKey(groupKey, key)) continue;
+            if (!prevGroup.isNull() && prevGroup[key] == kv.value()) continue;
+            if (outGroup.isNull()) outGroup = out.createNestedObject(groupKey);
+            outGroup[key] = kv.value();
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// ============================================================================
+// CONEXIÓN DE UN CLIENTE (tarea AsyncTCP)
+// ============================================================================
+void streamOnConnect(AsyncEventSourceClient* client) {
+    if (streamEvents.count() > STREAM_MAX_CLIENTS) {
+        streamStats.rejected++;
+        client->close();
+        return;
+    }
+
+    // El mutex ordena este envío con los deltas del loop: sin huecos
+    // ni repetidos entre el snapshot (o la reanudación) y lo que sigue
+    xSemaphoreTake(streamMutex, portMAX_DELAY);
+    uint32_t lastId = client->lastId();
+    bool resumable = lastId > 0 && lastId <= streamSeq &&
+                     streamSeq - lastId < STREAM_HISTORY;
+
+    if (resumable) {
+        for (uint32_t id = lastId + 1; id <= streamSeq; id++) {
+            StreamEvent& ev = streamRing[id % STREAM_HISTORY];
+            client->send(ev.data.c_str(), "delta", ev.id, STREAM_RETRY_MS);
+        }
+        streamStats.resumed++;
+    } else {
+        // Puede ser una versión más nueva que la del último delta: el delta
+        // siguiente trae valores absolutos, aplicarlo de nuevo no cambia nada
+        String snapshot;
+        statusCacheCopy(snapshot);
+        client->send(snapshot.c_str(), "snapshot", streamSeq, STREAM_RETRY_MS);
+        streamStats.snapshots++;
+    }
+    xSemaphoreGive(streamMutex);
+}
+
+// ============================================================================
+// INICIALIZACIÓN (antes de server.begin(), con el caché ya publicado)
+// ============================================================================
+void streamInit(AsyncWebServer& srv) {
+    streamMutex = xSemaphoreCreateMutex();
+
+    const StatusSnapshot& snap = statusCacheFront();
+    streamPrevValid = !deserializeJson(streamPrev, snap.data, snap.len);
+    streamVersion = snap.version;
+    // Arranca al azar: un Last-Event-ID de antes de un reinicio no coincide
+    // con el anillo nuevo y ese cliente recibe snapshot (0 = "sin id")
+    streamSeq = (esp_random() >> 1) | 1;
+
+    streamEvents.onConnect(streamOnConnect);
+    srv.addHandler(&streamEvents);
+    Serial.printf("[STREAM] SSE en /api/stream (máx %d clientes)\n", STREAM_MAX_CLIENTS);
+}
+
+// ============================================================================
+// ERRORES (parseo o delta que no entra)
+// ============================================================================
+void streamError(const char* what, const char* detail) {
+    static unsigned long lastLog = 0;
+    static uint32_t lastLogCount = 0;
+    streamStats.errors++;
+    if (lastLogCount == 0 || millis() - lastLog >= STREAM_ERROR_LOG_MS) {
+        LOG_E("[STREAM] ✗ %s: %s (%lu veces); se envía el snapshot completo",
+              what, detail, (unsigned long)(streamStats.errors - lastLogCount));
+        lastLog = millis();
+        lastLogCount = streamStats.errors;
+    }
+}
+
+// Guarda el evento en el anillo y lo manda a los clientes conectados
+void streamPublish(String& data) {
+    streamStats.deltas++;
+    streamStats.lastDeltaBytes = data.length();
+
+    xSemaphoreTake(streamMutex, portMAX_DELAY);
+    uint32_t id = ++streamSeq;
+    StreamEvent& ev = streamRing[id % STREAM_HISTORY];
+    ev.id = id;
+    ev.data = std::move(data);
+    if (streamEvents.count() > 0) {
+        streamEvents.send(ev.data.c_str(), "delta", id);
+    }
+    xSemaphoreGive(streamMutex);
+}
+
+// ============================================================================
+// LOOP DEL STREAM (llamar en cada vuelta, después de sensores y alertas)
+// ============================================================================
+void streamLoop() {
+    static unsigned long lastKeepalive = 0;
+
+    const StatusSnapshot& snap = statusCacheFront();
+    if (snap.version != streamVersion) {
+        streamVersion = snap.version;
+
+        // Estáticos: 12 KB que no pueden ir en el stack de la tarea del loop
+        static StaticJsonDocument<STREAM_DOC_BYTES> cur;
+        static StaticJsonDocument<STREAM_DOC_BYTES> delta;
+        DeserializationError err = deserializeJson(cur, snap.data, snap.len);
+        String data;
+
+        if (err) {
+            streamError("No se pudo parsear /api/status", err.c_str());
+            streamPrevValid = false;
+            data.concat(snap.data, snap.len);
+        } else if (!streamPrevValid) {
+            // Sin estado anterior confiable: el snapshot entero como delta
+            data.concat(snap.data, snap.len);
+            streamStats.full++;
+        } else if (streamDiff(streamPrev.as<JsonObjectConst>(), cur.as<JsonObjectConst>(),
+                              delta.to<JsonObject>())) {
+            if (delta.overflowed()) {
+                streamError("El delta no entra", "STREAM_DOC_BYTES");
+                data.concat(snap.data, snap.len);
+                streamStats.full++;
+            } else {
+                serializeJson(delta, data);
+            }
+        }
+
+        if (data.length() > 0) streamPublish(data);
+        if (!err) {
+            streamPrev.set(cur);
+            streamPrevValid = !streamPrev.overflowed();
+        }
+    }
+
+    if (millis() - lastKeepalive >= STREAM_KEEPALIVE_MS) {
+        lastKeepalive = millis();
+        if (streamEvents.count() > 0) {
+            char ka[80];
+            snprintf(ka, sizeof(ka), "{\"system\":{\"uptime_sec\":%lu,\"wifi_rssi\":%d}}",
+                     (millis() - state.bootTime) / 1000, (int)WiFi.RSSI());
+            // Sin id: no mueve el Last-Event-ID del navegador
+            streamEvents.send(ka, "ka");
+        }
+    }
+}
+
+// ============================================================================
+// JSON DE ESTADÍSTICAS (para /api/status)
+// ============================================================================
+void writeStreamStatsJSON(JsonWriter& w) {
+    w.field(JK(clients), (unsigned long)streamEvents.count());
+    w.field(JK(last_id), streamSeq);
+    w.field(JK(deltas), streamStats.deltas);
+    w.field(JK(snapshots), streamStats.snapshots);
+    w.field(JK(resumed), streamStats.resumed);
+    w.field(JK(rejected), streamStats.rejected);
+    w.field(JK(full), streamStats.full);
+    w.field(JK(errors), streamStats.errors);
+    w.field(JK(last_delta_bytes), streamStats.lastDeltaBytes);
+}
+
+#endif
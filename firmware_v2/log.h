@@ -0,0 +1,176 @@
+/*
+ * ============================================================================
+ * LOG.H - LOG SERIAL NO BLOQUEANTE v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * A 115200 baudios salen ~11 KB/s y el FIFO de la UART tiene 128 bytes:
+ * sin buffer, cada Serial.print espera a que salga el texto anterior, y
+ * printStatusJSON (unos KB cada 5 s) frenaba el loop cientos de ms.
+ *
+ * logInit() le da al driver de la UART un ring de LOG_TX_BUFFER_BYTES:
+ * write() copia ahí y vuelve, y la interrupción de la UART lo va pasando
+ * al FIFO. Además, logWrite() nunca espera: si el mensaje no entra entero
+ * en lo que queda libre del ring, se descarta y se cuenta. Cuando vuelve a
+ * haber lugar sale primero "[LOG] ✗ N mensajes descartados".
+ *
+ * Un bloque grande (printStatusJSON) solo entra con el ring casi vacío:
+ * logWriteIfRoom() no lo descarta, y el que llama lo reintenta en las
+ * vueltas siguientes mientras la UART vacía el ring.
+ *
+ *   LOG_E("[NET] ✗ Falla: %d", code);     // Error
+ *   LOG_W("[SENSOR] ⚠️ Sin sondas");       // Advertencia
+ *   LOG_I("[STATE] %s → %s", a, b);        // Información
+ *   LOG_D("[ALERTS] Suspendido");          // Depuración
+ *
+ * Cada llamada es una línea (el '\n' lo agrega el log). Los niveles por
+ * encima de LOG_LEVEL (config.h) no se compilan: ni el formato ni los
+ * argumentos, que por eso no deben tener efectos.
+ *
+ * El lugar libre sale de Serial.availableForWrite(), que con ring cuenta
+ * el ring (core arduino-esp32 2.0.10 o posterior). Los módulos que siguen
+ * con Serial.printf también escriben en el ring: no bloquean salvo que
+ * esté lleno.
+ *
+ * Contadores en /metrics (reefer_log_*).
+ *
+ * ============================================================================
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "config.h"
+
+// ============================================================================
+// NIVELES
+// ============================================================================
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_WARN      2
+#define LOG_LEVEL_INFO      3
+#define LOG_LEVEL_DEBUG     4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// ============================================================================
+// ESTADÍSTICAS
+// ============================================================================
+struct LogStats {
+    uint32_t lines;                 // Mensajes escritos en el ring
+    uint32_t bytes;
+    uint32_t dropped;               // Mensajes descartados por ring lleno
+    uint32_t droppedBytes;
+    uint32_t truncated;             // Líneas cortadas a LOG_LINE_MAX
+    uint32_t pendingDrops;          // Descartados sin aviso todavía
+    uint32_t peakUsed;              // Máximo ocupado del ring visto al escribir
+};
+
+LogStats logStats = {};
+
+// ============================================================================
+// INICIALIZACIÓN (antes de cualquier print)
+// ============================================================================
+void logInit() {
+    // El ring se pide antes de begin(): begin() instala el driver con él
+    Serial.setTxBufferSize(LOG_TX_BUFFER_BYTES);
+    Serial.begin(LOG_BAUD);
+}
+
+// ============================================================================
+// ESCRITURA
+// ============================================================================
+// Cuenta un mensaje descartado (sale en el aviso de la próxima escritura)
+void logCountDrop(size_t len) {
+    logStats.dropped++;
+    logStats.droppedBytes += len;
+    logStats.pendingDrops++;
+}
+
+// Escribe len bytes solo si entran enteros en el ring. Devuelve true si
+// salieron; si no, no escribe ni cuenta nada (el que llama puede reintentar)
+bool logWriteIfRoom(const char* data, size_t len) {
+    size_t room = Serial.availableForWrite();
+
+    char notice[64];
+    size_t noticeLen = 0;
+    if (logStats.pendingDrops) {
+        noticeLen = snprintf(notice, sizeof(notice), "[LOG] ✗ %lu mensajes descartados\n",
+                             (unsigned long)logStats.pendingDrops);
+    }
+
+    if (noticeLen + len > room) return false;
+
+    if (noticeLen) {
+        Serial.write((const uint8_t*)notice, noticeLen);
+        logStats.pendingDrops = 0;
+    }
+    Serial.write((const uint8_t*)data, len);
+
+    uint32_t used = noticeLen + len + (room < LOG_TX_BUFFER_BYTES ? LOG_TX_BUFFER_BYTES - room : 0);
+    if (used > logStats.peakUsed) logStats.peakUsed = used;
+    logStats.lines++;
+    logStats.bytes += len;
+    return true;
+}
+
+// Escribe len bytes solo si entran enteros en el ring; si no, los descarta.
+// Devuelve true si salieron.
+bool logWrite(const char* data, size_t len) {
+    if (logWriteIfRoom(data, len)) return true;
+    logCountDrop(len);
+    return false;
+}
+
+// Formatea una línea (sin '\n' final: lo agrega) y la escribe con logWrite
+void logPrintf(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+void logPrintf(const char* fmt, ...) {
+    char line[LOG_LINE_MAX];
+
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line) - 1, fmt, args);
+    va_end(args);
+    if (n < 0) return;
+
+    size_t len = (size_t)n;
+    if (len > sizeof(line) - 2) {
+        len = sizeof(line) - 2;
+        logStats.truncated++;
+    }
+    line[len++] = '\n';
+    logWrite(line, len);
+}
+
+// ============================================================================
+// MACROS POR NIVEL
+// ============================================================================
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_E(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_W(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_I(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_D(...) do {} while (0)
+#endif
+
+#endif
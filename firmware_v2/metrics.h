@@ -0,0 +1,273 @@
+/*
+ * ============================================================================
+ * METRICS.H - MÉTRICAS INTERNAS EN FORMATO PROMETHEUS v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * GET /metrics (text/plain, formato de exposición de Prometheus 0.0.4):
+ * latencia del loop, readSensors(), requests HTTP salientes por endpoint,
+ * handlers de la API, escrituras NVS, reconexiones WiFi, errores por sonda,
+ * colas de subida, log serial y fragmentación del heap. Sin cable serial.
+ *
+ * Registro fijo: contadores, gauges e histogramas con buckets fijos en
+ * variables globales. Observar es sumar enteros: sin heap, sin Strings,
+ * unos pocos µs en el camino caliente.
+ *
+ * Cada métrica tiene una sola tarea que la escribe (el loop, salvo
+ * web_handler que escribe AsyncTCP). El scrape lee sin lock: un
+ * histograma leído a mitad de una observación puede tener _count uno
+ * adelante de sus buckets, que Prometheus tolera.
+ *
+ *   metricObserve(metrics.sensors, micros() - start);
+ *   metrics.probeErrors[i]++;
+ *
+ * ============================================================================
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include "config.h"
+#include "log.h"
+
+// Opcionales (weak): si el módulo no está compilado, su gauge no sale
+extern int __attribute__((weak)) telegramQueueLength();
+extern int __attribute__((weak)) mqttQueueLength();
+extern int __attribute__((weak)) gprsQueueLength();
+
+// ============================================================================
+// BUCKETS (límites superiores en µs)
+// ============================================================================
+#define METRIC_BUCKETS 12
+
+// loop, readSensors, handlers de la API: de 100 µs a 1 s
+static const uint32_t METRIC_BOUNDS_FAST_US[METRIC_BUCKETS] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+
+// HTTP saliente, NVS, reconexión WiFi: de 5 ms a 30 s
+static const uint32_t METRIC_BOUNDS_SLOW_US[METRIC_BUCKETS] = {
+    5000, 10000, 25000, 50000, 100000, 250000, 500000,
+    1000000, 2500000, 5000000, 10000000, 30000000
+};
+
+// Endpoints HTTP salientes: mismo orden que NetEndpoint (net_health.h)
+#define METRIC_HTTP_TARGETS 2
+static const char* const METRIC_HTTP_LABELS[METRIC_HTTP_TARGETS] = {"supabase", "telegram"};
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+struct MetricHistogram {
+    const uint32_t* bounds;
+    uint32_t buckets[METRIC_BUCKETS + 1];   // No acumulados; el último es +Inf
+    uint32_t count;
+    uint64_t sumUs;
+};
+
+struct Metrics {
+    MetricHistogram loop;
+    MetricHistogram sensors;
+    MetricHistogram webHandler;
+    MetricHistogram httpClient[METRIC_HTTP_TARGETS];
+    MetricHistogram nvsWrite;
+    MetricHistogram wifiReconnect;
+
+    uint32_t httpErrors[METRIC_HTTP_TARGETS];   // Código <= 0 o 5xx
+    uint32_t probeReads[MAX_TEMP_SENSORS];
+    uint32_t probeErrors[MAX_TEMP_SENSORS];     // Fuera de -55..125 (desconectada = -127)
+    uint32_t dhtErrors;
+
+    // Gauges que muestrea el loop (-1 = módulo no compilado)
+    int16_t queueTelegram;
+    int16_t queueMqtt;
+    int16_t queueGprs;
+};
+
+Metrics metrics = {
+    {METRIC_BOUNDS_FAST_US}, {METRIC_BOUNDS_FAST_US}, {METRIC_BOUNDS_FAST_US},
+    {{METRIC_BOUNDS_SLOW_US}, {METRIC_BOUNDS_SLOW_US}},
+    {METRIC_BOUNDS_SLOW_US}, {METRIC_BOUNDS_SLOW_US}
+};
+
+// ============================================================================
+// OBSERVAR (camino caliente)
+// ============================================================================
+void metricObserve(MetricHistogram& h, uint32_t us) {
+    uint8_t i = 0;
+    while (i < METRIC_BUCKETS && us > h.bounds[i]) i++;
+    h.buckets[i]++;
+    h.sumUs += us;
+    h.count++;
+}
+
+// Llamar al final de cada vuelta del loop con el micros() del comienzo
+void metricsLoop(uint32_t loopStartUs) {
+    metricObserve(metrics.loop, micros() - loopStartUs);
+
+    static unsigned long lastSample = 0;
+    if (millis() - lastSample < METRICS_SAMPLE_MS) return;
+    lastSample = millis();
+    metrics.queueTelegram = telegramQueueLength ? telegramQueueLength() : -1;
+    metrics.queueMqtt = mqttQueueLength ? mqttQueueLength() : -1;
+    metrics.queueGprs = gprsQueueLength ? gprsQueueLength() : -1;
+}
+
+// ============================================================================
+// EXPOSICIÓN (tarea AsyncTCP)
+// ============================================================================
+// Todo con print() por partes (Print::printf pide heap en líneas largas)
+// y fin de línea '\n' solo, como pide el formato (println manda "\r\n")
+
+// Segundos exactos desde µs ("0.0025", "30"), sin float
+void metricPrintSeconds(Print& out, uint64_t us) {
+    out.print((unsigned long)(us / 1000000));
+    uint32_t frac = us % 1000000;
+    if (!frac) return;
+    char digits[8];
+    snprintf(digits, sizeof(digits), ".%06lu", (unsigned long)frac);
+    size_t len = 7;
+    while (digits[len - 1] == '0') len--;
+    out.write((const uint8_t*)digits, len);
+}
+
+void metricHeader(Print& out, const char* name, const char* type, const char* help) {
+    out.print("# HELP ");
+    out.print(name);
+    out.print(' ');
+    out.print(help);
+    out.print('\n');
+    out.print("# TYPE ");
+    out.print(name);
+    out.print(' ');
+    out.print(type);
+    out.print('\n');
+}
+
+// name{labels} value. labels sin llaves ("probe=\"1\""), o nullptr
+void metricLine(Print& out, const char* name, const char* suffix, const char* labels, long long value) {
+    out.print(name);
+    if (suffix) out.print(suffix);
+    if (labels) {
+        out.print('{');
+        out.print(labels);
+        out.print('}');
+    }
+    out.print(' ');
+    out.print(value);
+    out.print('\n');
+}
+
+void metricSample(Print& out, const char* name, const char* type, const char* help, long long value) {
+    metricHeader(out, name, type, help);
+    metricLine(out, name, nullptr, nullptr, value);
+}
+
+// Buckets acumulados, _sum y _count (sin encabezado: puede repetirse por label)
+void metricHistogramLines(Print& out, const char* name, const char* labels, const MetricHistogram& h) {
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i <= METRIC_BUCKETS; i++) {
+        cumulative += h.buckets[i];
+        out.print(name);
+        out.print("_bucket{");
+        if (labels) {
+            out.print(labels);
+            out.print(',');
+        }
+        out.print("le=\"");
+        if (i < METRIC_BUCKETS) metricPrintSeconds(out, h.bounds[i]);
+        else out.print("+Inf");
+        out.print("\"} ");
+        out.print(cumulative);
+        out.print('\n');
+    }
+    out.print(name);
+    out.print("_sum");
+    if (labels) {
+        out.print('{');
+        out.print(labels);
+        out.print('}');
+    }
+    out.print(' ');
+    metricPrintSeconds(out, h.sumUs);
+    out.print('\n');
+    metricLine(out, name, "_count", labels, h.count);
+}
+
+void metricHistogram(Print& out, const char* name, const char* help, const MetricHistogram& h) {
+    metricHeader(out, name, "histogram", help);
+    metricHistogramLines(out, name, nullptr, h);
+}
+
+void writeMetrics(Print& out) {
+    char labels[32];
+
+    metricSample(out, "reefer_uptime_seconds", "gauge", "Segundos desde el arranque",
+                 esp_timer_get_time() / 1000000);
+    metricHeader(out, "reefer_build_info", "gauge", "Firmware y equipo");
+    metricLine(out, "reefer_build_info", nullptr,
+               "version=\"" FIRMWARE_VERSION "\",device=\"" DEVICE_ID "\"", 1);
+
+    // Loop y sensores
+    metricHistogram(out, "reefer_loop_duration_seconds", "Vuelta de loop() sin el delay final", metrics.loop);
+    metricHistogram(out, "reefer_read_sensors_duration_seconds", "readSensors()", metrics.sensors);
+    metricHistogram(out, "reefer_web_handler_duration_seconds",
+                    "Handler de la API local hasta entregar la respuesta a AsyncTCP", metrics.webHandler);
+
+    metricHeader(out, "reefer_probe_reads_total", "counter", "Lecturas por sonda DS18B20");
+    for (uint8_t i = 0; i < MAX_TEMP_SENSORS; i++) {
+        snprintf(labels, sizeof(labels), "probe=\"%u\"", i + 1);
+        metricLine(out, "reefer_probe_reads_total", nullptr, labels, metrics.probeReads[i]);
+    }
+    metricHeader(out, "reefer_probe_errors_total", "counter", "Lecturas fuera de rango por sonda DS18B20");
+    for (uint8_t i = 0; i < MAX_TEMP_SENSORS; i++) {
+        snprintf(labels, sizeof(labels), "probe=\"%u\"", i + 1);
+        metricLine(out, "reefer_probe_errors_total", nullptr, labels, metrics.probeErrors[i]);
+    }
+    metricSample(out, "reefer_dht_errors_total", "counter", "Lecturas del DHT22 sin dato", metrics.dhtErrors);
+
+    // HTTP saliente
+    metricHeader(out, "reefer_http_client_duration_seconds", "histogram", "Requests HTTP salientes");
+    for (uint8_t i = 0; i < METRIC_HTTP_TARGETS; i++) {
+        snprintf(labels, sizeof(labels), "endpoint=\"%s\"", METRIC_HTTP_LABELS[i]);
+        metricHistogramLines(out, "reefer_http_client_duration_seconds", labels, metrics.httpClient[i]);
+    }
+    metricHeader(out, "reefer_http_client_errors_total", "counter", "Requests HTTP salientes fallidos (conexión o 5xx)");
+    for (uint8_t i = 0; i < METRIC_HTTP_TARGETS; i++) {
+        snprintf(labels, sizeof(labels), "endpoint=\"%s\"", METRIC_HTTP_LABELS[i]);
+        metricLine(out, "reefer_http_client_errors_total", nullptr, labels, metrics.httpErrors[i]);
+    }
+
+    // NVS y WiFi
+    metricHistogram(out, "reefer_nvs_write_duration_seconds", "Guardado en Preferences (config, uso GPRS)", metrics.nvsWrite);
+    metricHistogram(out, "reefer_wifi_reconnect_duration_seconds", "Tiempo sin WiFi hasta reconectar", metrics.wifiReconnect);
+    metricSample(out, "reefer_wifi_rssi_dbm", "gauge", "RSSI del AP actual", WiFi.RSSI());
+
+    // Colas de subida
+    metricHeader(out, "reefer_upload_queue_depth", "gauge", "Mensajes esperando salir");
+    if (metrics.queueTelegram >= 0) metricLine(out, "reefer_upload_queue_depth", nullptr, "queue=\"telegram\"", metrics.queueTelegram);
+    if (metrics.queueMqtt >= 0) metricLine(out, "reefer_upload_queue_depth", nullptr, "queue=\"mqtt\"", metrics.queueMqtt);
+    if (metrics.queueGprs >= 0) metricLine(out, "reefer_upload_queue_depth", nullptr, "queue=\"gprs\"", metrics.queueGprs);
+
+    // Log serial (log.h): lo que no entró en el ring TX
+    metricSample(out, "reefer_log_lines_total", "counter", "Mensajes de log escritos", logStats.lines);
+    metricSample(out, "reefer_log_dropped_total", "counter", "Mensajes de log descartados por ring TX lleno", logStats.dropped);
+    metricSample(out, "reefer_log_dropped_bytes_total", "counter", "Bytes de log descartados", logStats.droppedBytes);
+    metricSample(out, "reefer_log_tx_peak_bytes", "gauge", "Máximo ocupado del ring TX", logStats.peakUsed);
+
+    // Heap: libre, mínimo y bloque más grande (fragmentación)
+    size_t freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    metricSample(out, "reefer_heap_free_bytes", "gauge", "Heap libre", freeHeap);
+    metricSample(out, "reefer_heap_min_free_bytes", "gauge", "Mínimo de heap libre desde el arranque",
+                 heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+    metricSample(out, "reefer_heap_largest_free_block_bytes", "gauge", "Bloque libre más grande", largest);
+    metricSample(out, "reefer_heap_fragmentation_percent", "gauge", "100 - bloque más grande / libre",
+                 freeHeap ? 100 - (long long)(100ULL * largest / freeHeap) : 0);
+}
+
+#endif
@@ -0,0 +1,459 @@
+/*
+ * ============================================================================
+ * MQTT_TRANSPORT.H - TRANSPORTE MQTT v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * Alternativa a supabase.h para sitios con broker propio:
+ *
+ * - Lecturas compactas (claves cortas, sin nombres) cada 5 seg
+ * - Eventos (alertas, respuestas a comandos) en su propio tópico
+ * - QoS1 + sesión persistente (cleanSession = false, client id fijo):
+ *   el broker guarda los comandos mientras el equipo está desconectado
+ * - Buffer circular en RAM: lo que no se pudo publicar se reenvía en
+ *   orden al reconectar (se descarta lo más viejo si se llena)
+ * - Estado retenido "online" + testamento (LWT) "offline"
+ * - Comandos en una cola FIFO (MQTT_CMD_SLOTS): al reconectar el broker
+ *   entrega de una vez todo lo guardado en la sesión
+ *
+ * Tópicos (MQTT_TOPIC_PREFIX = "reefer"):
+ *   reefer/<DEVICE_ID>/readings   →  {"ts":..,"t":[..],"avg":..,"h":..,"d":0,"r":0,"st":0,"al":0}
+ *   reefer/<DEVICE_ID>/events     →  {"ts":..,"type":"temperature","sev":"critical","msg":".."}
+ *   reefer/<DEVICE_ID>/status     →  "online" / "offline" (retenido)
+ *   reefer/<DEVICE_ID>/cmd        ←  "ack_alert", "relay_on", "relay_off", "toggle_relay",
+ *                                    "defrost_start", "defrost_end"
+ *
+ * El transporte activo se elige en runtime (config.transport, /api/config)
+ * y se guarda en flash. Ver transportSync() / transportSendAlert().
+ *
+ * REQUIERE: librería "MQTT" de Joel Gaehwiler (256dpi/arduino-mqtt)
+ *
+ * ============================================================================
+ */
+
+#ifndef MQTT_TRANSPORT_H
+#define MQTT_TRANSPORT_H
+
+#include <WiFi.h>
+#include <MQTT.h>
+#include <time.h>
+#include <stdarg.h>
+#include "config.h"
+#include "types.h"
+#include "json_writer.h"
+
+extern Config config;
+extern SystemState state;
+extern SensorData sensorData;
+
+extern void acknowledgeAlert();
+extern void setRelay(bool on);
+extern void enterDefrostMode(const char* triggeredBy);
+extern void exitDefrostMode();
+extern void supabaseSync();
+extern void sendAlertToSupabase(String alertType, String severity, String message);
+
+// ============================================================================
+// TÓPICOS
+// ============================================================================
+#define MQTT_TOPIC_BASE     MQTT_TOPIC_PREFIX "/" DEVICE_ID
+#define MQTT_TOPIC_READINGS MQTT_TOPIC_BASE "/readings"
+#define MQTT_TOPIC_EVENTS   MQTT_TOPIC_BASE "/events"
+#define MQTT_TOPIC_STATUS   MQTT_TOPIC_BASE "/status"
+#define MQTT_TOPIC_CMD      MQTT_TOPIC_BASE "/cmd"
+
+#define MQTT_KEEPALIVE_SEC  30
+#define MQTT_TIMEOUT_MS     1500        // Espera de PUBACK/CONNACK
+#define MQTT_FLUSH_PER_LOOP 4           // Mensajes del buffer por vuelta de loop
+
+enum MqttMsgKind : uint8_t {
+    MQTT_MSG_READING = 0,
+    MQTT_MSG_EVENT
+};
+
+// ============================================================================
+// OBJETOS Y ESTADO
+// ============================================================================
+WiFiClient mqttNet;
+MQTTClient mqtt(MQTT_MSG_MAX_BYTES + 64);
+
+struct MqttOfflineMsg {
+    uint8_t kind;
+    uint16_t length;
+    char payload[MQTT_MSG_MAX_BYTES];
+};
+
+struct MqttState {
+    bool started;
+    unsigned long lastConnectAttempt;
+    unsigned long lastReading;
+
+    // Comandos recibidos, se ejecutan fuera del callback (FIFO circular)
+    char cmdQueue[MQTT_CMD_SLOTS][32];
+    uint8_t cmdHead;
+    uint8_t cmdCount;
+
+    // Buffer offline (FIFO circular)
+    MqttOfflineMsg queue[MQTT_OFFLINE_SLOTS];
+    uint8_t head;
+    uint8_t count;
+
+    // Estadísticas
+    unsigned long published;
+    unsigned long queued;
+    unsigned long dropped;
+    unsigned long oversize;         // Mensajes de más de MQTT_MSG_MAX_BYTES, descartados
+    unsigned long reconnects;
+    unsigned long commands;
+    unsigned long cmdDropped;       // Comandos perdidos con la cola llena
+};
+
+MqttState mqttState;
+
+// ============================================================================
+// FORMATO ACOTADO
+// ============================================================================
+// Agrega al buffer a partir de n. Si no entra, devuelve size y todo lo que
+// siga queda anulado: el que llama descarta el mensaje con n >= size.
+static size_t mqttAppendf(char* buf, size_t size, size_t n, const char* fmt, ...)
+    __attribute__((format(printf, 4, 5)));
+static size_t mqttAppendf(char* buf, size_t size, size_t n, const char* fmt, ...) {
+    if (n >= size) return size;
+    va_list args;
+    va_start(args, fmt);
+    int w = vsnprintf(buf + n, size - n, fmt, args);
+    va_end(args);
+    if (w < 0 || (size_t)w >= size - n) return size;
+    return n + w;
+}
+
+// ============================================================================
+// TIMESTAMP (epoch si hay NTP, si no segundos desde el arranque)
+// ============================================================================
+static size_t mqttAppendTimestamp(char* buf, size_t size, size_t n) {
+    time_t now = time(nullptr);
+    if (now > 1600000000) {
+        return mqttAppendf(buf, size, n, "\"ts\":%lu", (unsigned long)now);
+    }
+    return mqttAppendf(buf, size, n, "\"up\":%lu", (millis() - state.bootTime) / 1000);
+}
+
+// ============================================================================
+// BUFFER OFFLINE
+// ============================================================================
+void mqttEnqueue(uint8_t kind, const char* payload, size_t length) {
+    if (length >= MQTT_MSG_MAX_BYTES) {
+        mqttState.oversize++;
+        return;
+    }
+
+    if (mqttState.count == MQTT_OFFLINE_SLOTS) {
+        // Lleno: se pierde el mensaje más viejo
+        mqttState.head = (mqttState.head + 1) % MQTT_OFFLINE_SLOTS;
+        mqttState.count--;
+        mqttState.dropped++;
+    }
+
+    uint8_t slot = (mqttState.head + mqttState.count) % MQTT_OFFLINE_SLOTS;
+    mqttState.queue[slot].kind = kind;
+    mqttState.queue[slot].length = length;
+    memcpy(mqttState.queue[slot].payload, payload, length);
+    mqttState.count++;
+    mqttState.queued++;
+}
+
+static const char* mqttTopicFor(uint8_t kind) {
+    return kind == MQTT_MSG_EVENT ? MQTT_TOPIC_EVENTS : MQTT_TOPIC_READINGS;
+}
+
+// Publica respetando el orden: si hay cola, el mensaje va al final
+bool mqttPublish(uint8_t kind, const char* payload, size_t length) {
+    if (mqttState.count == 0 && mqtt.connected()) {
+        if (mqtt.publish(mqttTopicFor(kind), payload, length, false, 1)) {
+            mqttState.published++;
+            return true;
+        }
+    }
+    mqttEnqueue(kind, payload, length);
+    return false;
+}
+
+void mqttFlushQueue() {
+    int sent = 0;
+    while (mqttState.count > 0 && sent < MQTT_FLUSH_PER_LOOP && mqtt.connected()) {
+        MqttOfflineMsg& msg = mqttState.queue[mqttState.head];
+        if (!mqtt.publish(mqttTopicFor(msg.kind), msg.payload, msg.length, false, 1)) {
+            break;  // Sin PUBACK: queda en la cola
+        }
+        mqttState.head = (mqttState.head + 1) % MQTT_OFFLINE_SLOTS;
+        mqttState.count--;
+        mqttState.published++;
+        sent++;
+    }
+    if (sent > 0 && mqttState.count == 0) {
+        Serial.println("[MQTT] ✓ Buffer offline vaciado");
+    }
+}
+
+// ============================================================================
+// LECTURA COMPACTA
+// ============================================================================
+// ~100 bytes contra ~600 del JSON de supabaseSendReading()
+void mqttPublishReading() {
+    char buf[MQTT_MSG_MAX_BYTES];
+    size_t n = 0;
+
+    n = mqttAppendf(buf, sizeof(buf), n, "{");
+    n = mqttAppendTimestamp(buf, sizeof(buf), n);
+    n = mqttAppendf(buf, sizeof(buf), n, ",\"t\":[");
+
+    bool first = true;
+    for (int i = 0; i < MAX_TEMP_SENSORS; i++) {
+        if (!config.tempSensorEnabled[i]) continue;
+        if (sensorData.temp[i].valid) {
+            n = mqttAppendf(buf, sizeof(buf), n, first ? "%.1f" : ",%.1f", sensorData.temp[i].value);
+        } else {
+            n = mqttAppendf(buf, sizeof(buf), n, first ? "null" : ",null");
+        }
+        first = false;
+    }
+
+    uint8_t doors = 0;
+    for (int i = 0; i < MAX_DOOR_SENSORS; i++) {
+        if (sensorData.door[i].isOpen) doors |= (1 << i);
+    }
+    uint8_t relays = 0;
+    for (int i = 0; i < MAX_RELAYS; i++) {
+        if (sensorData.relay[i].state) relays |= (1 << i);
+    }
+
+    n = mqttAppendf(buf, sizeof(buf), n, "],\"avg\":%.1f", sensorData.tempAvg);
+    if (config.dht22Enabled && sensorData.dhtValid) {
+        n = mqttAppendf(buf, sizeof(buf), n, ",\"h\":%.0f", sensorData.humidity);
+    }
+    n = mqttAppendf(buf, sizeof(buf), n, ",\"d\":%u,\"r\":%u,\"st\":%d,\"al\":%d,\"rssi\":%d}",
+                    doors, relays, (int)state.currentState,
+                    state.alertActive ? (state.alertCritical ? 2 : 1) : 0,
+                    (int)WiFi.RSSI());
+
+    if (n >= sizeof(buf)) {         // Truncado: no publicar JSON roto
+        mqttState.oversize++;
+        return;
+    }
+    mqttPublish(MQTT_MSG_READING, buf, n);
+}
+
+// ============================================================================
+// EVENTOS
+// ============================================================================
+static bool mqttWriteEvent(JsonBufferPrint& out, const char* type, const char* severity,
+                           const char* message) {
+    JsonWriter w(out);
+    w.beginObject();
+    time_t now = time(nullptr);
+    if (now > 1600000000) w.field(JK(ts), (unsigned long)now);
+    else w.field(JK(up), (millis() - state.bootTime) / 1000);
+    w.field(JK(type), type);
+    w.field(JK(sev), severity);
+    w.field(JK(msg), message);
+    w.endObject();
+    return !out.overflow();
+}
+
+// Escapado por json_writer.h (comillas, barras y caracteres de control).
+// Si no entra, el mensaje se recorta (sin partir un carácter UTF-8)
+void mqttPublishEvent(const char* type, const char* severity, const char* message) {
+    char buf[MQTT_MSG_MAX_BYTES];
+    char msg[MQTT_MSG_MAX_BYTES];
+    size_t len = strlcpy(msg, message, sizeof(msg));
+    if (len >= sizeof(msg)) len = sizeof(msg) - 1;
+
+    while (true) {
+        JsonBufferPrint out(buf, sizeof(buf));
+        if (mqttWriteEvent(out, type, severity, msg)) {
+            mqttPublish(MQTT_MSG_EVENT, buf, out.length());
+            return;
+        }
+        if (len == 0) {             // Ni el encabezado entra: no publicar
+            mqttState.oversize++;
+            return;
+        }
+        len -= (len + 3) / 4;
+        while (len > 0 && ((uint8_t)msg[len] & 0xC0) == 0x80) len--;
+        msg[len] = '\0';
+    }
+}
+
+// ============================================================================
+// COMANDOS (tópico /cmd)
+// ============================================================================
+void mqttOnMessage(String& topic, String& payload) {
+    // Se ejecuta dentro de mqtt.loop() (o esperando un PUBACK): solo
+    // encolar, se ejecutan después en orden
+    if (topic != MQTT_TOPIC_CMD) return;
+    if (mqttState.cmdCount == MQTT_CMD_SLOTS) {
+        mqttState.cmdDropped++;
+        return;
+    }
+    payload.trim();
+    uint8_t slot = (mqttState.cmdHead + mqttState.cmdCount) % MQTT_CMD_SLOTS;
+    strlcpy(mqttState.cmdQueue[slot], payload.c_str(), sizeof(mqttState.cmdQueue[slot]));
+    mqttState.cmdCount++;
+}
+
+void mqttExecuteCommand(const char* cmd) {
+    mqttState.commands++;
+
+    Serial.printf("[MQTT] Comando recibido: %s\n", cmd);
+
+    bool ok = true;
+    if (strcmp(cmd, "ack_alert") == 0 || strcmp(cmd, "stop_alert") == 0) {
+        acknowledgeAlert();
+    } else if (strcmp(cmd, "relay_on") == 0) {
+        setRelay(true);
+    } else if (strcmp(cmd, "relay_off") == 0) {
+        setRelay(false);
+    } else if (strcmp(cmd, "toggle_relay") == 0) {
+        setRelay(!sensorData.relay[0].state);
+    } else if (strcmp(cmd, "defrost_start") == 0) {
+        enterDefrostMode("mqtt");
+    } else if (strcmp(cmd, "defrost_end") == 0) {
+        exitDefrostMode();
+    } else {
+        ok = false;
+        Serial.printf("[MQTT] Comando desconocido: %s\n", cmd);
+    }
+
+    mqttPublishEvent("command", ok ? "info" : "warning", cmd);
+}
+
+// Publicar la respuesta puede entregar más comandos (mqtt.loop() interno
+// esperando el PUBACK): quedan al final de la cola y salen en esta vuelta
+void mqttExecutePendingCommands() {
+    static bool running = false;
+    if (running) return;
+    running = true;
+    while (mqttState.cmdCount > 0) {
+        char cmd[sizeof(mqttState.cmdQueue[0])];
+        strlcpy(cmd, mqttState.cmdQueue[mqttState.cmdHead], sizeof(cmd));
+        mqttState.cmdHead = (mqttState.cmdHead + 1) % MQTT_CMD_SLOTS;
+        mqttState.cmdCount--;
+        mqttExecuteCommand(cmd);
+    }
+    running = false;
+}
+
+// ============================================================================
+// CONEXIÓN
+// ============================================================================
+void mqttInit() {
+    memset(&mqttState, 0, sizeof(mqttState));
+
+    mqtt.begin(MQTT_BROKER_HOST, MQTT_BROKER_PORT, mqttNet);
+    mqtt.setOptions(MQTT_KEEPALIVE_SEC, false, MQTT_TIMEOUT_MS);  // cleanSession = false
+    mqtt.setWill(MQTT_TOPIC_STATUS, "offline", true, 1);
+    mqtt.onMessage(mqttOnMessage);
+    mqttState.started = true;
+
+    Serial.printf("[MQTT] Broker: %s:%d (%s)\n", MQTT_BROKER_HOST, MQTT_BROKER_PORT, MQTT_TOPIC_BASE);
+}
+
+bool mqttConnect() {
+    mqttState.lastConnectAttempt = millis();
+
+    const char* user = strlen(MQTT_USER) > 0 ? MQTT_USER : nullptr;
+    const char* pass = strlen(MQTT_PASSWORD) > 0 ? MQTT_PASSWORD : nullptr;
+
+    // Client id fijo = DEVICE_ID, necesario para que el broker recuerde la sesión
+    if (!mqtt.connect(DEVICE_ID, user, pass)) {
+        Serial.printf("[MQTT] ✗ Sin conexión al broker (error %d, rc %d)\n",
+                      (int)mqtt.lastError(), (int)mqtt.returnCode());
+        return false;
+    }
+
+    mqttState.reconnects++;
+
+    // Con sesión persistente la suscripción ya existe en el broker
+    if (!mqtt.sessionPresent()) {
+        mqtt.subscribe(MQTT_TOPIC_CMD, 1);
+    }
+    mqtt.publish(MQTT_TOPIC_STATUS, "online", true, 1);
+
+    Serial.printf("[MQTT] ✓ Conectado (sesión %s, %u en buffer)\n",
+                  mqtt.sessionPresent() ? "recuperada" : "nueva", mqttState.count);
+    return true;
+}
+
+void mqttDisconnect() {
+    if (!mqttState.started) return;
+    if (mqtt.connected()) {
+        mqtt.publish(MQTT_TOPIC_STATUS, "offline", true, 1);
+        mqtt.disconnect();
+        Serial.println("[MQTT] Desconectado");
+    }
+}
+
+// ============================================================================
+// LOOP
+// ============================================================================
+void mqttLoop() {
+    if (!mqttState.started) mqttInit();
+
+    unsigned long now = millis();
+
+    if (state.wifiConnected && !mqtt.connected() &&
+        now - mqttState.lastConnectAttempt >= INTERVAL_MQTT_RECONNECT_MS) {
+        mqttConnect();
+    }
+
+    mqtt.loop();
+    mqttExecutePendingCommands();
+
+    if (mqtt.connected()) {
+        mqttFlushQueue();
+    }
+
+    // Las lecturas se generan aunque no haya broker (van al buffer)
+    if (now - mqttState.lastReading >= INTERVAL_MQTT_PUBLISH_MS) {
+        mqttState.lastReading = now;
+        mqttPublishReading();
+    }
+}
+
+int mqttQueueLength() {
+    return mqttState.count;
+}
+
+void getMqttJSON(JsonObject& obj) {
+    obj["connected"] = mqtt.connected();
+    obj["broker"] = MQTT_BROKER_HOST;
+    obj["published"] = mqttState.published;
+    obj["buffered"] = mqttState.count;
+    obj["dropped"] = mqttState.dropped;
+    obj["oversize"] = mqttState.oversize;
+    obj["reconnects"] = mqttState.reconnects;
+    obj["commands"] = mqttState.commands;
+    obj["commands_dropped"] = mqttState.cmdDropped;
+}
+
+// ============================================================================
+// SELECCIÓN DE TRANSPORTE (runtime, config.transport)
+// ============================================================================
+void transportSync() {
+    if (config.transport == TRANSPORT_MQTT) {
+        mqttLoop();
+    } else {
+        mqttDisconnect();
+        supabaseSync();
+    }
+}
+
+void transportSendAlert(String alertType, String severity, String message) {
+    if (config.transport == TRANSPORT_MQTT) {
+        mqttPublishEvent(alertType.c_str(), severity.c_str(), message.c_str());
+    } else {
+        sendAlertToSupabase(alertType, severity, message);  // WiFi o GPRS (ver supabaseUpload)
+    }
+}
+
+#endif // MQTT_TRANSPORT_H
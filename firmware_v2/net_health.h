@@ -0,0 +1,335 @@
+/*
+ * ============================================================================
+ * NET_HEALTH.H - SALUD DE CONECTIVIDAD POR ENDPOINT v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * Reemplaza la prueba periódica a generate_204 (GET bloqueante de hasta
+ * 5 seg cada 30 seg que además no decía nada de Supabase).
+ *
+ * Detección pasiva: cada módulo informa el resultado de sus requests
+ * reales (netReport) y consulta antes de intentar (netAllow). Por endpoint
+ * hay un circuit breaker:
+ *
+ *   CLOSED     → todo pasa; NET_FAILURE_THRESHOLD fallas seguidas lo abren
+ *   OPEN       → no se intenta nada (no se traba el loop en timeouts);
+ *                se sondea con TCP connect corto, con backoff + jitter
+ *   HALF_OPEN  → la sonda conectó: pasa UN request real de prueba y los
+ *                demás se rechazan hasta que informe. Si sale bien →
+ *                CLOSED; si falla → OPEN con más backoff
+ *
+ * Las sondas existen solo con el circuito abierto: con tráfico normal
+ * no se genera ni un paquete extra.
+ *
+ * Caché DNS por endpoint (TTL NET_DNS_TTL_MS): la sonda no resuelve el
+ * nombre cada vez y, si el DNS falla durante un corte, usa la última IP
+ * buena. Los requests HTTP resuelven por su cuenta (lwIP tiene su caché).
+ *
+ * state.internetAvailable = WiFi conectado y algún endpoint no abierto.
+ *
+ * ============================================================================
+ */
+
+#ifndef NET_HEALTH_H
+#define NET_HEALTH_H
+
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include "config.h"
+#include "types.h"
+#include "metrics.h"
+#include "json_writer.h"
+
+extern SystemState state;
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+typedef enum {
+    NET_EP_SUPABASE = 0,
+    NET_EP_TELEGRAM,
+    NET_EP_COUNT
+} NetEndpoint;
+
+static_assert(NET_EP_COUNT == METRIC_HTTP_TARGETS, "METRIC_HTTP_LABELS (metrics.h) sigue a NetEndpoint");
+
+typedef enum {
+    CIRCUIT_CLOSED = 0,
+    CIRCUIT_OPEN,
+    CIRCUIT_HALF_OPEN
+} CircuitState;
+
+struct EndpointHealth {
+    const char* name;
+    char host[64];
+    uint16_t port;
+
+    CircuitState circuit;
+    uint8_t consecutiveFailures;
+    uint8_t openLevel;              // Veces que se reabrió seguido (backoff)
+    unsigned long openedAt;
+    unsigned long nextProbeAt;
+    bool trialInFlight;             // HALF_OPEN: el request de prueba ya salió
+    unsigned long trialStartedAt;
+
+    // Caché DNS
+    IPAddress ip;
+    bool ipValid;
+    unsigned long resolvedAt;
+
+    // Estadísticas
+    unsigned long successes;
+    unsigned long failures;
+    unsigned long probes;
+    unsigned long rejected;         // Requests no intentados por circuito abierto
+    int lastCode;
+    unsigned long lastLatencyMs;
+    unsigned long lastSuccessAt;
+};
+
+EndpointHealth netEndpoints[NET_EP_COUNT];
+
+// ============================================================================
+// INICIALIZACIÓN
+// ============================================================================
+
+// "https://xxxx.supabase.co/..." → "xxxx.supabase.co"
+void netHostFromUrl(const char* url, char* host, size_t len) {
+    const char* start = strstr(url, "://");
+    start = start ? start + 3 : url;
+    size_t n = strcspn(start, "/:");
+    if (n >= len) n = len - 1;
+    memcpy(host, start, n);
+    host[n] = '\0';
+}
+
+void netHealthInit() {
+    for (int i = 0; i < NET_EP_COUNT; i++) netEndpoints[i] = EndpointHealth();
+
+    netEndpoints[NET_EP_SUPABASE].name = "supabase";
+    netHostFromUrl(SUPABASE_URL, netEndpoints[NET_EP_SUPABASE].host, sizeof(netEndpoints[0].host));
+    netEndpoints[NET_EP_SUPABASE].port = 443;
+
+    netEndpoints[NET_EP_TELEGRAM].name = "telegram";
+    strlcpy(netEndpoints[NET_EP_TELEGRAM].host, "api.telegram.org", sizeof(netEndpoints[0].host));
+    netEndpoints[NET_EP_TELEGRAM].port = 443;
+}
+
+// ============================================================================
+// CIRCUIT BREAKER
+// ============================================================================
+
+const char* netCircuitName(CircuitState c) {
+    switch (c) {
+        case CIRCUIT_CLOSED:    return "closed";
+        case CIRCUIT_OPEN:      return "open";
+        case CIRCUIT_HALF_OPEN: return "half_open";
+        default:                return "?";
+    }
+}
+
+unsigned long netProbeDelayMs(uint8_t level) {
+    uint8_t shift = level > 5 ? 5 : level;
+    unsigned long delayMs = NET_PROBE_BASE_MS << shift;
+    if (delayMs > NET_PROBE_MAX_MS) delayMs = NET_PROBE_MAX_MS;
+    // Jitter ±25%: varios equipos del sitio no sondean todos a la vez
+    return delayMs - delayMs / 4 + random(0, delayMs / 2);
+}
+
+void netOpenCircuit(EndpointHealth& ep) {
+    if (ep.circuit == CIRCUIT_HALF_OPEN && ep.openLevel < 255) ep.openLevel++;
+    ep.circuit = CIRCUIT_OPEN;
+    ep.openedAt = millis();
+    ep.nextProbeAt = ep.openedAt + netProbeDelayMs(ep.openLevel);
+    Serial.printf("[NET] ✗ %s: circuito ABIERTO (%u fallas, sonda en %lu seg)\n",
+                  ep.name, ep.consecutiveFailures, (ep.nextProbeAt - ep.openedAt) / 1000);
+}
+
+// Sin contar rechazos (para decidir rutas, ej. WiFi o GPRS)
+bool netEndpointUp(NetEndpoint id) {
+    return netEndpoints[id].circuit != CIRCUIT_OPEN;
+}
+
+// ¿Se puede intentar un request a este endpoint? Con HALF_OPEN solo el
+// primero (la prueba); el que llama debe informar el resultado con netReport
+bool netAllow(NetEndpoint id) {
+    EndpointHealth& ep = netEndpoints[id];
+    if (ep.circuit == CIRCUIT_CLOSED) return true;
+    if (ep.circuit == CIRCUIT_HALF_OPEN) {
+        // Una prueba que nunca informó no deja el circuito trabado
+        if (!ep.trialInFlight || millis() - ep.trialStartedAt >= NET_TRIAL_TIMEOUT_MS) {
+            ep.trialInFlight = true;
+            ep.trialStartedAt = millis();
+            return true;
+        }
+    }
+    ep.rejected++;
+    return false;
+}
+
+// Resultado de un request real: código HTTP (<= 0 = error de conexión)
+void netReport(NetEndpoint id, int code, unsigned long latencyMs) {
+    EndpointHealth& ep = netEndpoints[id];
+    ep.lastCode = code;
+    ep.lastLatencyMs = latencyMs;
+    ep.trialInFlight = false;
+
+    // Un 4xx también prueba que el servidor está alcanzable
+    bool ok = code > 0 && code < 500;
+    metricObserve(metrics.httpClient[id], latencyMs * 1000);
+    if (!ok) metrics.httpErrors[id]++;
+    if (ok) {
+        ep.successes++;
+        ep.lastSuccessAt = millis();
+        ep.consecutiveFailures = 0;
+        if (ep.circuit != CIRCUIT_CLOSED) {
+            Serial.printf("[NET] ✓ %s: circuito CERRADO (%lu seg abierto)\n",
+                          ep.name, (millis() - ep.openedAt) / 1000);
+            ep.circuit = CIRCUIT_CLOSED;
+            ep.openLevel = 0;
+        }
+        return;
+    }
+
+    ep.failures++;
+    if (ep.consecutiveFailures < 255) ep.consecutiveFailures++;
+    if (ep.circuit == CIRCUIT_HALF_OPEN ||
+        (ep.circuit == CIRCUIT_CLOSED && ep.consecutiveFailures >= NET_FAILURE_THRESHOLD)) {
+        netOpenCircuit(ep);
+    }
+}
+
+// ============================================================================
+// DNS CON CACHÉ
+// ============================================================================
+
+bool netResolve(EndpointHealth& ep) {
+    if (ep.ipValid && millis() - ep.resolvedAt < NET_DNS_TTL_MS) return true;
+
+    IPAddress ip;
+    if (WiFi.hostByName(ep.host, ip) == 1) {
+        ep.ip = ip;
+        ep.ipValid = true;
+        ep.resolvedAt = millis();
+        return true;
+    }
+    // DNS caído: seguir con la última IP conocida
+    return ep.ipValid;
+}
+
+// ============================================================================
+// SONDA (solo con circuito abierto)
+// ============================================================================
+
+void netProbe(EndpointHealth& ep) {
+    ep.probes++;
+    unsigned long start = millis();
+    bool reachable = false;
+
+    if (netResolve(ep)) {
+        WiFiClient client;
+        reachable = client.connect(ep.ip, ep.port, NET_PROBE_TIMEOUT_MS);
+        client.stop();
+    }
+
+    if (reachable) {
+        ep.circuit = CIRCUIT_HALF_OPEN;
+        ep.trialInFlight = false;
+        Serial.printf("[NET] %s: sonda OK en %lu ms → HALF_OPEN\n", ep.name, millis() - start);
+    } else {
+        if (ep.openLevel < 255) ep.openLevel++;
+        ep.nextProbeAt = millis() + netProbeDelayMs(ep.openLevel);
+        Serial.printf("[NET] %s: sonda falló, próxima en %lu seg\n",
+                      ep.name, (ep.nextProbeAt - millis()) / 1000);
+    }
+}
+
+// ============================================================================
+// LOOP (llamar en cada vuelta; sin tráfico propio salvo sondas)
+// ============================================================================
+
+void netHealthLoop() {
+    bool wifiUp = WiFi.status() == WL_CONNECTED;
+    if (wifiUp != state.wifiConnected) {
+        Serial.printf("[NET] WiFi %s\n", wifiUp ? "conectado" : "desconectado");
+        state.wifiConnected = wifiUp;
+    }
+
+    bool anyReachable = false;
+    unsigned long now = millis();
+
+    for (int i = 0; i < NET_EP_COUNT; i++) {
+        EndpointHealth& ep = netEndpoints[i];
+        // Una sonda por vuelta como máximo
+        if (wifiUp && ep.circuit == CIRCUIT_OPEN && (long)(now - ep.nextProbeAt) >= 0) {
+            netProbe(ep);
+            now = millis();
+            wifiUp = WiFi.status() == WL_CONNECTED;
+        }
+        if (ep.circuit != CIRCUIT_OPEN) anyReachable = true;
+    }
+
+    bool online = wifiUp && anyReachable;
+    if (online != state.internetAvailable) {
+        Serial.printf("[INTERNET] %s\n", online ? "✓ Online" : "✗ Offline");
+        state.internetAvailable = online;
+    }
+}
+
+void getNetHealthJSON(JsonArray& arr) {
+    unsigned long now = millis();
+    for (int i = 0; i < NET_EP_COUNT; i++) {
+        EndpointHealth& ep = netEndpoints[i];
+        JsonObject obj = arr.createNestedObject();
+        obj["name"] = ep.name;
+        obj["host"] = ep.host;
+        obj["circuit"] = netCircuitName(ep.circuit);
+        obj["consecutive_failures"] = ep.consecutiveFailures;
+        obj["successes"] = ep.successes;
+        obj["failures"] = ep.failures;
+        obj["rejected"] = ep.rejected;
+        obj["probes"] = ep.probes;
+        obj["last_code"] = ep.lastCode;
+        obj["last_latency_ms"] = ep.lastLatencyMs;
+        obj["last_success_sec"] = ep.lastSuccessAt ? (long)((now - ep.lastSuccessAt) / 1000) : -1;
+        if (ep.circuit == CIRCUIT_OPEN) {
+            obj["open_sec"] = (now - ep.openedAt) / 1000;
+            long next = (long)(ep.nextProbeAt - now);
+            obj["next_probe_sec"] = next > 0 ? next / 1000 : 0;
+        }
+        obj["dns_ip"] = ep.ipValid ? ep.ip.toString() : "";
+        obj["dns_age_sec"] = ep.ipValid ? (long)((now - ep.resolvedAt) / 1000) : -1;
+    }
+}
+
+// Mismos campos en streaming, para /api/status (web_api.h)
+void writeNetHealthJSON(JsonWriter& w) {
+    unsigned long now = millis();
+    for (int i = 0; i < NET_EP_COUNT; i++) {
+        EndpointHealth& ep = netEndpoints[i];
+        w.beginObject();
+        w.field(JK(name), ep.name);
+        w.field(JK(host), ep.host);
+        w.field(JK(circuit), netCircuitName(ep.circuit));
+        w.field(JK(consecutive_failures), ep.consecutiveFailures);
+        w.field(JK(successes), ep.successes);
+        w.field(JK(failures), ep.failures);
+        w.field(JK(rejected), ep.rejected);
+        w.field(JK(probes), ep.probes);
+        w.field(JK(last_code), ep.lastCode);
+        w.field(JK(last_latency_ms), ep.lastLatencyMs);
+        w.field(JK(last_success_sec), ep.lastSuccessAt ? (long)((now - ep.lastSuccessAt) / 1000) : -1L);
+        if (ep.circuit == CIRCUIT_OPEN) {
+            w.field(JK(open_sec), (now - ep.openedAt) / 1000);
+            long next = (long)(ep.nextProbeAt - now);
+            w.field(JK(next_probe_sec), next > 0 ? next / 1000 : 0L);
+        }
+        w.key(JK(dns_ip));
+        if (ep.ipValid) w.value(ep.ip.toString()); else w.value("");
+        w.field(JK(dns_age_sec), ep.ipValid ? (long)((now - ep.resolvedAt) / 1000) : -1L);
+        w.endObject();
+    }
+}
+
+#endif // NET_HEALTH_H
@@ -0,0 +1,200 @@
+/*
+ * ============================================================================
+ * PROFILER.H - PERFIL DEL LOOP POR SUBSISTEMA v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * loop() corre una docena de subsistemas: este módulo mide cuánto tarda
+ * cada uno, para rastrear hasta su origen una vuelta lenta.
+ *
+ * Cada etapa se mide con el contador de ciclos del CPU (ESP.getCycleCount)
+ * encadenando marcas: una sola lectura del contador por etapa, que cierra
+ * la anterior y abre la siguiente.
+ *
+ *   uint32_t t = profStart();
+ *   webApiLoop();
+ *   t = profMark(PROF_WEB_API, t);
+ *   if (toca) {
+ *       readSensors();
+ *       t = profMark(PROF_SENSORS, t);  // Solo cuenta las vueltas que corre
+ *   }
+ *
+ * Por etapa: cantidad, mín/prom/máx e histograma log2 de ciclos (el
+ * bucket b cuenta duraciones de 2^b a 2^(b+1) ciclos; a 240 MHz el 8 es
+ * ~1-2 µs). Registrar es restar, comparar y sumar: menos de 1 µs.
+ *
+ * El contador es de 32 bits: una etapa de más de 2^32 ciclos (~17 s a
+ * 240 MHz) da vuelta y se mide mal; ninguna debería acercarse.
+ *
+ * Lectura: comando serial PROFILE (tabla) y GET /api/profile (JSON).
+ * PROFILE_RESET pone todo en cero. Los dos comandos los atiende
+ * serial_frame.h, por línea de texto.
+ *
+ * ============================================================================
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "json_writer.h"
+
+// ============================================================================
+// ETAPAS (mismo orden que en loop())
+// ============================================================================
+enum ProfStage : uint8_t {
+    PROF_WEB_API = 0,
+    PROF_STATE_MACHINE,
+    PROF_SENSORS,
+    PROF_ALERTS,
+    PROF_STATUS_PRINT,
+    PROF_WIFI,
+    PROF_NET_HEALTH,
+    PROF_HISTORY,
+    PROF_TELEGRAM,
+    PROF_SIM800,
+    PROF_GPRS,
+    PROF_TRANSPORT,
+    PROF_LED,
+    PROF_RESET_BUTTON,
+    PROF_STREAM,
+    PROF_SERIAL_FRAME,
+    PROF_METRICS,
+    PROF_LOOP,                      // Vuelta completa (sin el delay final)
+    PROF_STAGE_COUNT
+};
+
+static const char* const PROF_STAGE_NAMES[PROF_STAGE_COUNT] = {
+    "webApiLoop", "stateMachineLoop", "readSensors", "checkAlerts", "printStatusJSON",
+    "wifiConnectionLoop", "netHealthLoop", "updateHistory", "telegramLoop", "sim800Loop",
+    "gprsUploaderLoop", "transportSync", "updateStatusLED", "checkWiFiResetButton",
+    "streamLoop", "serialFrameLoop", "metricsLoop", "loop"
+};
+
+#define PROF_BUCKETS 32             // log2 de ciclos: 2^0 .. 2^32
+
+// ============================================================================
+// ESTADÍSTICAS
+// ============================================================================
+struct ProfStageStats {
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t hist[PROF_BUCKETS];
+};
+
+ProfStageStats profStats[PROF_STAGE_COUNT];
+unsigned long profSince = 0;        // millis() del último reset
+uint32_t profCpuMhz = 240;
+
+void profReset() {
+    memset(profStats, 0, sizeof(profStats));
+    for (uint8_t i = 0; i < PROF_STAGE_COUNT; i++) profStats[i].minCycles = UINT32_MAX;
+    profSince = millis();
+    profCpuMhz = getCpuFrequencyMhz();
+}
+
+// ============================================================================
+// MEDICIÓN (camino caliente)
+// ============================================================================
+inline uint32_t profStart() {
+    return ESP.getCycleCount();
+}
+
+inline void profRecord(ProfStage stage, uint32_t cycles) {
+    ProfStageStats& s = profStats[stage];
+    s.count++;
+    s.totalCycles += cycles;
+    if (cycles < s.minCycles) s.minCycles = cycles;
+    if (cycles > s.maxCycles) s.maxCycles = cycles;
+    s.hist[31 - __builtin_clz(cycles | 1)]++;
+}
+
+// Cierra la etapa que empezó en since y devuelve el inicio de la próxima
+inline uint32_t profMark(ProfStage stage, uint32_t since) {
+    uint32_t now = ESP.getCycleCount();
+    profRecord(stage, now - since);
+    return now;
+}
+
+// ============================================================================
+// LECTURA
+// ============================================================================
+// Se lee sin lock desde la tarea AsyncTCP: una etapa puede salir con la
+// última muestra a medias (count uno adelante del histograma)
+
+float profCyclesToUs(uint64_t cycles) {
+    return (float)cycles / profCpuMhz;
+}
+
+float profAvgUs(const ProfStageStats& s) {
+    return s.count ? profCyclesToUs(s.totalCycles / s.count) : 0;
+}
+
+// Límite superior del bucket b en µs
+float profBucketUs(uint8_t b) {
+    return profCyclesToUs(2ULL << b);
+}
+
+// Tabla para el comando serial PROFILE
+void writeProfileText(Print& out) {
+    const ProfStageStats& loopStats = profStats[PROF_LOOP];
+    out.printf("\n=== PERFIL DEL LOOP (%lu vueltas en %lu s, CPU %lu MHz) ===\n",
+               (unsigned long)loopStats.count, (millis() - profSince) / 1000, (unsigned long)profCpuMhz);
+    out.println("etapa                    veces    mín µs    prom µs     máx µs  % loop");
+
+    for (uint8_t i = 0; i < PROF_STAGE_COUNT; i++) {
+        const ProfStageStats& s = profStats[i];
+        if (!s.count) continue;
+        float share = loopStats.totalCycles ? 100.0f * s.totalCycles / loopStats.totalCycles : 0;
+        out.printf("%-22s %8lu %9.1f %10.1f %10.1f %6.1f\n", PROF_STAGE_NAMES[i],
+                   (unsigned long)s.count, profCyclesToUs(s.minCycles), profAvgUs(s),
+                   profCyclesToUs(s.maxCycles), share);
+    }
+
+    // Histogramas: solo los buckets con muestras, "≤µs:veces"
+    out.println("\nhistograma log2 (≤ µs: veces)");
+    for (uint8_t i = 0; i < PROF_STAGE_COUNT; i++) {
+        const ProfStageStats& s = profStats[i];
+        if (!s.count) continue;
+        out.printf("%-22s", PROF_STAGE_NAMES[i]);
+        for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+            if (s.hist[b]) out.printf(" %.1f:%lu", profBucketUs(b), (unsigned long)s.hist[b]);
+        }
+        out.println();
+    }
+}
+
+// JSON para GET /api/profile
+void writeProfileJSON(JsonWriter& w) {
+    w.beginObject();
+    w.field(JK(cpu_mhz), profCpuMhz);
+    w.field(JK(since_sec), (millis() - profSince) / 1000);
+    w.beginArray(JK(stages));
+    for (uint8_t i = 0; i < PROF_STAGE_COUNT; i++) {
+        const ProfStageStats& s = profStats[i];
+        w.beginObject();
+        w.field(JK(name), PROF_STAGE_NAMES[i]);
+        w.field(JK(count), s.count);
+        w.field(JK(min_us), s.count ? profCyclesToUs(s.minCycles) : 0.0f, 1);
+        w.field(JK(avg_us), profAvgUs(s), 1);
+        w.field(JK(max_us), profCyclesToUs(s.maxCycles), 1);
+        w.field(JK(total_ms), profCyclesToUs(s.totalCycles) / 1000, 1);
+        // [límite µs, veces] de los buckets con muestras
+        w.beginArray(JK(hist));
+        for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+            if (!s.hist[b]) continue;
+            w.beginArray();
+            w.value(profBucketUs(b), 2);
+            w.value(s.hist[b]);
+            w.endArray();
+        }
+        w.endArray();
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+}
+
+#endif
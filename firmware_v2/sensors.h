@@ -22,6 +22,10 @@
 #include <DHT.h>
 #include "config.h"
 #include "types.h"
+#include "log.h"
+#include "serial_frame.h"
+#include "json_writer.h"
+#include "metrics.h"
 
 // Referencias externas
 extern OneWire oneWire;
@@ -30,6 +34,7 @@ extern DHT dht;
 extern Config config;
 extern SensorData sensorData;
 extern SystemState state;
+extern void statusNotify();
 
 // ============================================================================
 // NOMBRES DE SENSORES (arrays para acceso por índice)
@@ -65,7 +70,7 @@ const bool DOOR_ENABLED_DEFAULT[MAX_DOOR_SENSORS] = {
 // INICIALIZACIÓN DE SENSORES DE TEMPERATURA
 // ============================================================================
 void initTempSensors() {
-    Serial.println("[SENSOR] Iniciando sensores DS18B20...");
+    LOG_I("[SENSOR] Iniciando sensores DS18B20...");
     
     ds18b20.begin();
     delay(500);
@@ -73,16 +78,16 @@ void initTempSensors() {
     int count = ds18b20.getDeviceCount();
     sensorData.tempSensorCount = count;
     
-    Serial.printf("[SENSOR] Sensores DS18B20 detectados: %d\n", count);
+    LOG_I("[SENSOR] Sensores DS18B20 detectados: %d", count);
     
     if (count == 0) {
-        Serial.println("[SENSOR] ⚠️ NO HAY SENSORES - Reintentando...");
+        LOG_W("[SENSOR] ⚠️ NO HAY SENSORES - Reintentando...");
         delay(1000);
         ds18b20.begin();
         delay(500);
         count = ds18b20.getDeviceCount();
         sensorData.tempSensorCount = count;
-        Serial.printf("[SENSOR] Segundo intento: %d sensores\n", count);
+        LOG_I("[SENSOR] Segundo intento: %d sensores", count);
     }
     
     // Inicializar estructuras de cada sensor
@@ -107,7 +112,7 @@ void initTempSensors() {
         ds18b20.requestTemperatures();
         
         float t = ds18b20.getTempCByIndex(0);
-        Serial.printf("[SENSOR] >>> TEMPERATURA INICIAL: %.2f°C <<<\n", t);
+        LOG_I("[SENSOR] >>> TEMPERATURA INICIAL: %.2f°C <<<", t);
         
         if (t > -55 && t < 125) {
             sensorData.temp[0].value = t;
@@ -125,7 +130,7 @@ void initTempSensors() {
 // INICIALIZACIÓN DE SENSORES DE PUERTA
 // ============================================================================
 void initDoorSensors() {
-    Serial.println("[SENSOR] Iniciando sensores de puerta...");
+    LOG_I("[SENSOR] Iniciando sensores de puerta...");
     
     for (int i = 0; i < MAX_DOOR_SENSORS; i++) {
         sensorData.door[i].pin = DOOR_PINS[i];
@@ -138,8 +143,8 @@ void initDoorSensors() {
         
         if (sensorData.door[i].enabled) {
             pinMode(DOOR_PINS[i], INPUT_PULLUP);
-            Serial.printf("[SENSOR] Puerta %d (%s) en GPIO%d\n", 
-                          i + 1, DOOR_NAMES[i], DOOR_PINS[i]);
+            LOG_I("[SENSOR] Puerta %d (%s) en GPIO%d",
+                  i + 1, DOOR_NAMES[i], DOOR_PINS[i]);
         }
     }
 }
@@ -150,7 +155,7 @@ void initDoorSensors() {
 void initDHT22() {
     if (config.dht22Enabled) {
         dht.begin();
-        Serial.println("[SENSOR] DHT22 inicializado");
+        LOG_I("[SENSOR] DHT22 inicializado");
     }
 }
 
@@ -162,7 +167,7 @@ void initSensors() {
     initDoorSensors();
     initDHT22();
     
-    Serial.println("[SENSOR] ✓ Todos los sensores inicializados");
+    LOG_I("[SENSOR] ✓ Todos los sensores inicializados");
 }
 
 // ============================================================================
@@ -210,6 +215,7 @@ void readTempSensors() {
                 if (!sensorData.temp[i].enabled) continue;
                 
                 float t = ds18b20.getTempCByIndex(i);
+                metrics.probeReads[i]++;
                 
                 if (t > -55 && t < 125) {
                     sensorData.temp[i].value = t;
@@ -230,6 +236,7 @@ void readTempSensors() {
                     if (t > maxTemp) maxTemp = t;
                 } else {
                     sensorData.temp[i].valid = false;
+                    metrics.probeErrors[i]++;
                 }
             }
             
@@ -278,7 +285,8 @@ void readDoorSensors() {
             if (!wasOpen) {
                 sensorData.door[i].openSince = millis();
                 sensorData.door[i].opensToday++;
-                Serial.printf("[PUERTA] %s ABIERTA\n", sensorData.door[i].name);
+                LOG_I("[PUERTA] %s ABIERTA", sensorData.door[i].name);
+                frameEventDoor(i, true);
             }
         } else {
             // Registrar cierre
@@ -286,8 +294,9 @@ void readDoorSensors() {
                 unsigned long openDuration = (millis() - sensorData.door[i].openSince) / 1000;
                 sensorData.door[i].totalOpenToday += openDuration;
                 sensorData.door[i].openSince = 0;
-                Serial.printf("[PUERTA] %s CERRADA (estuvo abierta %lu seg)\n", 
-                              sensorData.door[i].name, openDuration);
+                LOG_I("[PUERTA] %s CERRADA (estuvo abierta %lu seg)",
+                      sensorData.door[i].name, openDuration);
+                frameEventDoor(i, false);
             }
         }
     }
@@ -301,6 +310,7 @@ void readDHT22() {
     
     float h = dht.readHumidity();
     float t = dht.readTemperature();
+    if (isnan(h) || isnan(t)) metrics.dhtErrors++;
     
     if (!isnan(h)) {
         sensorData.humidity = h;
@@ -315,16 +325,21 @@ void readDHT22() {
 // LECTURA COMPLETA DE SENSORES (llamar desde loop)
 // ============================================================================
 void readSensors() {
+    uint32_t start = micros();
     readTempSensors();
     readDoorSensors();
     readDHT22();
+    metricObserve(metrics.sensors, micros() - start);
     
     state.lastSensorRead = millis();
+    statusNotify();
 }
 
 // ============================================================================
 // OBTENER JSON DE SENSORES
 // ============================================================================
+// Para el status por Serial (printStatusJSON); /api/sensors usa
+// writeSensorsJSON, mismos campos escritos en streaming
 void getSensorsJSON(JsonObject& obj) {
     // Temperaturas
     JsonObject temps = obj.createNestedObject("temperatures");
@@ -389,7 +404,65 @@ void resetDailyStats() {
         sensorData.door[i].opensToday = 0;
     }
     
-    Serial.println("[SENSOR] Estadísticas diarias reseteadas");
+    LOG_I("[SENSOR] Estadísticas diarias reseteadas");
+}
+
+// ============================================================================
+// JSON DE SENSORES EN STREAMING (GET /api/sensors)
+// ============================================================================
+void writeSensorsJSON(JsonWriter& w) {
+    w.beginObject();
+
+    w.beginObject(JK(temperatures));
+    w.field(JK(avg), sensorData.tempAvg);
+    w.field(JK(min), sensorData.tempMin);
+    w.field(JK(max), sensorData.tempMax);
+    w.field(JK(valid), sensorData.tempValid);
+    w.field(JK(sensor_count), sensorData.tempSensorCount);
+    w.beginArray(JK(sensors));
+    for (int i = 0; i < MAX_TEMP_SENSORS; i++) {
+        const TempSensor& t = sensorData.temp[i];
+        if (!t.enabled) continue;
+        w.beginObject();
+        w.field(JK(index), i);
+        w.field(JK(name), t.name);
+        w.field(JK(value), t.value);
+        w.field(JK(valid), t.valid);
+        w.field(JK(min_today), t.minToday);
+        w.field(JK(max_today), t.maxToday);
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+
+    if (config.dht22Enabled) {
+        w.beginObject(JK(dht22));
+        w.field(JK(humidity), sensorData.humidity);
+        w.field(JK(temp_ambient), sensorData.tempAmbient);
+        w.field(JK(valid), sensorData.dhtValid);
+        w.endObject();
+    }
+
+    w.beginObject(JK(doors));
+    w.field(JK(any_open), sensorData.anyDoorOpen);
+    w.field(JK(open_count), sensorData.doorsOpenCount);
+    w.beginArray(JK(sensors));
+    for (int i = 0; i < MAX_DOOR_SENSORS; i++) {
+        const DoorSensor& d = sensorData.door[i];
+        if (!d.enabled) continue;
+        w.beginObject();
+        w.field(JK(index), i);
+        w.field(JK(name), d.name);
+        w.field(JK(is_open), d.isOpen);
+        w.field(JK(open_since_sec), d.isOpen ? (millis() - d.openSince) / 1000 : 0UL);
+        w.field(JK(opens_today), d.opensToday);
+        w.field(JK(total_open_today_sec), d.totalOpenToday);
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+
+    w.endObject();
 }
 
 #endif // SENSORS_H
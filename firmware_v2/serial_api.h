@@ -1,12 +1,12 @@
 /*
  * serial_api.h - API de comandos por Serial/COM, Web y App
- * Sistema Monitoreo Reefer v3.0
+ * Sistema Monitoreo Reefer v4.0
  * 
- * NOTA: Este módulo NO está integrado aún. Solo definiciones.
- * 
- * Permite controlar el ESP32 mediante:
- * 1. Puerto Serial (COM) - Para debug y configuración local
- * 2. API Web - Endpoints HTTP para control remoto
+ * firmware_v2.ino lo incluye después de web_api.h. Los comandos llegan por:
+ * 1. Puerto Serial (COM): líneas de texto y tramas COMMAND de
+ *    serial_frame.h, que es el dueño del RX del Serial
+ * 2. API Web: /api/command, /api/restart y /api/factory_reset, que
+ *    web_api.h encola para el loop
  * 3. App Android - Mismos endpoints que la web
  * 
  * COMANDOS DISPONIBLES:
@@ -22,296 +22,326 @@
  * - RELAY_OFF   : Apagar relay manualmente
  * - SUPABASE_ON : Habilitar Supabase
  * - SUPABASE_OFF: Deshabilitar Supabase
+ * - PROFILE     : Tiempo por subsistema del loop (profiler.h)
+ * - PROFILE_RESET: Poner el perfil en cero
  * - HELP        : Mostrar comandos disponibles
+ * 
+ * Los comandos están en la tabla SERIAL_COMMANDS: agregar uno es sumar
+ * su handler y una fila. Todos se ejecutan en el loop.
  */
 
 #ifndef SERIAL_API_H
 #define SERIAL_API_H
 
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
+#include <StreamString.h>
+#include "json_writer.h"
+#include "log.h"
+#include "profiler.h"
+#include "web_api.h"
 
 // Forward declarations
-extern WebServer server;
+extern AsyncWebServer server;
 extern Config config;
 extern SystemState state;
+extern SensorData sensorData;
 extern void saveConfig();
+extern void resetConfig();
 extern void setRelay(bool on);
 extern void acknowledgeAlert();
 extern void clearAlert();
+extern void enterDefrostMode(const char* triggeredBy);
+extern void exitDefrostMode();
+extern void statusNotify();
 
 // ============================================
-// CONFIGURACIÓN
+// COMANDOS
 // ============================================
-#define SERIAL_API_BAUD 115200
-#define SERIAL_BUFFER_SIZE 128
+// Cada uno recibe el argumento (lo que sigue al nombre, sin espacios
+// alrededor; vacío si no lleva) y devuelve la respuesta
+
+// RESTART - Reiniciar ESP32 (desde webApiLoop: antes sale la respuesta)
+String cmdRestart(const String& arg) {
+  Serial.println("[CMD] Reiniciando en 2 segundos...");
+  webRestartAt = millis() + 2000;
+  return "OK: Reiniciando...";
+}
+
+// RESET_WIFI - Borrar WiFi y reiniciar en modo AP (resetWiFi() desde webApiLoop)
+String cmdResetWifi(const String& arg) {
+  Serial.println("[CMD] Borrando configuración WiFi...");
+  webWifiResetAt = millis() + 500;
+  return "OK: WiFi reseteado, reiniciando en modo AP...";
+}
+
+// RESET_CONFIG - Restaurar configuración de fábrica
+String cmdResetConfig(const String& arg) {
+  Serial.println("[CMD] Restaurando configuración de fábrica...");
+  resetConfig();
+  return "OK: Configuración restaurada a valores de fábrica";
+}
+
+// STATUS - Estado del sistema
+String cmdStatus(const String& arg) {
+  String status = "\n=== ESTADO DEL SISTEMA ===\n";
+  status += "Estado: " + String(state.stateName) + "\n";
+  status += "Temperatura: " + String(sensorData.tempAvg, 1) + "°C\n";
+  status += "Temp Crítica: " + String(config.tempCritical, 1) + "°C\n";
+  status += "Alerta: " + String(state.alertActive ? "ACTIVA" : "Normal") + "\n";
+  status += "Relay: " + String(sensorData.relay[0].state ? "ON" : "OFF") + "\n";
+  status += "WiFi: " + String(state.wifiConnected ? "Conectado" : "Desconectado") + "\n";
+  status += "Internet: " + String(state.internetAvailable ? "OK" : "Sin conexión") + "\n";
+  status += "Supabase: " + String(config.supabaseEnabled ? "Habilitado" : "Deshabilitado") + "\n";
+  status += "IP: " + state.localIP + "\n";
+  status += "Uptime: " + String((millis() - state.bootTime) / 60000) + " min\n";
+  return status;
+}
+
+// SET_TEMP <valor> - Configurar temperatura crítica
+String cmdSetTemp(const String& arg) {
+  float newTemp = arg.toFloat();
+  if (newTemp < -50 || newTemp > 50) {
+    return "ERROR: Temperatura fuera de rango (-50 a 50)";
+  }
+  config.tempCritical = newTemp;
+  saveConfig();
+  return "OK: Temperatura crítica = " + String(newTemp, 1) + "°C";
+}
+
+// DEFROST_ON - Activar descongelamiento (máquina de estados)
+String cmdDefrostOn(const String& arg) {
+  enterDefrostMode("serial");
+  return "OK: Modo descongelamiento ACTIVADO";
+}
+
+// DEFROST_OFF - Desactivar descongelamiento (pasa a cooldown)
+String cmdDefrostOff(const String& arg) {
+  exitDefrostMode();
+  return "OK: Modo descongelamiento DESACTIVADO";
+}
+
+// ALERT_ACK - Silenciar alerta
+String cmdAlertAck(const String& arg) {
+  acknowledgeAlert();
+  return "OK: Alerta silenciada";
+}
+
+// ALERT_CLEAR - Limpiar alerta
+String cmdAlertClear(const String& arg) {
+  clearAlert();
+  return "OK: Alerta limpiada";
+}
+
+// RELAY_ON / RELAY_OFF
+String cmdRelayOn(const String& arg) {
+  setRelay(true);
+  return "OK: Relay ENCENDIDO";
+}
+String cmdRelayOff(const String& arg) {
+  setRelay(false);
+  return "OK: Relay APAGADO";
+}
+
+// SUPABASE_ON / SUPABASE_OFF
+String cmdSupabaseOn(const String& arg) {
+  config.supabaseEnabled = true;
+  saveConfig();
+  return "OK: Supabase HABILITADO";
+}
+String cmdSupabaseOff(const String& arg) {
+  config.supabaseEnabled = false;
+  saveConfig();
+  return "OK: Supabase DESHABILITADO";
+}
+
+// TELEGRAM_ON / TELEGRAM_OFF
+String cmdTelegramOn(const String& arg) {
+  config.telegramEnabled = true;
+  saveConfig();
+  return "OK: Telegram HABILITADO";
+}
+String cmdTelegramOff(const String& arg) {
+  config.telegramEnabled = false;
+  saveConfig();
+  return "OK: Telegram DESHABILITADO";
+}
+
+// SIMULATION_ON / SIMULATION_OFF
+String cmdSimOn(const String& arg) {
+  config.simulationMode = true;
+  saveConfig();
+  return "OK: Modo simulación ACTIVADO";
+}
+String cmdSimOff(const String& arg) {
+  config.simulationMode = false;
+  saveConfig();
+  return "OK: Modo simulación DESACTIVADO";
+}
+
+// SET_SIM_TEMP <temp> - Configurar temperatura simulada
+String cmdSetSimTemp(const String& arg) {
+  config.simTemp = arg.toFloat();
+  saveConfig();
+  return "OK: Temp simulada = " + String(config.simTemp, 1) + "°C";
+}
+
+// PROFILE - Tiempo por subsistema del loop
+String cmdProfile(const String& arg) {
+  StreamString out;
+  writeProfileText(out);
+  return out;
+}
+
+// PROFILE_RESET - Volver a medir desde cero
+String cmdProfileReset(const String& arg) {
+  profReset();
+  return "OK: Perfil en cero";
+}
+
+String cmdHelp(const String& arg);
 
 // ============================================
-// VARIABLES
+// TABLA DE COMANDOS
 // ============================================
-char serialBuffer[SERIAL_BUFFER_SIZE];
-int serialBufferIndex = 0;
+// Buscar un comando es recorrer la tabla; HELP sale de la misma tabla
+typedef String (*SerialCommandHandler)(const String& arg);
+
+struct SerialCommand {
+  const char* name;
+  const char* alias;             // nullptr si no tiene
+  bool takesArg;                 // "NOMBRE <arg>"
+  SerialCommandHandler handler;
+  const char* help;
+};
+
+static const SerialCommand SERIAL_COMMANDS[] = {
+  { "RESTART",        "REBOOT",        false, cmdRestart,      "Reiniciar ESP32" },
+  { "RESET_WIFI",     "WIFI_RESET",    false, cmdResetWifi,    "Borrar WiFi, modo AP" },
+  { "RESET_CONFIG",   "FACTORY_RESET", false, cmdResetConfig,  "Config de fábrica" },
+  { "STATUS",         nullptr,         false, cmdStatus,       "Estado del sistema" },
+  { "SET_TEMP",       nullptr,         true,  cmdSetTemp,      "<°C> Temp crítica" },
+  { "DEFROST_ON",     nullptr,         false, cmdDefrostOn,    "Activar descongelamiento" },
+  { "DEFROST_OFF",    nullptr,         false, cmdDefrostOff,   "Desactivar descongelamiento" },
+  { "ALERT_ACK",      "ACK",           false, cmdAlertAck,     "Silenciar alerta" },
+  { "ALERT_CLEAR",    "CLEAR",         false, cmdAlertClear,   "Limpiar alerta" },
+  { "RELAY_ON",       nullptr,         false, cmdRelayOn,      "Encender relay" },
+  { "RELAY_OFF",      nullptr,         false, cmdRelayOff,     "Apagar relay" },
+  { "SUPABASE_ON",    nullptr,         false, cmdSupabaseOn,   "Habilitar Supabase" },
+  { "SUPABASE_OFF",   nullptr,         false, cmdSupabaseOff,  "Deshabilitar Supabase" },
+  { "TELEGRAM_ON",    nullptr,         false, cmdTelegramOn,   "Habilitar Telegram" },
+  { "TELEGRAM_OFF",   nullptr,         false, cmdTelegramOff,  "Deshabilitar Telegram" },
+  { "SIMULATION_ON",  "SIM_ON",        false, cmdSimOn,        "Modo simulación" },
+  { "SIMULATION_OFF", "SIM_OFF",       false, cmdSimOff,       "Salir de modo simulación" },
+  { "SET_SIM_TEMP",   nullptr,         true,  cmdSetSimTemp,   "<°C> Temp simulada" },
+  { "PROFILE",        "PROF",          false, cmdProfile,      "Tiempo por etapa del loop" },
+  { "PROFILE_RESET",  nullptr,         false, cmdProfileReset, "Perfil en cero" },
+  { "HELP",           "?",             false, cmdHelp,         "Esta ayuda" },
+};
+
+// HELP - Mostrar ayuda
+String cmdHelp(const String& arg) {
+  String help = "\n=== COMANDOS DISPONIBLES ===\n";
+  char line[96];
+  for (const SerialCommand& c : SERIAL_COMMANDS) {
+    snprintf(line, sizeof(line), "%-15s- %s\n", c.name, c.help);
+    help += line;
+  }
+  return help;
+}
 
 // ============================================
 // PROCESAR COMANDO
 // ============================================
-String processCommand(String cmd) {
+// false si no está en la tabla (o falta/sobra el argumento); reply
+// queda con el error para mostrar
+bool runCommand(String cmd, String& reply) {
   cmd.trim();
   cmd.toUpperCase();
   
-  Serial.printf("[CMD] Recibido: %s\n", cmd.c_str());
+  LOG_I("[CMD] Recibido: %s", cmd.c_str());
   
-  // RESTART - Reiniciar ESP32
-  if (cmd == "RESTART" || cmd == "REBOOT") {
-    Serial.println("[CMD] Reiniciando en 2 segundos...");
-    delay(2000);
-    ESP.restart();
-    return "OK: Reiniciando...";
-  }
+  // "NOMBRE" o "NOMBRE <arg>"
+  int space = cmd.indexOf(' ');
+  String name = space < 0 ? cmd : cmd.substring(0, space);
+  String arg = space < 0 ? String() : cmd.substring(space + 1);
+  arg.trim();
   
-  // RESET_WIFI - Borrar WiFi y reiniciar en modo AP
-  if (cmd == "RESET_WIFI" || cmd == "WIFI_RESET") {
-    Serial.println("[CMD] Borrando configuración WiFi...");
-    WiFi.disconnect(true, true);
-    delay(1000);
-    ESP.restart();
-    return "OK: WiFi reseteado, reiniciando en modo AP...";
+  for (const SerialCommand& c : SERIAL_COMMANDS) {
+    if (name != c.name && !(c.alias && name == c.alias)) continue;
+    if (c.takesArg != (arg.length() > 0)) break;
+    reply = c.handler(arg);
+    statusNotify();
+    return true;
   }
   
-  // RESET_CONFIG - Restaurar configuración de fábrica
-  if (cmd == "RESET_CONFIG" || cmd == "FACTORY_RESET") {
-    Serial.println("[CMD] Restaurando configuración de fábrica...");
-    
-    // Valores por defecto
-    config.tempMax = -15.0;
-    config.tempCritical = -10.0;
-    config.alertDelaySec = 300;
-    config.doorOpenMaxSec = 120;
-    config.defrostCooldownSec = 1800;
-    config.defrostRelayNC = false;
-    config.relayEnabled = true;
-    config.buzzerEnabled = true;
-    config.telegramEnabled = true;
-    config.supabaseEnabled = false;
-    config.sensor1Enabled = true;
-    config.sensor2Enabled = false;
-    config.dht22Enabled = false;
-    config.doorEnabled = true;
-    config.simulationMode = false;
-    
-    saveConfig();
-    return "OK: Configuración restaurada a valores de fábrica";
-  }
-  
-  // STATUS - Estado del sistema
-  if (cmd == "STATUS") {
-    String status = "\n=== ESTADO DEL SISTEMA ===\n";
-    status += "Temperatura: " + String(sensorData.tempAvg, 1) + "°C\n";
-    status += "Temp Crítica: " + String(config.tempCritical, 1) + "°C\n";
-    status += "Alerta: " + String(state.alertActive ? "ACTIVA" : "Normal") + "\n";
-    status += "Relay: " + String(state.relayState ? "ON" : "OFF") + "\n";
-    status += "Defrost: " + String(state.defrostMode ? "ACTIVO" : "OFF") + "\n";
-    status += "WiFi: " + String(state.wifiConnected ? "Conectado" : "Desconectado") + "\n";
-    status += "Internet: " + String(state.internetAvailable ? "OK" : "Sin conexión") + "\n";
-    status += "Supabase: " + String(config.supabaseEnabled ? "Habilitado" : "Deshabilitado") + "\n";
-    status += "IP: " + state.localIP + "\n";
-    status += "Uptime: " + String((millis() - state.uptime) / 60000) + " min\n";
-    return status;
-  }
-  
-  // SET_TEMP <valor> - Configurar temperatura crítica
-  if (cmd.startsWith("SET_TEMP ")) {
-    float newTemp = cmd.substring(9).toFloat();
-    if (newTemp < -50 || newTemp > 50) {
-      return "ERROR: Temperatura fuera de rango (-50 a 50)";
-    }
-    config.tempCritical = newTemp;
-    saveConfig();
-    return "OK: Temperatura crítica = " + String(newTemp, 1) + "°C";
-  }
-  
-  // DEFROST_ON - Activar descongelamiento
-  if (cmd == "DEFROST_ON") {
-    state.defrostMode = true;
-    state.defrostStartTime = millis();
-    state.alertActive = false;
-    setRelay(false);
-    return "OK: Modo descongelamiento ACTIVADO";
-  }
-  
-  // DEFROST_OFF - Desactivar descongelamiento
-  if (cmd == "DEFROST_OFF") {
-    state.defrostMode = false;
-    state.defrostStartTime = 0;
-    return "OK: Modo descongelamiento DESACTIVADO";
-  }
-  
-  // ALERT_ACK - Silenciar alerta
-  if (cmd == "ALERT_ACK" || cmd == "ACK") {
-    acknowledgeAlert();
-    return "OK: Alerta silenciada";
-  }
-  
-  // ALERT_CLEAR - Limpiar alerta
-  if (cmd == "ALERT_CLEAR" || cmd == "CLEAR") {
-    clearAlert();
-    return "OK: Alerta limpiada";
-  }
-  
-  // RELAY_ON - Encender relay
-  if (cmd == "RELAY_ON") {
-    setRelay(true);
-    return "OK: Relay ENCENDIDO";
-  }
-  
-  // RELAY_OFF - Apagar relay
-  if (cmd == "RELAY_OFF") {
-    setRelay(false);
-    return "OK: Relay APAGADO";
-  }
-  
-  // SUPABASE_ON - Habilitar Supabase
-  if (cmd == "SUPABASE_ON") {
-    config.supabaseEnabled = true;
-    saveConfig();
-    return "OK: Supabase HABILITADO";
-  }
-  
-  // SUPABASE_OFF - Deshabilitar Supabase
-  if (cmd == "SUPABASE_OFF") {
-    config.supabaseEnabled = false;
-    saveConfig();
-    return "OK: Supabase DESHABILITADO";
-  }
-  
-  // TELEGRAM_ON / TELEGRAM_OFF
-  if (cmd == "TELEGRAM_ON") {
-    config.telegramEnabled = true;
-    saveConfig();
-    return "OK: Telegram HABILITADO";
-  }
-  if (cmd == "TELEGRAM_OFF") {
-    config.telegramEnabled = false;
-    saveConfig();
-    return "OK: Telegram DESHABILITADO";
-  }
-  
-  // SIMULATION_ON / SIMULATION_OFF
-  if (cmd == "SIMULATION_ON" || cmd == "SIM_ON") {
-    config.simulationMode = true;
-    saveConfig();
-    return "OK: Modo simulación ACTIVADO";
-  }
-  if (cmd == "SIMULATION_OFF" || cmd == "SIM_OFF") {
-    config.simulationMode = false;
-    saveConfig();
-    return "OK: Modo simulación DESACTIVADO";
-  }
-  
-  // SET_SIM_TEMP <temp1> <temp2> - Configurar temperaturas simuladas
-  if (cmd.startsWith("SET_SIM_TEMP ")) {
-    int spacePos = cmd.indexOf(' ', 13);
-    if (spacePos > 0) {
-      config.simTemp1 = cmd.substring(13, spacePos).toFloat();
-      config.simTemp2 = cmd.substring(spacePos + 1).toFloat();
-    } else {
-      config.simTemp1 = cmd.substring(13).toFloat();
-      config.simTemp2 = config.simTemp1;
-    }
-    saveConfig();
-    return "OK: Temp simulada = " + String(config.simTemp1, 1) + "°C / " + String(config.simTemp2, 1) + "°C";
-  }
-  
-  // HELP - Mostrar ayuda
-  if (cmd == "HELP" || cmd == "?") {
-    String help = "\n=== COMANDOS DISPONIBLES ===\n";
-    help += "RESTART        - Reiniciar ESP32\n";
-    help += "RESET_WIFI     - Borrar WiFi, modo AP\n";
-    help += "RESET_CONFIG   - Config de fábrica\n";
-    help += "STATUS         - Estado del sistema\n";
-    help += "SET_TEMP <°C>  - Temp crítica\n";
-    help += "DEFROST_ON/OFF - Descongelamiento\n";
-    help += "ALERT_ACK      - Silenciar alerta\n";
-    help += "RELAY_ON/OFF   - Control relay\n";
-    help += "SUPABASE_ON/OFF- Habilitar Supabase\n";
-    help += "TELEGRAM_ON/OFF- Habilitar Telegram\n";
-    help += "SIM_ON/OFF     - Modo simulación\n";
-    help += "SET_SIM_TEMP   - Temp simulada\n";
-    help += "HELP           - Esta ayuda\n";
-    return help;
-  }
-  
-  return "ERROR: Comando no reconocido. Escribe HELP para ver comandos.";
+  reply = "ERROR: Comando no reconocido. Escribe HELP para ver comandos.";
+  return false;
 }
 
-// ============================================
-// LEER COMANDOS DEL SERIAL
-// ============================================
-void serialApiLoop() {
-  while (Serial.available()) {
-    char c = Serial.read();
-    
-    if (c == '\n' || c == '\r') {
-      if (serialBufferIndex > 0) {
-        serialBuffer[serialBufferIndex] = '\0';
-        String response = processCommand(String(serialBuffer));
-        Serial.println(response);
-        serialBufferIndex = 0;
-      }
-    } else if (serialBufferIndex < SERIAL_BUFFER_SIZE - 1) {
-      serialBuffer[serialBufferIndex++] = c;
-    }
-  }
+String processCommand(String cmd) {
+  String reply;
+  runCommand(cmd, reply);
+  return reply;
 }
 
 // ============================================
 // HANDLER WEB: /api/command
 // ============================================
-void handleApiCommand() {
-  String cmd = "";
+// Corre en la tarea del servidor asíncrono: el comando se encola y lo
+// ejecuta el loop (web_api.h → webApiLoop); la salida va al Serial
+void handleApiCommand(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
   
   // Obtener comando de query string o body
-  if (server.hasArg("cmd")) {
-    cmd = server.arg("cmd");
-  } else if (server.hasArg("plain")) {
-    cmd = server.arg("plain");
+  char* cmd = nullptr;
+  if (request->hasParam("cmd")) {
+    cmd = strdup(request->getParam("cmd")->value().c_str());
+  } else if (request->_tempObject) {
+    cmd = webTakeBody(request);
   }
   
-  if (cmd.length() == 0) {
-    server.sendHeader("Access-Control-Allow-Origin", "*");
-    server.send(400, "application/json", "{\"error\":\"No command provided\"}");
+  if (!cmd || !cmd[0]) {
+    free(cmd);
+    webSendJSON(request, 400, "{\"error\":\"No command provided\"}");
     return;
   }
   
-  String response = processCommand(cmd);
-  
-  // Formatear respuesta como JSON
-  String json = "{";
-  json += "\"command\":\"" + cmd + "\",";
-  json += "\"response\":\"" + response + "\",";
-  json += "\"success\":" + String(response.startsWith("OK") ? "true" : "false");
-  json += "}";
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", json);
+  // La respuesta se escribe antes de encolar: después el loop libera cmd.
+  // JsonWriter escapa el texto (comillas o barras en el comando)
+  AsyncResponseStream* response = webBeginJSON(request);
+  response->setCode(202);
+  JsonWriter w(*response);
+  w.beginObject();
+  w.field(JK(command), (const char*)cmd);
+  w.field(JK(queued), true);
+  w.field(JK(success), true);
+  w.endObject();
+
+  if (webQueue(request, WEB_CMD_TEXT, false, cmd)) {
+    request->send(response);
+  } else {
+    delete response;                 // webQueue ya respondió 503
+  }
 }
 
 // ============================================
 // HANDLER WEB: /api/restart
 // ============================================
-void handleApiRestart() {
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true,\"message\":\"Reiniciando en 2 segundos...\"}");
-  delay(2000);
-  ESP.restart();
+void handleApiRestart(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (webQueue(request, WEB_CMD_RESTART)) {
+    webSendJSON(request, 200, "{\"success\":true,\"message\":\"Reiniciando en 2 segundos...\"}");
+  }
 }
 
 // ============================================
 // HANDLER WEB: /api/factory_reset
 // ============================================
-void handleApiFactoryReset() {
-  processCommand("RESET_CONFIG");
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true,\"message\":\"Configuración restaurada\"}");
+void handleApiFactoryReset(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (webQueue(request, WEB_CMD_TEXT, false, strdup("RESET_CONFIG"))) {
+    webSendJSON(request, 200, "{\"success\":true,\"message\":\"Configuración restaurada\"}");
+  }
 }
 
 // ============================================
@@ -320,22 +350,13 @@ void handleApiFactoryReset() {
 void setupSerialApiRoutes() {
   // Endpoint genérico para comandos
   server.on("/api/command", HTTP_GET, handleApiCommand);
-  server.on("/api/command", HTTP_POST, handleApiCommand);
+  server.on("/api/command", HTTP_POST, handleApiCommand, nullptr, webCollectBody);
   
   // Endpoints específicos
   server.on("/api/restart", HTTP_POST, handleApiRestart);
   server.on("/api/factory_reset", HTTP_POST, handleApiFactoryReset);
   
-  Serial.println("[SERIAL_API] Rutas configuradas");
-}
-
-// ============================================
-// INICIALIZACIÓN
-// ============================================
-void serialApiInit() {
-  serialBufferIndex = 0;
-  Serial.println("[SERIAL_API] API de comandos inicializada");
-  Serial.println("[SERIAL_API] Escribe HELP para ver comandos disponibles");
+  Serial.println("[SERIAL_API] Rutas configuradas (HELP por serial para ver comandos)");
 }
 
 #endif
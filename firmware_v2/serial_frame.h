@@ -0,0 +1,513 @@
+/*
+ * ============================================================================
+ * SERIAL_FRAME.H - TELEMETRÍA BINARIA POR SERIAL (COBS + CRC16) v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * El serial solo sacaba texto y JSON: la herramienta de escritorio no
+ * pasaba de unas pocas actualizaciones por segundo. En modo tramas el
+ * equipo manda muestras de sondas, puertas, corriente y estado hasta
+ * SERIAL_FRAME_MAX_HZ veces por segundo, y eventos (flanco de puerta,
+ * cambio de estado) en el momento en que pasan.
+ *
+ * TRAMA (todos los enteros little-endian):
+ *
+ *   0x00 | COBS( tipo u8 | seq u8 | payload | crc16 u16 ) | 0x00
+ *
+ * CRC-16/CCITT-FALSE (poli 0x1021, inicio 0xFFFF) de tipo..payload. COBS
+ * saca los 0x00 de adentro: el 0x00 separa tramas y el receptor se
+ * resincroniza en el siguiente. El seq sube de a uno por trama enviada:
+ * un salto en el host es una trama perdida.
+ *
+ * Los logs de texto (LOG_*, Serial.printf) siguen saliendo por el mismo
+ * puerto: quedan entre dos 0x00 como un bloque que no pasa el CRC, y el
+ * decodificador los muestra como texto.
+ *
+ * EQUIPO → HOST
+ *   0x01 HELLO    proto u8 | max_hz u8 | hz u8 | enviadas u32 | descartadas u32
+ *                 | rx_ok u32 | rx_err u32 | firmware (texto)
+ *   0x02 SAMPLE   t_ms u32 | t_lectura_ms u32 | estado u8 | flags u8
+ *                 | puertas u8 | corriente_cA u16 | n u8 | n × temp_c°C i16
+ *                 flags: bit0 alerta, bit1 crítica, bit2 señal defrost, bit3 WiFi
+ *                 temp inválida = -32768, sin sensor de corriente = 0xFFFF
+ *   0x03 DOOR     t_ms u32 | puerta u8 | abierta u8
+ *   0x04 STATE    t_ms u32 | desde u8 | hacia u8
+ *   0x05 RESPONSE tipo_pedido u8 | seq_pedido u8 | status u8 | texto
+ *                 (un texto largo sale en varias RESPONSE seguidas con
+ *                 el mismo seq_pedido, de hasta SERIAL_FRAME_MAX_PAYLOAD)
+ *
+ * HOST → EQUIPO (despachados por la tabla FRAME_COMMANDS)
+ *   0x80 PING     → HELLO (sirve también de keepalive)
+ *   0x81 STREAM   hz u8 (0 = solo eventos)
+ *   0x82 COMMAND  texto: mismo comando que por línea de texto
+ *   0x83 TEXT     vuelve al modo texto
+ *
+ * Se entra al modo tramas con cualquier trama válida o escribiendo
+ * FRAMED. Sin tramas del host por SERIAL_FRAME_IDLE_MS se vuelve a texto.
+ *
+ * En modo texto cada línea (salvo FRAMED) va a la tabla SERIAL_COMMANDS
+ * de serial_api.h, la misma que atiende COMMAND y /api/command.
+ *
+ * Las sondas DS18B20 se leen cada INTERVAL_SENSOR_READ_MS (la conversión
+ * tarda ~750 ms): SAMPLE lleva la última lectura y t_lectura_ms dice de
+ * cuándo es. Puertas y estado sí cambian entre lecturas.
+ *
+ * Las tramas salen con logWrite(): entran enteras al ring TX o se
+ * descartan, nunca esperan a la UART.
+ *
+ * Host: tools/serial_frame_decoder.py (captura y reproducción).
+ *
+ * ============================================================================
+ */
+
+#ifndef SERIAL_FRAME_H
+#define SERIAL_FRAME_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "types.h"
+#include "log.h"
+
+extern SensorData sensorData;
+extern SystemState state;
+
+// Opcionales (weak): sin el módulo, el campo sale como ausente
+extern float __attribute__((weak)) currentSensorRms();
+
+// serial_api.h (incluido después): tabla SERIAL_COMMANDS
+extern bool runCommand(String cmd, String& reply);
+
+// ============================================================================
+// PROTOCOLO
+// ============================================================================
+#define FRAME_PROTO_VERSION     1
+
+#define FRAME_HELLO             0x01
+#define FRAME_SAMPLE            0x02
+#define FRAME_DOOR              0x03
+#define FRAME_STATE             0x04
+#define FRAME_RESPONSE          0x05
+
+#define FRAME_CMD_PING          0x80
+#define FRAME_CMD_STREAM        0x81
+#define FRAME_CMD_COMMAND       0x82
+#define FRAME_CMD_TEXT          0x83
+
+#define FRAME_OK                0
+#define FRAME_ERR_LENGTH        1       // Payload fuera del largo del comando
+#define FRAME_ERR_UNKNOWN       2       // Tipo de comando desconocido
+#define FRAME_ERR_UNAVAILABLE   3       // Módulo no compilado
+#define FRAME_ERR_ARG           4       // Argumento fuera de rango
+
+#define FRAME_TEMP_INVALID      INT16_MIN
+#define FRAME_CURRENT_ABSENT    0xFFFF
+
+// tipo + seq + payload + crc
+#define FRAME_RAW_MAX           (2 + SERIAL_FRAME_MAX_PAYLOAD + 2)
+// COBS agrega un byte cada 254 (y el primero)
+#define FRAME_ENCODED_MAX       (FRAME_RAW_MAX + FRAME_RAW_MAX / 254 + 1)
+
+// ============================================================================
+// ESTADO
+// ============================================================================
+struct FrameStats {
+    uint32_t sent;
+    uint32_t dropped;               // Ring TX lleno (logWrite)
+    uint32_t rxOk;
+    uint32_t rxErrors;              // CRC, COBS o trama demasiado larga
+};
+
+FrameStats frameStats = {};
+bool frameMode = false;             // Modo tramas activo
+uint8_t frameHz = 0;                // Muestras por segundo (0 = solo eventos)
+uint8_t frameSeq = 0;
+unsigned long frameLastHost = 0;    // Última trama válida del host
+unsigned long frameLastSample = 0;
+
+uint8_t frameRx[FRAME_ENCODED_MAX];
+size_t frameRxLen = 0;
+bool frameRxOverflow = false;       // Se descarta hasta el próximo 0x00
+bool frameRxAfterZero = false;      // Llegó un 0x00: lo que sigue es trama, no línea
+
+bool serialFrameActive() {
+    return frameMode;
+}
+
+// ============================================================================
+// CRC16 Y COBS
+// ============================================================================
+uint16_t frameCrc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// out debe tener lugar para len + len / 254 + 1 bytes
+size_t cobsEncode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t codeAt = 0;
+    size_t o = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; i++) {
+        if (in[i]) {
+            out[o++] = in[i];
+            code++;
+        }
+        if (!in[i] || code == 0xFF) {
+            out[codeAt] = code;
+            codeAt = o++;
+            code = 1;
+        }
+    }
+    out[codeAt] = code;
+    return o;
+}
+
+// Devuelve los bytes decodificados; 0 si la entrada no es COBS válido
+size_t cobsDecode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t i = 0;
+    size_t o = 0;
+    while (i < len) {
+        uint8_t code = in[i++];
+        if (!code || i + code - 1 > len) return 0;
+        for (uint8_t j = 1; j < code; j++) out[o++] = in[i++];
+        if (code != 0xFF && i < len) out[o++] = 0;
+    }
+    return o;
+}
+
+// ============================================================================
+// ENVÍO
+// ============================================================================
+// Payload armado en el stack; los put* ignoran lo que no entra
+struct FramePayload {
+    uint8_t data[SERIAL_FRAME_MAX_PAYLOAD];
+    size_t len = 0;
+
+    void put8(uint8_t v) {
+        if (len < sizeof(data)) data[len++] = v;
+    }
+    void put16(uint16_t v) {
+        put8(v & 0xFF);
+        put8(v >> 8);
+    }
+    void put32(uint32_t v) {
+        put16(v & 0xFFFF);
+        put16(v >> 16);
+    }
+    void putText(const char* text) {
+        while (*text && len < sizeof(data)) data[len++] = (uint8_t)*text++;
+    }
+};
+
+bool frameSend(uint8_t type, const FramePayload& p) {
+    uint8_t raw[FRAME_RAW_MAX];
+    raw[0] = type;
+    raw[1] = frameSeq;
+    memcpy(raw + 2, p.data, p.len);
+    uint16_t crc = frameCrc16(raw, 2 + p.len);
+    raw[2 + p.len] = crc & 0xFF;
+    raw[3 + p.len] = crc >> 8;
+
+    uint8_t out[FRAME_ENCODED_MAX + 2];
+    out[0] = 0x00;
+    size_t n = 1 + cobsEncode(raw, 4 + p.len, out + 1);
+    out[n++] = 0x00;
+
+    // El seq avanza aunque se descarte: el host ve el hueco
+    frameSeq++;
+    if (!logWrite((const char*)out, n)) {
+        frameStats.dropped++;
+        return false;
+    }
+    frameStats.sent++;
+    return true;
+}
+
+void frameSendHello() {
+    FramePayload p;
+    p.put8(FRAME_PROTO_VERSION);
+    p.put8(SERIAL_FRAME_MAX_HZ);
+    p.put8(frameHz);
+    p.put32(frameStats.sent);
+    p.put32(frameStats.dropped);
+    p.put32(frameStats.rxOk);
+    p.put32(frameStats.rxErrors);
+    p.putText(DEVICE_ID " " FIRMWARE_VERSION);
+    frameSend(FRAME_HELLO, p);
+}
+
+void frameSendResponse(uint8_t reqType, uint8_t reqSeq, uint8_t status, const char* text) {
+    FramePayload p;
+    p.put8(reqType);
+    p.put8(reqSeq);
+    p.put8(status);
+    p.putText(text);
+    frameSend(FRAME_RESPONSE, p);
+}
+
+int16_t frameCenti(float value) {
+    float c = value * 100.0f;
+    if (c >= 32767.0f) return 32767;
+    if (c <= -32767.0f) return -32767;
+    return (int16_t)lroundf(c);
+}
+
+void frameSendSample() {
+    uint8_t flags = 0;
+    if (state.alertActive) flags |= 0x01;
+    if (state.alertCritical) flags |= 0x02;
+    if (sensorData.defrostSignalActive) flags |= 0x04;
+    if (state.wifiConnected) flags |= 0x08;
+
+    uint8_t doors = 0;
+    for (uint8_t i = 0; i < MAX_DOOR_SENSORS; i++) {
+        if (sensorData.door[i].enabled && sensorData.door[i].isOpen) doors |= 1 << i;
+    }
+
+    uint16_t current = FRAME_CURRENT_ABSENT;
+    if (currentSensorRms) {
+        float centi = currentSensorRms() * 100.0f;
+        current = centi < 0 ? 0 : centi >= 65534.0f ? 65534 : (uint16_t)lroundf(centi);
+    }
+
+    FramePayload p;
+    p.put32(millis());
+    p.put32(state.lastSensorRead);
+    p.put8(state.currentState);
+    p.put8(flags);
+    p.put8(doors);
+    p.put16(current);
+    p.put8(MAX_TEMP_SENSORS);
+    for (uint8_t i = 0; i < MAX_TEMP_SENSORS; i++) {
+        const TempSensor& t = sensorData.temp[i];
+        p.put16((uint16_t)(t.enabled && t.valid ? frameCenti(t.value) : FRAME_TEMP_INVALID));
+    }
+    frameSend(FRAME_SAMPLE, p);
+}
+
+// ============================================================================
+// EVENTOS (desde sensors.h y state_machine.h)
+// ============================================================================
+void frameEventDoor(uint8_t door, bool open) {
+    if (!frameMode) return;
+    FramePayload p;
+    p.put32(millis());
+    p.put8(door);
+    p.put8(open);
+    frameSend(FRAME_DOOR, p);
+}
+
+void frameEventState(SystemStateEnum from, SystemStateEnum to) {
+    if (!frameMode) return;
+    FramePayload p;
+    p.put32(millis());
+    p.put8(from);
+    p.put8(to);
+    frameSend(FRAME_STATE, p);
+}
+
+// ============================================================================
+// RESPUESTAS LARGAS
+// ============================================================================
+// Respuesta a un pedido del host partida en tramas RESPONSE: cada vez
+// que se llena el payload sale una; finish() manda la última
+class FrameResponsePrint : public Print {
+public:
+    FrameResponsePrint(uint8_t reqType, uint8_t reqSeq) : _type(reqType), _seq(reqSeq) {}
+
+    size_t write(uint8_t c) override {
+        if (_len == sizeof(_text) - 1) _send();
+        _text[_len++] = (char)c;
+        return 1;
+    }
+
+    void finish() {
+        if (_len || !_sent) _send();
+    }
+
+private:
+    void _send() {
+        _text[_len] = '\0';
+        frameSendResponse(_type, _seq, FRAME_OK, _text);
+        _len = 0;
+        _sent = true;
+    }
+
+    uint8_t _type;
+    uint8_t _seq;
+    char _text[SERIAL_FRAME_MAX_PAYLOAD - 3 + 1];   // Menos tipo, seq y status
+    size_t _len = 0;
+    bool _sent = false;
+};
+
+// ============================================================================
+// COMANDOS DEL HOST
+// ============================================================================
+void frameEnter() {
+    if (!frameMode) LOG_I("[FRAME] ✓ Modo tramas");
+    frameMode = true;
+    frameLastHost = millis();
+}
+
+void frameLeave(const char* reason) {
+    frameMode = false;
+    frameHz = 0;
+    frameRxAfterZero = false;
+    LOG_I("[FRAME] Modo texto (%s)", reason);
+}
+
+void frameCmdPing(uint8_t seq, const uint8_t* payload, size_t len) {
+    frameSendHello();
+}
+
+void frameCmdStream(uint8_t seq, const uint8_t* payload, size_t len) {
+    if (payload[0] > SERIAL_FRAME_MAX_HZ) {
+        frameSendResponse(FRAME_CMD_STREAM, seq, FRAME_ERR_ARG, "hz fuera de rango");
+        return;
+    }
+    frameHz = payload[0];
+    frameLastSample = 0;
+    frameSendResponse(FRAME_CMD_STREAM, seq, FRAME_OK, "");
+}
+
+// Misma tabla que la línea de texto (serial_api.h)
+void frameCmdCommand(uint8_t seq, const uint8_t* payload, size_t len) {
+    char cmd[SERIAL_FRAME_MAX_PAYLOAD + 1];
+    memcpy(cmd, payload, len);
+    cmd[len] = '\0';
+
+    String reply;
+    if (!runCommand(String(cmd), reply)) {
+        frameSendResponse(FRAME_CMD_COMMAND, seq, FRAME_ERR_UNKNOWN, "comando desconocido");
+        return;
+    }
+    FrameResponsePrint out(FRAME_CMD_COMMAND, seq);
+    out.print(reply);
+    out.finish();
+}
+
+void frameCmdText(uint8_t seq, const uint8_t* payload, size_t len) {
+    frameSendResponse(FRAME_CMD_TEXT, seq, FRAME_OK, "");
+    frameLeave("pedido del host");
+}
+
+struct FrameCommand {
+    uint8_t type;
+    uint16_t minLen;
+    uint16_t maxLen;
+    void (*handler)(uint8_t seq, const uint8_t* payload, size_t len);
+};
+
+static const FrameCommand FRAME_COMMANDS[] = {
+    { FRAME_CMD_PING,    0, 0,                        frameCmdPing },
+    { FRAME_CMD_STREAM,  1, 1,                        frameCmdStream },
+    { FRAME_CMD_COMMAND, 1, SERIAL_FRAME_MAX_PAYLOAD, frameCmdCommand },
+    { FRAME_CMD_TEXT,    0, 0,                        frameCmdText },
+};
+
+void frameDispatch(const uint8_t* raw, size_t len) {
+    uint8_t type = raw[0];
+    uint8_t seq = raw[1];
+    const uint8_t* payload = raw + 2;
+    size_t payloadLen = len - 4;
+
+    for (const FrameCommand& c : FRAME_COMMANDS) {
+        if (c.type != type) continue;
+        if (payloadLen < c.minLen || payloadLen > c.maxLen) {
+            frameSendResponse(type, seq, FRAME_ERR_LENGTH, "largo inválido");
+            return;
+        }
+        c.handler(seq, payload, payloadLen);
+        return;
+    }
+    frameSendResponse(type, seq, FRAME_ERR_UNKNOWN, "comando desconocido");
+}
+
+// ============================================================================
+// RECEPCIÓN
+// ============================================================================
+// Trama completa (sin el 0x00): valida y despacha. false si no es válida
+bool frameReceive() {
+    uint8_t raw[FRAME_ENCODED_MAX];
+    size_t len = cobsDecode(frameRx, frameRxLen, raw);
+    if (len < 4) {
+        frameStats.rxErrors++;
+        return false;
+    }
+    uint16_t crc = raw[len - 2] | (raw[len - 1] << 8);
+    if (crc != frameCrc16(raw, len - 2)) {
+        frameStats.rxErrors++;
+        return false;
+    }
+    frameStats.rxOk++;
+    frameEnter();
+    frameDispatch(raw, len);
+    return true;
+}
+
+// Línea de texto en modo texto: FRAMED o un comando de serial_api.h
+void frameTextLine() {
+    frameRx[frameRxLen] = '\0';
+    String line((const char*)frameRx);
+    line.trim();
+    if (line.equalsIgnoreCase("FRAMED")) {
+        frameEnter();
+        frameSendHello();
+    } else if (line.length()) {
+        String reply;
+        runCommand(line, reply);
+        Serial.println(reply);
+    }
+}
+
+// ============================================================================
+// LOOP
+// ============================================================================
+// Dueño del RX del Serial
+void serialFrameLoop() {
+    while (Serial.available()) {
+        uint8_t c = Serial.read();
+
+        if (c == 0x00) {
+            // Un 0x00 suelto abre una trama; si lo que llegó no era una
+            // trama válida se vuelve a leer líneas
+            bool pending = frameRxLen && !frameRxOverflow;
+            frameRxAfterZero = frameRxLen == 0;
+            if (pending) frameRxAfterZero = frameReceive() && frameMode;
+            frameRxLen = 0;
+            frameRxOverflow = false;
+            continue;
+        }
+        if (!frameMode && !frameRxAfterZero && (c == '\n' || c == '\r')) {
+            if (frameRxLen && !frameRxOverflow) frameTextLine();
+            frameRxLen = 0;
+            frameRxOverflow = false;
+            continue;
+        }
+        if (frameRxLen < sizeof(frameRx) - 1) {
+            frameRx[frameRxLen++] = c;
+        } else if (!frameRxOverflow) {
+            frameRxOverflow = true;
+            if (frameMode || frameRxAfterZero) frameStats.rxErrors++;
+        }
+    }
+
+    if (!frameMode) return;
+
+    if (millis() - frameLastHost > SERIAL_FRAME_IDLE_MS) {
+        frameLeave("host sin señal");
+        return;
+    }
+
+    if (frameHz && millis() - frameLastSample >= 1000UL / frameHz) {
+        frameLastSample = millis();
+        frameSendSample();
+    }
+}
+
+#endif
@@ -1,9 +1,22 @@
 /*
  * sim800.h - Módulo GSM SIM800L para SMS de emergencia
  * Sistema Monitoreo Reefer v3.0
- * 
- * NOTA: Este módulo NO está integrado aún. Solo definiciones.
- * 
+ *
+ * NOTA: En firmware_v2 se habilita con SIM800_ENABLED (o GPRS_ENABLED, que lo
+ * usa gprs_uploader.h): firmware_v2.ino llama sim800Init() en setup() y
+ * sim800Loop() en loop().
+ *
+ * Motor AT 100% no bloqueante (llamar sim800Loop() en cada vuelta):
+ * - UART → ring buffer → líneas; el prompt '>' de CMGS se detecta aparte
+ * - Cola de comandos AT, cada uno con su timeout y handlers de respuesta
+ * - Comandos con datos (CMGS, HTTPDATA): el payload se escribe por partes
+ *   según el espacio libre en el TX de la UART
+ * - URCs (+CREG, +CMTI, RING, UNDER-VOLTAGE...) se procesan en cualquier momento
+ * - Bandeja de salida de SMS con reintentos; sim800SendSMS() solo encola
+ * - Arranque (reset, espera de boot, AT, configuración) como secuencia de fases
+ *
+ * Ninguna función de este archivo usa delay() ni espera respuestas del módem.
+ *
  * CONEXIONES SIM800L:
  * - VCC: 3.7-4.2V (usar regulador, NO conectar directo a 5V)
  * - GND: GND
@@ -35,6 +48,68 @@ const char* SMS_PHONES[] = {
   // SMS_PHONE_2,
 };
 
+// Motor AT
+#define SIM800_RX_RING_SIZE     512     // Ring buffer de recepción
+#define SIM800_LINE_MAX         128     // Largo máximo de una línea de respuesta
+#define SIM800_CMD_QUEUE_SIZE   8       // Comandos AT pendientes
+#define SIM800_CMD_MAX_LEN      200     // AT+HTTPPARA="USERDATA" con headers
+#define SIM800_CMD_TIMEOUT_MS   2000    // Timeout por defecto de un comando
+#define SIM800_SMS_QUEUE_SIZE   6       // SMS en bandeja de salida
+#define SIM800_SMS_MAX_LEN      160     // Un SMS en modo texto (GSM 7 bits)
+#define SIM800_SMS_MAX_ATTEMPTS 3
+#define SIM800_SMS_RETRY_MS     30000   // Espera entre reintentos de un SMS
+#define SIM800_SMS_GAP_MS       2000    // Separación entre SMS (sin bloquear)
+#define SIM800_BOOT_MS          3000    // Espera post-reset antes del primer AT
+#define SIM800_PROBE_RETRIES    10      // AT sin respuesta antes de rendirse
+#define SIM800_RESTART_MS       60000   // Reintentar arranque completo
+#define SIM800_POLL_MS          60000   // Consultar señal y registro
+
+// ============================================
+// TIPOS DEL MOTOR AT
+// ============================================
+enum Sim800Result : uint8_t {
+  SIM800_RESULT_OK = 0,
+  SIM800_RESULT_ERROR,
+  SIM800_RESULT_TIMEOUT
+};
+
+enum Sim800Phase : uint8_t {
+  SIM800_PHASE_OFF = 0,         // Sin módulo o rendido, espera reintento
+  SIM800_PHASE_RESET,           // RST en bajo
+  SIM800_PHASE_BOOT,            // Esperando que el módulo arranque
+  SIM800_PHASE_PROBE,           // Mandando AT hasta que conteste
+  SIM800_PHASE_READY            // Operativo
+};
+
+enum Sim800CmdState : uint8_t {
+  SIM800_CMD_IDLE = 0,
+  SIM800_CMD_WAIT_PROMPT,       // Esperando '>' (CMGS) o DOWNLOAD (HTTPDATA)
+  SIM800_CMD_SENDING_PAYLOAD,   // Escribiendo datos a la UART por partes
+  SIM800_CMD_WAIT_RESULT        // Esperando OK / ERROR
+};
+
+typedef void (*Sim800LineHandler)(const char* line);
+typedef void (*Sim800DoneHandler)(Sim800Result result);
+typedef bool (*Sim800UrcHook)(const char* line);
+
+struct Sim800Command {
+  char text[SIM800_CMD_MAX_LEN];
+  uint16_t timeoutMs;
+  Sim800LineHandler onLine;     // Líneas intermedias (+CSQ: ..., etc.)
+  Sim800DoneHandler onDone;     // Resultado final
+  const char* payload;          // Datos tras el prompt (debe seguir vivo)
+  uint16_t payloadLen;
+  bool payloadCtrlZ;            // Terminar con Ctrl+Z (SMS)
+};
+
+struct Sim800Sms {
+  bool used;
+  uint8_t phone;                // Índice en SMS_PHONES
+  uint8_t attempts;
+  unsigned long nextAttempt;
+  char text[SIM800_SMS_MAX_LEN + 1];
+};
+
 // ============================================
 // VARIABLES
 // ============================================
@@ -47,119 +122,462 @@ struct SIM800State {
   String operatorName;
   unsigned long lastCheck;
   bool smsSent;
+
+  // Motor
+  Sim800Phase phase;
+  unsigned long phaseSince;
+  uint8_t probeAttempts;
+  Sim800CmdState cmdState;
+  unsigned long cmdSentAt;
+  uint16_t payloadSent;
+  unsigned long lastSmsAt;
+
+  // Estadísticas
+  unsigned long smsOk;
+  unsigned long smsFailed;
+  unsigned long cmdTimeouts;
+  unsigned long rxOverflows;
 };
 
 SIM800State sim800State;
+int gsmSignal = -1;     // Leído por supabase.h
+
+// Ring buffer de recepción
+uint8_t sim800Rx[SIM800_RX_RING_SIZE];
+uint16_t sim800RxHead = 0;
+uint16_t sim800RxTail = 0;
+char sim800Line[SIM800_LINE_MAX];
+uint8_t sim800LineLen = 0;
+
+// Cola de comandos (FIFO circular) y bandeja de SMS
+Sim800Command sim800Cmds[SIM800_CMD_QUEUE_SIZE];
+uint8_t sim800CmdHead = 0;
+uint8_t sim800CmdCount = 0;
+Sim800Sms sim800Outbox[SIM800_SMS_QUEUE_SIZE];
+int8_t sim800SmsInFlight = -1;      // Slot de la bandeja con CMGS en curso
+bool sim800Begun = false;
+
+// URCs de otros módulos (ej. +HTTPACTION para gprs_uploader.h)
+Sim800UrcHook sim800UrcHook = nullptr;
+
+void sim800StartPhase(Sim800Phase phase);
 
 // ============================================
-// INICIALIZACIÓN
+// UART → RING BUFFER
 // ============================================
-bool sim800Init() {
-  Serial.println("[SIM800] Inicializando...");
-  
-  sim800Serial.begin(SIM800_BAUD, SERIAL_8N1, SIM800_RX_PIN, SIM800_TX_PIN);
-  delay(1000);
-  
-  // Reset por hardware si está conectado
-  #ifdef SIM800_RST_PIN
-    pinMode(SIM800_RST_PIN, OUTPUT);
-    digitalWrite(SIM800_RST_PIN, LOW);
-    delay(100);
-    digitalWrite(SIM800_RST_PIN, HIGH);
-    delay(3000);
-  #endif
-  
-  // Test AT
-  sim800Serial.println("AT");
-  delay(500);
-  
-  if (sim800Serial.find("OK")) {
-    Serial.println("[SIM800] ✓ Módulo respondiendo");
-    sim800State.initialized = true;
-    
-    // Configurar modo texto para SMS
-    sim800Serial.println("AT+CMGF=1");
-    delay(500);
-    
-    // Verificar registro en red
-    sim800Serial.println("AT+CREG?");
-    delay(500);
-    
+void sim800PumpUart() {
+  while (sim800Serial.available()) {
+    uint16_t next = (sim800RxHead + 1) % SIM800_RX_RING_SIZE;
+    if (next == sim800RxTail) {
+      sim800State.rxOverflows++;
+      sim800Serial.read();  // Ring lleno: se pierde el byte
+      continue;
+    }
+    sim800Rx[sim800RxHead] = sim800Serial.read();
+    sim800RxHead = next;
+  }
+}
+
+// ============================================
+// COLA DE COMANDOS
+// ============================================
+bool sim800Queue(const char* text, uint16_t timeoutMs = SIM800_CMD_TIMEOUT_MS,
+                 Sim800LineHandler onLine = nullptr, Sim800DoneHandler onDone = nullptr,
+                 const char* payload = nullptr, uint16_t payloadLen = 0, bool payloadCtrlZ = false) {
+  if (sim800CmdCount >= SIM800_CMD_QUEUE_SIZE) {
+    Serial.printf("[SIM800] ✗ Cola AT llena, descartado %s\n", text);
+    return false;
+  }
+  Sim800Command& cmd = sim800Cmds[(sim800CmdHead + sim800CmdCount) % SIM800_CMD_QUEUE_SIZE];
+  strlcpy(cmd.text, text, sizeof(cmd.text));
+  cmd.timeoutMs = timeoutMs;
+  cmd.onLine = onLine;
+  cmd.onDone = onDone;
+  cmd.payload = payload;
+  cmd.payloadLen = payloadLen;
+  cmd.payloadCtrlZ = payloadCtrlZ;
+  sim800CmdCount++;
+  return true;
+}
+
+uint8_t sim800QueueFree() {
+  return SIM800_CMD_QUEUE_SIZE - sim800CmdCount;
+}
+
+Sim800Command* sim800CurrentCmd() {
+  return sim800CmdCount > 0 ? &sim800Cmds[sim800CmdHead] : nullptr;
+}
+
+void sim800FinishCmd(Sim800Result result) {
+  Sim800Command* cmd = sim800CurrentCmd();
+  if (!cmd) return;
+
+  Sim800DoneHandler onDone = cmd->onDone;
+  sim800CmdHead = (sim800CmdHead + 1) % SIM800_CMD_QUEUE_SIZE;
+  sim800CmdCount--;
+  sim800State.cmdState = SIM800_CMD_IDLE;
+
+  if (onDone) onDone(result);
+}
+
+void sim800FlushCmds() {
+  sim800CmdHead = 0;
+  sim800CmdCount = 0;
+  sim800State.cmdState = SIM800_CMD_IDLE;
+  sim800SmsInFlight = -1;  // El SMS queda en la bandeja y se reintenta
+}
+
+// ============================================
+// URCs (pueden llegar en cualquier momento)
+// ============================================
+// Devuelve true si la línea era un URC y ya se procesó
+bool sim800HandleUrc(const char* line) {
+  if (strncmp(line, "+CREG:", 6) == 0) {
+    // URC "+CREG: 1" o respuesta a consulta "+CREG: 0,1"
+    const char* comma = strchr(line, ',');
+    int status = atoi(comma ? comma + 1 : line + 6);
+    bool registered = (status == 1 || status == 5);
+    if (registered != sim800State.registered) {
+      Serial.printf("[SIM800] Red: %s\n", registered ? "REGISTRADO" : "SIN RED");
+    }
+    sim800State.registered = registered;
     return true;
-  } else {
-    Serial.println("[SIM800] ✗ No responde");
+  }
+  if (strncmp(line, "+CMTI:", 6) == 0) {
+    Serial.printf("[SIM800] SMS entrante: %s\n", line);
+    return true;
+  }
+  if (strcmp(line, "RING") == 0) {
+    sim800Queue("ATH");  // No atendemos llamadas
+    return true;
+  }
+  if (strcmp(line, "Call Ready") == 0 || strcmp(line, "SMS Ready") == 0) {
+    Serial.printf("[SIM800] %s\n", line);
+    return true;
+  }
+  if (strstr(line, "UNDER-VOLTAGE") || strstr(line, "NORMAL POWER DOWN")) {
+    // El módulo se apagó (típico con batería baja): arrancar de nuevo
+    Serial.printf("[SIM800] ⚠️ %s - reiniciando módulo\n", line);
     sim800State.initialized = false;
-    return false;
+    sim800State.registered = false;
+    sim800FlushCmds();
+    sim800StartPhase(SIM800_PHASE_OFF);
+    return true;
   }
+  return sim800UrcHook ? sim800UrcHook(line) : false;
 }
 
 // ============================================
-// VERIFICAR SEÑAL
+// PROCESAR UNA LÍNEA COMPLETA
 // ============================================
-int sim800GetSignal() {
-  if (!sim800State.initialized) return -1;
-  
-  sim800Serial.println("AT+CSQ");
-  delay(500);
-  
-  // Respuesta: +CSQ: XX,YY donde XX es la señal (0-31)
-  if (sim800Serial.find("+CSQ:")) {
-    int signal = sim800Serial.parseInt();
-    sim800State.signalStrength = signal;
-    return signal;
+void sim800HandleLine(const char* line) {
+  if (sim800HandleUrc(line)) return;
+
+  Sim800Command* cmd = sim800CurrentCmd();
+  if (!cmd || sim800State.cmdState == SIM800_CMD_IDLE) return;
+
+  if (sim800State.cmdState == SIM800_CMD_WAIT_PROMPT && strcmp(line, "DOWNLOAD") == 0) {
+    sim800State.cmdState = SIM800_CMD_SENDING_PAYLOAD;
+    sim800State.payloadSent = 0;
+    return;
+  }
+
+  if (strcmp(line, "OK") == 0) {
+    sim800FinishCmd(SIM800_RESULT_OK);
+  } else if (strcmp(line, "ERROR") == 0 || strncmp(line, "+CME ERROR", 10) == 0 ||
+             strncmp(line, "+CMS ERROR", 10) == 0) {
+    Serial.printf("[SIM800] ✗ %s → %s\n", cmd->text, line);
+    sim800FinishCmd(SIM800_RESULT_ERROR);
+  } else if (cmd->onLine && strcmp(line, cmd->text) != 0) {  // Ignorar eco
+    cmd->onLine(line);
+  }
+}
+
+void sim800ProcessRx() {
+  while (sim800RxTail != sim800RxHead) {
+    char c = sim800Rx[sim800RxTail];
+    sim800RxTail = (sim800RxTail + 1) % SIM800_RX_RING_SIZE;
+
+    // Prompt de AT+CMGS: llega "> " sin fin de línea
+    if (c == '>' && sim800LineLen == 0 && sim800State.cmdState == SIM800_CMD_WAIT_PROMPT) {
+      sim800State.cmdState = SIM800_CMD_SENDING_PAYLOAD;
+      sim800State.payloadSent = 0;
+      continue;
+    }
+
+    if (c == '\n') {
+      if (sim800LineLen > 0) {
+        sim800Line[sim800LineLen] = '\0';
+        sim800HandleLine(sim800Line);
+        sim800LineLen = 0;
+      }
+    } else if (c != '\r' && sim800LineLen < SIM800_LINE_MAX - 1) {
+      sim800Line[sim800LineLen++] = c;
+    }
   }
-  return -1;
 }
 
 // ============================================
-// VERIFICAR REGISTRO EN RED
+// DESPACHAR / VENCER COMANDOS
 // ============================================
-bool sim800IsRegistered() {
-  if (!sim800State.initialized) return false;
-  
-  sim800Serial.println("AT+CREG?");
-  delay(500);
-  
-  // Respuesta: +CREG: 0,1 (1=registrado, 5=roaming)
-  if (sim800Serial.find("+CREG:")) {
-    sim800Serial.parseInt();  // Ignorar primer número
-    int status = sim800Serial.parseInt();
-    sim800State.registered = (status == 1 || status == 5);
-    return sim800State.registered;
+void sim800RunCmds() {
+  Sim800Command* cmd = sim800CurrentCmd();
+  if (!cmd) return;
+  unsigned long now = millis();
+
+  if (sim800State.cmdState == SIM800_CMD_IDLE) {
+    sim800Serial.print(cmd->text);
+    sim800Serial.print("\r");
+    sim800State.cmdState = cmd->payload ? SIM800_CMD_WAIT_PROMPT : SIM800_CMD_WAIT_RESULT;
+    sim800State.cmdSentAt = now;
+    return;
+  }
+
+  // Payload: solo lo que entra en el TX de la UART, el resto en la próxima vuelta
+  if (sim800State.cmdState == SIM800_CMD_SENDING_PAYLOAD) {
+    int room = sim800Serial.availableForWrite();
+    uint16_t left = cmd->payloadLen - sim800State.payloadSent;
+    if (room > 0 && left > 0) {
+      uint16_t chunk = left < room ? left : room;
+      sim800Serial.write((const uint8_t*)cmd->payload + sim800State.payloadSent, chunk);
+      sim800State.payloadSent += chunk;
+      left -= chunk;
+    }
+    if (left == 0) {
+      if (cmd->payloadCtrlZ) sim800Serial.write(26);  // Ctrl+Z para enviar
+      sim800State.cmdState = SIM800_CMD_WAIT_RESULT;
+      sim800State.cmdSentAt = now;
+    }
+    return;
+  }
+
+  // CMGS/HTTPDATA: 5 seg para el prompt; el timeout del comando corre después
+  unsigned long timeout = sim800State.cmdState == SIM800_CMD_WAIT_PROMPT ? 5000 : cmd->timeoutMs;
+  if (now - sim800State.cmdSentAt >= timeout) {
+    if (sim800State.cmdState == SIM800_CMD_WAIT_PROMPT) {
+      sim800Serial.write(27);  // ESC: abortar el SMS
+    }
+    sim800State.cmdTimeouts++;
+    Serial.printf("[SIM800] ✗ Timeout: %s\n", cmd->text);
+    sim800FinishCmd(SIM800_RESULT_TIMEOUT);
   }
-  return false;
 }
 
 // ============================================
-// ENVIAR SMS
+// HANDLERS DE RESPUESTA
 // ============================================
-bool sim800SendSMS(const char* phone, String message) {
-  if (!sim800State.initialized || !sim800State.registered) {
-    Serial.println("[SIM800] ✗ No inicializado o sin red");
-    return false;
+void sim800OnCsq(const char* line) {
+  // +CSQ: XX,YY donde XX es la señal (0-31, 99 = desconocida)
+  if (strncmp(line, "+CSQ:", 5) != 0) return;
+  int signal = atoi(line + 5);
+  sim800State.signalStrength = signal == 99 ? -1 : signal;
+  gsmSignal = sim800State.signalStrength;
+}
+
+void sim800OnCops(const char* line) {
+  // +COPS: 0,0,"Movistar"
+  if (strncmp(line, "+COPS:", 6) != 0) return;
+  const char* start = strchr(line, '"');
+  const char* end = start ? strchr(start + 1, '"') : nullptr;
+  if (start && end) {
+    sim800State.operatorName = String(start + 1).substring(0, end - start - 1);
+  }
+}
+
+void sim800OnProbe(Sim800Result result) {
+  if (result == SIM800_RESULT_OK) {
+    Serial.println("[SIM800] ✓ Módulo respondiendo");
+    sim800State.initialized = true;
+    sim800StartPhase(SIM800_PHASE_READY);
+
+    sim800Queue("ATE0");              // Sin eco
+    sim800Queue("AT+CMGF=1");         // Modo texto para SMS
+    sim800Queue("AT+CNMI=2,1,0,0,0"); // URC +CMTI al recibir SMS
+    sim800Queue("AT+CREG=1");         // URC +CREG al cambiar registro
+    sim800Queue("AT+CREG?");
+    sim800Queue("AT+CSQ", SIM800_CMD_TIMEOUT_MS, sim800OnCsq);
+    sim800Queue("AT+COPS?", 5000, sim800OnCops);
+    return;
+  }
+
+  if (++sim800State.probeAttempts >= SIM800_PROBE_RETRIES) {
+    Serial.println("[SIM800] ✗ No responde");
+    sim800StartPhase(SIM800_PHASE_OFF);
+  } else {
+    sim800State.phaseSince = millis();  // Reintentar AT en 1 seg
   }
-  
-  Serial.printf("[SIM800] Enviando SMS a %s...\n", phone);
-  
-  // Comando AT para enviar SMS
-  sim800Serial.print("AT+CMGS=\"");
-  sim800Serial.print(phone);
-  sim800Serial.println("\"");
-  delay(500);
-  
-  // Esperar prompt '>'
-  if (sim800Serial.find(">")) {
-    sim800Serial.print(message);
-    sim800Serial.write(26);  // Ctrl+Z para enviar
-    delay(5000);
-    
-    if (sim800Serial.find("OK")) {
-      Serial.println("[SIM800] ✓ SMS enviado");
-      return true;
+}
+
+void sim800OnSmsDone(Sim800Result result);
+
+// ============================================
+// FASES DE ARRANQUE
+// ============================================
+void sim800StartPhase(Sim800Phase phase) {
+  sim800State.phase = phase;
+  sim800State.phaseSince = millis();
+
+  switch (phase) {
+    case SIM800_PHASE_RESET:
+      #ifdef SIM800_RST_PIN
+        pinMode(SIM800_RST_PIN, OUTPUT);
+        digitalWrite(SIM800_RST_PIN, LOW);
+      #endif
+      break;
+    case SIM800_PHASE_BOOT:
+      #ifdef SIM800_RST_PIN
+        digitalWrite(SIM800_RST_PIN, HIGH);
+      #endif
+      break;
+    case SIM800_PHASE_PROBE:
+      sim800State.probeAttempts = 0;
+      sim800FlushCmds();
+      break;
+    default:
+      break;
+  }
+}
+
+void sim800RunPhase() {
+  unsigned long elapsed = millis() - sim800State.phaseSince;
+
+  switch (sim800State.phase) {
+    case SIM800_PHASE_OFF:
+      if (elapsed >= SIM800_RESTART_MS) sim800StartPhase(SIM800_PHASE_RESET);
+      break;
+    case SIM800_PHASE_RESET:
+      if (elapsed >= 100) sim800StartPhase(SIM800_PHASE_BOOT);
+      break;
+    case SIM800_PHASE_BOOT:
+      if (elapsed >= SIM800_BOOT_MS) sim800StartPhase(SIM800_PHASE_PROBE);
+      break;
+    case SIM800_PHASE_PROBE:
+      if (sim800CmdCount == 0 && elapsed >= 1000) {
+        sim800Queue("AT", 1000, nullptr, sim800OnProbe);
+      }
+      break;
+    case SIM800_PHASE_READY:
+      // Consultas periódicas de señal y registro
+      if (millis() - sim800State.lastCheck >= SIM800_POLL_MS) {
+        sim800State.lastCheck = millis();
+        sim800Queue("AT+CSQ", SIM800_CMD_TIMEOUT_MS, sim800OnCsq);
+        sim800Queue("AT+CREG?");
+        Serial.printf("[SIM800] Señal: %d/31, Red: %s\n",
+                      sim800State.signalStrength,
+                      sim800State.registered ? "OK" : "NO");
+      }
+      break;
+  }
+}
+
+// ============================================
+// BANDEJA DE SALIDA DE SMS
+// ============================================
+void sim800OnSmsDone(Sim800Result result) {
+  if (sim800SmsInFlight < 0) return;
+  Sim800Sms& sms = sim800Outbox[sim800SmsInFlight];
+  sim800SmsInFlight = -1;
+  sim800State.lastSmsAt = millis();
+
+  if (result == SIM800_RESULT_OK) {
+    Serial.printf("[SIM800] ✓ SMS enviado a %s\n", SMS_PHONES[sms.phone]);
+    sim800State.smsOk++;
+    sim800State.smsSent = true;
+    sms.used = false;
+    return;
+  }
+
+  if (++sms.attempts >= SIM800_SMS_MAX_ATTEMPTS) {
+    Serial.printf("[SIM800] ✗ SMS a %s descartado tras %d intentos\n", SMS_PHONES[sms.phone], sms.attempts);
+    sim800State.smsFailed++;
+    sms.used = false;
+  } else {
+    sms.nextAttempt = millis() + SIM800_SMS_RETRY_MS;
+  }
+}
+
+void sim800RunOutbox() {
+  if (sim800State.phase != SIM800_PHASE_READY || !sim800State.registered) return;
+  if (sim800SmsInFlight >= 0 || sim800CmdCount > 0) return;
+
+  unsigned long now = millis();
+  if (now - sim800State.lastSmsAt < SIM800_SMS_GAP_MS) return;
+
+  for (int i = 0; i < SIM800_SMS_QUEUE_SIZE; i++) {
+    Sim800Sms& sms = sim800Outbox[i];
+    if (!sms.used || (long)(sms.nextAttempt - now) > 0) continue;
+
+    char cmd[48];
+    snprintf(cmd, sizeof(cmd), "AT+CMGS=\"%s\"", SMS_PHONES[sms.phone]);
+    if (sim800Queue(cmd, 60000, nullptr, sim800OnSmsDone, sms.text, strlen(sms.text), true)) {
+      sim800SmsInFlight = i;
+      Serial.printf("[SIM800] Enviando SMS a %s...\n", SMS_PHONES[sms.phone]);
     }
+    return;
+  }
+}
+
+// ============================================
+// INICIALIZACIÓN (no bloqueante: solo arranca la secuencia)
+// ============================================
+bool sim800Init() {
+  Serial.println("[SIM800] Inicializando...");
+
+  // Con buffer de TX el body del SMS (hasta 160 bytes a 9600 baud) no bloquea
+  sim800Serial.setRxBufferSize(SIM800_RX_RING_SIZE);
+  sim800Serial.setTxBufferSize(256);
+  sim800Serial.begin(SIM800_BAUD, SERIAL_8N1, SIM800_RX_PIN, SIM800_TX_PIN);
+
+  memset(sim800Outbox, 0, sizeof(sim800Outbox));
+  sim800State.initialized = false;
+  sim800State.registered = false;
+  sim800State.signalStrength = -1;
+  sim800State.lastCheck = millis();
+  sim800StartPhase(SIM800_PHASE_RESET);
+  sim800Begun = true;
+  return true;
+}
+
+// ============================================
+// VERIFICAR SEÑAL / REGISTRO (valores cacheados)
+// ============================================
+int sim800GetSignal() {
+  return sim800State.initialized ? sim800State.signalStrength : -1;
+}
+
+bool sim800IsRegistered() {
+  return sim800State.initialized && sim800State.registered;
+}
+
+// Módulo operativo (arranque y configuración terminados)
+bool sim800Ready() {
+  return sim800State.phase == SIM800_PHASE_READY;
+}
+
+// ============================================
+// ENVIAR SMS (encola, no espera)
+// ============================================
+bool sim800QueueSms(uint8_t phoneIndex, const String& message) {
+  for (int i = 0; i < SIM800_SMS_QUEUE_SIZE; i++) {
+    Sim800Sms& sms = sim800Outbox[i];
+    if (sms.used) continue;
+    sms.used = true;
+    sms.phone = phoneIndex;
+    sms.attempts = 0;
+    sms.nextAttempt = millis();
+    strlcpy(sms.text, message.c_str(), sizeof(sms.text));
+    return true;
   }
-  
-  Serial.println("[SIM800] ✗ Error enviando SMS");
+  Serial.println("[SIM800] ✗ Bandeja de SMS llena");
+  sim800State.smsFailed++;
+  return false;
+}
+
+bool sim800SendSMS(const char* phone, String message) {
+  for (int i = 0; i < SMS_PHONE_COUNT; i++) {
+    if (strcmp(SMS_PHONES[i], phone) == 0) return sim800QueueSms(i, message);
+  }
+  Serial.printf("[SIM800] ✗ Número no configurado: %s\n", phone);
   return false;
 }
 
@@ -170,48 +588,41 @@ void sim800SendAlert(String alertMessage) {
   String fullMsg = "ALERTA REEFER\n";
   fullMsg += alertMessage;
   fullMsg += "\n\nSistema Monitoreo Reefer";
-  
+
   for (int i = 0; i < SMS_PHONE_COUNT; i++) {
-    sim800SendSMS(SMS_PHONES[i], fullMsg);
-    delay(2000);  // Pausa entre SMS
+    sim800QueueSms(i, fullMsg);  // La separación entre SMS la maneja la bandeja
   }
-  
-  sim800State.smsSent = true;
 }
 
 // ============================================
 // ENVIAR SMS DE CORTE DE LUZ
 // ============================================
 void sim800SendPowerAlert(bool powerLost) {
+  // Solo ASCII: el modo texto GSM 7 bits no tiene emojis ni tildes
   String msg;
   if (powerLost) {
-    msg = "⚠️ CORTE DE LUZ DETECTADO\n";
-    msg += "El sistema está funcionando con batería.\n";
-    msg += "Verificar suministro eléctrico.";
+    msg = "CORTE DE LUZ DETECTADO\n";
+    msg += "El sistema esta funcionando con bateria.\n";
+    msg += "Verificar suministro electrico.";
   } else {
-    msg = "✅ LUZ RESTAURADA\n";
-    msg += "El suministro eléctrico ha vuelto.";
+    msg = "LUZ RESTAURADA\n";
+    msg += "El suministro electrico ha vuelto.";
   }
-  
+
   sim800SendAlert(msg);
 }
 
 // ============================================
-// LOOP DE VERIFICACIÓN (llamar periódicamente)
+// LOOP DEL MOTOR (llamar en cada vuelta, nunca bloquea)
 // ============================================
 void sim800Loop() {
-  if (!sim800State.initialized) return;
-  
-  // Verificar cada 60 segundos
-  if (millis() - sim800State.lastCheck >= 60000) {
-    sim800State.lastCheck = millis();
-    sim800GetSignal();
-    sim800IsRegistered();
-    
-    Serial.printf("[SIM800] Señal: %d/31, Red: %s\n", 
-                  sim800State.signalStrength,
-                  sim800State.registered ? "OK" : "NO");
-  }
+  if (!sim800Begun) return;
+
+  sim800PumpUart();
+  sim800ProcessRx();
+  sim800RunPhase();
+  sim800RunOutbox();
+  sim800RunCmds();
 }
 
 #endif
@@ -23,6 +23,8 @@
 
 #include "config.h"
 #include "types.h"
+#include "log.h"
+#include "serial_frame.h"
 
 // Referencias externas
 extern SystemState state;
@@ -34,6 +36,8 @@ extern void setRelay(bool on);
 extern void sendTelegramAlert(String message);
 extern void supabaseSendDefrostStart(float tempAtStart, const char* triggeredBy);
 extern void supabaseSendDefrostEnd(float tempAtEnd, unsigned long durationMin);
+extern void statusNotify();
+void enterCooldownMode();
 
 // ============================================================================
 // TIMERS NO BLOQUEANTES GLOBALES
@@ -53,14 +57,16 @@ void changeState(SystemStateEnum newState, const char* reason = "") {
     state.stateChangedAt = millis();
     state.stateName = getStateName(newState);
     
-    Serial.printf("\n[STATE] ═══════════════════════════════════════\n");
-    Serial.printf("[STATE] %s → %s\n", 
-                  getStateName(state.previousState), 
-                  getStateName(newState));
+    LOG_I("\n[STATE] ═══════════════════════════════════════");
+    LOG_I("[STATE] %s → %s",
+          getStateName(state.previousState),
+          getStateName(newState));
     if (strlen(reason) > 0) {
-        Serial.printf("[STATE] Razón: %s\n", reason);
+        LOG_I("[STATE] Razón: %s", reason);
     }
-    Serial.printf("[STATE] ═══════════════════════════════════════\n\n");
+    LOG_I("[STATE] ═══════════════════════════════════════\n");
+    frameEventState(state.previousState, newState);
+    statusNotify();
 }
 
 // ============================================================================
@@ -80,7 +86,7 @@ void initStateMachine() {
     state.configLoadEndTime = 0;
     state.configLoadRemainingSeconds = 0;
     
-    Serial.println("[STATE] Máquina de estados inicializada");
+    LOG_I("[STATE] Máquina de estados inicializada");
 }
 
 // ============================================================================
@@ -108,8 +114,8 @@ void enterDefrostMode(const char* triggeredBy) {
     // Registrar en Supabase
     supabaseSendDefrostStart(sensorData.tempAvg, triggeredBy);
     
-    Serial.printf("[DEFROST] ⚡ INICIADO - Temp actual: %.1f°C\n", sensorData.tempAvg);
-    Serial.printf("[DEFROST] Máximo permitido: %d minutos\n", config.defrostMaxDurationSec / 60);
+    LOG_I("[DEFROST] ⚡ INICIADO - Temp actual: %.1f°C", sensorData.tempAvg);
+    LOG_I("[DEFROST] Máximo permitido: %d minutos", config.defrostMaxDurationSec / 60);
 }
 
 // ============================================================================
@@ -124,8 +130,8 @@ void exitDefrostMode() {
     // Registrar fin de defrost en Supabase
     supabaseSendDefrostEnd(sensorData.tempAvg, defrostMinutes);
     
-    Serial.printf("[DEFROST] ✓ FINALIZADO - Duró %lu minutos\n", defrostMinutes);
-    Serial.printf("[DEFROST] Temp al finalizar: %.1f°C\n", sensorData.tempAvg);
+    LOG_I("[DEFROST] ✓ FINALIZADO - Duró %lu minutos", defrostMinutes);
+    LOG_I("[DEFROST] Temp al finalizar: %.1f°C", sensorData.tempAvg);
     
     // Iniciar período de cooldown
     enterCooldownMode();
@@ -144,8 +150,8 @@ void enterCooldownMode() {
     // Iniciar timer de cooldown
     cooldownTimer.start(config.defrostCooldownSec * 1000UL);
     
-    Serial.printf("[COOLDOWN] ⏳ INICIADO - Esperando %d minutos\n", config.defrostCooldownSec / 60);
-    Serial.printf("[COOLDOWN] El sistema se enfriará antes de reactivar monitoreo\n");
+    LOG_I("[COOLDOWN] ⏳ INICIADO - Esperando %d minutos", config.defrostCooldownSec / 60);
+    LOG_I("[COOLDOWN] El sistema se enfriará antes de reactivar monitoreo");
 }
 
 // ============================================================================
@@ -159,7 +165,7 @@ void exitCooldownMode() {
     
     changeState(STATE_NORMAL, "Cooldown completado");
     
-    Serial.println("[COOLDOWN] ✓ COMPLETADO - Volviendo a monitoreo normal");
+    LOG_I("[COOLDOWN] ✓ COMPLETADO - Volviendo a monitoreo normal");
 }
 
 // ============================================================================
@@ -175,7 +181,7 @@ void enterLoadingConfigMode() {
     // Iniciar timer
     configLoadTimer.start(config.configApplyTimeSec * 1000UL);
     
-    Serial.printf("[CONFIG] ⚙️ APLICANDO - Esperando %d segundos\n", config.configApplyTimeSec);
+    LOG_I("[CONFIG] ⚙️ APLICANDO - Esperando %d segundos", config.configApplyTimeSec);
 }
 
 // ============================================================================
@@ -189,7 +195,7 @@ void exitLoadingConfigMode() {
     
     changeState(STATE_NORMAL, "Configuración aplicada");
     
-    Serial.println("[CONFIG] ✓ CONFIGURACIÓN APLICADA");
+    LOG_I("[CONFIG] ✓ CONFIGURACIÓN APLICADA");
 }
 
 // ============================================================================
@@ -204,9 +210,9 @@ void updateStateTimers() {
         static unsigned long lastCooldownLog = 0;
         if (millis() - lastCooldownLog > 30000) {
             lastCooldownLog = millis();
-            Serial.printf("[COOLDOWN] ⏳ Restante: %d segundos (%.1f min)\n", 
-                          state.cooldownRemainingSeconds,
-                          state.cooldownRemainingSeconds / 60.0);
+            LOG_D("[COOLDOWN] ⏳ Restante: %d segundos (%.1f min)",
+                  state.cooldownRemainingSeconds,
+                  state.cooldownRemainingSeconds / 60.0);
         }
     }
     
@@ -240,7 +246,7 @@ void checkStateTransitions() {
             }
             // Verificar timeout de seguridad
             else if (defrostMaxTimer.check()) {
-                Serial.println("[DEFROST] ⚠️ TIMEOUT - Forzando salida de defrost");
+                LOG_W("[DEFROST] ⚠️ TIMEOUT - Forzando salida de defrost");
                 exitDefrostMode();
             }
             break;
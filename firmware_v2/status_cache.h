@@ -0,0 +1,180 @@
+/*
+ * ============================================================================
+ * STATUS_CACHE.H - SNAPSHOT VERSIONADO DE /api/status v4.0
+ * Sistema Monitoreo Reefer Industrial
+ * ============================================================================
+ *
+ * El JSON de /api/status se serializa UNA vez por cambio (lectura de
+ * sensores, cambio de estado, alertas, comandos web) y todos los clientes
+ * reciben esos mismos bytes, sin volver a armar el documento.
+ *
+ * Doble buffer: el loop escribe el JSON (json_writer.h, sin documento
+ * intermedio) en el buffer de atrás sin bloquear a nadie y lo publica
+ * intercambiando el índice bajo el mutex. Los handlers (tarea AsyncTCP)
+ * solo toman el mutex para copiar el buffer publicado a la respuesta.
+ *
+ * Cada publicación lleva una versión creciente (arranca al azar en cada
+ * boot, así una versión vieja no coincide por casualidad), que va:
+ *   - en el ETag ("s<versión>") → If-None-Match igual = 304 sin cuerpo
+ *   - en el campo "version" del JSON → GET /api/status?since=<versión>
+ *     espera hasta que haya una versión nueva (long-poll, hasta
+ *     STATUS_LONGPOLL_MS) y recién ahí responde
+ *
+ * ============================================================================
+ */
+
+#ifndef STATUS_CACHE_H
+#define STATUS_CACHE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "json_writer.h"
+#include "log.h"
+
+// ============================================================================
+// ESTRUCTURAS
+// ============================================================================
+struct StatusSnapshot {
+    char data[STATUS_CACHE_BYTES];
+    uint16_t len;
+    uint32_t version;
+};
+
+struct StatusCacheStats {
+    uint32_t published;
+    uint32_t overflow;              // JSON más grande que STATUS_CACHE_BYTES
+    uint32_t served;                // Respuestas con cuerpo
+    uint32_t notModified;           // 304
+    uint32_t longPolls;
+    uint32_t longPollTimeouts;      // Vencieron sin versión nueva
+    uint32_t buildUs;               // Última escritura del snapshot
+    uint8_t longPollActive;
+};
+
+StatusSnapshot statusBuf[2];
+volatile uint8_t statusFront = 0;           // Índice del snapshot publicado
+SemaphoreHandle_t statusMutex = nullptr;
+volatile bool statusDirty = true;
+StatusCacheStats statusStats = {};
+
+typedef void (*StatusWriterFn)(JsonWriter& w);   // Escribe los miembros
+
+// ============================================================================
+// AVISO DE CAMBIO (sensores, estado, alertas, comandos web)
+// ============================================================================
+// El snapshot se vuelve a escribir en la próxima vuelta del loop; de esa
+// versión salen también los deltas de /api/stream (live_stream.h)
+void statusNotify() {
+    statusDirty = true;
+}
+
+// ============================================================================
+// INICIALIZACIÓN
+// ============================================================================
+void statusCacheInit() {
+    statusMutex = xSemaphoreCreateMutex();
+    statusFront = 0;
+    statusBuf[0].len = 0;
+    statusBuf[0].version = esp_random() >> 1;
+    statusDirty = true;
+}
+
+// ============================================================================
+// PUBLICAR (loop)
+// ============================================================================
+// Escribe {"version":N, <miembros>} en el buffer libre y lo publica.
+// Devuelve false si no entra (queda el snapshot anterior). En ese caso
+// igual se baja statusDirty: reintentar en cada vuelta daría lo mismo;
+// el refresco periódico (WEB_SNAPSHOT_INTERVAL_MS) lo vuelve a probar.
+bool statusCachePublish(StatusWriterFn writeMembers) {
+    uint8_t back = statusFront ^ 1;
+    StatusSnapshot& snap = statusBuf[back];
+    uint32_t version = statusBuf[statusFront].version + 1;
+    unsigned long start = micros();
+
+    JsonBufferPrint out(snap.data, sizeof(snap.data));
+    JsonWriter w(out);
+    w.beginObject();
+    w.field(JK(version), version);
+    writeMembers(w);
+    w.endObject();
+
+    if (out.overflow()) {
+        static unsigned long lastLog = 0;
+        static uint32_t lastLogCount = 0;
+        statusStats.overflow++;
+        statusDirty = false;
+        if (lastLogCount == 0 || millis() - lastLog >= STATUS_OVERFLOW_LOG_MS) {
+            LOG_E("[STATUS] ✗ El JSON no entra en %d bytes de caché (%lu veces)",
+                  STATUS_CACHE_BYTES, (unsigned long)(statusStats.overflow - lastLogCount));
+            lastLog = millis();
+            lastLogCount = statusStats.overflow;
+        }
+        return false;
+    }
+    snap.len = out.length();
+    snap.version = version;
+    statusStats.buildUs = micros() - start;
+
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    statusFront = back;
+    xSemaphoreGive(statusMutex);
+
+    statusStats.published++;
+    statusDirty = false;
+    return true;
+}
+
+// ============================================================================
+// LECTURA (tarea AsyncTCP)
+// ============================================================================
+uint32_t statusCacheVersion() {
+    return statusBuf[statusFront].version;
+}
+
+// MessagePack lleva otro ETag: mismo recurso, otra representación
+void statusCacheETag(uint32_t version, char* out, size_t size, bool msgpack = false) {
+    snprintf(out, size, "\"s%lu%s\"", (unsigned long)version, msgpack ? "m" : "");
+}
+
+// Solo desde el loop (único que publica): sin mutex
+const StatusSnapshot& statusCacheFront() {
+    return statusBuf[statusFront];
+}
+
+// Copia el snapshot publicado a la respuesta; devuelve su versión
+uint32_t statusCacheWrite(Print& out) {
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    const StatusSnapshot& snap = statusBuf[statusFront];
+    out.write((const uint8_t*)snap.data, snap.len);
+    uint32_t version = snap.version;
+    xSemaphoreGive(statusMutex);
+    return version;
+}
+
+// Copia el snapshot publicado; devuelve su versión
+uint32_t statusCacheCopy(String& out) {
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    const StatusSnapshot& snap = statusBuf[statusFront];
+    out.reserve(snap.len);
+    out.concat(snap.data, snap.len);
+    uint32_t version = snap.version;
+    xSemaphoreGive(statusMutex);
+    return version;
+}
+
+// ============================================================================
+// JSON DE ESTADÍSTICAS (para /api/status)
+// ============================================================================
+void writeStatusCacheJSON(JsonWriter& w) {
+    w.field(JK(published), statusStats.published);
+    w.field(JK(served), statusStats.served);
+    w.field(JK(not_modified), statusStats.notModified);
+    w.field(JK(long_polls), statusStats.longPolls);
+    w.field(JK(long_poll_active), statusStats.longPollActive);
+    w.field(JK(long_poll_timeouts), statusStats.longPollTimeouts);
+    w.field(JK(overflow), statusStats.overflow);
+    w.field(JK(build_us), statusStats.buildUs);
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <Preferences.h>
 #include "config.h"
 #include "types.h"
+#include "metrics.h"
 
 extern Preferences prefs;
 extern Config config;
@@ -47,6 +48,7 @@ void loadConfig() {
     config.telegramEnabled = prefs.getBool("telegramEn", true);
     config.supabaseEnabled = prefs.getBool("supabaseEn", true);
     config.dht22Enabled = prefs.getBool("dht22En", DHT22_ENABLED);
+    config.transport = prefs.getUChar("transport", DEFAULT_TRANSPORT);
     
     // Sensores de temperatura habilitados
     config.tempSensorEnabled[0] = prefs.getBool("temp1En", TEMP_SENSOR_1_ENABLED);
@@ -76,6 +78,7 @@ void loadConfig() {
     Serial.printf("[STORAGE] Temp crítica: %.1f°C\n", config.tempCritical);
     Serial.printf("[STORAGE] Delay alerta: %d seg\n", config.alertDelaySec);
     Serial.printf("[STORAGE] Cooldown defrost: %d seg\n", config.defrostCooldownSec);
+    Serial.printf("[STORAGE] Transporte: %s\n", config.transport == TRANSPORT_MQTT ? "MQTT" : "HTTP");
 }
 
 // ============================================================================
@@ -87,6 +90,7 @@ void saveConfig() {
     // Entrar en modo LOADING_CONFIG
     enterLoadingConfigMode();
     
+    uint32_t start = micros();
     prefs.begin("reefer", false);  // Lectura/escritura
     
     // Umbrales de temperatura
@@ -109,6 +113,7 @@ void saveConfig() {
     prefs.putBool("telegramEn", config.telegramEnabled);
     prefs.putBool("supabaseEn", config.supabaseEnabled);
     prefs.putBool("dht22En", config.dht22Enabled);
+    prefs.putUChar("transport", config.transport);
     
     // Sensores de temperatura
     prefs.putBool("temp1En", config.tempSensorEnabled[0]);
@@ -133,6 +138,7 @@ void saveConfig() {
     prefs.putBool("simDoor", config.simDoorOpen);
     
     prefs.end();
+    metricObserve(metrics.nvsWrite, micros() - start);
     
     Serial.println("[STORAGE] ✓ Configuración guardada");
 }
@@ -169,6 +175,7 @@ void getConfigJSON(JsonObject& obj) {
     obj["telegram_enabled"] = config.telegramEnabled;
     obj["supabase_enabled"] = config.supabaseEnabled;
     obj["dht22_enabled"] = config.dht22Enabled;
+    obj["transport"] = config.transport == TRANSPORT_MQTT ? "mqtt" : "http";
     
     obj["simulation_mode"] = config.simulationMode;
     obj["sim_temp"] = config.simTemp;
@@ -21,6 +21,8 @@
 #include <ArduinoJson.h>
 #include "config.h"
 #include "types.h"
+#include "gzip_stream.h"
+#include "net_health.h"
 
 extern Config config;
 extern SystemState state;
@@ -34,43 +36,105 @@ extern bool __attribute__((weak)) acPowerPresent;
 extern float __attribute__((weak)) batteryVoltage;
 extern int __attribute__((weak)) gsmSignal;
 
+// ============================================
+// ENVIAR BODY (con compresión gzip opcional)
+// ============================================
+// Los bodies grandes (lecturas en lote) se comprimen antes de salir.
+// Si el resultado no entra en el buffer o no achica, se envía plano.
+#if SUPABASE_GZIP_ENABLED
+GzipStream supabaseGzip;
+static uint8_t supabaseGzipBuf[SUPABASE_GZIP_MAX_BYTES];
+#endif
+
+int supabasePostBody(HTTPClient& http, const String& body) {
+  #if SUPABASE_GZIP_ENABLED
+  if (body.length() >= SUPABASE_GZIP_MIN_BYTES) {
+    GzipBufferSink sink = {supabaseGzipBuf, sizeof(supabaseGzipBuf), 0, false};
+    
+    supabaseGzip.begin(gzipBufferSinkWrite, &sink);
+    supabaseGzip.write((const uint8_t*)body.c_str(), body.length());
+    supabaseGzip.finish();
+    
+    if (!sink.overflow && sink.length < body.length()) {
+      Serial.printf("[GZIP] %u → %u bytes (%.0f%%) en %lu us\n",
+                    body.length(), sink.length,
+                    100.0f * sink.length / body.length(),
+                    (unsigned long)supabaseGzip.cpuMicros());
+      http.addHeader("Content-Encoding", "gzip");
+      return http.POST(supabaseGzipBuf, sink.length);
+    }
+  }
+  #endif
+  return http.POST(body);
+}
+
+// ============================================
+// SUBIDA CON RESPALDO GPRS
+// ============================================
+// Todas las inserciones pasan por acá. Con WiFi + internet van por
+// HTTPClient como siempre; sin WiFi y con gprs_uploader.h incluido se
+// encolan en el módem (devuelve 202 = aceptado, se envía en segundo plano).
+#define UPLOAD_PRIO_READING   0       // Lecturas: se descartan primero y se limitan por GPRS
+#define UPLOAD_PRIO_EVENT     1       // Alertas, puertas, cortes: siempre antes que lecturas
+#define UPLOAD_QUEUED_GPRS    202
+
+extern bool __attribute__((weak)) gprsUploaderAvailable();
+extern bool __attribute__((weak)) gprsUploaderPost(const char* path, const String& body, uint8_t priority);
+
+bool supabaseUplinkAvailable() {
+  if (!config.supabaseEnabled) return false;
+  if (state.internetAvailable && netEndpointUp(NET_EP_SUPABASE)) return true;
+  return gprsUploaderAvailable && gprsUploaderAvailable();
+}
+
+int supabaseUpload(const char* path, const String& body, uint8_t priority) {
+  if (state.internetAvailable && netAllow(NET_EP_SUPABASE)) {
+    unsigned long start = millis();
+    HTTPClient http;
+    http.begin(String(SUPABASE_URL) + path);
+    http.addHeader("Content-Type", "application/json");
+    http.addHeader("apikey", SUPABASE_ANON_KEY);
+    http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
+    http.addHeader("Prefer", "return=minimal");
+
+    int code = supabasePostBody(http, body);
+    http.end();
+    netReport(NET_EP_SUPABASE, code, millis() - start);
+    return code;
+  }
+
+  if (gprsUploaderAvailable && gprsUploaderAvailable() &&
+      gprsUploaderPost(path, body, priority)) {
+    return UPLOAD_QUEUED_GPRS;
+  }
+  return -1;
+}
+
 // ============================================
 // ENVIAR LECTURA COMPLETA A SUPABASE
 // ============================================
 bool supabaseSendReading() {
-  if (!config.supabaseEnabled || !state.internetAvailable) {
+  if (!supabaseUplinkAvailable()) {
     return false;
   }
   
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/readings";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  http.addHeader("Prefer", "return=minimal");
-  
   // Documento JSON grande para todos los datos
   StaticJsonDocument<1024> doc;
   
   // Identificación
   doc["device_id"] = DEVICE_ID;
   
-  // Temperaturas (hasta 4 sensores DS18B20)
-  doc["temp1"] = sensorData.temp1;
-  doc["temp2"] = sensorData.temp2;
-  // doc["temp3"] = sensorData.temp3;  // Futuro
-  // doc["temp4"] = sensorData.temp4;  // Futuro
+  // Temperaturas (columnas temp1/temp2 de la v3: sondas 1 y 2)
+  if (sensorData.temp[0].valid) doc["temp1"] = sensorData.temp[0].value;
+  if (sensorData.temp[1].valid) doc["temp2"] = sensorData.temp[1].value;
   doc["temp_avg"] = sensorData.tempAvg;
-  doc["temp_dht"] = sensorData.tempDHT;
-  doc["humidity"] = sensorData.humidity;
+  if (sensorData.dhtValid) {
+    doc["temp_dht"] = sensorData.tempAmbient;
+    doc["humidity"] = sensorData.humidity;
+  }
   
-  // Estado de puertas (hasta 4)
-  doc["door1_open"] = sensorData.doorOpen;
-  // doc["door2_open"] = door2Open;  // Futuro
-  // doc["door3_open"] = door3Open;  // Futuro
-  // doc["door4_open"] = door4Open;  // Futuro
+  // Estado de puertas
+  doc["door1_open"] = sensorData.anyDoorOpen;
   
   // Estado eléctrico (si power_monitor está habilitado)
   #ifdef POWER_MONITOR_H
@@ -87,10 +151,10 @@ bool supabaseSendReading() {
   #endif
   
   // Estado del sistema
-  doc["relay_on"] = state.relayState;
+  doc["relay_on"] = sensorData.relay[0].state;
   doc["buzzer_on"] = false;  // TODO: agregar variable
   doc["alert_active"] = state.alertActive;
-  doc["defrost_mode"] = state.defrostMode;
+  doc["defrost_mode"] = state.currentState == STATE_DEFROST;
   doc["simulation_mode"] = config.simulationMode;
   
   // Conectividad
@@ -100,18 +164,19 @@ bool supabaseSendReading() {
   #endif
   
   // Metadata del sistema
-  doc["uptime_sec"] = (millis() - state.uptime) / 1000;
+  doc["uptime_sec"] = (millis() - state.bootTime) / 1000;
   doc["free_heap"] = ESP.getFreeHeap();
   
   String body;
   serializeJson(doc, body);
   
-  int code = http.POST(body);
-  http.end();
+  int code = supabaseUpload("/rest/v1/readings", body, UPLOAD_PRIO_READING);
   
   if (code == 201 || code == 200) {
     Serial.println("[SUPABASE] ✓ Lectura enviada");
     return true;
+  } else if (code == UPLOAD_QUEUED_GPRS) {
+    return true;
   } else {
     Serial.printf("[SUPABASE] ✗ Error: %d\n", code);
     return false;
@@ -122,16 +187,7 @@ bool supabaseSendReading() {
 // ENVIAR ALERTA A SUPABASE
 // ============================================
 void sendAlertToSupabase(String alertType, String severity, String message) {
-  if (!config.supabaseEnabled || !state.internetAvailable) return;
-  
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/alerts";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  http.addHeader("Prefer", "return=minimal");
+  if (!supabaseUplinkAvailable()) return;
   
   StaticJsonDocument<256> doc;
   doc["device_id"] = DEVICE_ID;
@@ -142,8 +198,7 @@ void sendAlertToSupabase(String alertType, String severity, String message) {
   String body;
   serializeJson(doc, body);
   
-  int code = http.POST(body);
-  http.end();
+  int code = supabaseUpload("/rest/v1/alerts", body, UPLOAD_PRIO_EVENT);
   
   if (code == 201 || code == 200) {
     Serial.println("[SUPABASE] ✓ Alerta enviada");
@@ -154,10 +209,11 @@ void sendAlertToSupabase(String alertType, String severity, String message) {
 // ACTUALIZAR ESTADO ONLINE E IP
 // ============================================
 bool supabaseUpdateDeviceStatus(bool isOnline) {
-  if (!config.supabaseEnabled || !state.internetAvailable) {
+  if (!config.supabaseEnabled || !state.internetAvailable || !netAllow(NET_EP_SUPABASE)) {
     return false;
   }
   
+  unsigned long start = millis();
   HTTPClient http;
   String url = String(SUPABASE_URL) + "/rest/v1/devices?device_id=eq." + String(DEVICE_ID);
   
@@ -177,6 +233,7 @@ bool supabaseUpdateDeviceStatus(bool isOnline) {
   
   int code = http.PATCH(payload);
   http.end();
+  netReport(NET_EP_SUPABASE, code, millis() - start);
   
   if (code == 200 || code == 204) {
     Serial.printf("[SUPABASE] ✓ Estado actualizado (IP: %s)\n", state.localIP.c_str());
@@ -190,16 +247,7 @@ bool supabaseUpdateDeviceStatus(bool isOnline) {
 // ============================================
 void supabaseSendDoorEvent(int doorNumber, const char* doorName, bool opened, 
                            int openDurationSec = 0, float tempAtOpen = 0, float tempAtClose = 0) {
-  if (!config.supabaseEnabled || !state.internetAvailable) return;
-  
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/door_events";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  http.addHeader("Prefer", "return=minimal");
+  if (!supabaseUplinkAvailable()) return;
   
   StaticJsonDocument<256> doc;
   doc["device_id"] = DEVICE_ID;
@@ -216,8 +264,7 @@ void supabaseSendDoorEvent(int doorNumber, const char* doorName, bool opened,
   
   String body;
   serializeJson(doc, body);
-  http.POST(body);
-  http.end();
+  supabaseUpload("/rest/v1/door_events", body, UPLOAD_PRIO_EVENT);
 }
 
 // ============================================
@@ -225,16 +272,7 @@ void supabaseSendDoorEvent(int doorNumber, const char* doorName, bool opened,
 // ============================================
 void supabaseSendPowerEvent(bool powerLost, int outageDurationSec = 0, 
                             float minBatteryVoltage = 0, int batteryUsedPercent = 0) {
-  if (!config.supabaseEnabled || !state.internetAvailable) return;
-  
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/power_events";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  http.addHeader("Prefer", "return=minimal");
+  if (!supabaseUplinkAvailable()) return;
   
   StaticJsonDocument<256> doc;
   doc["device_id"] = DEVICE_ID;
@@ -248,8 +286,7 @@ void supabaseSendPowerEvent(bool powerLost, int outageDurationSec = 0,
   
   String body;
   serializeJson(doc, body);
-  http.POST(body);
-  http.end();
+  supabaseUpload("/rest/v1/power_events", body, UPLOAD_PRIO_EVENT);
   
   Serial.printf("[SUPABASE] Evento de energía: %s\n", powerLost ? "CORTE" : "RESTAURADO");
 }
@@ -258,16 +295,7 @@ void supabaseSendPowerEvent(bool powerLost, int outageDurationSec = 0,
 // INICIAR SESIÓN DE DESCONGELAMIENTO
 // ============================================
 void supabaseSendDefrostStart(float tempAtStart, const char* triggeredBy = "manual") {
-  if (!config.supabaseEnabled || !state.internetAvailable) return;
-  
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/defrost_sessions";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  http.addHeader("Prefer", "return=minimal");
+  if (!supabaseUplinkAvailable()) return;
   
   StaticJsonDocument<256> doc;
   doc["device_id"] = DEVICE_ID;
@@ -276,8 +304,7 @@ void supabaseSendDefrostStart(float tempAtStart, const char* triggeredBy = "manu
   
   String body;
   serializeJson(doc, body);
-  http.POST(body);
-  http.end();
+  supabaseUpload("/rest/v1/defrost_sessions", body, UPLOAD_PRIO_EVENT);
 }
 
 // ============================================
@@ -285,16 +312,7 @@ void supabaseSendDefrostStart(float tempAtStart, const char* triggeredBy = "manu
 // ============================================
 void supabaseSendMaintenanceLog(float compressorHours, int compressorStarts, 
                                  float maxCurrentEver, const char* notes = "") {
-  if (!config.supabaseEnabled || !state.internetAvailable) return;
-  
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/maintenance_logs";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_ANON_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
-  http.addHeader("Prefer", "return=minimal");
+  if (!supabaseUplinkAvailable()) return;
   
   StaticJsonDocument<256> doc;
   doc["device_id"] = DEVICE_ID;
@@ -306,16 +324,16 @@ void supabaseSendMaintenanceLog(float compressorHours, int compressorStarts,
   
   String body;
   serializeJson(doc, body);
-  http.POST(body);
-  http.end();
+  supabaseUpload("/rest/v1/maintenance_logs", body, UPLOAD_PRIO_EVENT);
 }
 
 // ============================================
 // VERIFICAR COMANDOS PENDIENTES
 // ============================================
 String supabaseCheckCommands() {
-  if (!config.supabaseEnabled || !state.internetAvailable) return "";
+  if (!config.supabaseEnabled || !state.internetAvailable || !netAllow(NET_EP_SUPABASE)) return "";
   
+  unsigned long start = millis();
   HTTPClient http;
   String url = String(SUPABASE_URL) + "/rest/v1/commands";
   url += "?device_id=eq." + String(DEVICE_ID);
@@ -328,6 +346,7 @@ String supabaseCheckCommands() {
   http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANON_KEY));
   
   int code = http.GET();
+  netReport(NET_EP_SUPABASE, code, millis() - start);
   String command = "";
   
   if (code == 200) {
@@ -365,11 +384,12 @@ void supabaseSync() {
   
   unsigned long now = millis();
   
-  // Enviar lectura cada SUPABASE_SYNC_INTERVAL (5 segundos)
-  if (now - state.lastSupabaseSync >= SUPABASE_SYNC_INTERVAL) {
+  // Enviar lectura cada INTERVAL_SUPABASE_SYNC_MS (5 segundos)
+  if (now - state.lastSupabaseSync >= INTERVAL_SUPABASE_SYNC_MS) {
     state.lastSupabaseSync = now;
     
-    if (state.internetAvailable) {
+    // Sin WiFi la lectura puede salir por GPRS (el uploader aplica su propio límite)
+    if (supabaseUplinkAvailable()) {
       supabaseSendReading();
     }
   }
@@ -1,58 +1,308 @@
 /*
  * telegram.h - Notificaciones Telegram
  * Sistema Monitoreo Reefer v3.0
+ *
+ * Cola de salida con prioridades (nada se envía desde el lugar que
+ * genera la alerta, todo pasa por telegramLoop()):
+ *
+ * - Coalescencia por clave: una alerta repetida con la misma clave
+ *   reemplaza el texto pendiente y suma un contador, no encola otra
+ * - Se envía primero la de mayor prioridad (a igual prioridad, la más vieja)
+ * - Reintento con backoff exponencial + jitter ante errores de red / 5xx
+ * - 429: se respeta parameters.retry_after para TODA la cola
+ * - Un solo WiFiClientSecure con keep-alive para todos los chats
+ *   (se evita un handshake TLS por destinatario)
+ * - Estado de entrega por chat: si un chat falla solo se reintenta ese
  */
 
 #ifndef TELEGRAM_H
 #define TELEGRAM_H
 
+#include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include "config.h"
 #include "types.h"
+#include "net_health.h"
 
 extern Config config;
 extern SystemState state;
 extern SensorData sensorData;
 
 // ============================================
-// ENVIAR MENSAJE A TELEGRAM
+// CONFIGURACIÓN DE LA COLA
 // ============================================
-void sendTelegramMessage(String message) {
-  if (strlen(TELEGRAM_BOT_TOKEN) < 10) return;
-  if (millis() - state.lastTelegramAlert < 300000) return;
-  
-  HTTPClient http;
+#define TELEGRAM_QUEUE_SIZE       8
+#define TELEGRAM_KEY_LEN          24
+#define TELEGRAM_BACKOFF_BASE_MS  2000UL
+#define TELEGRAM_BACKOFF_MAX_MS   300000UL    // Tope del backoff: 5 min
+#define TELEGRAM_MAX_ATTEMPTS     8           // Las críticas no se descartan nunca
+
+enum TelegramPriority : uint8_t {
+  TG_PRIO_LOW = 0,        // Informativos (test, estado)
+  TG_PRIO_NORMAL,         // Warnings
+  TG_PRIO_HIGH,           // Puerta abierta, corte de luz
+  TG_PRIO_CRITICAL        // Temperatura crítica
+};
+
+struct TelegramMessage {
+  bool used;
+  char key[TELEGRAM_KEY_LEN];
+  String text;
+  uint8_t priority;
+  uint8_t pendingChats;       // Bit i = falta entregar a TELEGRAM_CHAT_IDS[i]
+  uint8_t attempts;
+  uint16_t repeats;           // Veces que se coalesció
+  unsigned long createdAt;
+  unsigned long nextAttempt;
+};
+
+struct TelegramStats {
+  unsigned long sent;
+  unsigned long failed;
+  unsigned long coalesced;
+  unsigned long dropped;
+  unsigned long rateLimited;
+};
+
+TelegramMessage telegramQueue[TELEGRAM_QUEUE_SIZE];
+TelegramStats telegramStats;
+unsigned long telegramBlockedUntil = 0;   // 429: nadie envía hasta acá
+
+WiFiClientSecure telegramClient;
+HTTPClient telegramHttp;
+
+// ============================================
+// ENCOLAR (con coalescencia por clave)
+// ============================================
+bool telegramNotify(const char* key, uint8_t priority, const String& text) {
+  if (strlen(TELEGRAM_BOT_TOKEN) < 10) return false;
+  unsigned long now = millis();
+
+  // ¿Ya hay uno pendiente con la misma clave? Reemplazar el texto
+  for (int i = 0; i < TELEGRAM_QUEUE_SIZE; i++) {
+    TelegramMessage& m = telegramQueue[i];
+    if (m.used && strcmp(m.key, key) == 0) {
+      m.text = text;
+      m.repeats++;
+      if (priority > m.priority) {
+        // Sube de prioridad: sale ya, sin heredar el backoff del anterior
+        m.priority = priority;
+        m.attempts = 0;
+        m.nextAttempt = now;
+      }
+      m.pendingChats = (1 << TELEGRAM_CHAT_COUNT) - 1;  // El texto nuevo va a todos
+      telegramStats.coalesced++;
+      Serial.printf("[TELEGRAM] Coalescido '%s' (x%u)\n", key, m.repeats + 1);
+      return true;
+    }
+  }
+
+  // Slot libre, o desalojar el de menor prioridad (el más viejo)
+  int slot = -1;
+  for (int i = 0; i < TELEGRAM_QUEUE_SIZE; i++) {
+    if (!telegramQueue[i].used) { slot = i; break; }
+  }
+  if (slot < 0) {
+    for (int i = 0; i < TELEGRAM_QUEUE_SIZE; i++) {
+      TelegramMessage& m = telegramQueue[i];
+      if (m.priority > priority) continue;
+      if (slot < 0 || m.priority < telegramQueue[slot].priority ||
+          (m.priority == telegramQueue[slot].priority && m.createdAt < telegramQueue[slot].createdAt)) {
+        slot = i;
+      }
+    }
+    if (slot < 0) {
+      telegramStats.dropped++;
+      Serial.printf("[TELEGRAM] ✗ Cola llena, descartado '%s'\n", key);
+      return false;
+    }
+    telegramStats.dropped++;
+    Serial.printf("[TELEGRAM] Cola llena, desalojado '%s'\n", telegramQueue[slot].key);
+  }
+
+  TelegramMessage& m = telegramQueue[slot];
+  m.used = true;
+  strlcpy(m.key, key, sizeof(m.key));
+  m.text = text;
+  m.priority = priority;
+  m.pendingChats = (1 << TELEGRAM_CHAT_COUNT) - 1;
+  m.attempts = 0;
+  m.repeats = 0;
+  m.createdAt = now;
+  m.nextAttempt = now;
+  return true;
+}
+
+// ============================================
+// ENVIAR A UN CHAT (conexión reutilizada)
+// ============================================
+// Devuelve el código HTTP; en 429 carga retryAfterSec
+int telegramPost(const char* chatId, const String& text, int& retryAfterSec) {
   String url = "https://api.telegram.org/bot" + String(TELEGRAM_BOT_TOKEN) + "/sendMessage";
-  
-  for (int i = 0; i < TELEGRAM_CHAT_COUNT; i++) {
-    http.begin(url);
-    http.addHeader("Content-Type", "application/json");
-    
-    StaticJsonDocument<512> doc;
-    doc["chat_id"] = TELEGRAM_CHAT_IDS[i];
-    doc["text"] = message;
-    doc["parse_mode"] = "Markdown";
-    
-    String body;
-    serializeJson(doc, body);
-    
-    int code = http.POST(body);
-    Serial.printf("[TELEGRAM] Enviado a %s: %d\n", TELEGRAM_CHAT_IDS[i], code);
-    http.end();
+
+  telegramHttp.begin(telegramClient, url);
+  telegramHttp.addHeader("Content-Type", "application/json");
+
+  StaticJsonDocument<1024> doc;
+  doc["chat_id"] = chatId;
+  doc["text"] = text;
+  doc["parse_mode"] = "Markdown";
+
+  String body;
+  serializeJson(doc, body);
+
+  unsigned long start = millis();
+  int code = telegramHttp.POST(body);
+  netReport(NET_EP_TELEGRAM, code, millis() - start);
+  retryAfterSec = 0;
+
+  if (code == 429) {
+    StaticJsonDocument<64> filter;
+    filter["parameters"]["retry_after"] = true;
+    StaticJsonDocument<128> resp;
+    if (!deserializeJson(resp, telegramHttp.getString(), DeserializationOption::Filter(filter))) {
+      retryAfterSec = resp["parameters"]["retry_after"] | 30;
+    } else {
+      retryAfterSec = 30;
+    }
+  } else if (code > 0) {
+    telegramHttp.getString();  // Consumir el body para poder reusar el socket
+  }
+
+  telegramHttp.end();  // Con setReuse(true) el socket queda abierto
+  return code;
+}
+
+// ============================================
+// BACKOFF
+// ============================================
+unsigned long telegramBackoffMs(uint8_t attempts) {
+  uint8_t shift = attempts > 8 ? 8 : attempts;
+  unsigned long delayMs = TELEGRAM_BACKOFF_BASE_MS << shift;
+  if (delayMs > TELEGRAM_BACKOFF_MAX_MS) delayMs = TELEGRAM_BACKOFF_MAX_MS;
+  return delayMs + random(0, delayMs / 4);
+}
+
+// ============================================
+// PROCESAR COLA (llamar en cada loop)
+// ============================================
+void telegramLoop() {
+  static bool clientReady = false;
+  if (!clientReady) {
+    telegramClient.setInsecure();
+    telegramHttp.setReuse(true);
+    clientReady = true;
+  }
+
+  if (!config.telegramEnabled || !state.internetAvailable) return;
+
+  unsigned long now = millis();
+  if ((long)(telegramBlockedUntil - now) > 0) return;
+
+  // Elegir el mensaje vencido de mayor prioridad (a igual prioridad, el más viejo)
+  int next = -1;
+  for (int i = 0; i < TELEGRAM_QUEUE_SIZE; i++) {
+    TelegramMessage& m = telegramQueue[i];
+    if (!m.used || (long)(m.nextAttempt - now) > 0) continue;
+    if (next < 0 || m.priority > telegramQueue[next].priority ||
+        (m.priority == telegramQueue[next].priority && m.createdAt < telegramQueue[next].createdAt)) {
+      next = i;
+    }
+  }
+  if (next < 0) return;
+  if (!netAllow(NET_EP_TELEGRAM)) return;  // Circuito abierto: esperar a la sonda
+
+  TelegramMessage& m = telegramQueue[next];
+  String text = m.text;
+  if (m.repeats > 0) {
+    text += "\n🔁 _Repetido " + String(m.repeats + 1) + " veces_";
+  }
+
+  bool retry = false;
+  for (int c = 0; c < TELEGRAM_CHAT_COUNT; c++) {
+    if (!(m.pendingChats & (1 << c))) continue;
+    if (!netEndpointUp(NET_EP_TELEGRAM)) {  // Se abrió con el chat anterior
+      retry = true;
+      break;
+    }
+
+    int retryAfter = 0;
+    int code = telegramPost(TELEGRAM_CHAT_IDS[c], text, retryAfter);
+    Serial.printf("[TELEGRAM] '%s' → %s: %d\n", m.key, TELEGRAM_CHAT_IDS[c], code);
+
+    if (code == 200) {
+      m.pendingChats &= ~(1 << c);
+      telegramStats.sent++;
+    } else if (code == 429) {
+      // Límite de Telegram: frenar toda la cola el tiempo indicado
+      telegramStats.rateLimited++;
+      telegramBlockedUntil = millis() + retryAfter * 1000UL;
+      Serial.printf("[TELEGRAM] 429: esperando %d seg\n", retryAfter);
+      return;
+    } else if (code >= 400 && code < 500) {
+      // Chat inválido o bot bloqueado: reintentar no sirve
+      m.pendingChats &= ~(1 << c);
+      telegramStats.failed++;
+    } else {
+      retry = true;  // Red o 5xx
+    }
+  }
+
+  if (m.pendingChats == 0) {
+    m.used = false;
+    m.text = "";
+    return;
   }
-  
-  state.lastTelegramAlert = millis();
+
+  if (retry) {
+    m.attempts++;
+    if (m.attempts >= TELEGRAM_MAX_ATTEMPTS && m.priority < TG_PRIO_CRITICAL) {
+      Serial.printf("[TELEGRAM] ✗ Descartado '%s' tras %u intentos\n", m.key, m.attempts);
+      telegramStats.dropped++;
+      m.used = false;
+      m.text = "";
+      return;
+    }
+    m.nextAttempt = millis() + telegramBackoffMs(m.attempts);
+  }
+}
+
+int telegramQueueLength() {
+  int n = 0;
+  for (int i = 0; i < TELEGRAM_QUEUE_SIZE; i++) {
+    if (telegramQueue[i].used) n++;
+  }
+  return n;
+}
+
+void getTelegramJSON(JsonObject& obj) {
+  obj["queued"] = telegramQueueLength();
+  obj["sent"] = telegramStats.sent;
+  obj["failed"] = telegramStats.failed;
+  obj["coalesced"] = telegramStats.coalesced;
+  obj["dropped"] = telegramStats.dropped;
+  obj["rate_limited"] = telegramStats.rateLimited;
+  long blocked = (long)(telegramBlockedUntil - millis());
+  obj["blocked_sec"] = blocked > 0 ? blocked / 1000 : 0;
 }
 
 // ============================================
 // ENVIAR ALERTA A TELEGRAM
 // ============================================
-void sendTelegramAlert(String message) {
+String telegramFormat(const String& message) {
   String fullMsg = "🏔️ *" + String(DEVICE_NAME) + "*\n\n" + message;
-  fullMsg += "\n\n📍 " + String(LOCATION_DETAIL);
+  fullMsg += "\n\n📍 " + String(DEVICE_LOCATION);
   fullMsg += "\n🌡️ Temp: " + String(sensorData.tempAvg, 1) + "°C";
-  sendTelegramMessage(fullMsg);
+  return fullMsg;
+}
+
+void sendTelegramAlert(String message) {
+  telegramNotify("general", TG_PRIO_NORMAL, telegramFormat(message));
+}
+
+void sendTelegramAlert(const char* key, uint8_t priority, String message) {
+  telegramNotify(key, priority, telegramFormat(message));
 }
 
 // ============================================
@@ -60,19 +310,14 @@ void sendTelegramAlert(String message) {
 // ============================================
 bool testTelegram() {
   if (!state.internetAvailable) return false;
-  
+
   String msg = "✅ *Test de conexión*\n\n";
-  msg += "📍 " + String(LOCATION_DETAIL) + "\n";
+  msg += "📍 " + String(DEVICE_LOCATION) + "\n";
   msg += "🌡️ Temperatura: " + String(sensorData.tempAvg, 1) + "°C\n";
   msg += "📶 WiFi: " + String(WiFi.RSSI()) + " dBm\n";
   msg += "🔗 IP: " + state.localIP;
-  
-  unsigned long savedTime = state.lastTelegramAlert;
-  state.lastTelegramAlert = 0;
-  sendTelegramMessage(msg);
-  state.lastTelegramAlert = savedTime;
-  
-  return true;
+
+  return telegramNotify("test", TG_PRIO_LOW, msg);
 }
 
 #endif
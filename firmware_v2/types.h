@@ -71,6 +71,9 @@ struct Config {
     bool supabaseEnabled;
     bool dht22Enabled;
     
+    // Transporte de lecturas/eventos (TransportType)
+    uint8_t transport;
+    
     // Sensores de temperatura habilitados
     bool tempSensorEnabled[MAX_TEMP_SENSORS];
     
@@ -170,7 +173,6 @@ struct SystemState {
     
     // Última lectura de sensores
     unsigned long lastSensorRead;
-    unsigned long lastInternetCheck;
 };
 
 // ============================================================================
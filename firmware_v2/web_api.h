@@ -1,20 +1,48 @@
 /*
  * web_api.h - Servidor web y API REST
  * Sistema Monitoreo Reefer v3.0
+ *
+ * Servidor asíncrono (ESPAsyncWebServer + AsyncTCP): las conexiones se
+ * atienden en la tarea de AsyncTCP, varias a la vez, sin pasar por loop().
+ * Un teléfono lento con mal WiFi ya no frena el control de alertas.
+ *
+ * Reglas para no compartir estado entre tareas:
+ * - GET: se responde con una copia del JSON que arma el loop apenas cambia
+ *   algo (o cada WEB_SNAPSHOT_INTERVAL_MS). /api/status sale del caché
+ *   versionado de status_cache.h: ETag/304 y long-poll con ?since=.
+ *   /api/status, /api/config y /api/history aceptan ?fields= y
+ *   Accept: application/msgpack (api_format.h).
+ * - POST: el handler valida y encola un WebCommand; el loop lo aplica en
+ *   webApiLoop(). Se responde al encolar (la app vuelve a leer /api/status).
+ *
+ * Límites por conexión: WEB_MAX_CONNECTIONS en curso, cuerpo de hasta
+ * WEB_MAX_BODY_BYTES y WEB_MIN_FREE_HEAP libre para aceptar un request.
  */
 
 #ifndef WEB_API_H
 #define WEB_API_H
 
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
 #include "config.h"
 #include "types.h"
+#include "json_writer.h"
+#include "api_format.h"
+#include "status_cache.h"
+#include "live_stream.h"
+#include "metrics.h"
+#include "net_health.h"
+#include "wifi_utils.h"
+#include "profiler.h"
+#include "web_assets.h"
 
-extern WebServer server;
+extern AsyncWebServer server;
 extern Config config;
 extern SensorData sensorData;
 extern SystemState state;
+extern HistoryPoint history[HISTORY_SIZE];
+extern int historyIndex;
 
 extern void saveConfig();
 extern void acknowledgeAlert();
@@ -23,115 +51,238 @@ extern void triggerAlert(String message, bool critical);
 extern void setRelay(bool on);
 extern bool testTelegram();
 extern void resetWiFi();
-extern String getEmbeddedHTML();
+extern void enterDefrostMode(const char* triggeredBy);
+extern void exitDefrostMode();
+
+// serial_api.h (incluido después): comandos de texto y sus rutas
+extern String processCommand(String cmd);
+extern void setupSerialApiRoutes();
 
 // ============================================
-// HANDLER: Página principal
+// COLA DE MUTACIONES (handlers → loop)
 // ============================================
-void handleRoot() {
-  server.send(200, "text/html", getEmbeddedHTML());
-}
+enum WebCommandType : uint8_t {
+  WEB_CMD_CONFIG,
+  WEB_CMD_ACK_ALERT,
+  WEB_CMD_TEST_ALERT,
+  WEB_CMD_RELAY,
+  WEB_CMD_TELEGRAM_TEST,
+  WEB_CMD_DEFROST,
+  WEB_CMD_WIFI_RESET,
+  WEB_CMD_TEXT,          // Comando de serial_api.h
+  WEB_CMD_RESTART
+};
+
+struct WebCommand {
+  WebCommandType type;
+  bool value;            // Relé / defrost: estado pedido
+  char* body;            // JSON o texto (malloc, lo libera el loop)
+};
+
+struct WebStats {
+  unsigned long requests;
+  unsigned long rejected;        // Sin lugar (conexiones o heap)
+  unsigned long tooLarge;        // Cuerpo > WEB_MAX_BODY_BYTES
+  unsigned long queued;
+  unsigned long queueFull;
+  uint8_t active;                // Conexiones en curso
+  uint8_t peakActive;
+  int8_t lastTelegramTest;       // 1 ok, -1 falló, 0 sin probar
+  uint32_t handlerUsMax;         // Handler GET más lento (hasta el send)
+};
+
+QueueHandle_t webCmdQueue = nullptr;
+SemaphoreHandle_t webSnapshotMutex = nullptr;
+char webConfigJson[WEB_CONFIG_BYTES];
+size_t webConfigLen = 0;
+bool webSnapshotDirty = true;
+unsigned long webWifiResetAt = 0;
+unsigned long webRestartAt = 0;
+WebStats webStats = {};
 
 // ============================================
-// HANDLER: API Status
+// SNAPSHOTS (los arma el loop)
 // ============================================
-void handleApiStatus() {
-  StaticJsonDocument<1024> doc;
-  
-  JsonObject sensor = doc.createNestedObject("sensor");
-  sensor["temp1"] = sensorData.temp1;
-  sensor["temp2"] = sensorData.temp2;
-  sensor["temp_avg"] = sensorData.tempAvg;
-  sensor["temp_dht"] = sensorData.tempDHT;
-  sensor["humidity"] = sensorData.humidity;
-  sensor["door_open"] = sensorData.doorOpen;
-  sensor["door_open_sec"] = sensorData.doorOpen ? (millis() - sensorData.doorOpenSince) / 1000 : 0;
-  sensor["sensor_count"] = sensorData.sensorCount;
-  sensor["valid"] = sensorData.valid;
-  
-  JsonObject sys = doc.createNestedObject("system");
-  sys["alert_active"] = state.alertActive;
-  sys["alert_acknowledged"] = state.alertAcknowledged;
-  sys["critical"] = state.criticalAlert;
-  sys["alert_message"] = state.alertMessage;
-  sys["relay_on"] = state.relayState;
-  sys["internet"] = state.internetAvailable;
-  sys["wifi_connected"] = state.wifiConnected;
-  sys["ap_mode"] = state.apMode;
-  sys["uptime_sec"] = (millis() - state.uptime) / 1000;
-  sys["total_alerts"] = state.totalAlerts;
-  sys["wifi_rssi"] = WiFi.RSSI();
-  sys["simulation_mode"] = config.simulationMode;
-  sys["door_enabled"] = config.doorEnabled;
-  sys["sensor1_enabled"] = config.sensor1Enabled;
-  sys["sensor2_enabled"] = config.sensor2Enabled;
-  sys["defrost_mode"] = state.defrostMode;
-  sys["defrost_minutes"] = state.defrostMode ? (millis() - state.defrostStartTime) / 60000 : 0;
-  sys["supabase_enabled"] = config.supabaseEnabled;
-  
-  JsonObject device = doc.createNestedObject("device");
-  device["id"] = DEVICE_ID;
-  device["name"] = DEVICE_NAME;
-  device["ip"] = state.localIP;
-  device["mdns"] = String(MDNS_NAME) + ".local";
-  
-  JsonObject loc = doc.createNestedObject("location");
-  loc["name"] = LOCATION_NAME;
-  loc["detail"] = LOCATION_DETAIL;
-  
-  String response;
-  serializeJson(doc, response);
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", response);
+// Miembros de /api/status (status_cache.h agrega "version" y las llaves).
+// live_stream.h saca los deltas de /api/stream de este mismo JSON.
+void writeStatusJSON(JsonWriter& w) {
+  // Claves de la v3 (la app Android lee sensor.temp1/temp2 y door_open)
+  // armadas con los datos de la v4: sondas 1 y 2, cualquier puerta
+  const TempSensor& t1 = sensorData.temp[0];
+  const TempSensor& t2 = sensorData.temp[1];
+  unsigned long doorOpenSec = 0;
+  for (int i = 0; i < MAX_DOOR_SENSORS; i++) {
+    const DoorSensor& d = sensorData.door[i];
+    if (d.isOpen && (millis() - d.openSince) / 1000 > doorOpenSec) doorOpenSec = (millis() - d.openSince) / 1000;
+  }
+  bool doorEnabled = false;
+  for (int i = 0; i < MAX_DOOR_SENSORS; i++) doorEnabled |= config.doorEnabled[i];
+  bool defrost = state.currentState == STATE_DEFROST;
+
+  w.beginObject(JK(sensor));
+  w.key(JK(temp1));
+  if (t1.valid) w.value(t1.value); else w.null();
+  w.key(JK(temp2));
+  if (t2.valid) w.value(t2.value); else w.null();
+  w.field(JK(temp_avg), sensorData.tempAvg);
+  w.key(JK(temp_dht));
+  if (sensorData.dhtValid) w.value(sensorData.tempAmbient); else w.null();
+  w.key(JK(humidity));
+  if (sensorData.dhtValid) w.value(sensorData.humidity); else w.null();
+  w.field(JK(door_open), sensorData.anyDoorOpen);
+  w.field(JK(door_open_sec), doorOpenSec);
+  w.field(JK(sensor_count), sensorData.tempSensorCount);
+  w.field(JK(valid), sensorData.tempValid);
+  w.endObject();
+
+  w.beginObject(JK(system));
+  w.field(JK(state), state.stateName);
+  w.field(JK(alert_active), state.alertActive);
+  w.field(JK(alert_acknowledged), state.alertAcknowledged);
+  w.field(JK(critical), state.alertCritical);
+  w.field(JK(alert_message), state.alertMessage);
+  w.field(JK(relay_on), sensorData.relay[0].state);
+  w.field(JK(internet), state.internetAvailable);
+  w.field(JK(wifi_connected), state.wifiConnected);
+  w.field(JK(ap_mode), state.apMode);
+  w.field(JK(uptime_sec), (millis() - state.bootTime) / 1000);
+  w.field(JK(total_alerts), state.totalAlerts);
+  w.field(JK(wifi_rssi), (int)WiFi.RSSI());
+  w.field(JK(simulation_mode), config.simulationMode);
+  w.field(JK(door_enabled), doorEnabled);
+  w.field(JK(sensor1_enabled), config.tempSensorEnabled[0]);
+  w.field(JK(sensor2_enabled), config.tempSensorEnabled[1]);
+  w.field(JK(defrost_mode), defrost);
+  w.field(JK(defrost_minutes), defrost ? (millis() - state.defrostStartTime) / 60000 : 0UL);
+  w.field(JK(supabase_enabled), config.supabaseEnabled);
+  w.endObject();
+
+  w.beginObject(JK(device));
+  w.field(JK(id), DEVICE_ID);
+  w.field(JK(name), DEVICE_NAME);
+  w.field(JK(ip), state.localIP);
+  w.field(JK(mdns), MDNS_NAME ".local");
+  w.endObject();
+
+  w.beginObject(JK(location));
+  w.field(JK(name), DEVICE_LOCATION);
+  w.field(JK(lat), LOCATION_LAT, 6);
+  w.field(JK(lon), LOCATION_LON, 6);
+  w.endObject();
+
+  w.beginObject(JK(network));
+  w.beginArray(JK(endpoints));
+  writeNetHealthJSON(w);
+  w.endArray();
+  w.beginObject(JK(wifi));
+  writeWiFiJSON(w);
+  w.endObject();
+  #if GPRS_ENABLED
+  // gprs_uploader.h (firmware_v2.ino lo incluye antes que este archivo)
+  w.beginObject(JK(gprs));
+  writeGprsJSON(w);
+  w.endObject();
+  #endif
+  w.endObject();
+
+  w.beginObject(JK(web));
+  w.field(JK(requests), webStats.requests);
+  w.field(JK(active), webStats.active);
+  w.field(JK(peak_active), webStats.peakActive);
+  w.field(JK(rejected), webStats.rejected);
+  w.field(JK(too_large), webStats.tooLarge);
+  w.field(JK(queue_full), webStats.queueFull);
+  w.field(JK(last_telegram_test), webStats.lastTelegramTest);
+  w.field(JK(handler_us_max), webStats.handlerUsMax);
+  w.field(JK(heap_min), ESP.getMinFreeHeap());
+  writeApiFormatStatsJSON(w);
+  w.endObject();
+
+  w.beginObject(JK(stream));
+  writeStreamStatsJSON(w);
+  w.endObject();
+
+  w.beginObject(JK(cache));
+  writeStatusCacheJSON(w);
+  w.endObject();
 }
 
-// ============================================
-// HANDLER: GET Config
-// ============================================
-void handleApiGetConfig() {
-  StaticJsonDocument<512> doc;
-  
-  doc["temp_max"] = config.tempMax;
-  doc["temp_critical"] = config.tempCritical;
-  doc["alert_delay_sec"] = config.alertDelaySec;
-  doc["door_open_max_sec"] = config.doorOpenMaxSec;
-  doc["defrost_cooldown_sec"] = config.defrostCooldownSec;
-  doc["defrost_relay_nc"] = config.defrostRelayNC;
-  doc["relay_enabled"] = config.relayEnabled;
-  doc["buzzer_enabled"] = config.buzzerEnabled;
-  doc["telegram_enabled"] = config.telegramEnabled;
-  doc["supabase_enabled"] = config.supabaseEnabled;
-  doc["sensor1_enabled"] = config.sensor1Enabled;
-  doc["sensor2_enabled"] = config.sensor2Enabled;
-  doc["dht22_enabled"] = config.dht22Enabled;
-  doc["door_enabled"] = config.doorEnabled;
-  doc["simulation_mode"] = config.simulationMode;
-  
-  String response;
-  serializeJson(doc, response);
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", response);
+void writeConfigJSON(JsonWriter& w) {
+  w.beginObject();
+  w.field(JK(temp_max), config.tempMax);
+  w.field(JK(temp_critical), config.tempCritical);
+  w.field(JK(alert_delay_sec), config.alertDelaySec);
+  w.field(JK(door_open_max_sec), config.doorOpenMaxSec);
+  w.field(JK(defrost_cooldown_sec), config.defrostCooldownSec);
+  w.field(JK(defrost_relay_nc), config.defrostRelayNC);
+  w.field(JK(relay_enabled), config.relayEnabled);
+  w.field(JK(buzzer_enabled), config.buzzerEnabled);
+  w.field(JK(telegram_enabled), config.telegramEnabled);
+  w.field(JK(supabase_enabled), config.supabaseEnabled);
+  w.field(JK(dht22_enabled), config.dht22Enabled);
+  w.field(JK(simulation_mode), config.simulationMode);
+
+  // Escalares de la v3 que usa la app (sondas 1 y 2, alguna puerta) y los
+  // arrays completos, con los mismos nombres que getConfigJSON()
+  bool doorEnabled = false;
+  for (int i = 0; i < MAX_DOOR_SENSORS; i++) doorEnabled |= config.doorEnabled[i];
+  w.field(JK(sensor1_enabled), config.tempSensorEnabled[0]);
+  w.field(JK(sensor2_enabled), config.tempSensorEnabled[1]);
+  w.field(JK(door_enabled), doorEnabled);
+  w.beginArray(JK(temp_sensors_enabled));
+  for (int i = 0; i < MAX_TEMP_SENSORS; i++) w.value(config.tempSensorEnabled[i]);
+  w.endArray();
+  w.beginArray(JK(doors_enabled));
+  for (int i = 0; i < MAX_DOOR_SENSORS; i++) w.value(config.doorEnabled[i]);
+  w.endArray();
+  w.field(JK(transport), config.transport == TRANSPORT_MQTT ? "mqtt" : "http");
+  w.endObject();
+}
+
+// Historial del minuto (firmware_v2.ino), del más viejo al más nuevo
+void writeHistoryJSON(JsonWriter& w) {
+  unsigned long now = millis();
+  w.beginObject();
+  w.field(JK(interval_sec), (unsigned long)(INTERVAL_HISTORY_UPDATE_MS / 1000));
+  w.beginArray(JK(points));
+  for (int i = 0; i < HISTORY_SIZE; i++) {
+    const HistoryPoint& p = history[(historyIndex + i) % HISTORY_SIZE];
+    if (p.timestamp == 0) continue;
+    w.beginObject();
+    w.field(JK(ago_sec), (now - p.timestamp) / 1000);
+    w.field(JK(temp), p.temp);
+    w.field(JK(humidity), p.humidity);
+    w.field(JK(door_open), p.doorOpen);
+    w.field(JK(alert), p.alertActive);
+    w.endObject();
+  }
+  w.endArray();
+  w.endObject();
+}
+
+void webRefreshSnapshots() {
+  statusCachePublish(writeStatusJSON);
+
+  char cfg[WEB_CONFIG_BYTES];
+  JsonBufferPrint out(cfg, sizeof(cfg));
+  JsonWriter w(out);
+  writeConfigJSON(w);
+  if (!out.overflow()) {
+    xSemaphoreTake(webSnapshotMutex, portMAX_DELAY);
+    memcpy(webConfigJson, cfg, out.length());
+    webConfigLen = out.length();
+    xSemaphoreGive(webSnapshotMutex);
+  }
+  webSnapshotDirty = false;
 }
 
 // ============================================
-// HANDLER: POST Config
+// APLICAR MUTACIONES (en el loop)
 // ============================================
-void handleApiSetConfig() {
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No body\"}");
-    return;
-  }
-  
+void applyConfigJSON(const char* body) {
   StaticJsonDocument<512> doc;
-  DeserializationError error = deserializeJson(doc, server.arg("plain"));
-  
-  if (error) {
-    server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
-    return;
-  }
-  
+  if (deserializeJson(doc, body)) return;   // Ya validado en el handler
+
   if (doc.containsKey("temp_max")) config.tempMax = doc["temp_max"];
   if (doc.containsKey("temp_critical")) config.tempCritical = doc["temp_critical"];
   if (doc.containsKey("alert_delay_sec")) config.alertDelaySec = doc["alert_delay_sec"];
@@ -142,134 +293,618 @@ void handleApiSetConfig() {
   if (doc.containsKey("buzzer_enabled")) config.buzzerEnabled = doc["buzzer_enabled"];
   if (doc.containsKey("telegram_enabled")) config.telegramEnabled = doc["telegram_enabled"];
   if (doc.containsKey("supabase_enabled")) config.supabaseEnabled = doc["supabase_enabled"];
-  if (doc.containsKey("sensor1_enabled")) config.sensor1Enabled = doc["sensor1_enabled"];
-  if (doc.containsKey("sensor2_enabled")) config.sensor2Enabled = doc["sensor2_enabled"];
+  if (doc.containsKey("sensor1_enabled")) config.tempSensorEnabled[0] = doc["sensor1_enabled"];
+  if (doc.containsKey("sensor2_enabled")) config.tempSensorEnabled[1] = doc["sensor2_enabled"];
   if (doc.containsKey("dht22_enabled")) config.dht22Enabled = doc["dht22_enabled"];
-  if (doc.containsKey("door_enabled")) config.doorEnabled = doc["door_enabled"];
+  if (doc.containsKey("door_enabled")) {
+    // Escalar de la v3: todas las puertas
+    for (int i = 0; i < MAX_DOOR_SENSORS; i++) config.doorEnabled[i] = doc["door_enabled"];
+  }
+  JsonArrayConst temps = doc["temp_sensors_enabled"];
+  for (int i = 0; i < MAX_TEMP_SENSORS && i < (int)temps.size(); i++) config.tempSensorEnabled[i] = temps[i];
+  JsonArrayConst doors = doc["doors_enabled"];
+  for (int i = 0; i < MAX_DOOR_SENSORS && i < (int)doors.size(); i++) config.doorEnabled[i] = doors[i];
   if (doc.containsKey("simulation_mode")) config.simulationMode = doc["simulation_mode"];
-  
-  Serial.printf("[CONFIG] Guardado: tempCrit=%.1f, supabase=%d\n", config.tempCritical, config.supabaseEnabled);
-  
+  if (doc.containsKey("transport")) {
+    const char* transport = doc["transport"] | "http";
+    config.transport = strcmp(transport, "mqtt") == 0 ? TRANSPORT_MQTT : TRANSPORT_HTTP;
+  }
+
+  Serial.printf("[CONFIG] Guardado: tempCrit=%.1f, supabase=%d, transporte=%s\n",
+                config.tempCritical, config.supabaseEnabled,
+                config.transport == TRANSPORT_MQTT ? "mqtt" : "http");
+
   saveConfig();
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true}");
+}
+
+void applyDefrost(bool on) {
+  if (on) {
+    enterDefrostMode("Web");
+  } else if (state.currentState == STATE_DEFROST) {
+    exitDefrostMode();
+  }
+}
+
+void webApplyCommand(WebCommand& cmd) {
+  switch (cmd.type) {
+    case WEB_CMD_CONFIG:
+      applyConfigJSON(cmd.body);
+      break;
+    case WEB_CMD_ACK_ALERT:
+      acknowledgeAlert();
+      break;
+    case WEB_CMD_TEST_ALERT:
+      triggerAlert("🧪 Alerta de prueba", true);
+      break;
+    case WEB_CMD_RELAY:
+      setRelay(cmd.value);
+      break;
+    case WEB_CMD_TELEGRAM_TEST:
+      webStats.lastTelegramTest = testTelegram() ? 1 : -1;
+      break;
+    case WEB_CMD_DEFROST:
+      applyDefrost(cmd.value);
+      break;
+    case WEB_CMD_WIFI_RESET:
+      webWifiResetAt = millis() + 500;   // Que salga la respuesta antes
+      break;
+    case WEB_CMD_TEXT:
+      Serial.println("[WEB] " + processCommand(String(cmd.body)));
+      break;
+    case WEB_CMD_RESTART:
+      webRestartAt = millis() + 2000;
+      break;
+  }
+  free(cmd.body);
+  webSnapshotDirty = true;
+  statusNotify();
+}
+
+// Llamar en cada vuelta del loop: único lugar donde la API toca el estado
+void webApiLoop() {
+  WebCommand cmd;
+  while (xQueueReceive(webCmdQueue, &cmd, 0) == pdTRUE) {
+    webApplyCommand(cmd);
+  }
+
+  static unsigned long lastSnapshot = 0;
+  if (webSnapshotDirty || statusDirty || millis() - lastSnapshot >= WEB_SNAPSHOT_INTERVAL_MS) {
+    lastSnapshot = millis();
+    webRefreshSnapshots();
+  }
+
+  if (webWifiResetAt && (long)(millis() - webWifiResetAt) >= 0) {
+    webWifiResetAt = 0;
+    resetWiFi();
+  }
+  if (webRestartAt && (long)(millis() - webRestartAt) >= 0) {
+    ESP.restart();
+  }
+}
+
+// ============================================
+// HELPERS (tarea AsyncTCP)
+// ============================================
+void webSendJSON(AsyncWebServerRequest* request, int code, const String& json) {
+  AsyncWebServerResponse* response = request->beginResponse(code, "application/json", json);
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
+
+// Respuesta que se escribe directo en su buffer de envío (JsonWriter o
+// copia de un snapshot): sin String ni documento intermedio
+AsyncResponseStream* webBeginJSON(AsyncWebServerRequest* request) {
+  AsyncResponseStream* response = request->beginResponseStream("application/json", WEB_STREAM_CHUNK);
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  return response;
+}
+
+// JSON o MessagePack según Accept; Vary para que ningún caché los mezcle
+AsyncResponseStream* webBeginFormat(AsyncWebServerRequest* request, const ApiFormat& fmt) {
+  AsyncResponseStream* response =
+      request->beginResponseStream(fmt.msgpack ? API_MSGPACK_MIME : "application/json", WEB_STREAM_CHUNK);
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  response->addHeader("Vary", "Accept");
+  return response;
+}
+
+// Tiempo del handler hasta entregar la respuesta a AsyncTCP (≈ primer byte)
+void webSendTimed(AsyncWebServerRequest* request, AsyncWebServerResponse* response, unsigned long startUs) {
+  request->send(response);
+  uint32_t us = micros() - startUs;
+  if (us > webStats.handlerUsMax) webStats.handlerUsMax = us;
+  metricObserve(metrics.webHandler, us);
+}
+
+// Admisión: tope de conexiones en curso y de heap libre
+bool webAdmit(AsyncWebServerRequest* request) {
+  webStats.requests++;
+  if (webStats.active >= WEB_MAX_CONNECTIONS || ESP.getFreeHeap() < WEB_MIN_FREE_HEAP) {
+    webStats.rejected++;
+    webSendJSON(request, 503, "{\"error\":\"Ocupado, reintentar\"}");
+    return false;
+  }
+  webStats.active++;
+  if (webStats.active > webStats.peakActive) webStats.peakActive = webStats.active;
+  request->onDisconnect([]() { webStats.active--; });
+  return true;
+}
+
+// Lee ?fields= / Accept; responde 400 y devuelve false si no sirven
+bool webTakeFormat(AsyncWebServerRequest* request, ApiFormat& fmt) {
+  if (apiParseFormat(request, fmt)) return true;
+  webSendJSON(request, 400, "{\"error\":\"fields too long\"}");
+  return false;
+}
+
+// Proyecta / pasa a MessagePack un JSON ya armado (copia propia, se
+// modifica) directo en la respuesta; 500 si no entra en el documento
+void webSendRendered(AsyncWebServerRequest* request, const ApiFormat& fmt, char* json, size_t len,
+                     JsonDocument* filter, size_t docBytes, unsigned long startUs) {
+  AsyncResponseStream* response = webBeginFormat(request, fmt);
+  if (!apiRender(json, len, filter, fmt, docBytes, *response)) {
+    delete response;
+    webSendJSON(request, 500, "{\"error\":\"Response too large\"}");
+    return;
+  }
+  webSendTimed(request, response, startUs);
+}
+
+// Cuerpo del POST en _tempObject (lo libera el request, o el loop si se encola)
+void webCollectBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+  if (total > WEB_MAX_BODY_BYTES) return;   // El handler responde 413
+  if (index == 0) request->_tempObject = malloc(total + 1);
+  char* buf = (char*)request->_tempObject;
+  if (!buf) return;
+  memcpy(buf + index, data, len);
+  if (index + len == total) buf[total] = '\0';
+}
+
+// Toma el cuerpo completo; responde el error y devuelve nullptr si no sirve
+char* webTakeBody(AsyncWebServerRequest* request) {
+  if (request->contentLength() > WEB_MAX_BODY_BYTES) {
+    webStats.tooLarge++;
+    webSendJSON(request, 413, "{\"error\":\"Body too large\"}");
+    return nullptr;
+  }
+  char* body = (char*)request->_tempObject;
+  if (!body) {
+    webSendJSON(request, 400, "{\"error\":\"No body\"}");
+    return nullptr;
+  }
+  request->_tempObject = nullptr;
+  return body;
+}
+
+bool webQueue(AsyncWebServerRequest* request, WebCommandType type, bool value = false, char* body = nullptr) {
+  WebCommand cmd = {type, value, body};
+  if (xQueueSend(webCmdQueue, &cmd, 0) != pdTRUE) {
+    free(body);
+    webStats.queueFull++;
+    webSendJSON(request, 503, "{\"error\":\"Ocupado, reintentar\"}");
+    return false;
+  }
+  webStats.queued++;
+  return true;
+}
+
+// ============================================
+// HANDLER: Página principal
+// ============================================
+// html_ui.h va comprimido en web_assets.h (tools/gen_web_assets.py): se
+// manda directo desde flash, sin copia en heap. Con el ETag el navegador
+// revalida y recibe 304 sin cuerpo.
+void handleRoot(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (request->hasHeader("If-None-Match") &&
+      request->header("If-None-Match") == WEB_INDEX_ETAG) {
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", WEB_INDEX_ETAG);
+    response->addHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
+    request->send(response);
+    return;
+  }
+  AsyncWebServerResponse* response =
+      request->beginResponse(200, WEB_INDEX_MIME, WEB_INDEX_GZ, WEB_INDEX_GZ_LEN);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", WEB_INDEX_ETAG);
+  response->addHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
+  request->send(response);
+}
+
+// ============================================
+// HANDLER: API Status
+// ============================================
+// Estado compartido de un long-poll; al destruirse la respuesta (entregada
+// o con el cliente desconectado) libera su lugar
+struct StatusLongPoll {
+  uint32_t since;
+  unsigned long startedAt;
+  bool ready = false;
+  ApiFormat fmt;
+  char body[STATUS_CACHE_BYTES];      // Proyectado o MessagePack nunca es más largo (heap, make_shared)
+  size_t len = 0;
+  ~StatusLongPoll() { statusStats.longPollActive--; }
+};
+
+// Copia el snapshot publicado a out: tal cual o con solo los campos
+// pedidos / en MessagePack (siempre con "version"). false si no entra.
+// La copia va en heap: STATUS_CACHE_BYTES es mucho para el stack de AsyncTCP.
+bool webWriteStatus(Print& out, const ApiFormat& fmt, uint32_t& version) {
+  if (apiIsPlain(fmt)) {
+    version = statusCacheWrite(out);
+    return true;
+  }
+  char* json = (char*)malloc(STATUS_CACHE_BYTES);
+  if (!json) {
+    version = statusCacheVersion();
+    return false;
+  }
+  JsonBufferPrint copy(json, STATUS_CACHE_BYTES);
+  version = statusCacheWrite(copy);
+
+  StaticJsonDocument<API_FILTER_BYTES> filter;
+  if (fmt.projected) {
+    filter["version"] = true;
+    apiAddFields(filter.as<JsonObject>(), fmt.fields);
+  }
+  bool ok = apiRender(json, copy.length(), fmt.projected ? &filter : nullptr, fmt, API_DOC_BYTES, out) > 0;
+  free(json);
+  return ok;
+}
+
+void webSendStatus(AsyncWebServerRequest* request, const ApiFormat& fmt, unsigned long startUs) {
+  AsyncResponseStream* response = webBeginFormat(request, fmt);
+  uint32_t version;
+  if (!webWriteStatus(*response, fmt, version)) {
+    delete response;
+    webSendJSON(request, 500, "{\"error\":\"Response too large\"}");
+    return;
+  }
+  char etag[16];
+  statusCacheETag(version, etag, sizeof(etag), fmt.msgpack);
+  statusStats.served++;
+
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("Access-Control-Expose-Headers", "ETag");
+  webSendTimed(request, response, startUs);
+}
+
+void webSendNotModified(AsyncWebServerRequest* request, const ApiFormat& fmt, uint32_t version) {
+  char etag[16];
+  statusCacheETag(version, etag, sizeof(etag), fmt.msgpack);
+  statusStats.notModified++;
+
+  AsyncWebServerResponse* response = request->beginResponse(304);
+  response->addHeader("ETag", etag);
+  response->addHeader("Vary", "Accept");
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
+
+// Respuesta chunked que no manda cuerpo hasta que haya versión nueva o se
+// venza STATUS_LONGPOLL_MS. AsyncTCP vuelve a llamar al filler en cada
+// poll de la conexión (~500 ms) mientras devuelva RESPONSE_TRY_AGAIN.
+void webLongPollStatus(AsyncWebServerRequest* request, const ApiFormat& fmt, uint32_t since) {
+  statusStats.longPolls++;
+  statusStats.longPollActive++;
+  std::shared_ptr<StatusLongPoll> lp = std::make_shared<StatusLongPoll>();
+  lp->since = since;
+  lp->startedAt = millis();
+  lp->fmt = fmt;
+
+  AsyncWebServerResponse* response = request->beginChunkedResponse(
+      fmt.msgpack ? API_MSGPACK_MIME : "application/json",
+      [lp](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        if (!lp->ready) {
+          if (statusCacheVersion() == lp->since) {
+            if (millis() - lp->startedAt < STATUS_LONGPOLL_MS) return RESPONSE_TRY_AGAIN;
+            statusStats.longPollTimeouts++;
+          }
+          JsonBufferPrint out(lp->body, sizeof(lp->body));
+          uint32_t version;
+          webWriteStatus(out, lp->fmt, version);
+          lp->len = out.length();
+          statusStats.served++;
+          lp->ready = true;
+        }
+        if (index >= lp->len) return 0;
+        size_t n = min(maxLen, lp->len - index);
+        memcpy(buffer, lp->body + index, n);
+        return n;
+      });
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("Vary", "Accept");
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
+
+// GET /api/status
+//   If-None-Match: "s<v>"  → 304 si no hubo cambios
+//   ?since=<v>             → si v es la versión actual, espera la próxima
+//                            (el JSON trae "version" para el siguiente pedido)
+//   ?fields= / Accept      → api_format.h (el ETag de MessagePack es "s<v>m")
+void handleApiStatus(AsyncWebServerRequest* request) {
+  unsigned long startUs = micros();
+  if (!webAdmit(request)) return;
+  ApiFormat fmt;
+  if (!webTakeFormat(request, fmt)) return;
+  uint32_t version = statusCacheVersion();
+
+  if (request->hasParam("since")) {
+    uint32_t since = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+    if (since == version) {
+      if (statusStats.longPollActive < STATUS_LONGPOLL_MAX) {
+        webLongPollStatus(request, fmt, since);
+      } else {
+        webSendNotModified(request, fmt, version);   // Sin lugar: que reintente
+      }
+      return;
+    }
+  } else if (request->hasHeader("If-None-Match")) {
+    char etag[16];
+    statusCacheETag(version, etag, sizeof(etag), fmt.msgpack);
+    if (request->header("If-None-Match") == etag) {
+      webSendNotModified(request, fmt, version);
+      return;
+    }
+  }
+  webSendStatus(request, fmt, startUs);
+}
+
+// ============================================
+// HANDLER: GET Config
+// ============================================
+void handleApiGetConfig(AsyncWebServerRequest* request) {
+  unsigned long startUs = micros();
+  if (!webAdmit(request)) return;
+  ApiFormat fmt;
+  if (!webTakeFormat(request, fmt)) return;
+
+  if (apiIsPlain(fmt)) {
+    AsyncResponseStream* response = webBeginFormat(request, fmt);
+    xSemaphoreTake(webSnapshotMutex, portMAX_DELAY);
+    response->write((const uint8_t*)webConfigJson, webConfigLen);
+    xSemaphoreGive(webSnapshotMutex);
+    webSendTimed(request, response, startUs);
+    return;
+  }
+
+  char json[WEB_CONFIG_BYTES];
+  xSemaphoreTake(webSnapshotMutex, portMAX_DELAY);
+  size_t len = webConfigLen;
+  memcpy(json, webConfigJson, len);
+  xSemaphoreGive(webSnapshotMutex);
+
+  StaticJsonDocument<API_FILTER_BYTES> filter;
+  if (fmt.projected) apiAddFields(filter.to<JsonObject>(), fmt.fields);
+  webSendRendered(request, fmt, json, len, fmt.projected ? &filter : nullptr, API_DOC_BYTES, startUs);
+}
+
+// ============================================
+// HANDLERS: Sensores e historial
+// ============================================
+// Se escriben directo desde los datos del loop, sin snapshot: son valores
+// de 4 bytes que el loop reemplaza enteros; en el peor caso un sensor
+// sale de la lectura anterior y otro de la nueva.
+void handleApiSensors(AsyncWebServerRequest* request) {
+  unsigned long startUs = micros();
+  if (!webAdmit(request)) return;
+  AsyncResponseStream* response = webBeginJSON(request);
+  JsonWriter w(*response);
+  writeSensorsJSON(w);
+  webSendTimed(request, response, startUs);
+}
+
+// ?fields= elige campos de cada punto: ?fields=temp,door_open. Proyectado
+// o en MessagePack se arma primero el JSON en heap (API_HISTORY_BYTES) y
+// después el documento (API_HISTORY_DOC_BYTES); WEB_MIN_FREE_HEAP cubre los dos.
+void handleApiHistory(AsyncWebServerRequest* request) {
+  unsigned long startUs = micros();
+  if (!webAdmit(request)) return;
+  ApiFormat fmt;
+  if (!webTakeFormat(request, fmt)) return;
+
+  if (apiIsPlain(fmt)) {
+    AsyncResponseStream* response = webBeginFormat(request, fmt);
+    JsonWriter w(*response);
+    writeHistoryJSON(w);
+    webSendTimed(request, response, startUs);
+    return;
+  }
+
+  char* json = (char*)malloc(API_HISTORY_BYTES);
+  if (!json) {
+    webSendJSON(request, 503, "{\"error\":\"Ocupado, reintentar\"}");
+    return;
+  }
+  JsonBufferPrint out(json, API_HISTORY_BYTES);
+  JsonWriter w(out);
+  writeHistoryJSON(w);
+
+  if (out.overflow()) {
+    apiFormatStats.errors++;
+    webSendJSON(request, 500, "{\"error\":\"Response too large\"}");
+  } else {
+    StaticJsonDocument<API_FILTER_BYTES> filter;
+    if (fmt.projected) {
+      filter["interval_sec"] = true;
+      apiAddFields(filter.createNestedArray("points").createNestedObject(), fmt.fields);
+    }
+    webSendRendered(request, fmt, json, out.length(), fmt.projected ? &filter : nullptr,
+                    API_HISTORY_DOC_BYTES, startUs);
+  }
+  free(json);
+}
+
+// ============================================
+// HANDLER: Métricas (Prometheus)
+// ============================================
+void handleMetrics(AsyncWebServerRequest* request) {
+  unsigned long startUs = micros();
+  if (!webAdmit(request)) return;
+  AsyncResponseStream* response =
+      request->beginResponseStream("text/plain; version=0.0.4; charset=utf-8", WEB_STREAM_CHUNK);
+  writeMetrics(*response);
+  webSendTimed(request, response, startUs);
+}
+
+// ============================================
+// HANDLER: Perfil del loop
+// ============================================
+// Para ponerlo en cero: comando serial PROFILE_RESET (serial_frame.h)
+void handleApiProfile(AsyncWebServerRequest* request) {
+  unsigned long startUs = micros();
+  if (!webAdmit(request)) return;
+  AsyncResponseStream* response = webBeginJSON(request);
+  JsonWriter w(*response);
+  writeProfileJSON(w);
+  webSendTimed(request, response, startUs);
+}
+
+// ============================================
+// HANDLER: POST Config
+// ============================================
+void handleApiSetConfig(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  char* body = webTakeBody(request);
+  if (!body) return;
+
+  // Validar acá para contestar 400; se aplica en el loop
+  StaticJsonDocument<512> doc;
+  if (deserializeJson(doc, body)) {
+    free(body);
+    webSendJSON(request, 400, "{\"error\":\"Invalid JSON\"}");
+    return;
+  }
+
+  if (webQueue(request, WEB_CMD_CONFIG, false, body)) {
+    webSendJSON(request, 200, "{\"success\":true}");
+  }
 }
 
 // ============================================
 // HANDLER: Acknowledge Alert
 // ============================================
-void handleApiAckAlert() {
-  acknowledgeAlert();
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true}");
+void handleApiAckAlert(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (webQueue(request, WEB_CMD_ACK_ALERT)) {
+    webSendJSON(request, 200, "{\"success\":true}");
+  }
 }
 
 // ============================================
 // HANDLER: Test Alert
 // ============================================
-void handleApiTestAlert() {
-  triggerAlert("🧪 Alerta de prueba", true);
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true}");
+void handleApiTestAlert(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (webQueue(request, WEB_CMD_TEST_ALERT)) {
+    webSendJSON(request, 200, "{\"success\":true}");
+  }
 }
 
 // ============================================
 // HANDLER: Relay Control
 // ============================================
-void handleApiRelay() {
-  if (server.hasArg("plain")) {
+void handleApiRelay(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  char* body = (char*)request->_tempObject;
+  if (body) {
     StaticJsonDocument<64> doc;
-    deserializeJson(doc, server.arg("plain"));
-    if (doc.containsKey("state")) {
-      setRelay(doc["state"]);
+    if (!deserializeJson(doc, body) && doc.containsKey("state")) {
+      if (!webQueue(request, WEB_CMD_RELAY, doc["state"].as<bool>())) return;
     }
   }
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true}");
+  webSendJSON(request, 200, "{\"success\":true}");
 }
 
 // ============================================
 // HANDLER: Test Telegram
 // ============================================
-void handleApiTelegramTest() {
-  bool success = testTelegram();
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(success ? 200 : 500, "application/json", 
-              success ? "{\"success\":true}" : "{\"error\":\"Failed\"}");
+// El envío (hasta segundos) corre en el loop: se contesta 202 y el
+// resultado queda en /api/status → web.last_telegram_test
+void handleApiTelegramTest(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (webQueue(request, WEB_CMD_TELEGRAM_TEST)) {
+    webSendJSON(request, 202, "{\"success\":true,\"queued\":true}");
+  }
 }
 
 // ============================================
 // HANDLER: Defrost Mode
 // ============================================
-void handleApiDefrost() {
-  state.defrostMode = !state.defrostMode;
-  
-  if (state.defrostMode) {
-    state.defrostStartTime = millis();
-    state.alertActive = false;
-    state.criticalAlert = false;
-    state.alertAcknowledged = false;
-    setRelay(false);
-    digitalWrite(PIN_BUZZER, LOW);
-    Serial.println("[DESCONGELAMIENTO] ACTIVADO");
-  } else {
-    unsigned long defrostMin = (millis() - state.defrostStartTime) / 60000;
-    state.defrostStartTime = 0;
-    Serial.printf("[DESCONGELAMIENTO] DESACTIVADO - Duró %lu min\n", defrostMin);
+void handleApiDefrost(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  // Estado pedido fijo (no un toggle): dos clicks encolados no se anulan
+  bool on = state.currentState != STATE_DEFROST;
+  if (webQueue(request, WEB_CMD_DEFROST, on)) {
+    webSendJSON(request, 200, "{\"success\":true,\"defrost_mode\":" + String(on ? "true" : "false") + "}");
   }
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true,\"defrost_mode\":" + String(state.defrostMode ? "true" : "false") + "}");
 }
 
 // ============================================
 // HANDLER: WiFi Reset
 // ============================================
-void handleApiWifiReset() {
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", "{\"success\":true}");
-  delay(500);
-  resetWiFi();
+void handleApiWifiReset(AsyncWebServerRequest* request) {
+  if (!webAdmit(request)) return;
+  if (webQueue(request, WEB_CMD_WIFI_RESET)) {
+    webSendJSON(request, 200, "{\"success\":true}");
+  }
 }
 
 // ============================================
 // HANDLER: CORS Preflight
 // ============================================
-void handleCORS() {
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.sendHeader("Access-Control-Allow-Methods", "GET, POST, OPTIONS");
-  server.sendHeader("Access-Control-Allow-Headers", "Content-Type");
-  server.send(204);
+void handleCORS(AsyncWebServerRequest* request) {
+  AsyncWebServerResponse* response = request->beginResponse(204);
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  response->addHeader("Access-Control-Allow-Methods", "GET, POST, OPTIONS");
+  response->addHeader("Access-Control-Allow-Headers", "Content-Type");
+  request->send(response);
 }
 
 // ============================================
 // HANDLER: Not Found
 // ============================================
-void handleNotFound() {
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(404, "application/json", "{\"error\":\"Not found\"}");
+void handleNotFound(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_OPTIONS) {
+    handleCORS(request);
+    return;
+  }
+  webSendJSON(request, 404, "{\"error\":\"Not found\"}");
 }
 
 // ============================================
 // CONFIGURAR RUTAS
 // ============================================
 void setupWebServer() {
+  webCmdQueue = xQueueCreate(WEB_CMD_QUEUE_LEN, sizeof(WebCommand));
+  webSnapshotMutex = xSemaphoreCreateMutex();
+  statusCacheInit();
+  webRefreshSnapshots();
+
   server.on("/", HTTP_GET, handleRoot);
   server.on("/api/status", HTTP_GET, handleApiStatus);
   server.on("/api/config", HTTP_GET, handleApiGetConfig);
-  server.on("/api/config", HTTP_POST, handleApiSetConfig);
+  server.on("/api/sensors", HTTP_GET, handleApiSensors);
+  server.on("/api/history", HTTP_GET, handleApiHistory);
+  server.on("/metrics", HTTP_GET, handleMetrics);
+  server.on("/api/profile", HTTP_GET, handleApiProfile);
+  server.on("/api/config", HTTP_POST, handleApiSetConfig, nullptr, webCollectBody);
   server.on("/api/config", HTTP_OPTIONS, handleCORS);
   server.on("/api/alert/ack", HTTP_POST, handleApiAckAlert);
   server.on("/api/alert/test", HTTP_POST, handleApiTestAlert);
-  server.on("/api/relay", HTTP_POST, handleApiRelay);
+  server.on("/api/relay", HTTP_POST, handleApiRelay, nullptr, webCollectBody);
   server.on("/api/telegram/test", HTTP_POST, handleApiTelegramTest);
   server.on("/api/defrost", HTTP_POST, handleApiDefrost);
   server.on("/api/wifi/reset", HTTP_POST, handleApiWifiReset);
+  setupSerialApiRoutes();
   server.onNotFound(handleNotFound);
-  
+  streamInit(server);
+
   server.begin();
-  Serial.println("[OK] Web server iniciado");
+  Serial.printf("[OK] Web server asíncrono iniciado (máx %d conexiones)\n", WEB_MAX_CONNECTIONS);
 }
 
 #endif
@@ -0,0 +1,246 @@
+/*
+ * WEB_ASSETS.H - Páginas web comprimidas (GENERADO, no editar)
+ *
+ * Regenerar con: python3 tools/gen_web_assets.py
+ *
+ *   WEB_INDEX  firmware_v2/html_ui.h         12033 →  3601 bytes gzip
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+#define WEB_INDEX_MIME "text/html"
+#define WEB_INDEX_ETAG "\"7406b955fca017de\""
+#define WEB_INDEX_GZ_LEN 3601
+const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x1a, 0x4b, 0x6f, 0x1b, 0xc7,
+  0xf9, 0x9e, 0x5f, 0x31, 0x66, 0x10, 0x2f, 0x19, 0xf3, 0xad, 0x87, 0x65, 0x52, 0xa4, 0x43, 0x4b,
+  0x74, 0xaa, 0xc2, 0x7a, 0x80, 0x92, 0x13, 0x14, 0x4d, 0x61, 0x0c, 0x77, 0x87, 0xe4, 0x58, 0xcb,
+  0x9d, 0xc5, 0xee, 0x50, 0x32, 0x43, 0xe9, 0xd6, 0x5e, 0xd2, 0x00, 0x41, 0xeb, 0x02, 0x41, 0xd3,
+  0x04, 0x41, 0x4e, 0x6d, 0x0e, 0x05, 0x9a, 0xf6, 0x52, 0xf4, 0xd0, 0x00, 0xd6, 0x3f, 0xf1, 0x1f,
+  0x68, 0x7e, 0x42, 0xbf, 0x79, 0xec, 0x72, 0x76, 0xb9, 0x94, 0x29, 0x47, 0xba, 0x88, 0x9c, 0xf9,
+  0xf6, 0x7b, 0xbf, 0x97, 0xef, 0x6c, 0xdf, 0xd9, 0x3d, 0xdc, 0x39, 0xf9, 0xd5, 0x51, 0x17, 0x8d,
+  0xf8, 0xd8, 0x6d, 0xbf, 0xb3, 0x2d, 0xfe, 0x21, 0x17, 0x7b, 0xc3, 0x56, 0x8e, 0x84, 0x39, 0x71,
+  0x40, 0xb0, 0xd3, 0x7e, 0x07, 0xa1, 0xed, 0x31, 0xe1, 0x18, 0xd9, 0x23, 0x1c, 0x84, 0x84, 0xb7,
+  0x72, 0x4f, 0x4f, 0x1e, 0x97, 0xb6, 0x72, 0xf3, 0x0b, 0x0f, 0x8f, 0x49, 0x2b, 0x77, 0x46, 0xc9,
+  0xb9, 0xcf, 0x02, 0x9e, 0x43, 0x36, 0xf3, 0x38, 0xf1, 0x00, 0xf0, 0x9c, 0x3a, 0x7c, 0xd4, 0x72,
+  0xc8, 0x19, 0xb5, 0x49, 0x49, 0x7e, 0x29, 0x22, 0xea, 0x51, 0x4e, 0xb1, 0x5b, 0x0a, 0x6d, 0xec,
+  0x92, 0x56, 0xad, 0x5c, 0x55, 0x88, 0x38, 0xe5, 0x2e, 0x69, 0x77, 0x5c, 0x12, 0x00, 0xc2, 0x5e,
+  0xb7, 0xfb, 0xb8, 0xdb, 0xdb, 0xae, 0xa8, 0x43, 0x71, 0x1d, 0xf2, 0xa9, 0xfa, 0x84, 0xd0, 0xfb,
+  0xb3, 0x3e, 0x7b, 0x51, 0x0a, 0xe9, 0xa7, 0xd4, 0x1b, 0x36, 0xfa, 0x2c, 0x70, 0x48, 0x50, 0x82,
+  0x93, 0xe6, 0x18, 0x07, 0x43, 0xea, 0x35, 0xaa, 0x4d, 0x1f, 0x3b, 0x8e, 0xb8, 0xab, 0x5e, 0x4a,
+  0xf8, 0x3e, 0x73, 0xa6, 0xb3, 0x01, 0xb0, 0x54, 0x1a, 0xe0, 0x31, 0x75, 0xa7, 0x8d, 0x12, 0xf6,
+  0x7d, 0x97, 0x94, 0xc2, 0x69, 0xc8, 0xc9, 0xb8, 0xf8, 0xc8, 0xa5, 0xde, 0xe9, 0x3e, 0xb6, 0x8f,
+  0xe5, 0xd7, 0xc7, 0x00, 0x57, 0xb4, 0x8e, 0xc9, 0x90, 0x11, 0xf4, 0x74, 0xcf, 0x2a, 0xf6, 0x58,
+  0x9f, 0x71, 0x56, 0x0c, 0xb1, 0x17, 0x96, 0x42, 0x12, 0xd0, 0x41, 0xb3, 0x8f, 0xed, 0xd3, 0x61,
+  0xc0, 0x26, 0x9e, 0xd3, 0x78, 0xb7, 0x3a, 0xa8, 0xdd, 0xaf, 0xe3, 0xe6, 0x98, 0x7a, 0xa5, 0x11,
+  0xa1, 0xc3, 0x11, 0x6f, 0xd4, 0xaa, 0xd5, 0xb3, 0x51, 0xd3, 0x66, 0x2e, 0x0b, 0x1a, 0xef, 0x0e,
+  0x06, 0x83, 0x98, 0x99, 0xda, 0xa6, 0xff, 0x42, 0xf1, 0x53, 0x16, 0xea, 0xc1, 0xd4, 0x23, 0xc1,
+  0x6c, 0x8c, 0x5f, 0x28, 0xb5, 0x34, 0x36, 0xaa, 0x55, 0x7f, 0x2e, 0x02, 0xc2, 0x13, 0xce, 0x14,
+  0xf4, 0xa8, 0x36, 0xe3, 0xe4, 0x05, 0x2f, 0x61, 0x97, 0x0e, 0xbd, 0x86, 0x0d, 0x6a, 0x25, 0x81,
+  0x86, 0x03, 0xa9, 0x39, 0x67, 0xe3, 0xc6, 0x3a, 0x3c, 0x29, 0xe5, 0x03, 0x9d, 0x90, 0x46, 0xad,
+  0xbc, 0x45, 0xc6, 0x11, 0x07, 0x9b, 0x55, 0xbc, 0x31, 0xc0, 0x9a, 0x6e, 0x38, 0xe9, 0x4b, 0x85,
+  0x66, 0x20, 0x8c, 0xc0, 0xd7, 0xef, 0xaf, 0x6f, 0xf5, 0x53, 0xe8, 0xeb, 0xd5, 0x04, 0xfe, 0xf2,
+  0x03, 0x32, 0x8e, 0x04, 0xc1, 0x81, 0x33, 0x33, 0xf5, 0x51, 0x23, 0xf5, 0x07, 0x6b, 0xfd, 0xa6,
+  0x36, 0x4a, 0x80, 0x1d, 0x3a, 0x09, 0x1b, 0xb5, 0x3a, 0x3c, 0x6f, 0xaa, 0x21, 0x85, 0x5f, 0xdc,
+  0x1b, 0x08, 0xd1, 0xa8, 0x3e, 0x5b, 0x04, 0x30, 0x55, 0x6a, 0xc8, 0x1a, 0xb3, 0x02, 0xa6, 0xf3,
+  0x4b, 0x7d, 0x3a, 0xcc, 0x90, 0x6d, 0x0e, 0xbe, 0x0e, 0x8a, 0x91, 0xdf, 0xce, 0x95, 0xb1, 0xfa,
+  0xcc, 0x75, 0x22, 0x9d, 0x0b, 0xc6, 0x50, 0xd5, 0xc4, 0xc6, 0x4e, 0x67, 0x9a, 0x68, 0xbd, 0xee,
+  0xac, 0x11, 0x62, 0xde, 0x9d, 0xe3, 0xc0, 0x8b, 0x6e, 0x07, 0xfd, 0xfe, 0xa0, 0xbe, 0x6e, 0xde,
+  0xda, 0x01, 0xe5, 0xd1, 0x2d, 0x19, 0xac, 0xc3, 0x5f, 0x13, 0x7b, 0x74, 0x8c, 0x39, 0x65, 0x5e,
+  0xc3, 0x9f, 0xb8, 0x21, 0x41, 0xe5, 0x8d, 0x10, 0x22, 0x61, 0x20, 0x82, 0x41, 0x23, 0xfe, 0xe0,
+  0x94, 0x4c, 0x07, 0x01, 0x44, 0x52, 0x88, 0x24, 0xc8, 0xac, 0xfa, 0x5e, 0x11, 0xbc, 0xe9, 0xbd,
+  0x19, 0xf3, 0xb1, 0x4d, 0xf9, 0xb4, 0x51, 0xbb, 0xdc, 0x30, 0xbe, 0x95, 0xef, 0x5f, 0x46, 0x66,
+  0xe5, 0x98, 0x4f, 0xc2, 0x52, 0xc0, 0xce, 0x67, 0x0e, 0x0d, 0x7d, 0x17, 0x4f, 0x1b, 0x03, 0x97,
+  0xbc, 0x68, 0x3e, 0x9f, 0x84, 0x9c, 0x0e, 0xa6, 0x25, 0x1d, 0x8d, 0x8d, 0x10, 0x9e, 0x24, 0xa5,
+  0x3e, 0xe1, 0xe7, 0x84, 0x78, 0x73, 0x83, 0x54, 0x85, 0xdc, 0xcd, 0x38, 0x8e, 0x94, 0xc6, 0xe1,
+  0x2c, 0x64, 0x2e, 0x75, 0xd0, 0xbb, 0x6b, 0x6b, 0xeb, 0xb5, 0x8d, 0x8d, 0x05, 0x52, 0x0d, 0x17,
+  0x87, 0xbc, 0x64, 0x8f, 0xa8, 0x0b, 0x1e, 0x90, 0x78, 0xd6, 0x63, 0x1e, 0x49, 0x82, 0xbb, 0xb8,
+  0x4f, 0xdc, 0x48, 0x1f, 0x0f, 0xd6, 0xf1, 0x5a, 0x7f, 0x2b, 0x09, 0x70, 0x86, 0xdd, 0x09, 0x99,
+  0xa5, 0x2d, 0xa3, 0x61, 0xb0, 0x48, 0x09, 0xa5, 0x3e, 0xf6, 0x44, 0xc0, 0x98, 0xce, 0xa6, 0x35,
+  0x9b, 0xf0, 0xac, 0x0c, 0xcf, 0x7b, 0x53, 0xf4, 0x48, 0xa0, 0x48, 0x71, 0x06, 0xf3, 0x26, 0xdd,
+  0x32, 0xb6, 0x39, 0x3d, 0x23, 0xb1, 0x7e, 0xfb, 0x2e, 0xb3, 0x4f, 0x75, 0x76, 0x99, 0x00, 0x16,
+  0x6f, 0xa6, 0xa2, 0x58, 0xd8, 0x6b, 0xce, 0xd0, 0x7a, 0xcc, 0x90, 0xc4, 0x9b, 0x66, 0x2e, 0x19,
+  0x56, 0xb5, 0x94, 0x6f, 0x6e, 0x56, 0xab, 0x4d, 0x7b, 0x12, 0x84, 0xa0, 0x33, 0x9f, 0x51, 0x93,
+  0x6f, 0xce, 0xfc, 0xc6, 0x56, 0x1c, 0x32, 0x7d, 0xee, 0x95, 0x86, 0x01, 0x58, 0x34, 0xa1, 0x9b,
+  0x7a, 0xdd, 0xde, 0xd8, 0x20, 0x46, 0xd0, 0x18, 0xd0, 0x7d, 0xa1, 0x6c, 0x13, 0x18, 0xec, 0x51,
+  0x1f, 0x6c, 0x66, 0x03, 0xb3, 0x00, 0xca, 0x41, 0x12, 0x7c, 0xf0, 0xe0, 0xfe, 0x5a, 0x6d, 0x09,
+  0x78, 0x40, 0x9c, 0x2c, 0x1b, 0x2d, 0xc0, 0x52, 0xcf, 0x9f, 0x70, 0xe9, 0xb2, 0x4b, 0x73, 0x41,
+  0x0c, 0x82, 0x94, 0xff, 0x24, 0x74, 0x9f, 0xb2, 0xe1, 0xe6, 0x3c, 0x41, 0x28, 0xff, 0x32, 0xf3,
+  0xd5, 0xd6, 0x46, 0x9c, 0x25, 0x14, 0x4e, 0xc1, 0x9c, 0x9f, 0x8c, 0x95, 0x21, 0x36, 0x75, 0x6a,
+  0x80, 0x21, 0xf9, 0x79, 0x26, 0x80, 0x1a, 0xb5, 0xb9, 0x69, 0xeb, 0x0b, 0xbe, 0xb6, 0x35, 0x37,
+  0xf6, 0x42, 0xf4, 0x64, 0xd5, 0x8c, 0x37, 0xe4, 0x33, 0x93, 0x05, 0x08, 0xdc, 0x38, 0xd9, 0xe8,
+  0x0c, 0x6d, 0x32, 0x02, 0xd1, 0x2b, 0x0a, 0x90, 0xf2, 0xc0, 0xf5, 0x6a, 0x2c, 0xc5, 0x80, 0x31,
+  0xf0, 0x9a, 0x8c, 0x84, 0x18, 0x3d, 0x2c, 0x13, 0x7b, 0x12, 0xaf, 0xa1, 0xb6, 0xfb, 0x5a, 0x6d,
+  0xdb, 0x15, 0x5d, 0x7b, 0xb7, 0x2b, 0xaa, 0x1d, 0xd8, 0x16, 0x05, 0x55, 0x16, 0x65, 0x87, 0x9e,
+  0x21, 0x1b, 0x12, 0x41, 0xd8, 0xca, 0xc5, 0x35, 0x2d, 0xa7, 0x8a, 0xf4, 0xf6, 0xa8, 0xd6, 0x7e,
+  0xfd, 0xcd, 0x6f, 0xff, 0xf7, 0xef, 0x2f, 0x50, 0xaa, 0xa6, 0xc3, 0x85, 0x82, 0xf0, 0xa3, 0x67,
+  0xa3, 0xba, 0x94, 0x6b, 0x1f, 0x75, 0x0e, 0x76, 0xbb, 0xfb, 0x87, 0x07, 0x7b, 0x4f, 0xf7, 0xd1,
+  0x49, 0x77, 0xe7, 0x17, 0xe8, 0xea, 0x4b, 0x04, 0x67, 0xa8, 0xb3, 0xdf, 0xed, 0xed, 0xed, 0xc0,
+  0x87, 0xe3, 0xbd, 0x27, 0x1f, 0x09, 0x24, 0xbe, 0xc2, 0xa1, 0x10, 0x19, 0x6c, 0x98, 0x41, 0x9b,
+  0x43, 0xd4, 0xd1, 0x27, 0x8f, 0xd4, 0x81, 0x7a, 0x48, 0x3f, 0x21, 0xa5, 0x6a, 0xe5, 0xcc, 0xc2,
+  0x59, 0xcf, 0xa8, 0x0f, 0xb9, 0xf6, 0x4f, 0xdf, 0x7e, 0xf5, 0x37, 0xd4, 0x79, 0xd2, 0xed, 0x9d,
+  0x74, 0x50, 0x67, 0xe7, 0x64, 0xef, 0xa3, 0xce, 0x76, 0x05, 0x10, 0x24, 0x90, 0xc5, 0x94, 0xf6,
+  0xc3, 0x61, 0x2e, 0x42, 0xad, 0x2b, 0xcb, 0x96, 0x30, 0x51, 0xae, 0x7d, 0x02, 0x95, 0x81, 0x04,
+  0x90, 0xef, 0x02, 0xe8, 0xa4, 0x82, 0xab, 0xbf, 0x73, 0x6a, 0xe3, 0x24, 0x22, 0x95, 0x4a, 0x22,
+  0x51, 0xe2, 0xc0, 0xce, 0x21, 0xe6, 0xd9, 0x2e, 0xb5, 0x4f, 0x41, 0x53, 0x10, 0xfb, 0x52, 0x9d,
+  0xf9, 0x82, 0xe0, 0xeb, 0x2f, 0x7f, 0x40, 0xbb, 0xdd, 0x93, 0xee, 0x41, 0xb7, 0xa7, 0xf9, 0xdb,
+  0xae, 0x28, 0x1c, 0x5a, 0xc3, 0x73, 0xec, 0x0b, 0x8a, 0x12, 0x95, 0x76, 0xae, 0x8f, 0x51, 0x1d,
+  0xb0, 0x7d, 0xfe, 0x9d, 0xb0, 0xd6, 0x49, 0x77, 0xff, 0xa8, 0xdb, 0xeb, 0x9c, 0x3c, 0xed, 0x01,
+  0x36, 0x38, 0x37, 0xa5, 0xd4, 0xcf, 0x46, 0xb5, 0x16, 0xe9, 0x32, 0xa9, 0x14, 0x2d, 0xbe, 0xe4,
+  0xda, 0xa5, 0x52, 0xb9, 0xf4, 0xea, 0x1f, 0x3b, 0x06, 0xe9, 0x1b, 0x72, 0xf1, 0xf2, 0x33, 0xd4,
+  0x85, 0xb2, 0xe0, 0x30, 0xe4, 0x10, 0x17, 0x1d, 0x53, 0xd1, 0x94, 0xe1, 0x65, 0x9c, 0xcc, 0xeb,
+  0x51, 0xae, 0xbd, 0x2d, 0xc2, 0x24, 0x75, 0x21, 0x33, 0x47, 0xae, 0x7d, 0x4c, 0x03, 0xe2, 0x01,
+  0x12, 0x01, 0x91, 0x09, 0x27, 0x0b, 0x90, 0x12, 0x23, 0x20, 0x90, 0x14, 0x8e, 0xe5, 0x71, 0xae,
+  0xdd, 0xf1, 0xf1, 0x10, 0x3b, 0xf1, 0x93, 0x0b, 0x66, 0xbf, 0x21, 0x1b, 0xe4, 0xea, 0x07, 0xec,
+  0xa2, 0x5d, 0x12, 0x42, 0xb4, 0x0c, 0x81, 0xce, 0x98, 0x42, 0x40, 0xb2, 0xd5, 0xf8, 0x72, 0xc8,
+  0x20, 0x60, 0x21, 0x3f, 0x86, 0x38, 0xc6, 0xae, 0xd0, 0xf3, 0x6d, 0x31, 0x35, 0xf1, 0x71, 0x1f,
+  0x87, 0x64, 0x35, 0x2e, 0x42, 0x0d, 0x1d, 0x29, 0xe8, 0xd6, 0xd8, 0x78, 0xea, 0x73, 0x3a, 0x5e,
+  0x91, 0x89, 0x89, 0x84, 0xbd, 0x45, 0xe2, 0x1f, 0xd3, 0xc7, 0x74, 0x35, 0xd2, 0xe7, 0x74, 0x40,
+  0x7b, 0x61, 0x48, 0x05, 0x71, 0xe4, 0x3c, 0x1a, 0xdf, 0x12, 0x03, 0x7b, 0x22, 0x2f, 0x7b, 0x84,
+  0xaf, 0xc6, 0x04, 0xd5, 0xd0, 0xb7, 0x6e, 0x84, 0xbd, 0xa3, 0x55, 0x7d, 0x51, 0x0c, 0x74, 0x7b,
+  0x7e, 0x36, 0xe9, 0x9b, 0x06, 0xfc, 0xef, 0xd1, 0x47, 0x18, 0x6a, 0x10, 0xf4, 0xbd, 0x3b, 0x0c,
+  0x3a, 0xe2, 0x21, 0x24, 0x48, 0x87, 0x85, 0x3f, 0x33, 0xe4, 0xe3, 0x74, 0x06, 0x59, 0xa9, 0x8c,
+  0x76, 0xe2, 0x7c, 0xbb, 0x8a, 0x78, 0xf6, 0x60, 0x28, 0x1e, 0xdb, 0x81, 0x2e, 0x5e, 0x48, 0x28,
+  0xd3, 0xd9, 0xad, 0xe8, 0xf7, 0xf5, 0x17, 0x3f, 0x48, 0x9e, 0x28, 0x60, 0x67, 0x88, 0x84, 0xa2,
+  0x1e, 0xac, 0xcc, 0x92, 0xcc, 0xfb, 0xbb, 0x22, 0x3b, 0x49, 0xe7, 0x83, 0x92, 0x7f, 0x4b, 0x5c,
+  0xfd, 0xf4, 0xed, 0x5f, 0x3f, 0x43, 0x47, 0x90, 0x5b, 0x4a, 0x4e, 0x9c, 0x99, 0x6c, 0x7a, 0xf5,
+  0x2f, 0x6f, 0x65, 0xd6, 0x76, 0x55, 0x6e, 0xda, 0x61, 0x50, 0x2f, 0xd9, 0xb9, 0x77, 0xeb, 0xfc,
+  0xfd, 0xe9, 0x73, 0xd4, 0x23, 0xee, 0xd5, 0xf7, 0x51, 0xea, 0x2c, 0xdf, 0x94, 0xb3, 0x5e, 0xa4,
+  0xb6, 0x9f, 0xe9, 0xad, 0xaf, 0xbf, 0xfa, 0xb3, 0x30, 0x60, 0xec, 0xa7, 0x5a, 0x4d, 0xd9, 0x9e,
+  0x1a, 0x37, 0xb0, 0x31, 0x0a, 0xb8, 0x97, 0x32, 0x25, 0xbc, 0x33, 0xea, 0x09, 0x22, 0x1f, 0x45,
+  0x79, 0x70, 0xb8, 0xc2, 0x76, 0x45, 0x41, 0xce, 0x9f, 0x5c, 0xc0, 0x2c, 0x9b, 0x43, 0xd0, 0x9c,
+  0xfc, 0x86, 0xf8, 0xd4, 0x87, 0x96, 0xc3, 0x9b, 0x8c, 0xfb, 0x51, 0xe7, 0x43, 0xbd, 0xd8, 0x8b,
+  0x91, 0xd4, 0x4a, 0x2b, 0x57, 0xaa, 0x55, 0x45, 0x77, 0x42, 0xfc, 0x56, 0xae, 0x5a, 0xde, 0xd0,
+  0x5a, 0x6f, 0x2f, 0x73, 0xf0, 0x65, 0x76, 0xbb, 0x46, 0xb0, 0xa4, 0x87, 0x3b, 0x44, 0x3b, 0x39,
+  0xca, 0x83, 0x3b, 0x4c, 0x38, 0x0b, 0x6f, 0x47, 0x2e, 0x23, 0x14, 0x22, 0xc9, 0x36, 0x22, 0xb9,
+  0x6a, 0x39, 0xe1, 0x7a, 0xe2, 0xbf, 0x96, 0x6e, 0x99, 0x23, 0xbe, 0x85, 0x74, 0x4b, 0x23, 0xe5,
+  0x96, 0xe5, 0x4b, 0xc7, 0x53, 0x24, 0xe4, 0x5a, 0x6c, 0xbd, 0x0d, 0x2d, 0xe5, 0xc6, 0x8d, 0xa4,
+  0x5c, 0x6c, 0x30, 0xfb, 0x32, 0x58, 0xe6, 0xfd, 0x25, 0x3e, 0x23, 0xca, 0xb9, 0x55, 0x83, 0xf9,
+  0xc7, 0xff, 0xa2, 0x0f, 0x9f, 0x76, 0x7a, 0xbb, 0x9d, 0xde, 0x0d, 0x3b, 0x4b, 0xb3, 0x65, 0xd9,
+  0x59, 0xcc, 0xf9, 0xa0, 0xc6, 0x7d, 0x06, 0x2d, 0xde, 0x62, 0x2b, 0x94, 0x0a, 0x25, 0xb3, 0xf3,
+  0x51, 0xd5, 0x2e, 0x6a, 0xae, 0xcd, 0x89, 0xbd, 0x99, 0x31, 0x9e, 0x9a, 0xfb, 0x8d, 0x8c, 0x51,
+  0x2d, 0x35, 0x76, 0x56, 0xb3, 0x16, 0x05, 0x86, 0x03, 0x68, 0xbf, 0xee, 0x88, 0x35, 0x00, 0x6b,
+  0x88, 0x75, 0x64, 0x00, 0x7c, 0x9b, 0xec, 0x9d, 0xc8, 0x96, 0xa4, 0x2a, 0xa6, 0x25, 0x71, 0xd5,
+  0x16, 0xf6, 0x59, 0xd1, 0x08, 0x6a, 0xc6, 0x56, 0x3a, 0x83, 0xef, 0xda, 0xfa, 0x86, 0x59, 0x38,
+  0x1b, 0x0e, 0x5d, 0xa2, 0xcf, 0x95, 0x65, 0x40, 0x83, 0x6a, 0x16, 0xe9, 0xc1, 0x08, 0x70, 0xbc,
+  0x73, 0x78, 0xf0, 0x61, 0xf7, 0x49, 0x67, 0x7f, 0xaf, 0x7b, 0x70, 0x72, 0xf8, 0xb3, 0x86, 0x80,
+  0x97, 0x3f, 0x80, 0x90, 0x36, 0x05, 0xa5, 0x26, 0x2b, 0xf0, 0x1b, 0x5d, 0x87, 0x13, 0xd0, 0x01,
+  0x71, 0xc9, 0x30, 0xc0, 0x63, 0xc5, 0xe2, 0xcb, 0x7f, 0xa2, 0xa3, 0x80, 0xf5, 0x71, 0x80, 0xa2,
+  0xf3, 0x24, 0x67, 0x99, 0x58, 0x03, 0xe2, 0x18, 0x48, 0xa1, 0x29, 0x20, 0xfc, 0x63, 0xe8, 0xb9,
+  0x00, 0x63, 0x72, 0xaa, 0x8a, 0xb6, 0x20, 0x92, 0xd0, 0x77, 0x50, 0x1e, 0x00, 0x10, 0xa9, 0x3e,
+  0x6e, 0x55, 0xe9, 0xd5, 0x7c, 0x9c, 0x18, 0x0a, 0xdb, 0x57, 0x5f, 0xb9, 0xd0, 0x5b, 0x62, 0x84,
+  0x6d, 0x3e, 0x01, 0x57, 0xf8, 0x54, 0x85, 0xb7, 0x30, 0xb8, 0xa8, 0x34, 0xc2, 0x40, 0x62, 0xef,
+  0xf5, 0xd4, 0x77, 0x30, 0xbf, 0xbe, 0x01, 0x5d, 0xc2, 0xac, 0x76, 0x9c, 0x85, 0x41, 0x77, 0xee,
+  0x36, 0x30, 0xf1, 0x1a, 0x40, 0x8b, 0x93, 0xaf, 0xbe, 0xcb, 0xaa, 0x60, 0xf1, 0x07, 0xb9, 0x30,
+  0xb7, 0x03, 0xea, 0x73, 0x05, 0xe1, 0x82, 0x6e, 0xe4, 0x74, 0x2a, 0xfd, 0x97, 0xb4, 0x06, 0xd8,
+  0x0d, 0x49, 0x51, 0x3b, 0x2e, 0x04, 0xa2, 0x3e, 0x69, 0xc6, 0xc0, 0x21, 0x6f, 0x79, 0x13, 0xd7,
+  0x2d, 0x92, 0x50, 0xfd, 0xf7, 0x99, 0xeb, 0x0a, 0x07, 0x0f, 0xe4, 0xd7, 0xe6, 0x5c, 0x9f, 0x38,
+  0x9c, 0x7a, 0x36, 0x1a, 0x4c, 0x3c, 0x5b, 0xec, 0x36, 0xd1, 0x80, 0x70, 0x7b, 0xa4, 0x02, 0x35,
+  0x5f, 0x98, 0x69, 0x7d, 0xf0, 0x60, 0x3a, 0x8b, 0x03, 0x09, 0xc2, 0x3d, 0xe4, 0x28, 0x68, 0xe1,
+  0x73, 0x4c, 0xb9, 0x82, 0xcf, 0x5b, 0x15, 0xec, 0xd3, 0x8a, 0xaa, 0xdf, 0x56, 0xa1, 0x19, 0xc3,
+  0x02, 0x17, 0x0a, 0x2c, 0x28, 0x3f, 0x0f, 0x99, 0x97, 0x37, 0xae, 0x60, 0x9e, 0x83, 0x80, 0xce,
+  0x87, 0x3c, 0x3e, 0xbb, 0xb4, 0xb1, 0xc0, 0x45, 0x0a, 0x33, 0x41, 0x82, 0xb9, 0xa4, 0x4c, 0x82,
+  0x80, 0x05, 0x70, 0xd0, 0x54, 0xfb, 0x90, 0xcb, 0x39, 0xd7, 0x31, 0xbf, 0x1a, 0x8d, 0x73, 0x1d,
+  0xaf, 0xbc, 0xe5, 0x94, 0x43, 0x02, 0x28, 0x03, 0xb9, 0xdc, 0x7d, 0x86, 0xcf, 0x86, 0x65, 0xce,
+  0x1e, 0xd3, 0x17, 0xc4, 0xc9, 0xd7, 0x0c, 0x96, 0x34, 0x34, 0x80, 0x74, 0xdd, 0x96, 0xc3, 0xec,
+  0xc9, 0x18, 0x92, 0x48, 0x79, 0x48, 0x78, 0xd7, 0x25, 0xe2, 0xe3, 0xa3, 0xe9, 0x9e, 0x93, 0xb7,
+  0xc4, 0xbd, 0x29, 0xa3, 0x82, 0x2f, 0x8b, 0xdc, 0xb3, 0xa3, 0xdf, 0x9a, 0xf0, 0x7b, 0x16, 0x54,
+  0x64, 0x6b, 0x01, 0x46, 0xba, 0xed, 0x81, 0x78, 0xd5, 0x62, 0x45, 0x13, 0xb8, 0x01, 0x44, 0x07,
+  0x79, 0x5f, 0xbc, 0x9e, 0x79, 0xec, 0x32, 0xcc, 0xf3, 0xbc, 0xd0, 0x86, 0x5a, 0x5f, 0x30, 0x9f,
+  0x7c, 0x02, 0xa3, 0x74, 0x19, 0x92, 0xa2, 0xe2, 0x41, 0xee, 0xa8, 0x4d, 0x46, 0x88, 0xd8, 0x4a,
+  0x67, 0x20, 0xd9, 0xba, 0x0e, 0x89, 0x58, 0x83, 0x2f, 0x20, 0xb9, 0x06, 0x9e, 0x9d, 0x9a, 0xd0,
+  0xf1, 0x07, 0xd3, 0x37, 0x41, 0xd9, 0xf2, 0x45, 0x8c, 0xda, 0xbf, 0x3e, 0x53, 0x8b, 0xd7, 0xb4,
+  0x96, 0xf5, 0x03, 0xa7, 0x8b, 0xd0, 0xa7, 0x1e, 0x3b, 0x77, 0x89, 0x33, 0x24, 0xce, 0xc5, 0x85,
+  0xe1, 0xd4, 0xe2, 0x6f, 0xa9, 0x4d, 0x8c, 0x91, 0xdf, 0x2a, 0x24, 0x4c, 0x91, 0x37, 0x38, 0xbb,
+  0x7b, 0xf7, 0x4e, 0x44, 0xb6, 0xf0, 0xd0, 0x3a, 0xea, 0x75, 0x0f, 0x76, 0xf7, 0x76, 0x3b, 0x56,
+  0xc3, 0xd2, 0x4b, 0x02, 0xeb, 0xc6, 0x94, 0x64, 0x8e, 0x28, 0xcb, 0x05, 0xdc, 0x35, 0x94, 0xf4,
+  0x0e, 0x15, 0x08, 0xe9, 0xdd, 0xa6, 0x95, 0xa1, 0x41, 0x33, 0x96, 0x63, 0x9d, 0xe8, 0xc3, 0x67,
+  0x63, 0x38, 0x5d, 0x5d, 0x1b, 0x89, 0x45, 0x43, 0x4a, 0x1f, 0x06, 0x99, 0x87, 0x96, 0xaa, 0x3f,
+  0xc0, 0xd7, 0x01, 0x0b, 0xc6, 0x00, 0xfa, 0x16, 0xb8, 0x4d, 0x0d, 0x24, 0x70, 0xeb, 0x2a, 0x2e,
+  0x84, 0x56, 0xab, 0xec, 0x4c, 0xa1, 0x97, 0x91, 0x49, 0x6e, 0x29, 0xd2, 0x32, 0x44, 0xea, 0x89,
+  0xa0, 0x9e, 0x11, 0x0f, 0xf7, 0xc1, 0x67, 0x1e, 0x5a, 0xaf, 0xbf, 0x7e, 0xa9, 0x4b, 0x3c, 0x10,
+  0x86, 0xde, 0x64, 0x84, 0xfb, 0xd4, 0xa5, 0x62, 0x19, 0xb5, 0x8a, 0x70, 0x0b, 0x54, 0x13, 0xd2,
+  0x2d, 0xa7, 0x1a, 0x49, 0x08, 0xb2, 0xaa, 0x2d, 0xec, 0x8d, 0x64, 0x55, 0xcb, 0x90, 0x94, 0x8c,
+  0x03, 0x61, 0x11, 0xae, 0x76, 0x2a, 0xf9, 0x98, 0xb4, 0x02, 0x7d, 0x16, 0x12, 0xbb, 0xb0, 0x82,
+  0x38, 0xd1, 0xaa, 0x63, 0x99, 0xfa, 0xc4, 0xfd, 0xb3, 0x00, 0x00, 0xee, 0x59, 0x62, 0x13, 0xb2,
+  0x8a, 0x86, 0x92, 0x8b, 0x8b, 0x65, 0x88, 0x23, 0x28, 0x65, 0x8f, 0x43, 0xcf, 0xa5, 0x9e, 0x50,
+  0xce, 0xeb, 0xaf, 0xbf, 0x44, 0x87, 0x83, 0x81, 0xfc, 0xf6, 0x36, 0xb4, 0x32, 0xad, 0x31, 0xa7,
+  0x65, 0x58, 0x41, 0x07, 0xdc, 0x4a, 0xfe, 0xac, 0x16, 0x21, 0x0b, 0xa2, 0xa8, 0x8b, 0x32, 0xf5,
+  0x57, 0x40, 0x32, 0xef, 0x28, 0x52, 0x68, 0x3c, 0x72, 0x8e, 0x76, 0xe1, 0x38, 0x0f, 0xc7, 0xec,
+  0x09, 0x13, 0xef, 0xcb, 0x45, 0x11, 0x3e, 0xe6, 0x01, 0x34, 0xb6, 0xf9, 0xac, 0x44, 0xaa, 0xb2,
+  0xa3, 0x5a, 0x7f, 0x2f, 0xaf, 0x41, 0xc6, 0x4a, 0xdc, 0x4c, 0xc7, 0x90, 0xfc, 0x8d, 0x24, 0x54,
+  0x98, 0xe9, 0x57, 0x5f, 0xa9, 0x3c, 0xae, 0x12, 0x32, 0x3c, 0x77, 0x3d, 0xfa, 0xfd, 0x70, 0xb8,
+  0xcc, 0xbe, 0x2a, 0x55, 0x8f, 0x49, 0x18, 0xe2, 0x21, 0xd1, 0xc5, 0x39, 0x2a, 0x1e, 0x8b, 0x44,
+  0x03, 0x32, 0x66, 0x67, 0xc4, 0xa0, 0x7b, 0x79, 0x83, 0xe0, 0x48, 0x8c, 0x0e, 0xb1, 0x0f, 0xe8,
+  0xd1, 0x21, 0x99, 0x71, 0xe4, 0x6b, 0x25, 0xb0, 0xbe, 0x98, 0x27, 0x6e, 0x90, 0xca, 0x4e, 0x16,
+  0x83, 0x6f, 0x31, 0xff, 0x8a, 0xd9, 0x90, 0x84, 0x17, 0x17, 0xd5, 0x15, 0xf0, 0xce, 0x07, 0x80,
+  0xeb, 0x72, 0xef, 0xeb, 0xaf, 0x7f, 0x27, 0xfa, 0x7e, 0x3d, 0x02, 0x00, 0xdb, 0xd7, 0x4e, 0x04,
+  0xd6, 0x4d, 0xe9, 0xce, 0x5b, 0x8d, 0xa4, 0x8e, 0xa2, 0x57, 0x12, 0x40, 0x70, 0x3e, 0xb8, 0x58,
+  0x6f, 0xd3, 0x82, 0xa5, 0x1a, 0x47, 0xe8, 0x37, 0x9c, 0x68, 0xf0, 0xbc, 0x61, 0xdf, 0x68, 0xcb,
+  0xc7, 0xac, 0x85, 0x4e, 0xcc, 0x5e, 0xda, 0x3c, 0x5e, 0x93, 0x33, 0xa2, 0x8d, 0x09, 0xe8, 0x40,
+  0xcd, 0xdc, 0xb6, 0x6a, 0xfa, 0x44, 0xb7, 0x44, 0x21, 0x00, 0x57, 0x42, 0x32, 0x5f, 0x4f, 0xc4,
+  0x68, 0xf6, 0x31, 0x1f, 0x95, 0xe5, 0x80, 0x9a, 0xb7, 0x75, 0x00, 0x38, 0x02, 0x40, 0x24, 0xe3,
+  0xca, 0x66, 0x75, 0x35, 0xe6, 0x52, 0x6b, 0x81, 0x2c, 0xe4, 0x80, 0x3d, 0xf2, 0x3a, 0x5b, 0x83,
+  0x09, 0x12, 0x17, 0x17, 0xb5, 0xad, 0x6a, 0xb5, 0xb0, 0x22, 0x25, 0x63, 0xff, 0x99, 0xf2, 0xc1,
+  0x94, 0x36, 0xd2, 0x8d, 0xea, 0x75, 0x18, 0x13, 0x4a, 0x31, 0x71, 0xbe, 0x49, 0x35, 0x50, 0x5e,
+  0x20, 0x80, 0x56, 0xa4, 0xb2, 0xa8, 0xa2, 0x25, 0xa4, 0xde, 0xac, 0xa8, 0xb7, 0xa1, 0xdb, 0xcb,
+  0x90, 0x6f, 0x4e, 0x48, 0x76, 0x7f, 0xcf, 0x3c, 0xfb, 0xa1, 0xee, 0x98, 0xd0, 0x0e, 0xc4, 0x87,
+  0x78, 0xd3, 0x95, 0x3f, 0xd8, 0x29, 0xc4, 0x7d, 0x14, 0xea, 0xf4, 0x29, 0x28, 0x41, 0x9c, 0x1e,
+  0x16, 0x32, 0x62, 0xeb, 0x4d, 0xa1, 0x64, 0xee, 0x70, 0xa2, 0xf8, 0xd1, 0xb3, 0x89, 0xdd, 0x32,
+  0xba, 0xfb, 0x1b, 0x44, 0x41, 0xec, 0x34, 0xba, 0xfb, 0x76, 0x14, 0x9e, 0x3d, 0xef, 0x5a, 0x2c,
+  0x8b, 0x61, 0x50, 0x78, 0x7f, 0xb3, 0x9a, 0x44, 0xe5, 0xd8, 0x2b, 0xa1, 0x5a, 0xe2, 0xf9, 0x26,
+  0xbe, 0xa5, 0x89, 0xa1, 0x38, 0x1b, 0x13, 0x3e, 0x62, 0x4e, 0xc3, 0x3a, 0x3a, 0x3c, 0x3e, 0xb1,
+  0x8a, 0xe2, 0x25, 0x36, 0x09, 0xc2, 0xc6, 0xcc, 0xd2, 0x16, 0x2a, 0x9d, 0x4c, 0x7d, 0x51, 0xf7,
+  0xc5, 0xaf, 0xc2, 0xc0, 0xab, 0x85, 0x12, 0x2b, 0x22, 0x65, 0x58, 0x97, 0x45, 0xf1, 0xa6, 0xbb,
+  0xf1, 0xcb, 0xe3, 0xc3, 0x03, 0xa8, 0x1c, 0xa2, 0xe8, 0xd2, 0xc1, 0x34, 0x3f, 0x4b, 0x84, 0x40,
+  0x83, 0xdb, 0xc5, 0x94, 0xd3, 0x36, 0xb0, 0x53, 0xcc, 0xf2, 0xad, 0x86, 0x63, 0x5f, 0x16, 0x2e,
+  0x63, 0x5d, 0xca, 0xa7, 0xf2, 0x32, 0x93, 0x27, 0xf7, 0xc9, 0x68, 0x38, 0xc1, 0x81, 0x23, 0x26,
+  0x8a, 0x18, 0xd6, 0x4c, 0x8f, 0xcd, 0xa5, 0xd3, 0x6c, 0xa2, 0xeb, 0x0b, 0x55, 0x16, 0xe6, 0x68,
+  0xa4, 0xdc, 0x7e, 0xe0, 0x32, 0x48, 0xc5, 0x61, 0x65, 0x6d, 0x13, 0xfc, 0xbb, 0x38, 0x36, 0x0f,
+  0xf3, 0xe1, 0x7b, 0xf2, 0x54, 0xa6, 0x07, 0xe8, 0x02, 0x46, 0xed, 0x6a, 0x21, 0x20, 0x7c, 0x12,
+  0x78, 0x68, 0x74, 0xcf, 0x1a, 0x21, 0xeb, 0xde, 0xf8, 0x9e, 0x05, 0x0d, 0x1e, 0x5c, 0x8d, 0xe7,
+  0x57, 0xe2, 0x0c, 0xae, 0xe0, 0x61, 0x19, 0x2c, 0xa1, 0xd5, 0xd4, 0x17, 0xa1, 0xfc, 0x72, 0x8d,
+  0x83, 0xce, 0x5f, 0x62, 0xcf, 0x16, 0xad, 0x26, 0xd5, 0x52, 0x81, 0x41, 0x2e, 0x6d, 0x38, 0xd0,
+  0x5c, 0x62, 0xbd, 0xa0, 0x29, 0xa4, 0x90, 0x27, 0xd7, 0x50, 0xb3, 0xe5, 0x65, 0x83, 0x6b, 0xa0,
+  0x8a, 0x78, 0x22, 0x83, 0x96, 0x32, 0x4f, 0x50, 0x66, 0xa7, 0xaa, 0xda, 0xee, 0x13, 0x2f, 0xc4,
+  0xcf, 0x09, 0x22, 0xde, 0x19, 0x15, 0x03, 0x01, 0x34, 0xa4, 0xdf, 0x7c, 0x8e, 0xba, 0xa2, 0xc0,
+  0x59, 0x4b, 0x78, 0x31, 0xb6, 0x57, 0x33, 0xd0, 0x9d, 0xf4, 0xc7, 0x60, 0x9c, 0xb7, 0x5e, 0xfd,
+  0x28, 0xd7, 0x55, 0x04, 0x07, 0x72, 0x63, 0xf5, 0xd0, 0x2a, 0x14, 0x16, 0xf9, 0x13, 0xed, 0x75,
+  0x45, 0x62, 0xc8, 0x60, 0x2e, 0x5b, 0xf4, 0xe4, 0x96, 0x30, 0x8a, 0x7d, 0x83, 0x72, 0xa2, 0x98,
+  0xbf, 0xfa, 0x11, 0x26, 0x1c, 0xd9, 0x55, 0x01, 0x1f, 0x4e, 0x6a, 0x11, 0xfb, 0x10, 0xe4, 0x7b,
+  0xf5, 0x63, 0x67, 0xd9, 0xed, 0x27, 0xde, 0x27, 0xde, 0x13, 0x1c, 0x2a, 0x1f, 0x86, 0xff, 0x30,
+  0xf5, 0x3b, 0xf3, 0x71, 0x29, 0xb8, 0xfa, 0xce, 0x2b, 0x83, 0x50, 0xf3, 0xea, 0xbd, 0x28, 0x9e,
+  0x66, 0x25, 0x43, 0xb6, 0xf8, 0xa1, 0xa4, 0xb5, 0xa3, 0x3c, 0x98, 0xf6, 0xfe, 0x4a, 0x05, 0x41,
+  0x43, 0x4c, 0xf0, 0x18, 0x2c, 0x83, 0xce, 0x60, 0x74, 0x43, 0x79, 0xbd, 0x4e, 0x12, 0x87, 0x85,
+  0x06, 0x0a, 0x3d, 0xec, 0x87, 0x23, 0x26, 0x96, 0x06, 0x22, 0xe9, 0x10, 0x1b, 0x18, 0x44, 0x53,
+  0xc1, 0xaf, 0x3f, 0xb9, 0xfa, 0x3e, 0x14, 0xbf, 0xd4, 0x91, 0xbf, 0x35, 0x00, 0x39, 0xca, 0x11,
+  0xc6, 0x23, 0xe6, 0xc2, 0x9c, 0x31, 0x44, 0x36, 0x44, 0x21, 0xaa, 0x83, 0x78, 0x43, 0x74, 0xf5,
+  0x1f, 0x0f, 0xe2, 0x5d, 0x24, 0x25, 0x82, 0x42, 0x8a, 0x3c, 0x86, 0x46, 0x78, 0x8a, 0xba, 0x67,
+  0x70, 0x70, 0xcc, 0x26, 0x81, 0x4d, 0x10, 0x83, 0x0e, 0x16, 0x29, 0xb2, 0x42, 0x21, 0x36, 0x26,
+  0xe5, 0x64, 0x7c, 0x8e, 0x49, 0x30, 0x24, 0x79, 0x5c, 0xec, 0xc7, 0x9a, 0x81, 0x88, 0xcd, 0x2b,
+  0x17, 0x3d, 0x45, 0xd4, 0x43, 0x7d, 0x43, 0x65, 0x60, 0xb6, 0xfe, 0xaf, 0x4f, 0x7f, 0x73, 0xa7,
+  0x25, 0x57, 0x6e, 0x77, 0xef, 0x8a, 0xf7, 0x04, 0x6c, 0x80, 0xc4, 0x59, 0xab, 0xd5, 0xb2, 0x58,
+  0xff, 0x39, 0x48, 0x62, 0x15, 0xb0, 0xf8, 0xae, 0x11, 0xc3, 0xc7, 0x8b, 0x8b, 0x19, 0x64, 0x2d,
+  0xf8, 0x90, 0x5e, 0xca, 0x48, 0x38, 0x71, 0x91, 0x54, 0xa4, 0xd8, 0xa4, 0xc9, 0xa0, 0xc5, 0x66,
+  0x5a, 0x31, 0x42, 0x15, 0x07, 0x5c, 0x2b, 0x43, 0x39, 0xf1, 0x9d, 0x78, 0x15, 0x58, 0x98, 0xcd,
+  0xb7, 0x82, 0xe0, 0xa5, 0xf2, 0x15, 0x36, 0x64, 0xe5, 0xbc, 0x61, 0xb6, 0x62, 0xbd, 0x0a, 0x69,
+  0x25, 0x1d, 0xb6, 0x0b, 0x34, 0x98, 0x9f, 0x20, 0x61, 0x50, 0xb0, 0x5d, 0x08, 0x92, 0x18, 0xf3,
+  0xfc, 0xa2, 0x99, 0x5a, 0x48, 0x5e, 0x66, 0xf1, 0xad, 0xdc, 0x22, 0x11, 0x08, 0x77, 0xce, 0xa9,
+  0x07, 0xe9, 0xb8, 0x6c, 0x98, 0xad, 0x30, 0x4b, 0x0a, 0xa9, 0xb3, 0x58, 0x3c, 0x66, 0x88, 0x15,
+  0x28, 0xcc, 0x61, 0xc6, 0x13, 0xf1, 0xbe, 0x52, 0xa0, 0xb7, 0xd2, 0xb5, 0x11, 0x8a, 0xc8, 0xb4,
+  0x45, 0x5a, 0x6d, 0x21, 0x49, 0xc8, 0x0b, 0x33, 0x65, 0x9b, 0x90, 0x17, 0x65, 0x19, 0x91, 0xc5,
+  0x2e, 0x0f, 0x23, 0x08, 0xe6, 0xb8, 0x20, 0x68, 0xc5, 0x6b, 0xcc, 0xcb, 0xcb, 0x66, 0x4c, 0x51,
+  0x4c, 0x5a, 0x92, 0xa0, 0x98, 0x80, 0x08, 0xcc, 0x43, 0x79, 0x2b, 0xf2, 0x62, 0xab, 0x28, 0x70,
+  0x87, 0xbc, 0xb5, 0x88, 0x2e, 0x81, 0xad, 0x70, 0x2d, 0x36, 0xe9, 0xee, 0x56, 0x51, 0x32, 0x7b,
+  0x3d, 0xe4, 0x69, 0x16, 0x18, 0xf3, 0x98, 0x4f, 0xbc, 0x96, 0x61, 0xb9, 0xc4, 0xa5, 0xec, 0xfa,
+  0x5b, 0xa6, 0x5a, 0x9b, 0x2a, 0xac, 0xcc, 0x68, 0x09, 0x08, 0x95, 0xd5, 0x17, 0xab, 0x00, 0xcc,
+  0x83, 0xda, 0x83, 0xa9, 0xfc, 0xcd, 0x4f, 0x08, 0xd6, 0xa6, 0x0e, 0x0b, 0x0a, 0xe9, 0x50, 0x4f,
+  0x58, 0x55, 0x51, 0xcc, 0xc8, 0x11, 0xe9, 0x5a, 0xb9, 0x5d, 0x89, 0x56, 0xe1, 0xdb, 0x15, 0xf5,
+  0xcb, 0xb5, 0xed, 0x8a, 0xfa, 0xbd, 0xfb, 0xff, 0x01, 0xd0, 0x37, 0x60, 0x4a, 0x01, 0x2f, 0x00,
+  0x00,
+};
+
+#endif
@@ -1,6 +1,26 @@
 /*
  * wifi_utils.h - Gestión de WiFi y conectividad
  * Sistema Monitoreo Reefer v3.0
+ *
+ * Reconexión sin pasar por WiFiManager (que solo se usa al arrancar
+ * y para el portal de configuración):
+ *
+ * - Caché en memoria RTC del último AP bueno: SSID, BSSID, canal e IP
+ *   (IP, gateway, máscara, DNS). Con eso la reconexión no escanea ni
+ *   pide DHCP: típicamente < 1 seg. Sobrevive a reinicios por software.
+ *   La clave no va a la RTC: sale de las redes conocidas (NVS / config.h)
+ * - La IP cacheada es una concesión que nadie renueva: a los
+ *   WIFI_DHCP_RENEW_DELAY_MS de la conexión rápida se vuelve a DHCP con el
+ *   enlace arriba. Si el DHCP no contesta, la caché se invalida
+ * - Si la rápida no entra en WIFI_FAST_TIMEOUT_MS: escaneo asincrónico
+ *   y se elige la mejor red conocida (ranking + RSSI), con DHCP
+ * - Varias redes en orden de preferencia: la guardada por el portal
+ *   primero y después WIFI_NETWORKS (config.h)
+ * - Failover por RSSI: con el AP actual débil un rato, se escanea y se
+ *   salta a otro AP/red si es claramente mejor
+ * - Métricas por reconexión (duración, método, motivo de la caída)
+ *
+ * wifiConnectionLoop() no bloquea; llamarla en cada vuelta.
  */
 
 #ifndef WIFI_UTILS_H
@@ -9,24 +29,225 @@
 #include <WiFi.h>
 #include <WiFiManager.h>
 #include <ESPmDNS.h>
-#include <HTTPClient.h>
+#include <ArduinoJson.h>
 #include "config.h"
 #include "types.h"
+#include "metrics.h"
+#include "json_writer.h"
 
 extern WiFiManager wifiManager;
 extern SystemState state;
 
 // ============================================
-// CONECTAR WIFI
+// CACHÉ RTC Y ESTADO
+// ============================================
+#define WIFI_CACHE_MAGIC    0x57494632  // "WIF2" (sin clave)
+#define WIFI_HISTORY_SIZE   8
+
+struct WiFiFastCache {
+  uint32_t magic;
+  char ssid[33];
+  uint8_t bssid[6];
+  int32_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns1;
+  uint32_t dns2;
+};
+
+RTC_DATA_ATTR WiFiFastCache wifiCache;
+
+enum WiFiLinkState {
+  WIFI_LINK_UP = 0,
+  WIFI_LINK_FAST,           // Reconexión con BSSID/canal/IP cacheados
+  WIFI_LINK_SCAN,           // Escaneo asincrónico en curso
+  WIFI_LINK_CONNECTING,     // Conexión completa (DHCP) a la red elegida
+  WIFI_LINK_BACKOFF         // Nada a la vista: esperar y reescanear
+};
+
+struct WiFiCandidate {
+  char ssid[33];
+  char password[65];
+};
+
+struct WiFiReconnectStats {
+  unsigned long reconnects;
+  unsigned long fastOk;
+  unsigned long fastFailed;
+  unsigned long scanOk;
+  unsigned long failovers;        // Cambios de AP por RSSI
+  unsigned long lastMs;
+  unsigned long minMs;
+  unsigned long maxMs;
+  unsigned long totalMs;
+  const char* lastMethod;
+  uint8_t lastReason;             // wifi_err_reason_t de la última caída
+  unsigned long history[WIFI_HISTORY_SIZE];  // Últimas duraciones (ms)
+  uint8_t historyPos;
+  unsigned long dhcpRenewed;      // IP pedida por DHCP tras una conexión rápida
+  unsigned long dhcpFailed;       // ...sin respuesta del DHCP (caché invalidada)
+};
+
+WiFiLinkState wifiLink = WIFI_LINK_UP;
+unsigned long wifiLinkSince = 0;
+unsigned long wifiDownSince = 0;
+unsigned long wifiBackoffMs = 1000;
+bool wifiFailoverScan = false;      // Escaneo por RSSI débil, con el enlace arriba
+uint8_t wifiWeakChecks = 0;
+volatile uint8_t wifiDisconnectReason = 0;
+volatile bool wifiGotIp = false;    // Evento GOT_IP (DHCP) pendiente de atender
+bool wifiDhcpPending = false;       // Conexión rápida con IP estática: falta pasar a DHCP
+bool wifiDhcpRenewing = false;      // DHCP pedido, esperando la IP
+unsigned long wifiDhcpSince = 0;
+
+WiFiCandidate wifiKnown[WIFI_MAX_NETWORKS];
+int wifiKnownCount = 0;
+WiFiReconnectStats wifiStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, "boot", 0, {0}, 0};
+
+// ============================================
+// REDES CONOCIDAS
+// ============================================
+void wifiAddKnown(const char* ssid, const char* password) {
+  if (!ssid || !ssid[0] || wifiKnownCount >= WIFI_MAX_NETWORKS) return;
+  for (int i = 0; i < wifiKnownCount; i++) {
+    if (strcmp(wifiKnown[i].ssid, ssid) == 0) return;
+  }
+  strlcpy(wifiKnown[wifiKnownCount].ssid, ssid, sizeof(wifiKnown[0].ssid));
+  strlcpy(wifiKnown[wifiKnownCount].password, password ? password : "", sizeof(wifiKnown[0].password));
+  wifiKnownCount++;
+}
+
+void wifiLoadKnownNetworks() {
+  wifiKnownCount = 0;
+  // La red del portal primero (la que configuró el instalador)
+  wifiAddKnown(WiFi.SSID().c_str(), WiFi.psk().c_str());
+  for (int i = 0; WIFI_NETWORKS[i].ssid; i++) {
+    wifiAddKnown(WIFI_NETWORKS[i].ssid, WIFI_NETWORKS[i].password);
+  }
+}
+
+int wifiKnownRank(const char* ssid) {
+  for (int i = 0; i < wifiKnownCount; i++) {
+    if (strcmp(wifiKnown[i].ssid, ssid) == 0) return i;
+  }
+  return -1;
+}
+
+// ============================================
+// CACHÉ DEL ÚLTIMO AP BUENO
+// ============================================
+void wifiSaveCache() {
+  memset(&wifiCache, 0, sizeof(wifiCache));  // Sin restos de la caché vieja (con clave)
+  wifiCache.magic = WIFI_CACHE_MAGIC;
+  strlcpy(wifiCache.ssid, WiFi.SSID().c_str(), sizeof(wifiCache.ssid));
+  memcpy(wifiCache.bssid, WiFi.BSSID(), 6);
+  wifiCache.channel = WiFi.channel();
+  wifiCache.ip = (uint32_t)WiFi.localIP();
+  wifiCache.gateway = (uint32_t)WiFi.gatewayIP();
+  wifiCache.subnet = (uint32_t)WiFi.subnetMask();
+  wifiCache.dns1 = (uint32_t)WiFi.dnsIP(0);
+  wifiCache.dns2 = (uint32_t)WiFi.dnsIP(1);
+}
+
+// La clave se busca entre las redes conocidas: si el SSID ya no está, no sirve
+bool wifiCacheValid() {
+  return wifiCache.magic == WIFI_CACHE_MAGIC && wifiCache.ssid[0] && wifiCache.ip != 0 &&
+         wifiKnownRank(wifiCache.ssid) >= 0;
+}
+
+void wifiInvalidateCache() {
+  wifiCache.magic = 0;
+}
+
+// Sin escaneo ni DHCP: mismo AP, mismo canal, misma IP
+void wifiBeginFast() {
+  WiFi.config(IPAddress(wifiCache.ip), IPAddress(wifiCache.gateway), IPAddress(wifiCache.subnet),
+              IPAddress(wifiCache.dns1), IPAddress(wifiCache.dns2));
+  WiFi.begin(wifiCache.ssid, wifiKnown[wifiKnownRank(wifiCache.ssid)].password,
+             wifiCache.channel, wifiCache.bssid, true);
+}
+
+// ============================================
+// MÉTRICAS
+// ============================================
+void wifiOnEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+  // Corre en la tarea del driver: solo guardar el motivo
+  if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    wifiDisconnectReason = info.wifi_sta_disconnected.reason;
+  } else if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    wifiGotIp = true;
+  }
+}
+
+void wifiRecordReconnect(const char* method) {
+  unsigned long ms = millis() - wifiDownSince;
+  wifiStats.reconnects++;
+  wifiStats.lastMs = ms;
+  wifiStats.lastMethod = method;
+  wifiStats.totalMs += ms;
+  if (wifiStats.minMs == 0 || ms < wifiStats.minMs) wifiStats.minMs = ms;
+  if (ms > wifiStats.maxMs) wifiStats.maxMs = ms;
+  wifiStats.history[wifiStats.historyPos] = ms;
+  wifiStats.historyPos = (wifiStats.historyPos + 1) % WIFI_HISTORY_SIZE;
+  metricObserve(metrics.wifiReconnect, ms < 4000000UL ? ms * 1000 : 4000000000UL);
+}
+
+void wifiOnLinkUp(const char* method) {
+  wifiLink = WIFI_LINK_UP;
+  wifiBackoffMs = 1000;
+  wifiWeakChecks = 0;
+  state.wifiConnected = true;
+  state.localIP = WiFi.localIP().toString();
+  wifiSaveCache();
+  // La rápida usó la IP cacheada como estática: renovarla por DHCP en un rato
+  wifiDhcpPending = strcmp(method, "fast") == 0;
+  wifiDhcpRenewing = false;
+  wifiDhcpSince = millis();
+
+  if (wifiDownSince != 0) {
+    wifiRecordReconnect(method);
+    Serial.printf("[WIFI] ✓ Reconectado (%s) a %s canal %d en %lu ms, IP %s\n",
+                  method, WiFi.SSID().c_str(), WiFi.channel(), wifiStats.lastMs, state.localIP.c_str());
+  }
+  wifiDownSince = 0;
+}
+
+// ============================================
+// CONECTAR WIFI (arranque)
 // ============================================
 void connectWiFi() {
+  WiFi.onEvent(wifiOnEvent);
+  WiFi.setAutoReconnect(false);  // La reconexión la maneja wifiConnectionLoop()
+  WiFi.mode(WIFI_STA);
+  wifiLoadKnownNetworks();  // La red del portal sale de NVS: ya está con el modo STA
+
+  // Reinicio por software: el AP de antes suele seguir ahí
+  if (wifiCacheValid()) {
+    unsigned long start = millis();
+    wifiBeginFast();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_FAST_TIMEOUT_MS) {
+      delay(10);
+    }
+    if (WiFi.status() == WL_CONNECTED) {
+      Serial.printf("[WIFI] ✓ Conexión rápida (caché RTC) en %lu ms\n", millis() - start);
+      wifiOnLinkUp("fast");
+      state.apMode = false;
+      Serial.printf("[WIFI] IP: %s\n", state.localIP.c_str());
+      return;
+    }
+    Serial.println("[WIFI] Caché RTC sin respuesta, usando WiFiManager");
+    WiFi.disconnect();
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // Volver a DHCP
+  }
+
   Serial.println("\n[WIFI] Iniciando WiFiManager...");
-  
+
   wifiManager.setConfigPortalTimeout(180);
   wifiManager.setConnectTimeout(30);
-  
+
   String apName = String(DEVICE_NAME) + "_Setup";
-  
+
   if (!wifiManager.autoConnect(apName.c_str(), "reefer123")) {
     Serial.println("[WIFI] ✗ Falló conexión - Modo AP activo");
     state.apMode = true;
@@ -37,7 +258,10 @@ void connectWiFi() {
     state.apMode = false;
     state.localIP = WiFi.localIP().toString();
     Serial.printf("[WIFI] IP: %s\n", state.localIP.c_str());
+    wifiLoadKnownNetworks();
+    wifiSaveCache();
   }
+  WiFi.setAutoReconnect(false);  // WiFiManager lo reactiva
 }
 
 // ============================================
@@ -53,42 +277,264 @@ void setupMDNS() {
 }
 
 // ============================================
-// VERIFICAR CONEXIÓN A INTERNET
+// ELEGIR RED TRAS UN ESCANEO
 // ============================================
-void checkInternet() {
-  if (millis() - state.lastInternetCheck < 30000) return;
-  state.lastInternetCheck = millis();
-  
-  if (!state.wifiConnected) {
-    state.internetAvailable = false;
-    return;
-  }
-  
-  HTTPClient http;
-  http.setTimeout(5000);
-  http.begin("http://www.google.com/generate_204");
-  int httpCode = http.GET();
-  http.end();
-  
-  state.internetAvailable = (httpCode == 204 || httpCode == 200);
-  
-  static bool lastState = false;
-  if (state.internetAvailable != lastState) {
-    Serial.printf("[INTERNET] %s\n", state.internetAvailable ? "✓ Online" : "✗ Offline");
-    lastState = state.internetAvailable;
+// Devuelve el índice en el resultado del escaneo, -1 si no hay red conocida.
+// La de mejor ranking gana salvo que otra se oiga WIFI_RSSI_HYSTERESIS_DB mejor.
+int wifiPickFromScan(int found) {
+  int best = -1;
+  int bestRank = 0;
+  int bestRssi = -127;
+
+  for (int i = 0; i < found; i++) {
+    int rank = wifiKnownRank(WiFi.SSID(i).c_str());
+    if (rank < 0) continue;
+    int rssi = WiFi.RSSI(i);
+
+    bool better;
+    if (best < 0) {
+      better = true;
+    } else if (rank == bestRank) {
+      better = rssi > bestRssi;                     // Mismo SSID: el AP más fuerte
+    } else if (rank < bestRank) {
+      better = rssi > bestRssi - WIFI_RSSI_HYSTERESIS_DB;
+    } else {
+      better = rssi > bestRssi + WIFI_RSSI_HYSTERESIS_DB;
+    }
+    if (better) {
+      best = i;
+      bestRank = rank;
+      bestRssi = rssi;
+    }
   }
+  return best;
+}
+
+void wifiConnectTo(int scanIndex) {
+  int rank = wifiKnownRank(WiFi.SSID(scanIndex).c_str());
+  uint8_t bssid[6];
+  memcpy(bssid, WiFi.BSSID(scanIndex), 6);
+  int32_t channel = WiFi.channel(scanIndex);
+
+  Serial.printf("[WIFI] Conectando a %s (%d dBm, canal %d, prioridad %d)\n",
+                wifiKnown[rank].ssid, WiFi.RSSI(scanIndex), channel, rank + 1);
+
+  WiFi.disconnect();
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // DHCP: puede ser otra subred
+  WiFi.begin(wifiKnown[rank].ssid, wifiKnown[rank].password, channel, bssid, true);
+  wifiLink = WIFI_LINK_CONNECTING;
+  wifiLinkSince = millis();
+}
+
+void wifiStartScan() {
+  WiFi.scanDelete();
+  WiFi.scanNetworks(true, false, false, 120);  // Asincrónico, ~120 ms por canal
+  wifiLink = WIFI_LINK_SCAN;
+  wifiLinkSince = millis();
+}
+
+void wifiBackoff() {
+  wifiLink = WIFI_LINK_BACKOFF;
+  wifiLinkSince = millis();
+  Serial.printf("[WIFI] Sin red conocida, reintento en %lu seg\n", wifiBackoffMs / 1000);
 }
 
 // ============================================
-// RECONECTAR WIFI
+// LOOP DE CONEXIÓN (no bloqueante)
 // ============================================
-void reconnectWiFi() {
-  static unsigned long lastReconnect = 0;
-  if (millis() - lastReconnect < 30000) return;
-  lastReconnect = millis();
-  
-  Serial.println("[WIFI] Intentando reconectar...");
-  WiFi.reconnect();
+void wifiConnectionLoop() {
+  if (state.apMode || wifiKnownCount == 0) return;
+
+  bool connected = WiFi.status() == WL_CONNECTED;
+  unsigned long now = millis();
+
+  switch (wifiLink) {
+    case WIFI_LINK_UP: {
+      // Pasando a DHCP la IP puede faltar un momento: no es una caída
+      if (!connected && wifiDhcpRenewing && now - wifiDhcpSince < WIFI_CONNECT_TIMEOUT_MS) break;
+
+      if (!connected && !wifiFailoverScan) {
+        if (wifiDhcpRenewing) {
+          // El DHCP no dio IP: la caché ya no sirve para la rápida
+          wifiStats.dhcpFailed++;
+          wifiDhcpRenewing = false;
+          wifiInvalidateCache();
+          Serial.println("[WIFI] ✗ Sin respuesta del DHCP, caché invalidada");
+        }
+        wifiDhcpPending = false;
+        wifiDownSince = now;
+        state.wifiConnected = false;
+        Serial.printf("[WIFI] ✗ Enlace caído (motivo %u)\n", wifiDisconnectReason);
+        wifiStats.lastReason = wifiDisconnectReason;
+        if (wifiCacheValid()) {
+          wifiBeginFast();
+          wifiLink = WIFI_LINK_FAST;
+          wifiLinkSince = now;
+        } else {
+          wifiStartScan();
+        }
+        break;
+      }
+
+      // Renovación de la IP de la conexión rápida, con el enlace arriba
+      if (wifiDhcpPending && now - wifiDhcpSince >= WIFI_DHCP_RENEW_DELAY_MS) {
+        wifiDhcpPending = false;
+        wifiDhcpRenewing = true;
+        wifiDhcpSince = now;
+        wifiGotIp = false;
+        Serial.println("[WIFI] Renovando IP por DHCP");
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+      } else if (wifiDhcpRenewing && wifiGotIp && connected) {
+        wifiDhcpRenewing = false;
+        wifiStats.dhcpRenewed++;
+        String ip = WiFi.localIP().toString();
+        if (ip != state.localIP) {
+          Serial.printf("[WIFI] IP nueva por DHCP: %s (antes %s)\n", ip.c_str(), state.localIP.c_str());
+        }
+        state.localIP = ip;
+        wifiSaveCache();
+      }
+
+      // Failover por RSSI: el AP actual se oye mal de forma sostenida
+      static unsigned long lastRssiCheck = 0;
+      if (connected && now - lastRssiCheck >= INTERVAL_WIFI_RSSI_CHECK_MS) {
+        lastRssiCheck = now;
+        if (WiFi.RSSI() < WIFI_RSSI_FAILOVER_DBM) {
+          if (++wifiWeakChecks >= WIFI_RSSI_WEAK_CHECKS && !wifiFailoverScan) {
+            Serial.printf("[WIFI] Señal débil (%d dBm), buscando alternativas\n", WiFi.RSSI());
+            wifiFailoverScan = true;
+            WiFi.scanDelete();
+            WiFi.scanNetworks(true, false, false, 120);
+          }
+        } else {
+          wifiWeakChecks = 0;
+        }
+      }
+
+      if (wifiFailoverScan) {
+        int found = WiFi.scanComplete();
+        if (found == WIFI_SCAN_RUNNING) break;
+        wifiFailoverScan = false;
+        wifiWeakChecks = 0;
+        if (!connected) {  // Se cayó durante el escaneo: lo toma la próxima vuelta
+          WiFi.scanDelete();
+          break;
+        }
+        int pick = found > 0 ? wifiPickFromScan(found) : -1;
+        // Solo cambiar si el elegido es otro AP y se oye claramente mejor
+        if (pick >= 0 && memcmp(WiFi.BSSID(pick), WiFi.BSSID(), 6) != 0 &&
+            WiFi.RSSI(pick) >= WiFi.RSSI() + WIFI_RSSI_HYSTERESIS_DB) {
+          wifiStats.failovers++;
+          wifiDownSince = now;
+          state.wifiConnected = false;
+          wifiConnectTo(pick);
+        }
+        WiFi.scanDelete();
+      }
+      break;
+    }
+
+    case WIFI_LINK_FAST:
+      if (connected) {
+        wifiStats.fastOk++;
+        wifiOnLinkUp("fast");
+      } else if (now - wifiLinkSince >= WIFI_FAST_TIMEOUT_MS) {
+        wifiStats.fastFailed++;
+        Serial.println("[WIFI] Reconexión rápida sin respuesta, escaneando");
+        WiFi.disconnect();
+        wifiStartScan();
+      }
+      break;
+
+    case WIFI_LINK_SCAN: {
+      int found = WiFi.scanComplete();
+      if (found == WIFI_SCAN_RUNNING) break;
+      int pick = found > 0 ? wifiPickFromScan(found) : -1;
+      if (pick >= 0) {
+        wifiConnectTo(pick);
+      } else {
+        wifiBackoff();
+      }
+      WiFi.scanDelete();
+      break;
+    }
+
+    case WIFI_LINK_CONNECTING:
+      if (connected) {
+        wifiStats.scanOk++;
+        wifiOnLinkUp("scan");
+      } else if (now - wifiLinkSince >= WIFI_CONNECT_TIMEOUT_MS) {
+        Serial.println("[WIFI] ✗ Timeout de conexión");
+        WiFi.disconnect();
+        wifiBackoff();
+      }
+      break;
+
+    case WIFI_LINK_BACKOFF:
+      if (connected) {
+        wifiOnLinkUp("scan");
+      } else if (now - wifiLinkSince >= wifiBackoffMs) {
+        wifiBackoffMs = wifiBackoffMs * 2 > WIFI_BACKOFF_MAX_MS ? WIFI_BACKOFF_MAX_MS : wifiBackoffMs * 2;
+        wifiStartScan();
+      }
+      break;
+  }
+}
+
+void getWiFiJSON(JsonObject& obj) {
+  static const char* linkNames[] = {"up", "fast", "scan", "connecting", "backoff"};
+  obj["link"] = linkNames[wifiLink];
+  obj["ssid"] = WiFi.SSID();
+  obj["bssid"] = WiFi.BSSIDstr();
+  obj["channel"] = WiFi.channel();
+  obj["known_networks"] = wifiKnownCount;
+  obj["reconnects"] = wifiStats.reconnects;
+  obj["fast_ok"] = wifiStats.fastOk;
+  obj["fast_failed"] = wifiStats.fastFailed;
+  obj["scan_ok"] = wifiStats.scanOk;
+  obj["rssi_failovers"] = wifiStats.failovers;
+  obj["dhcp_renewed"] = wifiStats.dhcpRenewed;
+  obj["dhcp_failed"] = wifiStats.dhcpFailed;
+  obj["last_ms"] = wifiStats.lastMs;
+  obj["last_method"] = wifiStats.lastMethod;
+  obj["last_reason"] = wifiStats.lastReason;
+  obj["min_ms"] = wifiStats.minMs;
+  obj["max_ms"] = wifiStats.maxMs;
+  obj["avg_ms"] = wifiStats.reconnects ? wifiStats.totalMs / wifiStats.reconnects : 0;
+  JsonArray hist = obj.createNestedArray("history_ms");
+  for (int i = 0; i < WIFI_HISTORY_SIZE; i++) {
+    unsigned long ms = wifiStats.history[(wifiStats.historyPos + i) % WIFI_HISTORY_SIZE];
+    if (ms) hist.add(ms);
+  }
+}
+
+// Mismos campos que getWiFiJSON, escritos en streaming (/api/status)
+void writeWiFiJSON(JsonWriter& w) {
+  static const char* linkNames[] = {"up", "fast", "scan", "connecting", "backoff"};
+  w.field(JK(link), linkNames[wifiLink]);
+  w.field(JK(ssid), WiFi.SSID());
+  w.field(JK(bssid), WiFi.BSSIDstr());
+  w.field(JK(channel), (int)WiFi.channel());
+  w.field(JK(known_networks), wifiKnownCount);
+  w.field(JK(reconnects), wifiStats.reconnects);
+  w.field(JK(fast_ok), wifiStats.fastOk);
+  w.field(JK(fast_failed), wifiStats.fastFailed);
+  w.field(JK(scan_ok), wifiStats.scanOk);
+  w.field(JK(rssi_failovers), wifiStats.failovers);
+  w.field(JK(dhcp_renewed), wifiStats.dhcpRenewed);
+  w.field(JK(dhcp_failed), wifiStats.dhcpFailed);
+  w.field(JK(last_ms), wifiStats.lastMs);
+  w.field(JK(last_method), wifiStats.lastMethod);
+  w.field(JK(last_reason), (int)wifiStats.lastReason);
+  w.field(JK(min_ms), wifiStats.minMs);
+  w.field(JK(max_ms), wifiStats.maxMs);
+  w.field(JK(avg_ms), wifiStats.reconnects ? wifiStats.totalMs / wifiStats.reconnects : 0UL);
+  w.beginArray(JK(history_ms));
+  for (int i = 0; i < WIFI_HISTORY_SIZE; i++) {
+    unsigned long ms = wifiStats.history[(wifiStats.historyPos + i) % WIFI_HISTORY_SIZE];
+    if (ms) w.value(ms);
+  }
+  w.endArray();
 }
 
 // ============================================
@@ -96,6 +542,7 @@ void reconnectWiFi() {
 // ============================================
 void resetWiFi() {
   Serial.println("[WIFI] Reseteando configuración...");
+  wifiInvalidateCache();
   wifiManager.resetSettings();
   delay(1000);
   ESP.restart();
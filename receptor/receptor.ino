@@ -5,12 +5,18 @@
  */
 
 #include <WiFi.h>
+#include <WiFiUdp.h>
+#include <esp_now.h>
+#include <esp_wifi.h>
 #include <WebServer.h>
 #include <SPIFFS.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 #include <time.h>
 #include <Preferences.h>
+#include "rift_protocol.h"
+#include "rift_registry.h"
+#include "web_assets.h"
 
 // CONFIGURACIÓN
 const char* WIFI_SSID = "PARAMETICAN_WIFI";
@@ -27,6 +33,14 @@ const char* SUPABASE_KEY = "tu-anon-key-aqui";
 const char* NTP_SERVER = "pool.ntp.org";
 const long GMT_OFFSET = -3 * 3600;
 
+// ESP-NOW: enlace directo con los emisores, no depende del AP del sitio.
+// Clave del sitio: IGUAL a la de los emisores, cambiar en cada instalación
+#define USE_ESPNOW true
+const uint8_t RIFT_SITE_KEY[16] = {
+  0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x69,
+  0x63, 0x61, 0x6E, 0x2D, 0x52, 0x49, 0x46, 0x54
+};
+
 // PINES PARA ALERTA LOCAL (sin internet)
 #define BUZZER_PIN 25      // GPIO25 - Buzzer pequeño (transistor 2N2222)
 #define LED_ALERT_PIN 26   // GPIO26 - LED rojo de alerta
@@ -42,44 +56,113 @@ struct AlertThresholds {
 };
 AlertThresholds thresholds;
 
-// ESTRUCTURAS
-#define MAX_RIFTS 6
-#define MAX_HISTORY 1440
+// RIFTs: registro dinámico por rift_id (rift_registry.h). Los vencimientos
+// por RIFT van en la rueda de timers (timer_wheel.h): el loop no los recorre
+#define RIFT_OFFLINE_MS 120000    // Sin lecturas por este tiempo → offline
+enum RiftTimerKind : uint8_t { TIMER_OFFLINE, TIMER_EVICT, TIMER_ALERT };
+uint16_t riftAlertCount = 0;      // RIFTs con alerta activa
+uint16_t riftCriticalCount = 0;   // ... y temperatura crítica (sirena)
 
-struct RiftData {
-  int id;
-  String name;
-  String location;
-  float temp1, temp2, tempAvg;
-  bool doorOpen;
-  unsigned long doorOpenSince;
-  int sensorCount, rssi;
-  unsigned long lastUpdate;
-  bool online, alertActive;
-  String alertMessage;
-  unsigned long alertStartTime;
-};
+WebServer server(80);
+Preferences preferences;
 
-struct HistoryPoint {
-  unsigned long timestamp;
-  float temperature;
-  bool doorOpen;
-};
+// Páginas embebidas: el navegador las usa 1 hora sin preguntar y después
+// revalida con el ETag (304). Tras un update se ven a lo sumo 1 hora viejas.
+#define WEB_ASSET_CACHE_CONTROL "public, max-age=3600"
 
-RiftData rifts[MAX_RIFTS];
-HistoryPoint history[MAX_RIFTS][MAX_HISTORY];
-int historyIndex[MAX_RIFTS] = {0};
+// Protocolo binario UDP (rift_protocol.h)
+#define RIFT_UDP_MAX_PER_LOOP 64   // Datagramas procesados por vuelta como máximo
+WiFiUDP riftUdp;
+unsigned long udpFrames = 0;
+unsigned long udpInvalid = 0;      // Largo/cabecera/CRC incorrectos
+unsigned long udpAcksSent = 0;
 
-WebServer server(80);
-Preferences preferences;
+// ESP-NOW: un par cifrado por RIFT (MAC del emisor, persistida en Preferences).
+// El chip admite pocos pares cifrados: los RIFTs de más usan UDP/HTTP
+#define ESPNOW_RX_SLOTS 16
+struct EspNowRx {
+  uint8_t mac[6];
+  uint8_t len;
+  int8_t rssi;
+  uint8_t data[sizeof(RiftFrame)];
+};
+uint8_t BROADCAST_MAC[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+bool espnowReady = false;
+uint8_t espnowChannel = 1;
+unsigned long espnowInvalid = 0;   // CRC/firma/MAC que no corresponde
+// El callback corre en la tarea WiFi: solo encola, el loop procesa
+EspNowRx espnowRx[ESPNOW_RX_SLOTS];
+volatile uint8_t espnowRxHead = 0, espnowRxTail = 0;
+volatile unsigned long espnowRxDropped = 0;
+portMUX_TYPE espnowMux = portMUX_INITIALIZER_UNLOCKED;
 
 bool internetAvailable = false;
 unsigned long lastInternetCheck = 0;
 unsigned long lastSupabaseSync = 0;
+unsigned long supabaseSyncInterval = 300000;   // Baja a SYNC_BACKLOG_MS si quedó pendiente
 unsigned long systemStartTime = 0;
 unsigned long totalDataReceived = 0;
+unsigned long totalBackfilled = 0;    // Lecturas diferidas guardadas (historial o cola a Supabase)
+
+// Ingesta: HTTP (suelta y por lote), UDP y ESP-NOW encolan acá; un único
+// worker en el loop aplica al registro de RIFTs, historial y alertas
+#define INGEST_RING_SIZE 256
+#define INGEST_MAX_PER_LOOP 64          // Lecturas aplicadas por vuelta como máximo
+#define INGEST_BATCH_MAX_BYTES 8192     // Cuerpo máximo de /api/data/batch (el emisor manda ~2.5 KB)
+#define STATUS_CHUNK_BYTES 1024         // Pedazo de /api/status chunked (stack del handler)
+enum IngestKind : uint8_t { INGEST_LIVE, INGEST_BACKFILL };
+enum IngestSource : uint8_t { SRC_HTTP, SRC_UDP, SRC_ESPNOW };
+struct IngestItem {
+  uint16_t riftId;
+  IngestKind kind;
+  IngestSource source;
+  bool hasSeq, prevBoot, doorOpen;
+  uint8_t sensorCount;
+  int8_t rssi;
+  bool cloudSlot;                 // Reservó lugar en la cola a Supabase (cloudRows): toda diferida con hora UTC
+  uint32_t seq, senderMs;
+  unsigned long at;               // millis() de la lectura (recepción, o recepción - edad); 0 = antes del arranque
+  uint32_t epoch;                 // Hora UTC de una diferida (emisor o NTP propio); 0 = sin hora
+  unsigned long doorOpenSince;
+  float temp1, temp2, tempAvg;
+};
+struct IngestStats {
+  unsigned long queued, processed, dropped, duplicates, late, backfilled, rejected;
+  uint16_t highWater;
+};
+IngestItem ingestRing[INGEST_RING_SIZE];
+uint16_t ingestHead = 0, ingestCount = 0;
+IngestStats ingestStats = {};
 unsigned long totalAlertsSent = 0;
 
+// Diferidas con hora UTC que no tienen lugar en el historial: anteriores
+// al arranque del receptor o más viejas que sus MAX_HISTORY puntos (3 h;
+// el emisor guarda 24 h). Suben a Supabase con su hora sin pasar por el
+// historial en RAM. Esta cola también es RAM, como la de ingesta. El lote
+// reserva lugar antes de confirmar cada lectura
+#define CLOUD_BACKLOG_SIZE 512     // 12 bytes por fila
+struct __attribute__((packed)) CloudRow {
+  uint32_t epoch;
+  uint16_t riftId;
+  int16_t temperature;             // Centésimas (riftEncodeTemp)
+  uint8_t doorOpen;
+};
+CloudRow cloudRows[CLOUD_BACKLOG_SIZE];
+#define BACKFILL_DEDUP_MS 10000    // Misma lectura si difiere menos que esto (el emisor manda cada 30 seg)
+uint16_t cloudHead = 0, cloudCount = 0;
+uint16_t cloudReserved = 0;        // Diferidas en la cola de ingesta que pueden venir acá
+
+// Sync a Supabase (syncToSupabase)
+#define SYNC_MAX_ROWS 100          // Filas por insert (~12 KB de cuerpo)
+#define SYNC_MAX_RIFTS 32          // RIFTs por insert
+#define SYNC_BACKLOG_MS 10000      // Próximo sync si quedó pendiente
+#define SYNC_RETRY_MS 60000        // Próximo sync tras un error
+struct SyncStats {
+  unsigned long rows, batches, failures, lastMs;
+  int lastCode;
+};
+SyncStats syncStats = {};
+
 // Variables para alerta local
 bool localAlertActive = false;
 bool criticalAlertActive = false;  // Para sirena potente
@@ -109,11 +192,14 @@ void setup() {
   }
   
   loadConfiguration();
-  initRifts();
+  twInit(onRiftTimer);
+  riftRegistryInit();
   connectWiFi();
   configTime(GMT_OFFSET, 0, NTP_SERVER);
   setupWebServer();
   server.begin();
+  riftUdp.begin(RIFT_UDP_PORT);
+  if (USE_ESPNOW) initEspNow();
   
   systemStartTime = millis();
   Serial.println("Sistema listo: http://" + WiFi.localIP().toString());
@@ -121,6 +207,9 @@ void setup() {
 
 void loop() {
   server.handleClient();
+  pollRiftUdp();
+  pollEspNow();
+  ingestWorker();
   
   if (WiFi.status() != WL_CONNECTED) reconnectWiFi();
   
@@ -129,32 +218,17 @@ void loop() {
     lastInternetCheck = millis();
   }
   
-  if (internetAvailable && (millis() - lastSupabaseSync > 300000)) {
+  if (internetAvailable && (millis() - lastSupabaseSync > supabaseSyncInterval)) {
     syncToSupabase();
     lastSupabaseSync = millis();
   }
   
-  checkAlerts();
+  twRun();            // Offline, demoras de alerta y desalojos vencidos
   checkRiftStatus();
   updateLocalAlerts(); // Manejar buzzer y LEDs
   delay(10);
 }
 
-void initRifts() {
-  const char* names[] = {"RIFT-01","RIFT-02","RIFT-03","RIFT-04","RIFT-05","RIFT-06"};
-  const char* locs[] = {"Deposito Principal","Deposito Carnes","Deposito Lacteos",
-                        "Deposito Verduras","Deposito Bebidas","Deposito Reserva"};
-  
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    rifts[i].id = i + 1;
-    rifts[i].name = names[i];
-    rifts[i].location = locs[i];
-    rifts[i].online = false;
-    rifts[i].temp1 = rifts[i].temp2 = rifts[i].tempAvg = -999.0;
-    rifts[i].alertActive = false;
-  }
-}
-
 void loadConfiguration() {
   preferences.begin("parametican", false);
   thresholds.tempMax = preferences.getFloat("tempMax", -18.0);
@@ -185,17 +259,27 @@ void connectWiFi() {
   }
   
   if (WiFi.status() == WL_CONNECTED) {
+    espnowChannel = WiFi.channel();
     Serial.println("WiFi OK - IP: " + WiFi.localIP().toString());
   }
 }
 
+// Con ESP-NOW se reintenta solo en el canal conocido (un scan completo deja
+// a los emisores sin receptor ~2 seg); cada 6 intentos se barre todo por si
+// el AP cambió de canal
 void reconnectWiFi() {
   static unsigned long lastAttempt = 0;
+  static uint8_t attempts = 0;
   if (millis() - lastAttempt > 10000) {
     WiFi.disconnect();
-    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    if (USE_ESPNOW && ++attempts % 6 != 0) {
+      WiFi.begin(WIFI_SSID, WIFI_PASSWORD, espnowChannel);
+    } else {
+      WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    }
     lastAttempt = millis();
   }
+  if (WiFi.status() == WL_CONNECTED) attempts = 0;
 }
 
 void checkInternetConnection() {
@@ -207,10 +291,14 @@ void checkInternetConnection() {
 }
 
 void setupWebServer() {
+  const char* assetHeaders[] = {"If-None-Match"};
+  server.collectHeaders(assetHeaders, 1);
+
   server.on("/", HTTP_GET, handleRoot);
   server.on("/app", HTTP_GET, handleMobileApp);  // App para celulares
   server.on("/api/status", HTTP_GET, handleGetStatus);
   server.on("/api/data", HTTP_POST, handlePostData);
+  server.on("/api/data/batch", HTTP_POST, handlePostBatch);
   server.on("/api/history", HTTP_GET, handleGetHistory);
   server.on("/api/alerts", HTTP_GET, handleGetAlerts);
   server.on("/api/config", HTTP_GET, handleGetConfig);
@@ -220,38 +308,152 @@ void setupWebServer() {
   server.onNotFound([]() { server.send(404, "text/plain", "Not found"); });
 }
 
-void handleRoot() {
-  File file = SPIFFS.open("/index.html", "r");
-  if (file) {
-    server.streamFile(file, "text/html");
-    file.close();
-  } else {
-    server.send(200, "text/html", "<h1>Campamento Parametican Silver</h1><p>Subir archivos SPIFFS</p>");
+// Páginas de web_assets.h (tools/gen_web_assets.py): gzip directo desde
+// flash, sin copia en heap. Con el ETag el navegador revalida y recibe 304.
+void sendAsset(const uint8_t* gz, size_t len, const char* mime, const char* etag) {
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
+  if (server.header("If-None-Match") == etag) {
+    server.send(304);
+    return;
   }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, mime, (PGM_P)gz, len);
+}
+
+void handleRoot() {
+  sendAsset(WEB_INDEX_GZ, WEB_INDEX_GZ_LEN, WEB_INDEX_MIME, WEB_INDEX_ETAG);
 }
 
+// Respuesta chunked: se manda de a pedazos de STATUS_CHUNK_BYTES sin
+// armar el JSON entero (con 40+ RIFTs serían ~50 KB de heap contiguo)
+class ChunkedResponse : public Print {
+public:
+  size_t skip = 0;              // Bytes a descartar de lo próximo que se escriba
+  
+  size_t write(uint8_t c) override {
+    if (skip) {
+      skip--;
+      return 1;
+    }
+    buf[len++] = c;
+    if (len == sizeof(buf)) flush();
+    return 1;
+  }
+  size_t write(const uint8_t* data, size_t size) override {
+    for (size_t i = 0; i < size; i++) write(data[i]);
+    return size;
+  }
+  void flush() {
+    if (len) server.sendContent((const char*)buf, len);
+    len = 0;
+  }
+  void end() {
+    flush();
+    server.sendContent("");   // Chunk vacío: fin de la respuesta
+  }
+private:
+  uint8_t buf[STATUS_CHUNK_BYTES];
+  size_t len = 0;
+};
+
 void handleGetStatus() {
-  StaticJsonDocument<2048> doc;
-  JsonArray arr = doc.createNestedArray("rifts");
-  
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    JsonObject r = arr.createNestedObject();
-    r["id"] = rifts[i].id;
-    r["name"] = rifts[i].name;
-    r["location"] = rifts[i].location;
-    r["temp1"] = rifts[i].temp1;
-    r["temp2"] = rifts[i].temp2;
-    r["temp_avg"] = rifts[i].tempAvg;
-    r["door_open"] = rifts[i].doorOpen;
-    r["door_open_since"] = rifts[i].doorOpenSince;
-    r["online"] = rifts[i].online;
-    r["last_update"] = rifts[i].lastUpdate;
-    r["alert_active"] = rifts[i].alertActive;
-    r["alert_message"] = rifts[i].alertMessage;
-    r["rssi"] = rifts[i].rssi;
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+  ChunkedResponse out;
+  out.print("{\"rifts\":[");
+  
+  // Un documento chico por RIFT, reusado (estático: fuera del stack del loop)
+  static StaticJsonDocument<1024> doc;
+  for (uint16_t i = 0; i < riftActiveCount; i++) {
+    RiftData& rift = *riftActive[i];
+    doc.clear();
+    JsonObject r = doc.to<JsonObject>();
+    r["id"] = rift.id;
+    r["name"] = rift.name;
+    r["location"] = rift.location;
+    r["temp1"] = rift.temp1;
+    r["temp2"] = rift.temp2;
+    r["temp_avg"] = rift.tempAvg;
+    r["door_open"] = rift.doorOpen;
+    r["door_open_since"] = rift.doorOpenSince;
+    r["online"] = rift.online;
+    r["last_update"] = rift.lastUpdate;
+    r["alert_active"] = rift.alertActive;
+    r["alert_message"] = rift.alertMessage;
+    r["rssi"] = rift.rssi;
+    
+    JsonObject link = r.createNestedObject("link");
+    link["transport"] = rift.transport == 0xFF ? "-" : ingestSourceName((IngestSource)rift.transport);
+    link["last_seq"] = rift.seq.highest;
+    link["received"] = rift.seq.received;
+    link["lost"] = rift.seq.lost;
+    link["reordered"] = rift.seq.reordered;
+    link["duplicates"] = rift.seq.duplicates;
+    link["restarts"] = rift.seq.restarts;
+    link["loss_pct"] = riftSeqLossPct(rift.seq);
+    
+    EspNowPeer& p = rift.espnow;
+    JsonObject en = link.createNestedObject("espnow");
+    en["paired"] = p.paired;
+    if (p.paired) {
+      en["mac"] = macToString(p.mac);
+      en["rssi"] = p.rssi;
+      en["rssi_avg"] = p.rssiAvg;
+      en["frames"] = p.frames;
+      en["pairings"] = p.pairings;
+      en["last_seen_sec"] = p.lastSeen ? (long)((millis() - p.lastSeen) / 1000) : -1;
+    }
+    if (i > 0) out.print(',');
+    serializeJson(doc, out);
   }
+  out.print(']');
   
+  // Resto del objeto: mismo documento, sin su '{' (ya abierto arriba)
+  doc.clear();
   doc["internet"] = internetAvailable;
+  doc["udp_frames"] = udpFrames;
+  doc["udp_invalid"] = udpInvalid;
+  doc["udp_acks"] = udpAcksSent;
+  doc["backfilled"] = totalBackfilled;
+  JsonObject ingest = doc.createNestedObject("ingest");
+  ingest["pending"] = ingestCount;
+  ingest["queued"] = ingestStats.queued;
+  ingest["processed"] = ingestStats.processed;
+  ingest["dropped"] = ingestStats.dropped;
+  ingest["duplicates"] = ingestStats.duplicates;
+  ingest["late"] = ingestStats.late;
+  ingest["rejected"] = ingestStats.rejected;
+  ingest["high_water"] = ingestStats.highWater;
+  JsonObject sync = doc.createNestedObject("supabase_sync");
+  sync["rows"] = syncStats.rows;
+  sync["batches"] = syncStats.batches;
+  sync["failures"] = syncStats.failures;
+  sync["last_code"] = syncStats.lastCode;
+  sync["last_ms"] = syncStats.lastMs;
+  sync["backlog"] = cloudCount;
+  sync["backlog_max"] = CLOUD_BACKLOG_SIZE;
+  JsonObject timers = doc.createNestedObject("timers");
+  timers["pending"] = twStats.pending;
+  timers["fired"] = twStats.fired;
+  timers["cascaded"] = twStats.cascaded;
+  JsonObject reg = doc.createNestedObject("registry");
+  reg["active"] = riftActiveCount;
+  reg["max_slots"] = riftStats.maxSlots;
+  reg["bytes_per_rift"] = sizeof(RiftData);
+  reg["bytes_used"] = (unsigned long)riftStats.allocated * sizeof(RiftData);
+  reg["budget"] = RIFT_MEMORY_BUDGET;
+  reg["heap_reserve"] = RIFT_HEAP_RESERVE;
+  reg["heap_limited"] = riftStats.heapLimited;
+  reg["archived"] = riftStats.archived;
+  reg["evicted"] = riftStats.evicted;
+  reg["restored"] = riftStats.restored;
+  reg["rejected"] = riftStats.rejected;
+  reg["max_probe"] = riftStats.maxProbe;
+  reg["free_heap"] = ESP.getFreeHeap();
+  doc["espnow_channel"] = espnowChannel;
+  doc["espnow_invalid"] = espnowInvalid;
+  doc["espnow_dropped"] = espnowRxDropped;
   doc["uptime"] = (millis() - systemStartTime) / 1000;
   doc["total_data"] = totalDataReceived;
   
@@ -262,11 +464,13 @@ void handleGetStatus() {
     doc["current_time"] = timeStr;
   }
   
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response);
+  out.print(',');
+  out.skip = 1;
+  serializeJson(doc, out);   // Incluye la '}' de cierre
+  out.end();
 }
 
+// Lectura suelta: se valida, se encola y se responde (el worker la aplica)
 void handlePostData() {
   if (!server.hasArg("plain")) {
     server.send(400, "application/json", "{\"error\":\"No data\"}");
@@ -276,46 +480,538 @@ void handlePostData() {
   StaticJsonDocument<512> doc;
   deserializeJson(doc, server.arg("plain"));
   
-  int riftId = doc["rift_id"] | 0;
-  if (riftId < 1 || riftId > MAX_RIFTS) {
+  IngestItem item;
+  if (!ingestItemFromJson(doc.as<JsonObject>(), doc["rift_id"] | 0, item)) {
     server.send(400, "application/json", "{\"error\":\"Invalid rift_id\"}");
     return;
   }
+  if (!ingestPush(item)) {
+    server.send(503, "application/json", "{\"error\":\"Cola de ingesta llena\"}");
+    return;
+  }
+  server.send(200, "application/json", "{\"status\":\"ok\"}");
+}
+
+// Muchas lecturas por request: {"rift_id":1,"readings":[{...},...]}.
+// Cada lectura puede traer su propio rift_id. Con "age_ms" o "epoch" es
+// diferida (buffer del emisor, no toca el estado actual); sin ellos, en vivo
+void handlePostBatch() {
+  String body = server.arg("plain");
+  if (body.length() > INGEST_BATCH_MAX_BYTES) {
+    server.send(413, "application/json", "{\"error\":\"Lote demasiado grande\"}");
+    return;
+  }
+  
+  // Parseo sin copia (zero-copy sobre body): el doc solo guarda punteros
+  DynamicJsonDocument doc(body.length() * 2 + 512);
+  if (deserializeJson(doc, &body[0])) {
+    server.send(400, "application/json", "{\"error\":\"JSON invalido\"}");
+    return;
+  }
   
-  int idx = riftId - 1;
-  rifts[idx].temp1 = doc["temp1"] | -999.0;
-  rifts[idx].temp2 = doc["temp2"] | -999.0;
-  rifts[idx].tempAvg = doc["temp_avg"] | -999.0;
-  rifts[idx].doorOpen = doc["door_open"] | false;
-  rifts[idx].doorOpenSince = doc["door_open_since"] | 0;
-  rifts[idx].sensorCount = doc["sensor_count"] | 0;
-  rifts[idx].rssi = doc["rssi"] | 0;
-  rifts[idx].lastUpdate = millis();
-  rifts[idx].online = true;
+  JsonArray readings = doc["readings"];
+  if (readings.isNull()) {
+    server.send(400, "application/json", "{\"error\":\"Falta readings\"}");
+    return;
+  }
+  
+  int defaultRift = doc["rift_id"] | 0;
+  int queued = 0, invalid = 0, tooOld = 0, full = 0;
+  // Una respuesta por lectura, en orden: el emisor saca de su buffer solo
+  // las "ok" / "old" / "invalid" y reintenta las "full"
+  String results;
+  results.reserve(readings.size() * 8 + 2);
+  results = "[";
+  for (JsonObject r : readings) {
+    IngestItem item;
+    const char* result;
+    if (!ingestItemFromJson(r, r["rift_id"] | defaultRift, item)) {
+      if (item.riftId == 0) {   // rift_id fuera de rango
+        invalid++;
+        result = "invalid";
+      } else {
+        tooOld++;
+        result = "old";
+      }
+    } else if (ingestPush(item)) {
+      queued++;
+      result = "ok";
+    } else {
+      full++;
+      result = "full";
+    }
+    if (results.length() > 1) results += ',';
+    results += '"';
+    results += result;
+    results += '"';
+  }
+  results += ']';
   
-  addToHistory(idx, rifts[idx].tempAvg, rifts[idx].doorOpen);
+  // 503 solo si no entró nada: con éxito parcial el emisor no reintenta el lote entero
+  String resp = "{\"status\":\"" + String(queued || !full ? "ok" : "full") + "\",\"queued\":" + String(queued) +
+                ",\"invalid\":" + String(invalid) + ",\"too_old\":" + String(tooOld) +
+                ",\"dropped\":" + String(full) + ",\"results\":" + results + "}";
+  server.send(queued || !full ? 200 : 503, "application/json", resp);
+}
+
+// ============================================
+// INGESTA: cola única y un solo worker
+// ============================================
+
+// JSON de /api/data o de un elemento del lote → IngestItem (false si no sirve)
+bool ingestItemFromJson(JsonObject r, int riftId, IngestItem& item) {
+  memset(&item, 0, sizeof(item));
+  item.kind = r.containsKey("age_ms") || r.containsKey("epoch") ? INGEST_BACKFILL : INGEST_LIVE;
+  if (riftId < 1 || riftId > 0xFFFF) return false;
+  
+  item.riftId = riftId;
+  item.source = SRC_HTTP;
+  item.hasSeq = r.containsKey("seq");
+  item.seq = r["seq"] | 0UL;
+  item.senderMs = r["sender_ms"] | 0UL;
+  item.temp1 = r["temp1"] | -999.0;
+  item.temp2 = r["temp2"] | -999.0;
+  item.tempAvg = r["temp_avg"] | -999.0;
+  item.doorOpen = r["door_open"] | false;
+  item.doorOpenSince = r["door_open_since"] | 0UL;
+  item.sensorCount = r["sensor_count"] | 0;
+  item.rssi = r["rssi"] | 0;
+  item.at = millis();
+  
+  if (item.kind == INGEST_BACKFILL) {
+    item.prevBoot = r["prev_boot"] | false;   // seq de otro boot: no sirve para deduplicar
+    item.epoch = r["epoch"] | 0UL;
+    time_t now = time(nullptr);
+    bool ntp = now > 1600000000;
+    
+    // Con hora UTC en los dos lados manda el epoch; si no, la edad relativa.
+    // at = 0: anterior al arranque del receptor (el historial empieza ahí)
+    if (item.epoch && ntp) {
+      unsigned long ageSec = now > (time_t)item.epoch ? now - item.epoch : 0;
+      item.at = ageSec < item.at / 1000 ? item.at - ageSec * 1000UL : 0;
+    } else if (r.containsKey("age_ms") && (r["age_ms"] | 0UL) < item.at) {
+      unsigned long ageMs = r["age_ms"] | 0UL;
+      item.at -= ageMs;
+      if (!item.epoch && ntp) item.epoch = now - ageMs / 1000;
+    } else {
+      item.at = 0;
+    }
+    
+    // Sin lugar en el historial ni hora UTC para subirla tal cual
+    if (!item.at && !item.epoch) return false;
+    // Si entra en el historial se sabe recién en el worker: con hora UTC
+    // se reserva lugar en la cola a Supabase por las dudas
+    item.cloudSlot = item.epoch != 0;
+  }
+  return true;
+}
+
+bool ingestPush(const IngestItem& item) {
+  if (ingestCount >= INGEST_RING_SIZE ||
+      (item.cloudSlot && cloudCount + cloudReserved >= CLOUD_BACKLOG_SIZE)) {
+    ingestStats.dropped++;
+    return false;
+  }
+  if (item.cloudSlot) cloudReserved++;
+  ingestRing[(ingestHead + ingestCount) % INGEST_RING_SIZE] = item;
+  ingestCount++;
+  ingestStats.queued++;
+  if (ingestCount > ingestStats.highWater) ingestStats.highWater = ingestCount;
+  return true;
+}
+
+const char* ingestSourceName(IngestSource src) {
+  switch (src) {
+    case SRC_UDP:    return "udp";
+    case SRC_ESPNOW: return "espnow";
+    default:         return "http";
+  }
+}
+
+// Único lugar que escribe el registro de RIFTs, historial y estado de alertas
+void ingestWorker() {
+  for (int n = 0; n < INGEST_MAX_PER_LOOP && ingestCount > 0; n++) {
+    IngestItem& it = ingestRing[ingestHead];
+    RiftData* rift = riftGetOrCreate(it.riftId);
+    
+    if (!rift) {
+      // Registro lleno de RIFTs online o con alerta
+      ingestStats.rejected++;
+    } else if (it.kind == INGEST_LIVE) {
+      RiftSeqResult res = it.hasSeq ? riftSeqAccept(rift->seq, it.seq, it.senderMs) : RIFT_SEQ_NEW;
+      if (res == RIFT_SEQ_NEW || res == RIFT_SEQ_RESTART) {
+        applyRiftReading(*rift, it.temp1, it.temp2, it.tempAvg, it.doorOpen, it.doorOpenSince,
+                         it.sensorCount, it.rssi, it.source);
+        evaluateAlerts(*rift);
+      } else if (res == RIFT_SEQ_LATE) {
+        // Llegó después de una más nueva: no pisa el estado actual pero
+        // va al historial en su lugar. Hora = la de la más nueva menos lo
+        // que las separa en el reloj del emisor
+        ingestStats.late++;
+        uint32_t behind = rift->seq.lastSenderMs - it.senderMs;
+        if (it.senderMs && it.senderMs < rift->seq.lastSenderMs && behind < rift->lastUpdate) {
+          insertHistory(*rift, rift->lastUpdate - behind, it.tempAvg, it.doorOpen);
+        }
+      } else {
+        // Repetida (ej. fallback HTTP de un frame que sí llegó)
+        ingestStats.duplicates++;
+      }
+    } else if (backfillSeen(*rift, it)) {
+      // Ya guardada (ej. se perdió el ACK y el seq quedó fuera de la ventana)
+      ingestStats.duplicates++;
+    } else if (it.prevBoot || riftSeqBackfill(rift->seq, it.seq)) {
+      // Más vieja que el historial del RIFT (o que el arranque): directo a Supabase
+      bool stored = it.at && insertHistory(*rift, it.at, it.tempAvg, it.doorOpen);
+      if (!stored && it.epoch) stored = cloudPush(it.riftId, it.epoch, it.tempAvg, it.doorOpen);
+      if (stored) {
+        totalBackfilled++;
+        ingestStats.backfilled++;
+      }
+    } else {
+      ingestStats.duplicates++;
+    }
+    if (it.cloudSlot) cloudReserved--;
+    
+    ingestHead = (ingestHead + 1) % INGEST_RING_SIZE;
+    ingestCount--;
+    ingestStats.processed++;
+  }
+  
+  // Un resumen cada 10 seg en lugar de una línea por lectura
+  static unsigned long lastReport = 0;
+  static unsigned long lastProcessed = 0;
+  if (millis() - lastReport >= 10000) {
+    if (ingestStats.processed != lastProcessed) {
+      Serial.printf("[INGEST] %lu lecturas en %lu seg (diferidas %lu, tarde %lu, dup %lu, descartadas %lu, pico cola %u)\n",
+                    ingestStats.processed - lastProcessed, (millis() - lastReport) / 1000,
+                    ingestStats.backfilled, ingestStats.late, ingestStats.duplicates, ingestStats.dropped,
+                    ingestStats.highWater);
+      lastProcessed = ingestStats.processed;
+    }
+    lastReport = millis();
+  }
+}
+
+void applyRiftReading(RiftData& rift, float temp1, float temp2, float tempAvg, bool doorOpen,
+                      unsigned long doorOpenSince, int sensorCount, int rssi, IngestSource source) {
+  rift.temp1 = temp1;
+  rift.temp2 = temp2;
+  rift.tempAvg = tempAvg;
+  rift.doorOpen = doorOpen;
+  rift.doorOpenSince = doorOpenSince;
+  rift.sensorCount = sensorCount;
+  rift.rssi = rssi;
+  rift.lastUpdate = millis();
+  rift.online = true;
+  rift.transport = source;
+  scheduleRiftTimer(rift, rift.linkTimer, TIMER_OFFLINE, RIFT_OFFLINE_MS);
+  
+  addToHistory(rift, tempAvg, doorOpen);
   totalDataReceived++;
   
-  Serial.println("[DATA] " + rifts[idx].name + ": " + String(rifts[idx].tempAvg, 1) + "C");
-  server.send(200, "application/json", "{\"status\":\"ok\"}");
+  // A cientos de frames/seg el Serial sería el cuello de botella
+  if (millis() - rift.lastLog >= 5000) {
+    rift.lastLog = millis();
+    Serial.println("[DATA] " + String(rift.name) + ": " + String(tempAvg, 1) + "C (" + ingestSourceName(source) + ")");
+  }
+}
+
+// Frames binarios de los emisores; se vacía el socket sin bloquear
+void pollRiftUdp() {
+  uint8_t buf[sizeof(RiftFrame) + 1];
+  
+  for (int n = 0; n < RIFT_UDP_MAX_PER_LOOP; n++) {
+    int len = riftUdp.parsePacket();
+    if (len <= 0) break;
+    
+    int got = riftUdp.read(buf, sizeof(buf));
+    if (got != len || !riftFrameValid(buf, got, RIFT_TYPE_READING)) {
+      udpInvalid++;
+      continue;
+    }
+    
+    RiftFrame f;
+    memcpy(&f, buf, sizeof(f));
+    if (f.riftId == 0) {
+      udpInvalid++;
+      continue;
+    }
+    udpFrames++;
+    // Cola llena: sin ACK, el emisor reintenta o lo guarda en su buffer
+    if (!queueRiftFrame(f, SRC_UDP, f.rssi)) continue;
+    
+    // Confirmar también duplicados: el ACK anterior se pudo haber perdido
+    if (f.flags & RIFT_FLAG_ACK_REQ) {
+      RiftAck ack = ackForFrame(f);
+      riftUdp.beginPacket(riftUdp.remoteIP(), riftUdp.remotePort());
+      riftUdp.write((const uint8_t*)&ack, sizeof(ack));
+      riftUdp.endPacket();
+      udpAcksSent++;
+    }
+  }
+}
+
+// Frame binario (UDP o ESP-NOW) a la cola de ingesta
+bool queueRiftFrame(const RiftFrame& f, IngestSource source, int rssi) {
+  IngestItem item;
+  memset(&item, 0, sizeof(item));
+  item.riftId = f.riftId;
+  item.kind = INGEST_LIVE;
+  item.source = source;
+  item.hasSeq = true;
+  item.seq = f.seq;
+  item.senderMs = f.senderMs;
+  item.temp1 = riftDecodeTemp(f.temp1);
+  item.temp2 = riftDecodeTemp(f.temp2);
+  item.tempAvg = riftDecodeTemp(f.tempAvg);
+  item.doorOpen = f.flags & RIFT_FLAG_DOOR_OPEN;
+  item.doorOpenSince = f.doorOpenSec;
+  item.sensorCount = f.sensorCount;
+  item.rssi = rssi;
+  item.at = millis();
+  return ingestPush(item);
+}
+
+RiftAck ackForFrame(const RiftFrame& f) {
+  RiftAck ack;
+  ack.riftId = f.riftId;
+  ack.seq = f.seq;
+  ack.senderMs = f.senderMs;
+  riftFinalizeAck(ack);
+  return ack;
+}
+
+String macToString(const uint8_t* mac) {
+  char buf[18];
+  snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  return String(buf);
+}
+
+// ESP-NOW -----------------------------------------------------------------
+
+void espnowEnqueue(const uint8_t* mac, const uint8_t* data, int len, int8_t rssi) {
+  if (len <= 0 || len > (int)sizeof(RiftFrame)) {
+    espnowRxDropped++;
+    return;
+  }
+  portENTER_CRITICAL(&espnowMux);
+  uint8_t next = (espnowRxHead + 1) % ESPNOW_RX_SLOTS;
+  if (next == espnowRxTail) {
+    espnowRxDropped++;
+  } else {
+    EspNowRx& rx = espnowRx[espnowRxHead];
+    memcpy(rx.mac, mac, 6);
+    memcpy(rx.data, data, len);
+    rx.len = len;
+    rx.rssi = rssi;
+    espnowRxHead = next;
+  }
+  portEXIT_CRITICAL(&espnowMux);
+}
+
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+void onEspnowRecv(const esp_now_recv_info_t* info, const uint8_t* data, int len) {
+  espnowEnqueue(info->src_addr, data, len, info->rx_ctrl->rssi);
+}
+#else
+// Core 2.x no da el RSSI en el callback: se toma del action frame visto en
+// modo promiscuo justo antes (mismo remitente)
+volatile int8_t promiscRssi = 0;
+uint8_t promiscMac[6];
+
+void onPromiscRx(void* buf, wifi_promiscuous_pkt_type_t type) {
+  const wifi_promiscuous_pkt_t* pkt = (const wifi_promiscuous_pkt_t*)buf;
+  if (type != WIFI_PKT_MGMT || pkt->payload[0] != 0xD0) return;   // Solo action frames
+  memcpy(promiscMac, pkt->payload + 10, 6);
+  promiscRssi = pkt->rx_ctrl.rssi;
+}
+
+void onEspnowRecv(const uint8_t* mac, const uint8_t* data, int len) {
+  espnowEnqueue(mac, data, len, memcmp(mac, promiscMac, 6) == 0 ? promiscRssi : 0);
+}
+#endif
+
+bool espnowAddPeer(const uint8_t* mac, bool encrypt) {
+  if (esp_now_is_peer_exist(mac)) esp_now_del_peer(mac);
+  esp_now_peer_info_t peer = {};
+  memcpy(peer.peer_addr, mac, 6);
+  peer.channel = 0;              // Canal actual de la radio
+  peer.ifidx = WIFI_IF_STA;
+  peer.encrypt = encrypt;
+  if (encrypt) riftDeriveLmk(RIFT_SITE_KEY, mac, peer.lmk);
+  return esp_now_add_peer(&peer) == ESP_OK;
+}
+
+void initEspNow() {
+  // El auto-reconnect del core escanea todos los canales: lo maneja reconnectWiFi()
+  WiFi.setAutoReconnect(false);
+  
+  if (esp_now_init() != ESP_OK) {
+    Serial.println("[ERROR] ESP-NOW");
+    return;
+  }
+  esp_now_set_pmk(RIFT_SITE_KEY);
+  esp_now_register_recv_cb(onEspnowRecv);
+#if !(defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3)
+  wifi_promiscuous_filter_t filter = {};
+  filter.filter_mask = WIFI_PROMIS_FILTER_MASK_MGMT;
+  esp_wifi_set_promiscuous_filter(&filter);
+  esp_wifi_set_promiscuous_rx_cb(onPromiscRx);
+  esp_wifi_set_promiscuous(true);
+#endif
+  espnowAddPeer(BROADCAST_MAC, false);
+  
+  espnowReady = true;
+  
+  // Pares guardados: tras reiniciar el receptor los emisores siguen sin re-emparejar
+  // (los frames ESP-NOW traen rift_id de 1 byte)
+  preferences.begin("parametican", true);
+  for (int id = 1; id <= 255; id++) {
+    String key = "enmac" + String(id);
+    if (!preferences.isKey(key.c_str())) continue;
+    RiftData* rift = riftGetOrCreate(id);
+    if (rift && preferences.getBytes(key.c_str(), rift->espnow.mac, 6) == 6) {
+      rift->espnow.paired = espnowAddPeer(rift->espnow.mac, true);
+    }
+  }
+  preferences.end();
+  
+  Serial.println("ESP-NOW OK - MAC " + WiFi.macAddress() + " canal " + String(espnowChannel));
+}
+
+// Hooks del registro: un RIFT pasado a flash libera sus timers y su par
+// cifrado (el chip tiene pocos); al volver se registra de nuevo o el emisor
+// re-empareja. Uno creado o restaurado que nunca transmite también vuelve a
+// flash por su timer de desalojo
+void riftOnCreate(RiftData& r) {
+  scheduleRiftTimer(r, r.linkTimer, TIMER_EVICT, RIFT_EVICT_AFTER_MS);
+}
+
+void riftOnEvict(RiftData& r) {
+  twCancel(r.linkTimer);
+  twCancel(r.alertTimer);
+  if (espnowReady && r.espnow.paired) esp_now_del_peer(r.espnow.mac);
+}
+
+void riftOnRestore(RiftData& r) {
+  scheduleRiftTimer(r, r.linkTimer, TIMER_EVICT, RIFT_EVICT_AFTER_MS);
+  if (espnowReady && r.espnow.paired) r.espnow.paired = espnowAddPeer(r.espnow.mac, true);
+}
+
+void handlePairRequest(const EspNowRx& rx) {
+  RiftPair req;
+  memcpy(&req, rx.data, sizeof(req));
+  if (req.riftId == 0 || !riftPairAuthentic(req, RIFT_SITE_KEY, rx.mac)) {
+    espnowInvalid++;
+    return;
+  }
+  
+  RiftData* rift = riftGetOrCreate(req.riftId);
+  if (!rift) {
+    Serial.println("[ESPNOW] Registro lleno, RIFT " + String(req.riftId) + " sin emparejar");
+    return;
+  }
+  EspNowPeer& p = rift->espnow;
+  bool sameMac = p.paired && memcmp(p.mac, rx.mac, 6) == 0;
+  if (!sameMac || !esp_now_is_peer_exist(rx.mac)) {
+    if (p.paired && !sameMac) esp_now_del_peer(p.mac);   // Placa reemplazada
+    if (!espnowAddPeer(rx.mac, true)) {
+      Serial.println("[ESPNOW] Sin lugar para el par de " + String(rift->name) + " (sigue por UDP/HTTP)");
+      return;
+    }
+    memcpy(p.mac, rx.mac, 6);
+    p.paired = true;
+    p.frames = 0;
+    preferences.begin("parametican", false);
+    preferences.putBytes(("enmac" + String(rift->id)).c_str(), p.mac, 6);
+    preferences.end();
+  }
+  p.pairings++;
+  
+  // Se responde siempre (el emisor pudo reiniciar); por broadcast porque el
+  // emisor todavía no tiene la LMK registrada para nosotros
+  uint8_t selfMac[6];
+  WiFi.macAddress(selfMac);
+  RiftPair ack;
+  memset(&ack, 0, sizeof(ack));
+  ack.type = RIFT_TYPE_PAIR_ACK;
+  ack.riftId = req.riftId;
+  ack.nonce = req.nonce;
+  ack.channel = WiFi.channel();
+  riftFinalizePair(ack, RIFT_SITE_KEY, selfMac);
+  esp_now_send(BROADCAST_MAC, (const uint8_t*)&ack, sizeof(ack));
+  
+  Serial.println("[ESPNOW] " + String(rift->name) + " emparejado (" + macToString(rx.mac) + ")");
+}
+
+void handleEspNowReading(const EspNowRx& rx) {
+  RiftFrame f;
+  memcpy(&f, rx.data, sizeof(f));
+  // Solo del emisor emparejado con ese RIFT (otro par no puede hacerse pasar)
+  RiftData* rift = riftFind(f.riftId);
+  if (!rift || !rift->espnow.paired || memcmp(rift->espnow.mac, rx.mac, 6) != 0) {
+    espnowInvalid++;
+    return;
+  }
+  
+  EspNowPeer& p = rift->espnow;
+  p.frames++;
+  p.lastSeen = millis();
+  if (rx.rssi != 0) {
+    p.rssi = rx.rssi;
+    p.rssiAvg = p.rssiAvg == 0 ? rx.rssi : p.rssiAvg * 0.8f + rx.rssi * 0.2f;
+  }
+  if (!queueRiftFrame(f, SRC_ESPNOW, p.rssi)) return;
+  
+  if (f.flags & RIFT_FLAG_ACK_REQ) {
+    RiftAck ack = ackForFrame(f);
+    esp_now_send(p.mac, (const uint8_t*)&ack, sizeof(ack));
+  }
+}
+
+void pollEspNow() {
+  if (!espnowReady) return;
+  if (WiFi.status() == WL_CONNECTED) espnowChannel = WiFi.channel();
+  
+  while (true) {
+    EspNowRx rx;
+    bool empty;
+    portENTER_CRITICAL(&espnowMux);
+    empty = espnowRxTail == espnowRxHead;
+    if (!empty) {
+      rx = espnowRx[espnowRxTail];
+      espnowRxTail = (espnowRxTail + 1) % ESPNOW_RX_SLOTS;
+    }
+    portEXIT_CRITICAL(&espnowMux);
+    if (empty) break;
+    
+    if (riftFrameValid(rx.data, rx.len, RIFT_TYPE_PAIR_REQ)) {
+      handlePairRequest(rx);
+    } else if (riftFrameValid(rx.data, rx.len, RIFT_TYPE_READING)) {
+      handleEspNowReading(rx);
+    } else {
+      espnowInvalid++;
+    }
+  }
 }
 
 void handleGetHistory() {
   int riftId = server.arg("rift").toInt();
-  if (riftId < 1 || riftId > MAX_RIFTS) riftId = 1;
-  int idx = riftId - 1;
+  if (riftId < 1) riftId = 1;
+  // Un RIFT en flash no se restaura por una consulta: historial vacío
+  RiftData* rift = riftFind(riftId);
   
   StaticJsonDocument<4096> doc;
   doc["rift_id"] = riftId;
   JsonArray data = doc.createNestedArray("data");
   
-  for (int i = 0; i < 100; i++) {
-    int hIdx = (historyIndex[idx] - i + MAX_HISTORY) % MAX_HISTORY;
-    if (history[idx][hIdx].timestamp > 0) {
+  for (int i = 0; rift && i < 100; i++) {
+    const HistoryPoint& h = rift->history[(rift->historyIndex - 1 - i + MAX_HISTORY) % MAX_HISTORY];
+    if (h.timestamp > 0) {
       JsonObject p = data.createNestedObject();
-      p["t"] = history[idx][hIdx].timestamp;
-      p["temp"] = history[idx][hIdx].temperature;
-      p["door"] = history[idx][hIdx].doorOpen;
+      p["t"] = h.timestamp;
+      p["temp"] = riftDecodeTemp(h.temperature);
+      p["door"] = (bool)h.doorOpen;
     }
   }
   
@@ -325,15 +1021,16 @@ void handleGetHistory() {
 }
 
 void handleGetAlerts() {
-  StaticJsonDocument<1024> doc;
+  DynamicJsonDocument doc(512 + riftActiveCount * 192);
   JsonArray alerts = doc.createNestedArray("alerts");
   
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    if (rifts[i].alertActive) {
+  for (uint16_t i = 0; i < riftActiveCount; i++) {
+    RiftData& rift = *riftActive[i];
+    if (rift.alertActive) {
       JsonObject a = alerts.createNestedObject();
-      a["rift_id"] = rifts[i].id;
-      a["rift_name"] = rifts[i].name;
-      a["message"] = rifts[i].alertMessage;
+      a["rift_id"] = rift.id;
+      a["rift_name"] = rift.name;
+      a["message"] = rift.alertMessage;
     }
   }
   
@@ -363,6 +1060,12 @@ void handlePostConfig() {
   if (doc.containsKey("min_duration")) thresholds.minDurationSeconds = doc["min_duration"];
   if (doc.containsKey("door_max")) thresholds.doorOpenMaxSeconds = doc["door_max"];
   
+  // Umbrales nuevos: reprogramar demoras y recalcular alertas una vez
+  for (uint16_t i = 0; i < riftActiveCount; i++) {
+    twCancel(riftActive[i]->alertTimer);
+    evaluateAlerts(*riftActive[i]);
+  }
+  
   saveConfiguration();
   server.send(200, "application/json", "{\"status\":\"ok\"}");
 }
@@ -372,52 +1075,117 @@ void handleTestAlert() {
   server.send(200, "application/json", "{\"status\":\"ok\"}");
 }
 
-void addToHistory(int idx, float temp, bool door) {
-  history[idx][historyIndex[idx]].timestamp = millis();
-  history[idx][historyIndex[idx]].temperature = temp;
-  history[idx][historyIndex[idx]].doorOpen = door;
-  historyIndex[idx] = (historyIndex[idx] + 1) % MAX_HISTORY;
+void addToHistory(RiftData& rift, float temp, bool door) {
+  HistoryPoint& h = rift.history[rift.historyIndex];
+  h.timestamp = millis();
+  h.temperature = riftEncodeTemp(temp);
+  h.doorOpen = door;
+  h.flags = 0;
+  rift.historyIndex = (rift.historyIndex + 1) % MAX_HISTORY;
 }
 
-void checkAlerts() {
-  static unsigned long highTempStart[MAX_RIFTS] = {0};
+// Inserta manteniendo el orden por timestamp: se corren un lugar los puntos
+// más nuevos que ts (en un backfill suelen ser pocos). false si ts es más
+// viejo que todo el historial lleno
+bool insertHistory(RiftData& rift, unsigned long ts, float temp, bool door) {
+  HistoryPoint* h = rift.history;
+  int pos = rift.historyIndex;
+  if (ts == 0) ts = 1;   // 0 = slot vacío
+  if (h[pos].timestamp != 0 && ts <= h[pos].timestamp) return false;
   
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    if (!rifts[i].online || rifts[i].tempAvg == -999.0) continue;
-    
-    if (rifts[i].tempAvg > thresholds.tempCritical) {
-      if (!rifts[i].alertActive) {
-        triggerAlert(i, "CRITICO: Temp " + String(rifts[i].tempAvg, 1) + "C");
+  for (int n = 0; n < MAX_HISTORY - 1; n++) {
+    int prev = (pos - 1 + MAX_HISTORY) % MAX_HISTORY;
+    if (h[prev].timestamp == 0 || h[prev].timestamp <= ts) break;
+    h[pos] = h[prev];
+    pos = prev;
+  }
+  h[pos].timestamp = ts;
+  h[pos].temperature = riftEncodeTemp(temp);
+  h[pos].doorOpen = door;
+  h[pos].flags = 0;
+  rift.historyIndex = (rift.historyIndex + 1) % MAX_HISTORY;
+  // Debajo de la marca de agua: bajarla (los ya subidos tienen su flag)
+  if (ts <= rift.syncedTs) rift.syncedTs = ts - 1;
+  return true;
+}
+
+// Timers por RIFT ------------------------------------------------------------
+
+void scheduleRiftTimer(RiftData& rift, TimerNode& t, RiftTimerKind kind, unsigned long ms) {
+  t.owner = &rift;
+  t.kind = kind;
+  twSchedule(t, ms);
+}
+
+void onRiftTimer(TimerNode* t) {
+  RiftData& rift = *(RiftData*)t->owner;
+  switch (t->kind) {
+    case TIMER_OFFLINE:
+      rift.online = false;
+      Serial.println("[RIFT] " + String(rift.name) + " offline");
+      scheduleRiftTimer(rift, rift.linkTimer, TIMER_EVICT, RIFT_EVICT_AFTER_MS);
+      break;
+    case TIMER_EVICT:
+      riftEvictIfIdle(&rift);   // Con alerta sin resolver se queda en memoria
+      break;
+    case TIMER_ALERT:
+      evaluateAlerts(rift);     // Venció la demora de temp alta
+      break;
+  }
+}
+
+// Solo ante un evento del RIFT: lectura aplicada (worker de ingesta),
+// vencimiento de su demora de alerta o cambio de umbrales
+void evaluateAlerts(RiftData& rift) {
+  if (rift.online && rift.tempAvg != -999.0) {
+    if (rift.tempAvg > thresholds.tempCritical) {
+      if (!rift.alertActive) {
+        triggerAlert(rift, "CRITICO: Temp " + String(rift.tempAvg, 1) + "C");
       }
-    } else if (rifts[i].tempAvg > thresholds.tempMax) {
-      if (!rifts[i].doorOpen) {
-        if (highTempStart[i] == 0) highTempStart[i] = millis();
-        else if ((millis() - highTempStart[i]) / 1000 > thresholds.minDurationSeconds) {
-          if (!rifts[i].alertActive) {
-            triggerAlert(i, "Temp alta: " + String(rifts[i].tempAvg, 1) + "C");
+    } else if (rift.tempAvg > thresholds.tempMax) {
+      if (!rift.doorOpen) {
+        if (rift.highTempStart == 0) rift.highTempStart = millis();
+        unsigned long elapsed = millis() - rift.highTempStart;
+        if (elapsed / 1000 > (unsigned long)thresholds.minDurationSeconds) {
+          if (!rift.alertActive) {
+            triggerAlert(rift, "Temp alta: " + String(rift.tempAvg, 1) + "C");
           }
+        } else if (!twPending(rift.alertTimer)) {
+          scheduleRiftTimer(rift, rift.alertTimer, TIMER_ALERT,
+                            (thresholds.minDurationSeconds + 1) * 1000UL - elapsed);
         }
       }
     } else {
-      highTempStart[i] = 0;
-      if (rifts[i].alertActive) clearAlert(i);
+      rift.highTempStart = 0;
+      twCancel(rift.alertTimer);
+      if (rift.alertActive) clearAlert(rift);
     }
   }
+  
+  // Sirena: alerta activa con temperatura crítica
+  bool critical = rift.alertActive && rift.tempAvg > thresholds.tempCritical;
+  if (critical != rift.alertCritical) {
+    rift.alertCritical = critical;
+    if (critical) riftCriticalCount++;
+    else riftCriticalCount--;
+  }
 }
 
-void triggerAlert(int idx, String msg) {
-  rifts[idx].alertActive = true;
-  rifts[idx].alertMessage = msg;
-  rifts[idx].alertStartTime = millis();
+void triggerAlert(RiftData& rift, String msg) {
+  riftAlertCount++;
+  rift.alertActive = true;
+  strlcpy(rift.alertMessage, msg.c_str(), sizeof(rift.alertMessage));
+  rift.alertStartTime = millis();
   
-  String full = "ALERTA " + rifts[idx].name + "\n" + msg;
+  String full = "ALERTA " + String(rift.name) + "\n" + msg;
   sendTelegramAlert(full);
   totalAlertsSent++;
 }
 
-void clearAlert(int idx) {
-  rifts[idx].alertActive = false;
-  rifts[idx].alertMessage = "";
+void clearAlert(RiftData& rift) {
+  riftAlertCount--;
+  rift.alertActive = false;
+  rift.alertMessage[0] = '\0';
 }
 
 void sendTelegramAlert(String msg) {
@@ -438,53 +1206,195 @@ void sendTelegramAlert(String msg) {
   http.end();
 }
 
+// Diferida ya guardada: punto del historial o fila a Supabase del mismo
+// RIFT a menos de BACKFILL_DEDUP_MS. La cola se recorre entera: los lugares
+// libres conservan las filas ya subidas hasta que se reusan
+bool backfillSeen(const RiftData& rift, const IngestItem& it) {
+  if (it.at) {
+    for (int n = 0; n < MAX_HISTORY; n++) {
+      const HistoryPoint& h = rift.history[(rift.historyIndex - 1 - n + MAX_HISTORY) % MAX_HISTORY];
+      if (h.timestamp == 0 || h.timestamp + BACKFILL_DEDUP_MS < it.at) break;
+      if (h.timestamp < it.at + BACKFILL_DEDUP_MS) return true;
+    }
+  }
+  if (it.epoch) {
+    for (int i = 0; i < CLOUD_BACKLOG_SIZE; i++) {
+      const CloudRow& c = cloudRows[i];
+      if (c.epoch && c.riftId == it.riftId &&
+          (uint32_t)abs((int32_t)(c.epoch - it.epoch)) < BACKFILL_DEDUP_MS / 1000) return true;
+    }
+  }
+  return false;
+}
+
+// Fila para Supabase con su hora UTC (el lugar lo reservó ingestPush)
+bool cloudPush(uint16_t riftId, uint32_t epoch, float temp, bool door) {
+  if (cloudCount >= CLOUD_BACKLOG_SIZE) return false;
+  CloudRow& c = cloudRows[(cloudHead + cloudCount) % CLOUD_BACKLOG_SIZE];
+  c.epoch = epoch;
+  c.riftId = riftId;
+  c.temperature = riftEncodeTemp(temp);
+  c.doorOpen = door;
+  cloudCount++;
+  return true;
+}
+
+// Agrega una fila de Supabase a body (con la coma si no es la primera)
+void syncAppendRow(String& body, int rows, uint16_t riftId, const char* name, int16_t temp,
+                   bool door, time_t at) {
+  struct tm t;
+  gmtime_r(&at, &t);
+  char row[128];
+  snprintf(row, sizeof(row),
+           "%s{\"rift_id\":%u,\"rift_name\":\"%s\",\"temperature\":%.2f,\"door_open\":%s,"
+           "\"created_at\":\"%04d-%02d-%02dT%02d:%02d:%02dZ\"}",
+           rows ? "," : "", riftId, name, riftDecodeTemp(temp), door ? "true" : "false",
+           t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec);
+  body += row;
+}
+
+// Sync incremental: por RIFT solo los puntos del historial posteriores a su
+// marca de agua (syncedTs), en un único insert de muchas filas. La marca
+// avanza solo con respuesta 2xx; si falla, el próximo intento reenvía lo mismo
+bool historyPending(const RiftData& rift) {
+  const HistoryPoint& last = rift.history[(rift.historyIndex - 1 + MAX_HISTORY) % MAX_HISTORY];
+  return last.timestamp != 0 && last.timestamp != rift.syncedTs;
+}
+
+// Cantidad de puntos (los más nuevos) posteriores a la marca de agua:
+// se recorre solo lo nuevo
+int historyPendingCount(RiftData& rift) {
+  const HistoryPoint& newest = rift.history[(rift.historyIndex - 1 + MAX_HISTORY) % MAX_HISTORY];
+  if (newest.timestamp < rift.syncedTs) rift.syncedTs = 0;   // millis() dio la vuelta
+  int n = 0;
+  while (n < MAX_HISTORY) {
+    const HistoryPoint& h = rift.history[(rift.historyIndex - 1 - n + MAX_HISTORY) % MAX_HISTORY];
+    if (h.timestamp == 0 || h.timestamp <= rift.syncedTs) break;
+    n++;
+  }
+  return n;
+}
+
 void syncToSupabase() {
   if (String(SUPABASE_URL) == "https://tu-proyecto.supabase.co") return;
   
-  HTTPClient http;
-  String url = String(SUPABASE_URL) + "/rest/v1/temperature_logs";
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("apikey", SUPABASE_KEY);
-  http.addHeader("Authorization", "Bearer " + String(SUPABASE_KEY));
+  // created_at se calcula desde millis(): sin hora NTP se espera
+  time_t now = time(nullptr);
+  if (now < 1600000000) return;
   
-  StaticJsonDocument<512> doc;
-  JsonArray arr = doc.to<JsonArray>();
-  
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    if (rifts[i].online && rifts[i].tempAvg != -999.0) {
-      JsonObject r = arr.createNestedObject();
-      r["rift_id"] = rifts[i].id;
-      r["temperature"] = rifts[i].tempAvg;
-      r["door_open"] = rifts[i].doorOpen;
-    }
-  }
+  struct SyncRange {
+    RiftData* rift;
+    int start, count;
+    uint32_t lastTs;
+  };
+  SyncRange ranges[SYNC_MAX_RIFTS];
+  int nRanges = 0, rows = 0;
+  bool more = false;
+  // Con atraso se arranca donde quedó el lote anterior: ningún RIFT se queda sin turno
+  static uint16_t nextRift = 0;
+  uint16_t first = riftActiveCount ? nextRift % riftActiveCount : 0;
   
   String body;
-  serializeJson(doc, body);
-  http.POST(body);
-  http.end();
-}
-
-void checkRiftStatus() {
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    if (rifts[i].online && (millis() - rifts[i].lastUpdate > 120000)) {
-      rifts[i].online = false;
-    }
+  body.reserve(SYNC_MAX_ROWS * 120);
+  body = "[";
+  
+  // Primero las diferidas sin lugar en el historial, con su hora UTC
+  int cloudTaken = 0;
+  while (cloudTaken < cloudCount && rows < SYNC_MAX_ROWS) {
+    const CloudRow& c = cloudRows[(cloudHead + cloudTaken) % CLOUD_BACKLOG_SIZE];
+    cloudTaken++;
+    if (c.temperature == RIFT_TEMP_NONE) continue;
+    RiftData* rift = riftFind(c.riftId);
+    char name[16];
+    if (rift) strlcpy(name, rift->name, sizeof(name));
+    else snprintf(name, sizeof(name), "RIFT-%02u", c.riftId);
+    syncAppendRow(body, rows, c.riftId, name, c.temperature, c.doorOpen, c.epoch);
+    rows++;
   }
+  if (cloudTaken < cloudCount) more = true;
   
-  // Actualizar estado de alerta local
-  localAlertActive = false;
-  criticalAlertActive = false;
-  for (int i = 0; i < MAX_RIFTS; i++) {
-    if (rifts[i].alertActive) {
-      localAlertActive = true;
-      // Si la temperatura es crítica (>-10°C), activar sirena
-      if (rifts[i].tempAvg > thresholds.tempCritical) {
-        criticalAlertActive = true;
+  for (uint16_t k = 0; k < riftActiveCount; k++) {
+    uint16_t i = (first + k) % riftActiveCount;
+    RiftData& rift = *riftActive[i];
+    if (!historyPending(rift)) continue;
+    if (rows >= SYNC_MAX_ROWS || nRanges >= SYNC_MAX_RIFTS) {
+      more = true;
+      nextRift = i;
+      break;
+    }
+    
+    SyncRange& r = ranges[nRanges++];
+    int pending = historyPendingCount(rift);
+    r.rift = &rift;
+    r.start = (rift.historyIndex - pending + MAX_HISTORY) % MAX_HISTORY;
+    r.count = 0;
+    r.lastTs = rift.syncedTs;
+    for (int n = 0, pos = r.start; n < pending; n++, pos = (pos + 1) % MAX_HISTORY) {
+      if (rows >= SYNC_MAX_ROWS) {
+        more = true;
+        nextRift = i;
+        break;
       }
+      const HistoryPoint& h = rift.history[pos];
+      r.count++;
+      r.lastTs = h.timestamp;
+      if ((h.flags & HISTORY_FLAG_SYNCED) || h.temperature == RIFT_TEMP_NONE) continue;
+      
+      syncAppendRow(body, rows, rift.id, rift.name, h.temperature, h.doorOpen,
+                    now - (millis() - h.timestamp) / 1000);
+      rows++;
     }
   }
+  body += "]";
+  
+  int code = 204;
+  unsigned long start = millis();
+  if (rows > 0) {
+    HTTPClient http;
+    String url = String(SUPABASE_URL) + "/rest/v1/temperature_logs";
+    http.begin(url);
+    http.setTimeout(10000);
+    http.addHeader("Content-Type", "application/json");
+    http.addHeader("apikey", SUPABASE_KEY);
+    http.addHeader("Authorization", "Bearer " + String(SUPABASE_KEY));
+    http.addHeader("Prefer", "return=minimal");
+    code = http.POST(body);
+    http.end();
+  }
+  syncStats.lastCode = code;
+  syncStats.lastMs = millis() - start;
+  
+  if (code < 200 || code >= 300) {
+    syncStats.failures++;
+    supabaseSyncInterval = SYNC_RETRY_MS;
+    Serial.printf("[SUPABASE] ✗ HTTP %d, %d filas quedan pendientes\n", code, rows);
+    return;
+  }
+  
+  // 2xx: sacar las diferidas subidas, marcar y avanzar la marca de agua de cada RIFT incluido
+  cloudHead = (cloudHead + cloudTaken) % CLOUD_BACKLOG_SIZE;
+  cloudCount -= cloudTaken;
+  for (int i = 0; i < nRanges; i++) {
+    SyncRange& r = ranges[i];
+    for (int n = 0, pos = r.start; n < r.count; n++, pos = (pos + 1) % MAX_HISTORY) {
+      r.rift->history[pos].flags |= HISTORY_FLAG_SYNCED;
+    }
+    r.rift->syncedTs = r.lastTs;
+  }
+  syncStats.rows += rows;
+  syncStats.batches += rows > 0;
+  supabaseSyncInterval = more ? SYNC_BACKLOG_MS : 300000;
+  if (rows > 0) {
+    Serial.printf("[SUPABASE] ✓ %d filas de %d RIFTs en %lu ms%s\n", rows, nRanges, syncStats.lastMs,
+                  more ? " (quedan pendientes)" : "");
+  }
+}
+
+// Offline y alertas los mantienen los timers y evaluateAlerts(): acá solo
+// se leen los contadores (no se recorren los RIFTs)
+void checkRiftStatus() {
+  localAlertActive = riftAlertCount > 0;
+  criticalAlertActive = riftCriticalCount > 0;   // Temp crítica (>-10°C): sirena
   
   // Resetear acknowledge de sirena si pasaron 30 minutos
   if (sirenAcknowledged && (millis() - sirenAckTime > 1800000)) {
@@ -543,259 +1453,5 @@ void handleAckAlert() {
 
 // App móvil para alertas locales
 void handleMobileApp() {
-  String html = getMobileAppHTML();
-  server.send(200, "text/html", html);
-}
-
-String getMobileAppHTML() {
-  return R"rawliteral(
-<!DOCTYPE html>
-<html lang="es">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no">
-    <meta name="apple-mobile-web-app-capable" content="yes">
-    <meta name="apple-mobile-web-app-status-bar-style" content="black-translucent">
-    <meta name="mobile-web-app-capable" content="yes">
-    <meta name="theme-color" content="#1a1a2e">
-    <title>ALERTA RIFT</title>
-    <style>
-        *{margin:0;padding:0;box-sizing:border-box}
-        html,body{height:100%;overflow:hidden}
-        body{font-family:-apple-system,BlinkMacSystemFont,sans-serif;background:#1a1a2e;color:#fff}
-        
-        #initScreen{position:fixed;inset:0;background:#1a1a2e;display:flex;flex-direction:column;align-items:center;justify-content:center;z-index:1000}
-        #initScreen h1{font-size:1.5em;margin-bottom:20px}
-        #initScreen p{color:#888;margin-bottom:30px;text-align:center;padding:0 20px}
-        #startBtn{background:linear-gradient(135deg,#00ff88,#00aa55);border:none;padding:20px 60px;border-radius:15px;color:#000;font-size:1.3em;font-weight:bold;cursor:pointer}
-        
-        #app{display:none;height:100%;flex-direction:column}
-        #app.active{display:flex}
-        
-        .header{background:linear-gradient(90deg,#0f3460,#533483);padding:12px;text-align:center}
-        .header h1{font-size:1.1em}
-        
-        .status{display:flex;justify-content:space-between;padding:8px 15px;background:rgba(0,0,0,0.4);font-size:0.8em}
-        .dot{width:10px;height:10px;border-radius:50%;display:inline-block;margin-right:5px}
-        .dot.ok{background:#0f0}
-        .dot.err{background:#f00;animation:blink .3s infinite}
-        @keyframes blink{50%{opacity:.2}}
-        
-        #alertFull{display:none;position:fixed;inset:0;background:#ff0000;z-index:100;flex-direction:column;align-items:center;justify-content:center;animation:flash .5s infinite}
-        #alertFull.active{display:flex}
-        @keyframes flash{0%,100%{background:#ff0000}50%{background:#cc0000}}
-        #alertFull h1{font-size:3em;margin-bottom:20px}
-        #alertFull .msg{font-size:1.5em;text-align:center;padding:20px}
-        #alertFull button{margin-top:30px;padding:20px 50px;font-size:1.2em;background:#fff;color:#000;border:none;border-radius:10px;font-weight:bold}
-        
-        .main{flex:1;overflow-y:auto;padding:10px}
-        .card{background:rgba(255,255,255,0.08);border-radius:10px;padding:12px;margin-bottom:10px;border:1px solid rgba(255,255,255,0.1)}
-        .card.alert{border-color:#f00;background:rgba(255,0,0,0.15)}
-        .card-head{display:flex;justify-content:space-between;font-size:0.9em;margin-bottom:8px}
-        .badge{padding:2px 8px;border-radius:8px;font-size:0.7em;font-weight:bold}
-        .badge.on{background:#0f0;color:#000}
-        .badge.off{background:#666}
-        .temp{font-size:2.8em;text-align:center;font-weight:bold;padding:10px 0}
-        .temp.ok{color:#0f0}
-        .temp.warn{color:#ff9800}
-        .temp.crit{color:#f00}
-        .info{display:flex;justify-content:space-between;font-size:0.8em;color:#888}
-        .door{text-align:center;padding:6px;border-radius:5px;margin-top:8px;font-size:0.85em}
-        .door.c{background:rgba(0,255,0,0.1);color:#0f0}
-        .door.o{background:rgba(255,150,0,0.2);color:#ff9800}
-        
-        .foot{padding:8px;text-align:center;font-size:0.75em;color:#666;background:rgba(0,0,0,0.3)}
-        
-        #audioStatus{position:fixed;bottom:60px;left:50%;transform:translateX(-50%);background:rgba(0,0,0,0.8);padding:8px 20px;border-radius:20px;font-size:0.8em;display:none}
-    </style>
-</head>
-<body>
-    <div id="initScreen">
-        <h1>🏔️ PARAMETICAN SILVER</h1>
-        <p>Esta app monitorea los RIFTs y te alerta con sonido y vibracion.<br><br>
-        <strong>IMPORTANTE:</strong> Debes tocar el boton para activar el audio (requisito del navegador).</p>
-        <button id="startBtn" onclick="initApp()">🔔 ACTIVAR ALERTAS</button>
-    </div>
-    
-    <div id="app">
-        <div class="header"><h1>🏔️ MONITOR RIFT</h1></div>
-        <div class="status">
-            <span><span class="dot" id="dot"></span><span id="connTxt">...</span></span>
-            <span id="time">--:--</span>
-        </div>
-        <div class="main" id="cards"></div>
-        <div class="foot">Polling 5s | <span id="lastUp">--</span></div>
-    </div>
-    
-    <div id="alertFull">
-        <h1>⚠️ ALERTA</h1>
-        <div class="msg" id="alertMsg"></div>
-        <button onclick="ackAlert()">🔇 SILENCIAR</button>
-    </div>
-    
-    <div id="audioStatus">🔊 Audio activo</div>
-    
-    <script>
-    let audioCtx, oscillator, gainNode;
-    let alertActive = false;
-    let silenced = false;
-    let wakeLock = null;
-    
-    function initApp() {
-        document.getElementById('initScreen').style.display = 'none';
-        document.getElementById('app').classList.add('active');
-        
-        // Crear contexto de audio (DEBE ser en respuesta a click del usuario)
-        audioCtx = new (window.AudioContext || window.webkitAudioContext)();
-        
-        // Mostrar confirmacion
-        const status = document.getElementById('audioStatus');
-        status.style.display = 'block';
-        setTimeout(() => status.style.display = 'none', 2000);
-        
-        // Mantener pantalla encendida
-        requestWakeLock();
-        
-        // Iniciar polling
-        fetchData();
-        setInterval(fetchData, 5000);
-        
-        // Vibrar para confirmar
-        if(navigator.vibrate) navigator.vibrate(200);
-    }
-    
-    async function requestWakeLock() {
-        try {
-            if('wakeLock' in navigator) {
-                wakeLock = await navigator.wakeLock.request('screen');
-            }
-        } catch(e) {}
-    }
-    
-    async function fetchData() {
-        try {
-            const r = await fetch('/api/status');
-            const d = await r.json();
-            
-            document.getElementById('dot').className = 'dot ok';
-            document.getElementById('connTxt').textContent = 'OK';
-            document.getElementById('lastUp').textContent = new Date().toLocaleTimeString();
-            if(d.current_time) document.getElementById('time').textContent = d.current_time.split(' ')[1];
-            
-            renderCards(d.rifts);
-            checkAlerts(d.rifts);
-        } catch(e) {
-            document.getElementById('dot').className = 'dot err';
-            document.getElementById('connTxt').textContent = 'SIN CONEXION';
-        }
-    }
-    
-    function renderCards(rifts) {
-        const c = document.getElementById('cards');
-        c.innerHTML = rifts.filter(r=>r.online).map(r => {
-            const tc = r.temp_avg > -10 ? 'crit' : r.temp_avg > -18 ? 'warn' : 'ok';
-            const cc = r.alert_active ? 'card alert' : 'card';
-            return `<div class="${cc}">
-                <div class="card-head"><span>${r.name}</span><span class="badge on">ON</span></div>
-                <div class="temp ${tc}">${r.temp_avg.toFixed(1)}°</div>
-                <div class="info"><span>${r.location}</span><span>${r.rssi}dBm</span></div>
-                <div class="door ${r.door_open?'o':'c'}">${r.door_open?'🚪 ABIERTA':'🔒 Cerrada'}</div>
-            </div>`;
-        }).join('') || '<div style="text-align:center;color:#666;padding:40px">Sin RIFTs</div>';
-    }
-    
-    function checkAlerts(rifts) {
-        const hasAlert = rifts.some(r => r.alert_active);
-        const alertDiv = document.getElementById('alertFull');
-        
-        if(hasAlert && !silenced) {
-            if(!alertActive) {
-                alertActive = true;
-                alertDiv.classList.add('active');
-                
-                const msgs = rifts.filter(r=>r.alert_active).map(r=>`${r.name}: ${r.alert_message}`);
-                document.getElementById('alertMsg').innerHTML = msgs.join('<br>');
-                
-                startAlarm();
-                vibrateLoop();
-            }
-        } else if(!hasAlert) {
-            alertActive = false;
-            silenced = false;
-            alertDiv.classList.remove('active');
-            stopAlarm();
-        }
-    }
-    
-    function startAlarm() {
-        if(!audioCtx) return;
-        try {
-            // Crear oscilador para sirena
-            oscillator = audioCtx.createOscillator();
-            gainNode = audioCtx.createGain();
-            
-            oscillator.connect(gainNode);
-            gainNode.connect(audioCtx.destination);
-            
-            oscillator.type = 'square';
-            oscillator.frequency.value = 800;
-            gainNode.gain.value = 0.3;
-            
-            oscillator.start();
-            
-            // Modular frecuencia para efecto sirena
-            sirenLoop();
-        } catch(e) {}
-    }
-    
-    function sirenLoop() {
-        if(!oscillator || !alertActive || silenced) return;
-        
-        // Alternar entre 800Hz y 600Hz
-        const freq = oscillator.frequency.value === 800 ? 600 : 800;
-        oscillator.frequency.setValueAtTime(freq, audioCtx.currentTime);
-        
-        setTimeout(sirenLoop, 500);
-    }
-    
-    function stopAlarm() {
-        try {
-            if(oscillator) {
-                oscillator.stop();
-                oscillator.disconnect();
-                oscillator = null;
-            }
-        } catch(e) {}
-    }
-    
-    function vibrateLoop() {
-        if(!alertActive || silenced) return;
-        if(navigator.vibrate) {
-            navigator.vibrate([300,100,300,100,300]);
-        }
-        setTimeout(vibrateLoop, 2000);
-    }
-    
-    async function ackAlert() {
-        silenced = true;
-        stopAlarm();
-        document.getElementById('alertFull').classList.remove('active');
-        
-        try {
-            await fetch('/api/ack-alert', {method:'POST'});
-        } catch(e) {}
-        
-        if(navigator.vibrate) navigator.vibrate(100);
-    }
-    
-    // Reconectar wakeLock si se pierde
-    document.addEventListener('visibilitychange', () => {
-        if(document.visibilityState === 'visible' && !wakeLock) {
-            requestWakeLock();
-        }
-    });
-    </script>
-</body>
-</html>
-)rawliteral";
+  sendAsset(WEB_APP_GZ, WEB_APP_GZ_LEN, WEB_APP_MIME, WEB_APP_ETAG);
 }
@@ -0,0 +1,364 @@
+/*
+ * ============================================================================
+ * RIFT_PROTOCOL.H - Protocolo binario emisor → receptor
+ * ============================================================================
+ * Archivo compartido: emisor/rift_protocol.h y receptor/rift_protocol.h
+ * deben ser IDÉNTICOS (copiar uno sobre el otro al modificar).
+ *
+ * Una lectura = un datagrama UDP de 32 bytes (vs ~350 de JSON + headers
+ * HTTP + handshake TCP). Campos en little-endian (ESP8266 y ESP32 lo son),
+ * temperaturas en centésimas de grado, CRC-16/CCITT al final.
+ *
+ *   off  tam  campo
+ *    0    1   magic (0xA7)
+ *    1    1   versión
+ *    2    1   tipo (lectura / ACK)
+ *    3    1   rift_id
+ *    4    4   seq          (arranca en 1 en cada boot del emisor)
+ *    8    4   sender_ms    (millis() del emisor al armar el frame)
+ *   12    6   temp1, temp2, temp_avg (int16, x100, RIFT_TEMP_NONE = sin dato)
+ *   18    1   flags        (bit0 puerta abierta, bit1 pide ACK, bit2 reenvío)
+ *   19    1   sensor_count
+ *   20    2   door_open_sec
+ *   22    1   rssi (int8)
+ *   23    1   reservado
+ *   24    4   uptime_sec
+ *   28    2   send_failures (envíos fallidos acumulados, satura en 65535)
+ *   30    2   crc16 de los bytes 0..29
+ *
+ * ACK (14 bytes): magic, versión, tipo, rift_id, seq y sender_ms del frame
+ * confirmado + crc16. El receptor solo responde si el frame lo pide.
+ *
+ * Los mismos frames viajan por UDP (vía AP) o por ESP-NOW (directo entre
+ * placas, sin AP). ESP-NOW agrega el emparejamiento (20 bytes, broadcast
+ * sin cifrar):
+ *
+ *   off  tam  campo
+ *    0    4   magic, versión, tipo (PAIR_REQ / PAIR_ACK), rift_id
+ *    4    4   nonce        (lo elige el emisor; el receptor lo devuelve)
+ *    8    1   canal WiFi del receptor (solo PAIR_ACK)
+ *    9    1   reservado
+ *   10    8   tag SipHash-2-4(clave del sitio, bytes 0..9 + MAC del que envía)
+ *   18    2   crc16 de los bytes 0..17
+ *
+ * El tag prueba que ambos lados conocen la clave del sitio. Con el par
+ * aceptado, cada lado registra al otro como peer cifrado con la LMK
+ * derivada de la clave y la MAC del emisor (riftDeriveLmk): las lecturas
+ * y ACK por ESP-NOW van cifradas (CCMP en hardware).
+ *
+ * Del lado receptor RiftSeqTracker detecta pérdidas (huecos de seq),
+ * llegadas fuera de orden, duplicados y reinicios del emisor.
+ * ============================================================================
+ */
+
+#ifndef RIFT_PROTOCOL_H
+#define RIFT_PROTOCOL_H
+
+#include <Arduino.h>
+
+#define RIFT_UDP_PORT         4210
+#define RIFT_MAGIC            0xA7
+#define RIFT_VERSION          1
+
+#define RIFT_TYPE_READING     1
+#define RIFT_TYPE_ACK         2
+#define RIFT_TYPE_PAIR_REQ    3
+#define RIFT_TYPE_PAIR_ACK    4
+
+#define RIFT_FLAG_DOOR_OPEN   0x01
+#define RIFT_FLAG_ACK_REQ     0x02
+#define RIFT_FLAG_RETRY       0x04
+
+#define RIFT_TEMP_NONE        INT16_MIN   // Sensor ausente (-999 en el firmware)
+#define RIFT_SEQ_WINDOW       32          // Ventana para detectar desorden/duplicados
+
+// ============================================================================
+// FRAMES
+// ============================================================================
+
+struct __attribute__((packed)) RiftFrame {
+  uint8_t  magic;
+  uint8_t  version;
+  uint8_t  type;
+  uint8_t  riftId;
+  uint32_t seq;
+  uint32_t senderMs;
+  int16_t  temp1;
+  int16_t  temp2;
+  int16_t  tempAvg;
+  uint8_t  flags;
+  uint8_t  sensorCount;
+  uint16_t doorOpenSec;
+  int8_t   rssi;
+  uint8_t  reserved;
+  uint32_t uptimeSec;
+  uint16_t sendFailures;
+  uint16_t crc;
+};
+
+struct __attribute__((packed)) RiftAck {
+  uint8_t  magic;
+  uint8_t  version;
+  uint8_t  type;
+  uint8_t  riftId;
+  uint32_t seq;
+  uint32_t senderMs;
+  uint16_t crc;
+};
+
+struct __attribute__((packed)) RiftPair {
+  uint8_t  magic;
+  uint8_t  version;
+  uint8_t  type;
+  uint8_t  riftId;
+  uint32_t nonce;
+  uint8_t  channel;
+  uint8_t  reserved;
+  uint64_t tag;
+  uint16_t crc;
+};
+
+static_assert(sizeof(RiftFrame) == 32, "RiftFrame debe medir 32 bytes");
+static_assert(sizeof(RiftAck) == 14, "RiftAck debe medir 14 bytes");
+static_assert(sizeof(RiftPair) == 20, "RiftPair debe medir 20 bytes");
+
+// ============================================================================
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+// ============================================================================
+
+inline uint16_t riftCrc16(const uint8_t* data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  while (len--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t b = 0; b < 8; b++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+// ============================================================================
+// CODIFICACIÓN
+// ============================================================================
+
+inline int16_t riftEncodeTemp(float t) {
+  if (t <= -999.0f || t != t) return RIFT_TEMP_NONE;
+  float scaled = t * 100.0f;
+  if (scaled > 32767.0f) scaled = 32767.0f;
+  if (scaled < -32767.0f) scaled = -32767.0f;
+  return (int16_t)(scaled + (scaled >= 0 ? 0.5f : -0.5f));
+}
+
+inline float riftDecodeTemp(int16_t t) {
+  return t == RIFT_TEMP_NONE ? -999.0f : t / 100.0f;
+}
+
+inline void riftFinalizeFrame(RiftFrame& f) {
+  f.magic = RIFT_MAGIC;
+  f.version = RIFT_VERSION;
+  f.crc = riftCrc16((const uint8_t*)&f, sizeof(RiftFrame) - 2);
+}
+
+inline void riftFinalizeAck(RiftAck& a) {
+  a.magic = RIFT_MAGIC;
+  a.version = RIFT_VERSION;
+  a.type = RIFT_TYPE_ACK;
+  a.crc = riftCrc16((const uint8_t*)&a, sizeof(RiftAck) - 2);
+}
+
+// Valida largo, cabecera y CRC de un datagrama recibido
+inline bool riftFrameValid(const uint8_t* buf, size_t len, uint8_t type) {
+  size_t expected;
+  switch (type) {
+    case RIFT_TYPE_ACK:      expected = sizeof(RiftAck); break;
+    case RIFT_TYPE_PAIR_REQ:
+    case RIFT_TYPE_PAIR_ACK: expected = sizeof(RiftPair); break;
+    default:                 expected = sizeof(RiftFrame); break;
+  }
+  if (len != expected) return false;
+  if (buf[0] != RIFT_MAGIC || buf[1] != RIFT_VERSION || buf[2] != type) return false;
+  uint16_t crc = buf[len - 2] | (buf[len - 1] << 8);
+  return crc == riftCrc16(buf, len - 2);
+}
+
+// ============================================================================
+// EMPAREJAMIENTO ESP-NOW (SipHash-2-4, clave del sitio de 16 bytes)
+// ============================================================================
+
+inline uint64_t riftRotl(uint64_t x, int b) {
+  return (x << b) | (x >> (64 - b));
+}
+
+inline void riftSipRound(uint64_t& v0, uint64_t& v1, uint64_t& v2, uint64_t& v3) {
+  v0 += v1; v1 = riftRotl(v1, 13); v1 ^= v0; v0 = riftRotl(v0, 32);
+  v2 += v3; v3 = riftRotl(v3, 16); v3 ^= v2;
+  v0 += v3; v3 = riftRotl(v3, 21); v3 ^= v0;
+  v2 += v1; v1 = riftRotl(v1, 17); v1 ^= v2; v2 = riftRotl(v2, 32);
+}
+
+inline uint64_t riftLoad64(const uint8_t* p, size_t n) {
+  uint64_t v = 0;
+  for (size_t i = 0; i < n; i++) v |= (uint64_t)p[i] << (8 * i);
+  return v;
+}
+
+inline uint64_t riftSipHash(const uint8_t key[16], const uint8_t* in, size_t len) {
+  uint64_t k0 = riftLoad64(key, 8), k1 = riftLoad64(key + 8, 8);
+  uint64_t v0 = k0 ^ 0x736f6d6570736575ULL, v1 = k1 ^ 0x646f72616e646f6dULL;
+  uint64_t v2 = k0 ^ 0x6c7967656e657261ULL, v3 = k1 ^ 0x7465646279746573ULL;
+
+  size_t tail = len & 7;
+  const uint8_t* end = in + len - tail;
+  for (; in != end; in += 8) {
+    uint64_t m = riftLoad64(in, 8);
+    v3 ^= m;
+    riftSipRound(v0, v1, v2, v3);
+    riftSipRound(v0, v1, v2, v3);
+    v0 ^= m;
+  }
+  uint64_t b = ((uint64_t)len << 56) | riftLoad64(in, tail);
+  v3 ^= b;
+  riftSipRound(v0, v1, v2, v3);
+  riftSipRound(v0, v1, v2, v3);
+  v0 ^= b;
+
+  v2 ^= 0xff;
+  for (int i = 0; i < 4; i++) riftSipRound(v0, v1, v2, v3);
+  return v0 ^ v1 ^ v2 ^ v3;
+}
+
+// Tag de un RiftPair: bytes 0..9 + MAC de quien lo envía
+inline uint64_t riftPairTag(const uint8_t key[16], const RiftPair& p, const uint8_t mac[6]) {
+  uint8_t msg[16];
+  memcpy(msg, &p, 10);
+  memcpy(msg + 10, mac, 6);
+  return riftSipHash(key, msg, sizeof(msg));
+}
+
+inline void riftFinalizePair(RiftPair& p, const uint8_t key[16], const uint8_t senderMac[6]) {
+  p.magic = RIFT_MAGIC;
+  p.version = RIFT_VERSION;
+  p.reserved = 0;
+  p.tag = riftPairTag(key, p, senderMac);
+  p.crc = riftCrc16((const uint8_t*)&p, sizeof(RiftPair) - 2);
+}
+
+inline bool riftPairAuthentic(const RiftPair& p, const uint8_t key[16], const uint8_t senderMac[6]) {
+  return p.tag == riftPairTag(key, p, senderMac);
+}
+
+// LMK del enlace emisor↔receptor: ambos la calculan sin transmitirla
+inline void riftDeriveLmk(const uint8_t key[16], const uint8_t emisorMac[6], uint8_t lmk[16]) {
+  uint8_t msg[7];
+  memcpy(msg + 1, emisorMac, 6);
+  for (uint8_t half = 0; half < 2; half++) {
+    msg[0] = 'L' + half;
+    uint64_t h = riftSipHash(key, msg, sizeof(msg));
+    for (int i = 0; i < 8; i++) lmk[half * 8 + i] = (uint8_t)(h >> (8 * i));
+  }
+}
+
+// ============================================================================
+// SECUENCIA (lado receptor)
+// ============================================================================
+
+enum RiftSeqResult {
+  RIFT_SEQ_NEW = 0,       // Más nuevo que todo lo visto: aplicar
+  RIFT_SEQ_LATE,          // Llegó fuera de orden: al historial por timestamp, no pisar el estado
+  RIFT_SEQ_DUPLICATE,     // Ya recibido (reenvío tras ACK perdido)
+  RIFT_SEQ_RESTART        // El emisor reinició: se toma como nuevo
+};
+
+struct RiftSeqTracker {
+  bool started;
+  uint32_t highest;       // Mayor seq recibido
+  uint32_t window;        // Bit i = se recibió (highest - i)
+  uint32_t lastSenderMs;
+  uint32_t firstSenderMs; // sender_ms del primer frame desde el último reset
+  uint32_t received;
+  uint32_t lost;          // Huecos aún no rellenados
+  uint32_t reordered;
+  uint32_t duplicates;
+  uint32_t restarts;
+};
+
+inline void riftSeqReset(RiftSeqTracker& t, uint32_t seq, uint32_t senderMs) {
+  t.started = true;
+  t.highest = seq;
+  t.window = 1;
+  t.lastSenderMs = senderMs;
+  t.firstSenderMs = senderMs;
+}
+
+inline RiftSeqResult riftSeqAccept(RiftSeqTracker& t, uint32_t seq, uint32_t senderMs) {
+  if (!t.started) {
+    riftSeqReset(t, seq, senderMs);
+    t.received++;
+    return RIFT_SEQ_NEW;
+  }
+
+  if (seq > t.highest) {
+    uint32_t gap = seq - t.highest;
+    t.lost += gap - 1;
+    t.window = gap >= RIFT_SEQ_WINDOW ? 1 : (t.window << gap) | 1;
+    t.highest = seq;
+    t.lastSenderMs = senderMs;
+    t.received++;
+    return RIFT_SEQ_NEW;
+  }
+
+  uint32_t diff = t.highest - seq;
+  // seq menor y reloj del emisor anterior a todo lo visto en esta sesión
+  // (un frame atrasado de la misma sesión nunca lo es): reinició
+  if (senderMs < t.lastSenderMs && (diff >= RIFT_SEQ_WINDOW || senderMs < t.firstSenderMs)) {
+    t.restarts++;
+    riftSeqReset(t, seq, senderMs);
+    t.received++;
+    return RIFT_SEQ_RESTART;
+  }
+
+  if (diff < RIFT_SEQ_WINDOW) {
+    uint32_t bit = 1UL << diff;
+    if (t.window & bit) {
+      t.duplicates++;
+      return RIFT_SEQ_DUPLICATE;
+    }
+    t.window |= bit;
+    if (t.lost > 0) t.lost--;   // Era un hueco: no se perdió, llegó tarde
+    t.reordered++;
+    t.received++;
+    return RIFT_SEQ_LATE;
+  }
+
+  // Más viejo que la ventana: no se puede saber si es duplicado
+  t.duplicates++;
+  return RIFT_SEQ_DUPLICATE;
+}
+
+// Lectura diferida (reenvío desde el buffer del emisor): nunca pasa a ser
+// la actual ni mueve highest; solo descarta duplicados y rellena huecos.
+// Fuera de la ventana no ve duplicados: el que llama los descarta antes
+// por RIFT y hora (sino una repetida se guarda dos veces y baja lost)
+inline bool riftSeqBackfill(RiftSeqTracker& t, uint32_t seq) {
+  if (!t.started || seq > t.highest) return true;
+  uint32_t diff = t.highest - seq;
+  if (diff < RIFT_SEQ_WINDOW) {
+    uint32_t bit = 1UL << diff;
+    if (t.window & bit) {
+      t.duplicates++;
+      return false;
+    }
+    t.window |= bit;
+  }
+  if (t.lost > 0) t.lost--;
+  t.received++;
+  return true;
+}
+
+// Pérdida en % sobre lo esperado (recibidos + huecos)
+inline float riftSeqLossPct(const RiftSeqTracker& t) {
+  uint32_t expected = t.received + t.lost;
+  return expected ? 100.0f * t.lost / expected : 0.0f;
+}
+
+#endif // RIFT_PROTOCOL_H
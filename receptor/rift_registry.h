@@ -0,0 +1,352 @@
+/*
+ * RIFT_REGISTRY.H - Registro dinámico de RIFTs del receptor
+ *
+ * Reemplaza los arreglos fijos indexados por rift_id - 1 (MAX_RIFTS = 6).
+ *
+ *  - Tabla hash de direccionamiento abierto (sondeo lineal) por rift_id.
+ *    Al borrar se corren los elementos siguientes (sin lápidas), así la
+ *    búsqueda nunca recorre más que el racimo donde cae el id.
+ *  - Cada RIFT ocupa un RiftData completo (estado, historial, secuencia,
+ *    par ESP-NOW). Los slots se piden al heap a medida que aparecen RIFTs,
+ *    hasta RIFT_MEMORY_BUDGET y siempre que queden RIFT_HEAP_RESERVE libres
+ *    para los handlers y el TLS de Supabase; los liberados quedan en una
+ *    lista para reusar (mismo tamaño, sin fragmentar).
+ *  - Un RIFT offline más de RIFT_EVICT_AFTER_MS (timer del sketch, ver
+ *    riftEvictIfIdle) o el más viejo, si falta lugar para uno nuevo, se
+ *    guarda en SPIFFS (/rift_<id>.bin) y se libera su slot. Si vuelve a
+ *    transmitir se restaura con su historial.
+ *  - riftActive[0..riftActiveCount) es la lista densa de RIFTs en memoria:
+ *    alertas, chequeos y handlers recorren solo esa lista.
+ *
+ * Con RIFT activo y alerta sin resolver nunca se desaloja (no se pierde la
+ * alarma local).
+ */
+
+#ifndef RIFT_REGISTRY_H
+#define RIFT_REGISTRY_H
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include "rift_protocol.h"
+#include "timer_wheel.h"
+
+// ============================================
+// CONFIGURACIÓN
+// ============================================
+#define RIFT_TABLE_SIZE 128                      // Potencia de 2; tope de RIFTs en memoria = mitad
+#define RIFT_MEMORY_BUDGET (128UL * 1024)        // Heap máximo para slots (~40 RIFTs de ~3.1 KB)
+#define RIFT_HEAP_RESERVE (72UL * 1024)          // Libre que no se toca: TLS de Supabase (~45 KB) o /api/data/batch (cuerpo + doc)
+#define RIFT_EVICT_AFTER_MS (6UL * 3600 * 1000)  // Offline más de esto → a flash
+#define MAX_HISTORY 360                          // Puntos por RIFT (3 h a 30 seg); backfill más viejo: directo a Supabase
+#define RIFT_ARCHIVE_MAGIC 0x52524731            // "RRG1"
+
+// ============================================
+// DATOS POR RIFT
+// ============================================
+
+// Temperatura en centésimas (como en el frame binario): 8 bytes por punto
+#define HISTORY_FLAG_SYNCED 0x01   // Ya subido a Supabase
+struct __attribute__((packed)) HistoryPoint {
+  uint32_t timestamp;        // millis() del receptor; 0 = vacío
+  int16_t temperature;
+  uint8_t doorOpen;
+  uint8_t flags;
+};
+
+struct EspNowPeer {
+  uint8_t mac[6];
+  bool paired;
+  int8_t rssi;
+  float rssiAvg;
+  unsigned long frames;
+  unsigned long lastSeen;
+  unsigned long pairings;
+};
+
+// Sin String: el slot se guarda y restaura tal cual desde flash (los
+// timers se desenganchan antes de archivar y se limpian al restaurar)
+struct RiftData {
+  uint16_t id;
+  char name[16];
+  char location[32];
+  float temp1, temp2, tempAvg;
+  bool doorOpen;
+  unsigned long doorOpenSince;
+  int sensorCount, rssi;
+  unsigned long lastUpdate;
+  bool online, alertActive;
+  bool alertCritical;        // Alerta con temp > crítica (sirena)
+  char alertMessage[48];
+  unsigned long alertStartTime;
+  unsigned long highTempStart;
+  uint8_t transport;         // IngestSource de la última lectura (0xFF = ninguna)
+  unsigned long lastLog;
+  RiftSeqTracker seq;
+  EspNowPeer espnow;
+  TimerNode linkTimer;       // Offline por silencio y después desalojo
+  TimerNode alertTimer;      // Demora de la alerta por temp alta
+  uint16_t activeIndex;      // Posición en riftActive[]
+  uint16_t historyIndex;
+  uint32_t syncedTs;         // Marca de agua: puntos con timestamp <= esto ya subidos
+  HistoryPoint history[MAX_HISTORY];
+};
+
+struct RiftArchiveHeader {
+  uint32_t magic;
+  uint32_t slotSize;         // Cambió RiftData (otro firmware) → se descarta
+  uint16_t id;
+  uint16_t reserved;
+  uint32_t boot;             // Otro arranque: millis() del historial ya no sirve
+};
+
+struct RiftRegistryStats {
+  uint16_t maxSlots;
+  uint16_t allocated;        // Slots pedidos al heap (activos + libres)
+  uint16_t archived;         // Archivos /rift_<id>.bin en SPIFFS
+  uint16_t maxProbe;         // Racimo más largo recorrido en una búsqueda
+  unsigned long evicted, restored, rejected, archiveErrors;
+  unsigned long heapLimited;  // Slot nuevo negado por RIFT_HEAP_RESERVE
+};
+
+// Hooks del sketch (ej. timers, liberar/volver a registrar el par ESP-NOW)
+void riftOnCreate(RiftData& r);
+void riftOnEvict(RiftData& r);
+void riftOnRestore(RiftData& r);
+
+// ============================================
+// ESTADO
+// ============================================
+RiftData* riftTable[RIFT_TABLE_SIZE];
+RiftData* riftActive[RIFT_TABLE_SIZE / 2];
+uint16_t riftActiveCount = 0;
+RiftData* riftFreeSlots[RIFT_TABLE_SIZE / 2];
+uint16_t riftFreeCount = 0;
+RiftRegistryStats riftStats = {};
+uint32_t riftBootId = 0;
+
+// ============================================
+// TABLA HASH
+// ============================================
+
+inline uint16_t riftHash(uint16_t id) {
+  // Fibonacci: ids consecutivos quedan repartidos por la tabla
+  return (uint16_t)((id * 40503u) >> 4) & (RIFT_TABLE_SIZE - 1);
+}
+
+RiftData* riftFind(uint16_t id) {
+  uint16_t pos = riftHash(id);
+  for (uint16_t n = 0; n < RIFT_TABLE_SIZE; n++) {
+    RiftData* r = riftTable[pos];
+    if (!r) return nullptr;
+    if (r->id == id) {
+      if (n + 1 > riftStats.maxProbe) riftStats.maxProbe = n + 1;
+      return r;
+    }
+    pos = (pos + 1) & (RIFT_TABLE_SIZE - 1);
+  }
+  return nullptr;
+}
+
+void riftTableInsert(RiftData* r) {
+  uint16_t pos = riftHash(r->id);
+  while (riftTable[pos]) pos = (pos + 1) & (RIFT_TABLE_SIZE - 1);
+  riftTable[pos] = r;
+}
+
+// Borrado con corrimiento hacia atrás: cada elemento del racimo que no
+// quedaría alcanzable desde su posición ideal se mueve al hueco
+void riftTableRemove(uint16_t id) {
+  uint16_t pos = riftHash(id);
+  while (riftTable[pos] && riftTable[pos]->id != id) pos = (pos + 1) & (RIFT_TABLE_SIZE - 1);
+  if (!riftTable[pos]) return;
+
+  uint16_t hole = pos;
+  riftTable[hole] = nullptr;
+  for (pos = (hole + 1) & (RIFT_TABLE_SIZE - 1); riftTable[pos]; pos = (pos + 1) & (RIFT_TABLE_SIZE - 1)) {
+    uint16_t ideal = riftHash(riftTable[pos]->id);
+    // ¿ideal está fuera del tramo circular (hole, pos]?
+    bool movable = hole <= pos ? (ideal <= hole || ideal > pos) : (ideal <= hole && ideal > pos);
+    if (movable) {
+      riftTable[hole] = riftTable[pos];
+      riftTable[pos] = nullptr;
+      hole = pos;
+    }
+  }
+}
+
+// ============================================
+// SLOTS
+// ============================================
+
+void riftDefaults(RiftData& r, uint16_t id) {
+  static const char* locs[] = {"Deposito Principal", "Deposito Carnes", "Deposito Lacteos",
+                               "Deposito Verduras", "Deposito Bebidas", "Deposito Reserva"};
+  memset(&r, 0, sizeof(r));
+  r.id = id;
+  snprintf(r.name, sizeof(r.name), "RIFT-%02u", id);
+  if (id >= 1 && id <= 6) strlcpy(r.location, locs[id - 1], sizeof(r.location));
+  r.temp1 = r.temp2 = r.tempAvg = -999.0;
+  r.transport = 0xFF;
+}
+
+String riftArchivePath(uint16_t id) {
+  return "/rift_" + String(id) + ".bin";
+}
+
+void riftActivate(RiftData* r) {
+  r->activeIndex = riftActiveCount;
+  riftActive[riftActiveCount++] = r;
+  riftTableInsert(r);
+}
+
+void riftDeactivate(RiftData* r) {
+  riftTableRemove(r->id);
+  RiftData* last = riftActive[--riftActiveCount];
+  riftActive[r->activeIndex] = last;
+  last->activeIndex = r->activeIndex;
+  riftFreeSlots[riftFreeCount++] = r;
+}
+
+bool riftArchive(RiftData& r) {
+  File f = SPIFFS.open(riftArchivePath(r.id), "w");
+  if (!f) return false;
+  RiftArchiveHeader h = {RIFT_ARCHIVE_MAGIC, sizeof(RiftData), r.id, 0, riftBootId};
+  bool ok = f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+            f.write((const uint8_t*)&r, sizeof(r)) == sizeof(r);
+  f.close();
+  if (!ok) SPIFFS.remove(riftArchivePath(r.id));
+  return ok;
+}
+
+bool riftRestore(RiftData& r, uint16_t id) {
+  String path = riftArchivePath(id);
+  File f = SPIFFS.open(path, "r");
+  if (!f) return false;
+  RiftArchiveHeader h;
+  bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+            h.magic == RIFT_ARCHIVE_MAGIC && h.slotSize == sizeof(RiftData) && h.id == id &&
+            f.read((uint8_t*)&r, sizeof(r)) == sizeof(r) && r.id == id;
+  f.close();
+  SPIFFS.remove(path);
+  if (riftStats.archived) riftStats.archived--;
+  r.linkTimer = TimerNode();
+  r.alertTimer = TimerNode();
+  r.highTempStart = 0;
+  if (ok && h.boot != riftBootId) {
+    // Archivado antes de reiniciar: se conservan nombre y par ESP-NOW
+    memset(r.history, 0, sizeof(r.history));
+    memset(&r.seq, 0, sizeof(r.seq));
+    r.historyIndex = 0;
+    r.syncedTs = 0;
+    r.lastUpdate = r.alertStartTime = r.highTempStart = r.lastLog = 0;
+    r.espnow.lastSeen = 0;
+  }
+  return ok;
+}
+
+// Guarda en flash y libera el slot
+void riftEvict(RiftData* r) {
+  riftOnEvict(*r);
+  if (riftArchive(*r)) {
+    riftStats.archived++;
+  } else {
+    riftStats.archiveErrors++;
+    Serial.println("[REGISTRY] ✗ No se pudo archivar " + String(r->name) + " (se pierde su historial)");
+  }
+  riftStats.evicted++;
+  Serial.println("[REGISTRY] " + String(r->name) + " a flash (offline " +
+                 String((millis() - r->lastUpdate) / 60000) + " min)");
+  riftDeactivate(r);
+}
+
+// Candidato a desalojar: offline, sin alerta, el que hace más que no transmite
+RiftData* riftOldestOffline() {
+  RiftData* oldest = nullptr;
+  for (uint16_t i = 0; i < riftActiveCount; i++) {
+    RiftData* r = riftActive[i];
+    if (r->online || r->alertActive) continue;
+    if (!oldest || millis() - r->lastUpdate > millis() - oldest->lastUpdate) oldest = r;
+  }
+  return oldest;
+}
+
+RiftData* riftAllocSlot() {
+  if (riftFreeCount > 0) return riftFreeSlots[--riftFreeCount];
+  if (riftStats.allocated < riftStats.maxSlots) {
+    if (ESP.getFreeHeap() < sizeof(RiftData) + RIFT_HEAP_RESERVE) {
+      riftStats.heapLimited++;
+    } else {
+      RiftData* r = (RiftData*)malloc(sizeof(RiftData));
+      if (r) {
+        riftStats.allocated++;
+        return r;
+      }
+    }
+  }
+  // Sin presupuesto (o sin heap): se hace lugar con el RIFT más olvidado
+  RiftData* victim = riftOldestOffline();
+  if (!victim) return nullptr;
+  riftEvict(victim);
+  return riftFreeSlots[--riftFreeCount];
+}
+
+// ============================================
+// API
+// ============================================
+
+void riftRegistryInit() {
+  memset(riftTable, 0, sizeof(riftTable));
+  riftActiveCount = 0;
+  riftFreeCount = 0;
+  riftStats = RiftRegistryStats();
+  riftBootId = esp_random();
+
+  uint32_t slots = RIFT_MEMORY_BUDGET / sizeof(RiftData);
+  riftStats.maxSlots = slots < RIFT_TABLE_SIZE / 2 ? slots : RIFT_TABLE_SIZE / 2;
+
+  File root = SPIFFS.open("/");
+  for (File f = root.openNextFile(); f; f = root.openNextFile()) {
+    String name = f.name();
+    if (name.indexOf("rift_") >= 0 && name.endsWith(".bin")) riftStats.archived++;
+  }
+
+  Serial.printf("[REGISTRY] %u bytes por RIFT, hasta %u en memoria, %u en flash\n",
+                (unsigned)sizeof(RiftData), riftStats.maxSlots, riftStats.archived);
+}
+
+// RIFT por id: el de memoria, el archivado en flash o uno nuevo.
+// nullptr si no hay lugar (todos online o con alerta)
+RiftData* riftGetOrCreate(uint16_t id) {
+  if (id == 0) return nullptr;
+  RiftData* r = riftFind(id);
+  if (r) return r;
+
+  r = riftAllocSlot();
+  if (!r) {
+    riftStats.rejected++;
+    return nullptr;
+  }
+
+  if (riftRestore(*r, id)) {
+    r->online = false;
+    riftStats.restored++;
+    riftActivate(r);
+    riftOnRestore(*r);
+    Serial.println("[REGISTRY] " + String(r->name) + " restaurado desde flash");
+  } else {
+    riftDefaults(*r, id);
+    riftActivate(r);
+    riftOnCreate(*r);
+    Serial.println("[REGISTRY] Nuevo " + String(r->name) + " (" + String(riftActiveCount) + " activos)");
+  }
+  return r;
+}
+
+// Vencimiento del timer de desalojo: pasa a flash si sigue sin transmitir
+bool riftEvictIfIdle(RiftData* r) {
+  if (r->online || r->alertActive) return false;
+  riftEvict(r);
+  return true;
+}
+
+#endif
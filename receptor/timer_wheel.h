@@ -0,0 +1,157 @@
+/*
+ * TIMER_WHEEL.H - Rueda de timers jerárquica del receptor
+ *
+ * Vencimientos por RIFT (offline, demora de alerta, desalojo a flash) sin
+ * recorrer todos los RIFTs en cada vuelta del loop.
+ *
+ *  - 4 niveles de 64 ranuras; tick de TW_TICK_MS:
+ *      nivel 0: 64 ticks (6.4 seg)      nivel 2: 64^3 ticks (7.3 h)
+ *      nivel 1: 64^2 ticks (6.8 min)    nivel 3: 64^4 ticks (19 días)
+ *  - Agregar y cancelar es O(1) (lista doble intrusiva: el nodo vive dentro
+ *    del dueño, no se pide memoria).
+ *  - Cada tick procesa solo su ranura del nivel 0; cada 64 ticks se
+ *    reparte una ranura del nivel siguiente hacia abajo (cascada).
+ *
+ * twRun() en el loop cuesta O(ticks transcurridos + timers vencidos).
+ * Los ticks salen de la diferencia sin signo entre lecturas de millis()
+ * (el resto se arrastra): el desborde a los 49.7 días no frena la rueda.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <Arduino.h>
+
+#define TW_TICK_MS 100
+#define TW_BITS 6
+#define TW_SLOTS (1 << TW_BITS)
+#define TW_MASK (TW_SLOTS - 1)
+#define TW_LEVELS 4
+
+struct TimerNode {
+  TimerNode* next;
+  TimerNode** pprev;         // nullptr = no programado
+  uint32_t expires;          // En ticks
+  uint8_t kind;              // Lo interpreta el callback
+  void* owner;
+};
+
+typedef void (*TimerCallback)(TimerNode* t);
+
+struct TimerWheelStats {
+  unsigned long scheduled, fired, cancelled, cascaded;
+  uint16_t pending;
+};
+
+TimerNode* twSlots[TW_LEVELS][TW_SLOTS];
+uint32_t twTick = 0;             // Próximo tick a procesar
+uint32_t twNow = 0;              // Tick actual, contado desde twInit()
+uint32_t twLastMs = 0;           // millis() ya convertido en ticks
+TimerCallback twCallback = nullptr;
+TimerWheelStats twStats = {};
+
+inline bool twPending(const TimerNode& t) {
+  return t.pprev != nullptr;
+}
+
+void twLink(TimerNode* t) {
+  uint32_t delta = t->expires - twTick;
+  TimerNode** head;
+  if ((int32_t)delta < 0) {
+    head = &twSlots[0][twTick & TW_MASK];   // Ya vencido: próximo tick
+  } else if (delta < (1UL << TW_BITS)) {
+    head = &twSlots[0][t->expires & TW_MASK];
+  } else if (delta < (1UL << (2 * TW_BITS))) {
+    head = &twSlots[1][(t->expires >> TW_BITS) & TW_MASK];
+  } else if (delta < (1UL << (3 * TW_BITS))) {
+    head = &twSlots[2][(t->expires >> (2 * TW_BITS)) & TW_MASK];
+  } else {
+    if (delta >= (1UL << (4 * TW_BITS))) t->expires = twTick + (1UL << (4 * TW_BITS)) - 1;
+    head = &twSlots[3][(t->expires >> (3 * TW_BITS)) & TW_MASK];
+  }
+  t->next = *head;
+  if (t->next) t->next->pprev = &t->next;
+  t->pprev = head;
+  *head = t;
+}
+
+void twUnlink(TimerNode* t) {
+  *t->pprev = t->next;
+  if (t->next) t->next->pprev = t->pprev;
+  t->next = nullptr;
+  t->pprev = nullptr;
+}
+
+void twInit(TimerCallback cb) {
+  memset(twSlots, 0, sizeof(twSlots));
+  twTick = 0;
+  twNow = 0;
+  twLastMs = millis();
+  twCallback = cb;
+  twStats = TimerWheelStats();
+}
+
+// Cancela si estaba programado
+void twCancel(TimerNode& t) {
+  if (!twPending(t)) return;
+  twUnlink(&t);
+  twStats.cancelled++;
+  twStats.pending--;
+}
+
+// (Re)programa t para dentro de delayMs
+void twSchedule(TimerNode& t, unsigned long delayMs) {
+  if (twPending(t)) {
+    twUnlink(&t);
+  } else {
+    twStats.pending++;
+  }
+  t.expires = twTick + (delayMs + TW_TICK_MS - 1) / TW_TICK_MS;
+  twLink(&t);
+  twStats.scheduled++;
+}
+
+// Reparte una ranura de un nivel superior; true si era la ranura 0
+// (entonces también toca bajar el nivel siguiente)
+bool twCascade(uint8_t level) {
+  uint8_t idx = (twTick >> (level * TW_BITS)) & TW_MASK;
+  TimerNode* t = twSlots[level][idx];
+  twSlots[level][idx] = nullptr;
+  while (t) {
+    TimerNode* next = t->next;
+    twLink(t);
+    twStats.cascaded++;
+    t = next;
+  }
+  return idx == 0;
+}
+
+// Llamar en cada vuelta del loop
+void twRun() {
+  uint32_t ticks = ((uint32_t)millis() - twLastMs) / TW_TICK_MS;
+  twLastMs += ticks * TW_TICK_MS;
+  twNow += ticks;
+  while ((int32_t)(twNow - twTick) >= 0) {
+    uint8_t idx = twTick & TW_MASK;
+    if (idx == 0) {
+      for (uint8_t level = 1; level < TW_LEVELS && twCascade(level); level++) {}
+    }
+
+    // Se desengancha la ranura entera: los callbacks pueden reprogramar
+    // (incluso para este mismo tick, que cae en la próxima vuelta)
+    TimerNode* expired = twSlots[0][idx];
+    twSlots[0][idx] = nullptr;
+    if (expired) expired->pprev = &expired;
+    twTick++;
+
+    while (expired) {
+      TimerNode* t = expired;
+      twUnlink(t);
+      twStats.pending--;
+      twStats.fired++;
+      if (twCallback) twCallback(t);
+    }
+  }
+}
+
+#endif
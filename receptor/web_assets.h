@@ -0,0 +1,518 @@
+/*
+ * WEB_ASSETS.H - Páginas web comprimidas (GENERADO, no editar)
+ *
+ * Regenerar con: python3 tools/gen_web_assets.py
+ *
+ *   WEB_INDEX  receptor/data/index.html      21017 →  4577 bytes gzip
+ *   WEB_APP    receptor/data/app.html        10183 →  3252 bytes gzip
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+#define WEB_INDEX_MIME "text/html"
+#define WEB_INDEX_ETAG "\"4b9245b5291acbd0\""
+#define WEB_INDEX_GZ_LEN 4577
+const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3c, 0x5b, 0x6f, 0xe3, 0xc6,
+  0xd5, 0xef, 0xf9, 0x15, 0x13, 0x65, 0x77, 0x29, 0x35, 0xa2, 0x44, 0x49, 0x96, 0x63, 0x5b, 0x96,
+  0x53, 0xc7, 0xd9, 0x4d, 0x5d, 0xac, 0x77, 0x8d, 0xb5, 0xb7, 0x45, 0x9f, 0x76, 0x47, 0xe2, 0x50,
+  0x9a, 0x2c, 0x45, 0xb2, 0x24, 0xe5, 0x4b, 0xbd, 0xfe, 0x03, 0x05, 0x8a, 0x02, 0x6d, 0x5e, 0xda,
+  0x97, 0xb4, 0x6f, 0x45, 0x81, 0x02, 0x01, 0x3e, 0xe0, 0x43, 0x9f, 0xfa, 0x90, 0xfc, 0x93, 0xfe,
+  0x81, 0x2f, 0x3f, 0xe1, 0x3b, 0x33, 0xc3, 0xcb, 0x90, 0x1c, 0x5e, 0xe4, 0xf5, 0xb6, 0x41, 0xab,
+  0xbd, 0x98, 0x97, 0x99, 0x33, 0xe7, 0x36, 0xe7, 0x36, 0x47, 0xde, 0xff, 0xf0, 0xf3, 0xe7, 0x47,
+  0xe7, 0xbf, 0x38, 0x7d, 0x8c, 0x96, 0xe1, 0xca, 0x3e, 0xf8, 0x60, 0x9f, 0xfd, 0x40, 0x36, 0x76,
+  0x16, 0xd3, 0x16, 0x09, 0x5a, 0xec, 0x01, 0xc1, 0xe6, 0xc1, 0x07, 0x08, 0x3e, 0xfb, 0x2b, 0x12,
+  0x62, 0x34, 0x5f, 0x62, 0x3f, 0x20, 0xe1, 0xb4, 0xf5, 0xf2, 0xfc, 0x89, 0xbe, 0xd3, 0x92, 0x5f,
+  0x39, 0x78, 0x45, 0xa6, 0xad, 0x0b, 0x4a, 0x2e, 0x3d, 0xd7, 0x0f, 0x5b, 0x68, 0xee, 0x3a, 0x21,
+  0x71, 0x60, 0xe8, 0x25, 0x35, 0xc3, 0xe5, 0xd4, 0x24, 0x17, 0x74, 0x4e, 0x74, 0x7e, 0xd3, 0x45,
+  0xd4, 0xa1, 0x21, 0xc5, 0xb6, 0x1e, 0xcc, 0xb1, 0x4d, 0xa6, 0x83, 0x9e, 0x11, 0x83, 0x0a, 0x69,
+  0x68, 0x93, 0x83, 0x23, 0xbc, 0xf2, 0x00, 0x9c, 0x13, 0xba, 0xe8, 0x14, 0xfb, 0x70, 0x15, 0xd2,
+  0x39, 0x76, 0xd0, 0x19, 0xb5, 0x2f, 0x88, 0x8f, 0x74, 0x74, 0xe2, 0xc2, 0x7c, 0xd7, 0xdf, 0xef,
+  0x8b, 0xe1, 0x62, 0x6a, 0x10, 0x5e, 0xc7, 0xd7, 0xec, 0xf3, 0x23, 0x74, 0x83, 0x56, 0xd8, 0x5f,
+  0x50, 0x67, 0x0f, 0x19, 0x13, 0xe4, 0x61, 0xd3, 0xa4, 0xce, 0x82, 0x5f, 0xcf, 0xdc, 0x2b, 0x3d,
+  0xa0, 0xbf, 0xe2, 0xb7, 0x33, 0xd7, 0x37, 0x89, 0xaf, 0xc3, 0xa3, 0x09, 0xba, 0x4d, 0x26, 0x27,
+  0x17, 0x33, 0xd7, 0xbc, 0x46, 0x37, 0xc9, 0x2d, 0xfb, 0x58, 0x40, 0x98, 0x6e, 0xe1, 0x15, 0xb5,
+  0xaf, 0xf7, 0x90, 0x76, 0x46, 0x16, 0x2e, 0x41, 0x2f, 0x8f, 0xb5, 0x2e, 0x3a, 0xc7, 0x4b, 0x77,
+  0x85, 0xbb, 0x28, 0xc0, 0x4e, 0xa0, 0x07, 0xc4, 0xa7, 0xd6, 0x24, 0x33, 0x71, 0x86, 0xe7, 0x6f,
+  0x16, 0xbe, 0xbb, 0x76, 0xcc, 0x3d, 0x64, 0x53, 0x87, 0x60, 0x5f, 0x5f, 0xf8, 0xd8, 0xa4, 0x40,
+  0x67, 0x7b, 0x30, 0x1a, 0x9b, 0x64, 0xd1, 0x45, 0x1f, 0x0d, 0xf0, 0x00, 0x0f, 0x09, 0x32, 0x1e,
+  0xb2, 0xeb, 0xed, 0xe1, 0x60, 0x44, 0xd0, 0xc0, 0x30, 0x1e, 0x76, 0xb2, 0xa0, 0xe6, 0xae, 0xed,
+  0xfa, 0x7b, 0xe8, 0x23, 0xcb, 0xca, 0xad, 0xb1, 0xa2, 0x8e, 0xbe, 0x24, 0x74, 0xb1, 0x0c, 0xf7,
+  0xd8, 0xbc, 0x8b, 0x65, 0xfa, 0x5a, 0x41, 0x5d, 0x8f, 0xc9, 0x17, 0x38, 0x7a, 0xd3, 0x18, 0xcf,
+  0x5d, 0x43, 0xa0, 0x69, 0x58, 0xa3, 0xad, 0x6d, 0x43, 0xa0, 0x39, 0x1e, 0x8d, 0xb6, 0x76, 0x46,
+  0x2a, 0x34, 0x13, 0xa6, 0x0f, 0x0d, 0xef, 0x2a, 0xfb, 0x2a, 0x24, 0x57, 0xa1, 0x8e, 0x6d, 0xba,
+  0x00, 0xf1, 0xcc, 0x01, 0x32, 0xf1, 0x73, 0xcc, 0x62, 0x32, 0x5a, 0x62, 0xd3, 0xbd, 0x04, 0x91,
+  0xa1, 0x2d, 0xef, 0x8a, 0xc3, 0x40, 0xfe, 0x62, 0x86, 0xdb, 0x46, 0x97, 0xff, 0xe9, 0x8d, 0x3a,
+  0x8d, 0xa8, 0x5b, 0x0e, 0x40, 0x15, 0xb8, 0xd4, 0x40, 0xe8, 0x04, 0xf8, 0xd2, 0xdb, 0x21, 0xab,
+  0x49, 0xa4, 0x1c, 0x20, 0xf9, 0x30, 0x74, 0x57, 0x7b, 0x68, 0xec, 0x65, 0x34, 0x20, 0x9e, 0xdc,
+  0x0b, 0xd6, 0x33, 0xae, 0x65, 0x00, 0x23, 0xe6, 0x3a, 0xc6, 0x78, 0x22, 0x03, 0x34, 0x7a, 0xbb,
+  0x0c, 0xa0, 0x62, 0xf2, 0xdc, 0x05, 0xf5, 0x0a, 0xa4, 0xa9, 0x64, 0x77, 0x6b, 0xbc, 0x6d, 0xe4,
+  0x66, 0xcb, 0xe8, 0x84, 0xae, 0x57, 0xc0, 0x25, 0x85, 0x1b, 0x84, 0x38, 0x5c, 0x07, 0xfa, 0x0c,
+  0xe7, 0x65, 0x66, 0xd2, 0xc0, 0xb3, 0x31, 0x28, 0xa4, 0x65, 0x93, 0x1c, 0xa7, 0xbf, 0x5c, 0x07,
+  0x21, 0xb5, 0xae, 0xf5, 0x68, 0x43, 0xaa, 0xd9, 0xbd, 0xc0, 0xb0, 0xec, 0xa8, 0x20, 0xa5, 0x44,
+  0x80, 0x83, 0x71, 0xfe, 0x95, 0xac, 0x25, 0xa5, 0x52, 0xe1, 0xfb, 0x05, 0x30, 0xd2, 0x2f, 0x7d,
+  0xb6, 0x00, 0xfb, 0xbf, 0x5a, 0x64, 0x11, 0x81, 0x34, 0x24, 0x2b, 0xe0, 0x5a, 0x96, 0x2a, 0xc4,
+  0xd5, 0x85, 0xbf, 0x0b, 0x12, 0x2a, 0x04, 0xe6, 0x3b, 0x35, 0x0c, 0x33, 0xdd, 0x30, 0xc7, 0x30,
+  0x6e, 0x88, 0x80, 0xae, 0x61, 0x9e, 0xae, 0x64, 0xf7, 0x14, 0xde, 0x44, 0xa6, 0x82, 0x6d, 0x85,
+  0x35, 0x20, 0x30, 0x36, 0x1e, 0x66, 0xdf, 0x63, 0x87, 0xae, 0x70, 0x48, 0x5d, 0xd0, 0x68, 0x6f,
+  0x6d, 0x07, 0x04, 0x0d, 0x03, 0x30, 0x74, 0x16, 0xb3, 0x75, 0xa4, 0x11, 0xd5, 0x80, 0x65, 0xcf,
+  0x75, 0xd8, 0x96, 0x03, 0xda, 0x65, 0xfe, 0x7e, 0x64, 0x18, 0x96, 0xb5, 0xb3, 0x93, 0x51, 0x31,
+  0x79, 0x8e, 0x65, 0xa9, 0x26, 0x59, 0xd6, 0x16, 0x7c, 0x26, 0x32, 0x5e, 0x8e, 0xeb, 0x10, 0x25,
+  0xa3, 0x7e, 0xfc, 0x86, 0x5c, 0x5b, 0xcc, 0xd2, 0x06, 0x11, 0xee, 0x59, 0x6e, 0xb1, 0x7d, 0xce,
+  0xf6, 0x37, 0x2c, 0xe1, 0x7a, 0x78, 0x4e, 0x43, 0x90, 0xc9, 0x40, 0x06, 0xc4, 0x3e, 0xe3, 0xec,
+  0x7b, 0xa3, 0x37, 0x96, 0x47, 0xa8, 0xe8, 0x66, 0x2a, 0x89, 0x01, 0x73, 0x9f, 0xdb, 0xea, 0x2b,
+  0x3d, 0x16, 0xca, 0x96, 0xc1, 0x34, 0x31, 0x35, 0xdf, 0x08, 0xaf, 0x43, 0x77, 0x92, 0x33, 0x27,
+  0x4a, 0x88, 0x0b, 0x9f, 0x9a, 0x65, 0x5b, 0x83, 0xbd, 0xcb, 0x69, 0x3d, 0x3c, 0xd1, 0x41, 0x9d,
+  0xe0, 0x7d, 0x48, 0x60, 0x83, 0xd8, 0xeb, 0x95, 0x03, 0x92, 0xf5, 0x89, 0x47, 0x70, 0xd8, 0x66,
+  0x8b, 0xea, 0x16, 0x0d, 0xbb, 0xcc, 0xaa, 0x02, 0x7a, 0xed, 0x11, 0x43, 0x0b, 0x18, 0x61, 0xf9,
+  0x9d, 0x8e, 0x62, 0xfb, 0x14, 0x8d, 0x5c, 0xce, 0xc4, 0x64, 0x07, 0x28, 0x19, 0x82, 0x7d, 0xb3,
+  0xc2, 0x1a, 0xf3, 0x7d, 0x36, 0x1c, 0x8f, 0xbb, 0xf1, 0x3f, 0xa3, 0x67, 0x8c, 0x3b, 0x95, 0x5a,
+  0x5a, 0xdc, 0xb8, 0x15, 0x46, 0x59, 0xcc, 0x85, 0x49, 0x60, 0x69, 0x03, 0xd7, 0x06, 0x56, 0x2a,
+  0x56, 0x1c, 0xe4, 0x16, 0x0c, 0x7d, 0xf0, 0x77, 0x54, 0xe8, 0x17, 0xbf, 0xb6, 0x5c, 0x7f, 0x05,
+  0xd2, 0x1f, 0x05, 0x5d, 0xc9, 0x8a, 0xf3, 0x07, 0xf5, 0xc4, 0xef, 0x2d, 0xdd, 0x8b, 0x82, 0x43,
+  0x4a, 0xa0, 0x46, 0x0b, 0x30, 0x69, 0xfd, 0xa2, 0xad, 0x03, 0x65, 0x9d, 0x2a, 0xa7, 0x31, 0x60,
+  0x0e, 0x63, 0xb4, 0xb1, 0xd7, 0x60, 0x68, 0xf4, 0x20, 0x2c, 0xf1, 0xf3, 0x26, 0x23, 0xe2, 0x6c,
+  0xce, 0x94, 0x97, 0x99, 0x00, 0x0e, 0xe1, 0x94, 0xef, 0xa5, 0x41, 0x43, 0x3b, 0x20, 0x6d, 0x42,
+  0x69, 0x76, 0xe9, 0x4e, 0xcc, 0x52, 0x2b, 0xfe, 0x08, 0x79, 0x8d, 0x46, 0x5d, 0xb4, 0xbd, 0xdb,
+  0x45, 0xbb, 0xdb, 0x5d, 0xe0, 0xfb, 0x56, 0x47, 0xbd, 0x53, 0xf3, 0xf3, 0xb9, 0x83, 0x1d, 0x24,
+  0xfc, 0xca, 0x41, 0x19, 0x76, 0x6a, 0x77, 0x33, 0x30, 0x4e, 0x57, 0x46, 0x14, 0x9b, 0x78, 0xa7,
+  0x00, 0xec, 0x07, 0xd1, 0x67, 0x24, 0xbc, 0x24, 0xc4, 0xc9, 0x71, 0x57, 0x61, 0xff, 0xab, 0xf6,
+  0x5b, 0x56, 0xf7, 0x4b, 0x51, 0x8e, 0xdd, 0x7b, 0x26, 0x44, 0x18, 0x32, 0x9f, 0xcc, 0x9f, 0x5c,
+  0x46, 0x0e, 0x61, 0xe6, 0xda, 0xe6, 0xa4, 0x1c, 0x8a, 0xb0, 0xc7, 0x39, 0xc2, 0x93, 0xbd, 0x36,
+  0x66, 0xac, 0xad, 0xf3, 0x28, 0xc5, 0x0d, 0x59, 0x08, 0x13, 0x8a, 0x6f, 0x33, 0xe8, 0xd5, 0x13,
+  0x2b, 0xd0, 0xac, 0x71, 0x33, 0xb1, 0x8a, 0x1b, 0x86, 0x91, 0xf1, 0x39, 0x19, 0x08, 0x6a, 0xa7,
+  0xb3, 0xbd, 0xbd, 0x3d, 0xc9, 0x84, 0xa7, 0x4a, 0x54, 0x98, 0xcd, 0xd5, 0x23, 0xad, 0x00, 0x08,
+  0x8a, 0x60, 0x30, 0x6b, 0xa6, 0x90, 0x51, 0x01, 0xe7, 0x02, 0xdb, 0x6b, 0xa2, 0x0a, 0xd2, 0x05,
+  0xe3, 0x46, 0xbd, 0xf1, 0x06, 0x8c, 0x6b, 0x1c, 0xa8, 0x1b, 0x86, 0xb9, 0x65, 0x59, 0xdd, 0x98,
+  0x69, 0x39, 0x4b, 0x04, 0xd0, 0x67, 0x6f, 0x68, 0xa8, 0xa7, 0xa0, 0xf4, 0xb9, 0x4d, 0xc1, 0x49,
+  0x30, 0x52, 0xd5, 0x43, 0x39, 0x13, 0x2c, 0x6a, 0xdb, 0xb1, 0x85, 0xe1, 0xb6, 0xce, 0xc3, 0x3e,
+  0x2c, 0x5b, 0x86, 0x9f, 0x12, 0x68, 0x35, 0xa3, 0x7a, 0x97, 0xd8, 0x77, 0x80, 0xb1, 0x1b, 0x04,
+  0xfd, 0x09, 0xcd, 0x96, 0xb5, 0xbb, 0x63, 0x18, 0xfc, 0x62, 0xfc, 0xc9, 0x70, 0x78, 0x77, 0x9a,
+  0xdf, 0x8d, 0x82, 0xb9, 0x4f, 0x59, 0x42, 0x68, 0xdf, 0x8d, 0x04, 0x16, 0x14, 0xc1, 0xc5, 0x7c,
+  0x0e, 0xda, 0x6d, 0xfc, 0xbb, 0x48, 0x48, 0x76, 0x4f, 0x29, 0x05, 0x7c, 0x27, 0xfd, 0xab, 0x91,
+  0xb3, 0xf1, 0x8c, 0xd8, 0xf9, 0x4c, 0xa7, 0x59, 0x66, 0x42, 0x9c, 0xc0, 0xf5, 0x03, 0xfd, 0x5e,
+  0x02, 0x30, 0x88, 0xb0, 0xd8, 0x3f, 0x45, 0x8c, 0x35, 0x28, 0x8b, 0xb1, 0x38, 0x76, 0xf5, 0x06,
+  0x5f, 0xa0, 0x19, 0xe5, 0x17, 0xcd, 0xf2, 0x99, 0x61, 0x59, 0x52, 0x3b, 0x30, 0x6a, 0xec, 0xf9,
+  0xce, 0x26, 0x49, 0x6f, 0x05, 0xb6, 0x91, 0x81, 0xcb, 0x3a, 0xa8, 0x51, 0xad, 0x83, 0x8a, 0xa7,
+  0xc7, 0x42, 0x2d, 0xe6, 0x9c, 0xb1, 0x98, 0x77, 0xb2, 0xb9, 0x45, 0x0a, 0xc1, 0x84, 0xfc, 0x55,
+  0xed, 0xd9, 0x2a, 0x5c, 0x7a, 0xad, 0x9b, 0x6e, 0x9e, 0x91, 0x0e, 0x2a, 0x32, 0xd2, 0x8d, 0xb9,
+  0xbf, 0x99, 0xa6, 0x48, 0xa4, 0xf7, 0xe6, 0xb6, 0x1b, 0x10, 0x33, 0xe7, 0xea, 0x22, 0x25, 0x41,
+  0x2c, 0x2a, 0x46, 0x83, 0x11, 0x0f, 0x92, 0x20, 0x36, 0x96, 0x9c, 0x67, 0x21, 0x67, 0x93, 0x61,
+  0xba, 0x1e, 0x71, 0x54, 0x10, 0x05, 0xb8, 0xf1, 0x10, 0xc0, 0xc5, 0x61, 0x57, 0xea, 0x4e, 0x99,
+  0xf9, 0x55, 0x4b, 0x6a, 0x85, 0x3d, 0x5d, 0x4a, 0xa7, 0xfe, 0x6d, 0x29, 0x44, 0x65, 0xca, 0x73,
+  0xa7, 0x1c, 0xa3, 0x8c, 0xda, 0x1f, 0x6e, 0xa4, 0x59, 0x59, 0xf5, 0x28, 0xd1, 0xed, 0x32, 0x2a,
+  0x79, 0x3e, 0x50, 0x52, 0xbb, 0x30, 0xf2, 0x15, 0x88, 0xb8, 0x76, 0xc1, 0x13, 0xd5, 0x6a, 0x99,
+  0x96, 0xca, 0x85, 0x97, 0x08, 0xca, 0xbd, 0xd2, 0x70, 0x38, 0x9c, 0xd4, 0xe5, 0xf4, 0x16, 0x5d,
+  0xe8, 0x01, 0x99, 0xb3, 0x3c, 0xe8, 0x3f, 0x5e, 0x13, 0x23, 0x72, 0xdf, 0x6b, 0xdd, 0x61, 0x58,
+  0x5d, 0x77, 0x28, 0x72, 0x65, 0x33, 0x4b, 0x17, 0x91, 0xa0, 0xae, 0xb9, 0x71, 0x3d, 0x36, 0xa9,
+  0x2f, 0xc4, 0xb9, 0x87, 0x04, 0xb2, 0x51, 0xd9, 0x2d, 0x5f, 0x33, 0x95, 0x21, 0x29, 0x43, 0x89,
+  0xaa, 0xa2, 0xa9, 0x1a, 0x0c, 0x75, 0xbc, 0x75, 0xd8, 0xd4, 0x55, 0x8f, 0x3a, 0x77, 0x90, 0xf0,
+  0xb0, 0xb3, 0x99, 0x1b, 0xa9, 0xf0, 0x40, 0xa5, 0x65, 0x79, 0xd9, 0x73, 0xcb, 0xc9, 0x88, 0x8a,
+  0xfa, 0x59, 0xe8, 0xdc, 0x25, 0xb0, 0x15, 0xe5, 0x88, 0xa4, 0x1c, 0xdf, 0x69, 0xba, 0xbb, 0x53,
+  0x72, 0x86, 0xac, 0xc8, 0x3e, 0xde, 0xd4, 0xab, 0x56, 0xd3, 0x5c, 0x9e, 0x64, 0xcd, 0xd7, 0x7e,
+  0xc0, 0x26, 0x7a, 0x2e, 0x2d, 0x9a, 0xd7, 0xb2, 0x9a, 0xd2, 0x30, 0x5f, 0x53, 0x1a, 0x06, 0xb5,
+  0xcc, 0xac, 0x2b, 0x29, 0xf1, 0x33, 0xa8, 0xf6, 0x40, 0x65, 0x7c, 0xe4, 0xfa, 0xc8, 0x38, 0x73,
+  0x04, 0x51, 0x2c, 0xb1, 0xd4, 0xa1, 0xc1, 0x2c, 0xa2, 0xeb, 0x98, 0xd8, 0xbf, 0x2e, 0xf3, 0xfa,
+  0x19, 0xa3, 0xa3, 0x04, 0xc3, 0xab, 0x42, 0x81, 0xee, 0x61, 0x87, 0xd8, 0xb5, 0x96, 0x35, 0x8b,
+  0xe1, 0xa0, 0x76, 0x6b, 0x28, 0x0b, 0x5a, 0xef, 0xd5, 0x00, 0x27, 0xa6, 0x26, 0xab, 0x95, 0x75,
+  0x94, 0xf7, 0x30, 0xd8, 0xa2, 0x0b, 0x22, 0xdb, 0xaa, 0x99, 0xed, 0xce, 0xdf, 0x54, 0xf0, 0x4c,
+  0x15, 0xf0, 0xbf, 0x4b, 0x04, 0x5b, 0x62, 0x77, 0xef, 0x72, 0x5c, 0xb2, 0xa9, 0xf9, 0xc9, 0xd8,
+  0xf6, 0xda, 0x10, 0x22, 0xa2, 0x7e, 0xce, 0x3c, 0xb1, 0x6c, 0x85, 0x86, 0xb9, 0x03, 0x2b, 0x31,
+  0x2e, 0x0a, 0x8d, 0xd8, 0x50, 0xe0, 0x49, 0xae, 0xc4, 0x1f, 0x8d, 0xc9, 0x54, 0xcb, 0xb2, 0xa9,
+  0x47, 0xcd, 0x89, 0x9a, 0x98, 0xbf, 0x22, 0x41, 0x80, 0x17, 0xe4, 0x6e, 0x9e, 0xc1, 0x72, 0xdd,
+  0xb0, 0xb8, 0x97, 0x6b, 0x8e, 0x12, 0x2b, 0x54, 0x34, 0x46, 0xa1, 0x90, 0x6b, 0x17, 0xd0, 0xa9,
+  0x3e, 0x68, 0xa4, 0x41, 0xe8, 0xfa, 0xd7, 0xff, 0x3d, 0x41, 0xcf, 0x12, 0x47, 0xda, 0xa2, 0x4a,
+  0x37, 0xe2, 0x28, 0x74, 0xa8, 0x88, 0x42, 0xef, 0xb8, 0x0b, 0x36, 0x49, 0xfb, 0x37, 0xd9, 0xdb,
+  0x3c, 0xba, 0x21, 0x8e, 0xd9, 0xd8, 0xc3, 0x8b, 0x83, 0x9e, 0xfc, 0x53, 0xe6, 0x60, 0x2c, 0xdb,
+  0xbd, 0xd4, 0x61, 0xcf, 0xf0, 0xa3, 0xaa, 0x06, 0xdc, 0x2b, 0x9e, 0xe1, 0xc6, 0x7b, 0xae, 0x70,
+  0xa0, 0x1f, 0xc5, 0xfb, 0x5b, 0x55, 0xdc, 0xcc, 0xc7, 0x05, 0xa1, 0x8b, 0x80, 0x37, 0xb5, 0x75,
+  0xca, 0x7c, 0x05, 0x9a, 0x39, 0x39, 0x56, 0x6e, 0x45, 0x46, 0xb9, 0x43, 0x16, 0xf2, 0x6d, 0x72,
+  0xa0, 0x13, 0x13, 0x9a, 0xd6, 0x1c, 0x9b, 0xe1, 0x5c, 0xa8, 0x33, 0x66, 0x82, 0xcc, 0x04, 0x6a,
+  0x5a, 0x07, 0x6c, 0x0a, 0x36, 0x57, 0xfb, 0x53, 0x1e, 0xc2, 0xac, 0x88, 0x49, 0x31, 0x6a, 0x4b,
+  0xe7, 0x91, 0x9f, 0x6c, 0x83, 0x15, 0xee, 0xe4, 0xa4, 0x55, 0xde, 0x5d, 0x30, 0xca, 0x5a, 0xaf,
+  0x42, 0xa1, 0x3a, 0x63, 0x87, 0x79, 0x71, 0x3a, 0x3f, 0x5a, 0x3e, 0xe6, 0x97, 0x7c, 0x4d, 0xe1,
+  0xfc, 0x65, 0xbf, 0x1f, 0x35, 0xbd, 0xec, 0xf7, 0x45, 0xa7, 0xce, 0x3e, 0xeb, 0x57, 0x89, 0xfa,
+  0x61, 0x4c, 0x7a, 0x81, 0xe6, 0x36, 0x0e, 0x82, 0x69, 0x4b, 0xa0, 0xda, 0x4a, 0x9b, 0x63, 0xf6,
+  0x97, 0x83, 0x83, 0xef, 0xbf, 0xfe, 0xed, 0x57, 0xff, 0xf7, 0xf7, 0xdf, 0xa2, 0xa3, 0xc3, 0x93,
+  0xd3, 0xc3, 0x93, 0xc7, 0xcf, 0xce, 0x9f, 0xa3, 0xd3, 0xc3, 0x17, 0x70, 0x75, 0x7e, 0x7c, 0x74,
+  0xf8, 0x0c, 0x9d, 0x1d, 0x3f, 0xfd, 0xd9, 0xe3, 0x17, 0x00, 0x78, 0x20, 0x4d, 0x93, 0x60, 0xc6,
+  0x7d, 0x11, 0xad, 0x83, 0x33, 0xb0, 0x7e, 0x64, 0x85, 0x91, 0x49, 0xe2, 0xc6, 0x1c, 0xe2, 0xb2,
+  0x9b, 0x73, 0xa0, 0x99, 0xf8, 0x40, 0x89, 0x8f, 0x91, 0x8e, 0x5e, 0x1c, 0x3f, 0x39, 0x0f, 0xf6,
+  0xfb, 0x00, 0x41, 0x0d, 0x4f, 0xb4, 0x4a, 0xb4, 0x00, 0xad, 0xdf, 0xff, 0x06, 0x1d, 0x11, 0xdf,
+  0x77, 0x01, 0x1a, 0xfc, 0xf7, 0x16, 0x6d, 0xed, 0x7c, 0xfb, 0xcd, 0x27, 0xda, 0xd6, 0x6e, 0x6f,
+  0xfc, 0x49, 0xeb, 0x0c, 0x62, 0x9a, 0xed, 0x6f, 0xbf, 0x19, 0xed, 0x6a, 0x03, 0x88, 0xba, 0x86,
+  0xad, 0x9f, 0x4b, 0x10, 0xa5, 0xcb, 0x02, 0x07, 0x52, 0x8e, 0xb6, 0x4a, 0xc8, 0x49, 0x1b, 0x0f,
+  0xa4, 0x11, 0x25, 0xa3, 0x4c, 0x37, 0x6c, 0x21, 0x6a, 0xb2, 0xde, 0x26, 0x8b, 0x9e, 0xf1, 0x67,
+  0xad, 0x83, 0x1c, 0x6d, 0xa2, 0x27, 0x09, 0x02, 0x96, 0x83, 0x9f, 0xd3, 0x27, 0x14, 0x3d, 0x75,
+  0x41, 0x51, 0x41, 0x5e, 0xec, 0x41, 0x8a, 0x40, 0x39, 0x3b, 0xee, 0x86, 0x0f, 0x0f, 0xa5, 0x1d,
+  0x12, 0xd6, 0xe2, 0x74, 0x1c, 0x0d, 0xbc, 0x1f, 0x8c, 0x18, 0x0c, 0xbe, 0x3e, 0x04, 0xf5, 0xec,
+  0xb8, 0xe2, 0x9c, 0xae, 0x40, 0x2f, 0x74, 0x7d, 0x8f, 0xff, 0xbd, 0xbf, 0x35, 0x0e, 0x5e, 0x7a,
+  0x21, 0x80, 0xde, 0x93, 0x56, 0x5c, 0xf3, 0x27, 0xad, 0x03, 0x63, 0x89, 0x8c, 0x55, 0xb4, 0x52,
+  0xc5, 0x82, 0x55, 0x3a, 0x92, 0xf8, 0xb3, 0x12, 0x15, 0x91, 0x63, 0x50, 0xc1, 0x6e, 0xf1, 0xe4,
+  0x94, 0x3f, 0xc8, 0xa1, 0xbb, 0x1c, 0x1d, 0xfc, 0xf3, 0x8f, 0x7f, 0x62, 0xfb, 0xeb, 0x90, 0x0d,
+  0xc2, 0x01, 0x3a, 0x64, 0x51, 0x2b, 0x86, 0x2d, 0x00, 0xaf, 0x8a, 0x02, 0x4d, 0xc1, 0x3d, 0x85,
+  0xed, 0x54, 0x90, 0x5c, 0xee, 0x56, 0x89, 0x1f, 0xab, 0x2a, 0x08, 0xbc, 0x7c, 0x6a, 0x85, 0xc1,
+  0x17, 0xec, 0xf6, 0xa0, 0xc9, 0xc4, 0x5c, 0xf8, 0xa2, 0x20, 0x05, 0x36, 0xe5, 0xaf, 0xd1, 0x4f,
+  0xf8, 0x30, 0x0a, 0xf6, 0x56, 0xb9, 0xb9, 0x75, 0x63, 0x50, 0x42, 0x5b, 0xcc, 0xdf, 0x6c, 0xd4,
+  0x20, 0x50, 0xe5, 0x0f, 0x8f, 0x52, 0xce, 0xdf, 0x81, 0xee, 0x4c, 0xe9, 0xb3, 0x62, 0xb3, 0xa4,
+  0x45, 0xc3, 0xdc, 0x20, 0x89, 0xca, 0xdf, 0xa0, 0x97, 0x33, 0x70, 0x29, 0x73, 0xfa, 0xdd, 0xff,
+  0x38, 0x40, 0xa6, 0x8d, 0xd2, 0x56, 0xc4, 0x22, 0x71, 0x7c, 0x1e, 0x46, 0x4b, 0x9f, 0x58, 0xc0,
+  0xc4, 0x30, 0xf4, 0x82, 0xbd, 0x7e, 0xff, 0xf2, 0xf2, 0xb2, 0xb7, 0x70, 0xdd, 0x85, 0x4d, 0x7a,
+  0x73, 0x77, 0xd5, 0x87, 0x45, 0x83, 0x4f, 0x7f, 0x39, 0xd5, 0xb7, 0x76, 0x7a, 0x83, 0x91, 0xb1,
+  0x35, 0xda, 0xe9, 0xea, 0xdb, 0xdb, 0xbd, 0xed, 0xf1, 0x70, 0x67, 0x77, 0xdc, 0x42, 0x21, 0x44,
+  0x31, 0xac, 0x9d, 0xf2, 0xd5, 0xcc, 0xc6, 0xce, 0x9b, 0x56, 0x8c, 0x29, 0x2b, 0x01, 0x64, 0x52,
+  0x46, 0x05, 0xc2, 0xec, 0x73, 0x38, 0xf3, 0xa9, 0x8f, 0x88, 0x83, 0xbe, 0xe0, 0x0b, 0xa2, 0x13,
+  0x58, 0xac, 0x88, 0x61, 0x1f, 0xe7, 0x78, 0xa2, 0x30, 0x0a, 0x54, 0xd4, 0x19, 0x0b, 0x93, 0x25,
+  0xd6, 0xf1, 0x11, 0xad, 0xc2, 0x88, 0xc0, 0x9f, 0x67, 0x89, 0x67, 0x85, 0xed, 0x20, 0xf4, 0x09,
+  0x09, 0x61, 0x56, 0xcf, 0xf5, 0x17, 0x7d, 0x72, 0xc5, 0x5a, 0x42, 0xfb, 0x64, 0x35, 0x23, 0x66,
+  0x8f, 0xf5, 0x98, 0x7e, 0x3a, 0x83, 0xdc, 0x7a, 0xca, 0x19, 0x01, 0xfc, 0x60, 0xac, 0x19, 0x0b,
+  0xb6, 0x0c, 0xc5, 0xdd, 0xe0, 0x11, 0x04, 0x6f, 0xc4, 0x9f, 0x02, 0x00, 0x87, 0xbe, 0x79, 0x04,
+  0xb1, 0xde, 0x1b, 0xb8, 0x53, 0xf3, 0xb0, 0x80, 0x10, 0xb6, 0x21, 0x12, 0xb3, 0xd6, 0xb6, 0x1d,
+  0xcc, 0x01, 0x09, 0x27, 0x4f, 0xbb, 0xa0, 0x74, 0x33, 0x0d, 0xcb, 0xd6, 0x34, 0x95, 0x5b, 0xfd,
+  0x0f, 0xdc, 0x95, 0xf2, 0x71, 0xb0, 0x25, 0x62, 0xfd, 0x89, 0x37, 0x7f, 0xcd, 0xc6, 0x48, 0x6b,
+  0x88, 0x2a, 0xcd, 0x2c, 0x8e, 0x54, 0xd8, 0xc7, 0x64, 0x34, 0xaf, 0xbb, 0x1d, 0xc8, 0xdb, 0xf3,
+  0xe4, 0xbb, 0x3f, 0x5f, 0x51, 0xf0, 0xcf, 0xed, 0x6f, 0xbf, 0x39, 0xea, 0xec, 0xf7, 0xc5, 0x00,
+  0xf5, 0x64, 0x51, 0x6d, 0x0b, 0xaf, 0x3d, 0x32, 0x6d, 0x39, 0x6b, 0x90, 0x57, 0xbc, 0x4b, 0xf9,
+  0xba, 0x0c, 0xe8, 0x09, 0xbe, 0x6a, 0x21, 0x1e, 0xc8, 0x4c, 0x5b, 0xfa, 0x60, 0xa7, 0x85, 0xc0,
+  0xf7, 0x7b, 0xd3, 0x96, 0xd1, 0x1b, 0xab, 0x50, 0x2f, 0x6a, 0xda, 0xbd, 0x50, 0x74, 0xe4, 0x7f,
+  0xf7, 0x37, 0x16, 0xf9, 0xdd, 0x0f, 0x49, 0x47, 0x10, 0x46, 0x4a, 0x34, 0x19, 0xff, 0x42, 0x9a,
+  0x28, 0x2c, 0xef, 0xa2, 0xd5, 0x77, 0x7f, 0x73, 0xe8, 0xca, 0x15, 0x4d, 0x3f, 0x40, 0x54, 0x40,
+  0x16, 0xef, 0x44, 0xd4, 0x09, 0x75, 0x3e, 0x5f, 0xfb, 0x09, 0x49, 0x23, 0x23, 0x21, 0x69, 0xdb,
+  0x78, 0xcf, 0x14, 0x31, 0x5d, 0xeb, 0x21, 0x6f, 0xcd, 0x09, 0xc1, 0x33, 0x7a, 0x3f, 0x04, 0x7d,
+  0x0e, 0xb1, 0xa1, 0xac, 0x78, 0x83, 0x9d, 0x84, 0xa2, 0x51, 0x43, 0x8a, 0x54, 0x8f, 0x18, 0x81,
+  0x3c, 0x80, 0x66, 0x06, 0x2e, 0x97, 0x4e, 0xe6, 0xeb, 0xe0, 0xe9, 0x91, 0x4d, 0xe1, 0x68, 0x47,
+  0x85, 0xc0, 0x6c, 0x0d, 0x09, 0xb8, 0x23, 0xd9, 0xf3, 0x16, 0x72, 0x9d, 0xb9, 0x4d, 0xe7, 0x6f,
+  0x20, 0xc8, 0xc1, 0x17, 0x44, 0x58, 0x8a, 0x76, 0x87, 0xc5, 0xbb, 0xbf, 0xfb, 0x07, 0xfa, 0x62,
+  0x8d, 0x7d, 0xb0, 0xf3, 0xfb, 0x7d, 0x31, 0xaf, 0x09, 0xc0, 0x9c, 0x83, 0x48, 0xc1, 0x87, 0x24,
+  0x08, 0xb9, 0xd9, 0x11, 0xd0, 0xbf, 0xfa, 0x0a, 0x9d, 0xfa, 0x2e, 0x4b, 0x25, 0x84, 0x2d, 0x52,
+  0xaf, 0x51, 0xee, 0x76, 0xab, 0x22, 0x26, 0x51, 0x8e, 0x91, 0xc3, 0x25, 0xaf, 0xb6, 0x77, 0x3f,
+  0x0d, 0xed, 0xbb, 0xe8, 0x0c, 0x83, 0xd7, 0x86, 0xdd, 0xbc, 0xfe, 0x55, 0x17, 0x1d, 0x82, 0x27,
+  0x74, 0x42, 0xea, 0x00, 0x82, 0x5e, 0x06, 0xa0, 0x94, 0x5e, 0xac, 0x92, 0xf4, 0xc2, 0x03, 0xd0,
+  0x22, 0xa5, 0x60, 0xee, 0x8f, 0x31, 0x81, 0xce, 0xc1, 0x34, 0x13, 0xb8, 0xbd, 0x02, 0xdf, 0xb3,
+  0x82, 0x78, 0xab, 0xad, 0x6f, 0x19, 0x60, 0x1e, 0x10, 0x46, 0x1f, 0x0f, 0x0d, 0x61, 0x27, 0xbc,
+  0x12, 0x92, 0xc0, 0x53, 0x50, 0x2f, 0x4c, 0x57, 0xb5, 0x49, 0x88, 0x22, 0xcd, 0xc3, 0x80, 0xe0,
+  0x14, 0xdd, 0xdc, 0x4e, 0x8a, 0x1e, 0x22, 0x20, 0x21, 0x0f, 0xa3, 0x41, 0x29, 0xdb, 0x6b, 0xcf,
+  0xc4, 0x21, 0x61, 0xa3, 0xbb, 0x68, 0x9c, 0xed, 0x2b, 0x49, 0x5f, 0xb5, 0xa5, 0xa7, 0xb6, 0x8b,
+  0xcd, 0x58, 0x09, 0xb2, 0x4f, 0x45, 0x98, 0x75, 0x2d, 0x3f, 0x4e, 0x2e, 0x70, 0x70, 0xed, 0xcc,
+  0x91, 0xb5, 0x76, 0x44, 0x9d, 0x49, 0x06, 0x5d, 0x28, 0x70, 0xe7, 0xbf, 0xb7, 0x20, 0xea, 0x5d,
+  0xe0, 0x9a, 0x91, 0x4f, 0x02, 0x0f, 0x2e, 0x08, 0x10, 0x86, 0x2f, 0x31, 0x0d, 0x91, 0x45, 0xc2,
+  0xf9, 0xb2, 0xad, 0xf5, 0xb1, 0x47, 0xfb, 0x22, 0x04, 0xd7, 0x72, 0x75, 0x82, 0x74, 0xb2, 0x29,
+  0x38, 0x22, 0x26, 0xc6, 0x90, 0x7a, 0x5f, 0x06, 0xae, 0xd3, 0x56, 0xcc, 0x29, 0x3c, 0x30, 0xdd,
+  0xf9, 0x9a, 0x69, 0x47, 0x0f, 0xe2, 0x9e, 0xc7, 0x36, 0x61, 0x97, 0x9f, 0x5d, 0x1f, 0x9b, 0x6d,
+  0x2d, 0x4d, 0xa5, 0xb4, 0x4e, 0x8f, 0xeb, 0xd7, 0x33, 0x16, 0x91, 0x4c, 0x91, 0x26, 0xf5, 0x70,
+  0x8b, 0xb6, 0x35, 0x6d, 0xd2, 0x1c, 0x6c, 0x36, 0x23, 0xca, 0x81, 0x56, 0xda, 0x22, 0x79, 0x3d,
+  0x0d, 0x7d, 0x8c, 0xda, 0x8c, 0xe2, 0x5e, 0x0c, 0x07, 0x7d, 0x8a, 0xb4, 0x08, 0x0b, 0xb4, 0x07,
+  0x97, 0xa2, 0x8f, 0x47, 0xc5, 0xae, 0x52, 0x94, 0xa4, 0x24, 0x09, 0xf0, 0x61, 0xd5, 0xcb, 0xa3,
+  0xa8, 0xee, 0x5a, 0x82, 0x11, 0x47, 0x20, 0x9a, 0xf5, 0x8a, 0xa5, 0x3b, 0xe8, 0xed, 0x5b, 0xe4,
+  0x90, 0x4b, 0x04, 0x92, 0x27, 0x6d, 0x00, 0xe1, 0xf2, 0xec, 0x92, 0x30, 0x88, 0x67, 0xa1, 0x4f,
+  0x9d, 0x45, 0x23, 0x51, 0x08, 0x79, 0x2e, 0xdd, 0xb5, 0x1f, 0xc0, 0xca, 0x27, 0x38, 0x5c, 0xf6,
+  0x2c, 0x1b, 0x2c, 0xad, 0x20, 0x58, 0x24, 0x56, 0xa8, 0x8f, 0x46, 0xdb, 0x85, 0x36, 0xa9, 0x74,
+  0xf6, 0x8a, 0x3a, 0xb9, 0xc9, 0x99, 0xd9, 0x0f, 0xc5, 0x6c, 0x80, 0xb2, 0x6d, 0x6c, 0xc2, 0x22,
+  0x31, 0xbd, 0xc0, 0x1d, 0x81, 0xeb, 0xc7, 0x48, 0x5b, 0x72, 0xc9, 0xf0, 0xc5, 0xe1, 0x6e, 0xa5,
+  0x35, 0xa0, 0x16, 0x98, 0x07, 0x91, 0xff, 0x0b, 0x96, 0x19, 0x09, 0x14, 0x79, 0x92, 0xd4, 0x9c,
+  0x4f, 0xe2, 0xd0, 0x81, 0xdb, 0x50, 0x46, 0x71, 0x0a, 0xa2, 0x67, 0x51, 0x1b, 0x74, 0xa3, 0xed,
+  0xa3, 0xe9, 0x01, 0xf2, 0x45, 0x95, 0xfb, 0x95, 0x18, 0x5d, 0xca, 0x36, 0x29, 0x71, 0x64, 0xb0,
+  0xca, 0xd8, 0x20, 0x0d, 0xd3, 0x6a, 0x60, 0xb1, 0xac, 0xb1, 0x1e, 0x14, 0x1b, 0xa5, 0x35, 0xa1,
+  0x99, 0x5a, 0xa8, 0x2d, 0x53, 0xdc, 0xb3, 0x89, 0xb3, 0x08, 0x97, 0xe8, 0x00, 0x19, 0x1d, 0x85,
+  0x5d, 0x11, 0x71, 0x77, 0x82, 0xac, 0xd8, 0x64, 0x6c, 0xb1, 0x1e, 0x36, 0xd9, 0xe2, 0x1c, 0x92,
+  0x6a, 0xe1, 0x74, 0x22, 0x1f, 0x4d, 0x1d, 0x48, 0xe1, 0x7e, 0x72, 0x7e, 0xf2, 0x94, 0x59, 0x18,
+  0x79, 0x79, 0xc8, 0x04, 0x04, 0x83, 0x5f, 0x2b, 0x41, 0x28, 0x53, 0xf5, 0xaa, 0x70, 0xa5, 0x62,
+  0xd2, 0x9c, 0x45, 0xf8, 0xdf, 0x7f, 0xfd, 0xc7, 0xbf, 0x94, 0xc4, 0x45, 0xd5, 0xd3, 0xa3, 0x23,
+  0x94, 0x9a, 0x65, 0xd5, 0x73, 0xa3, 0x7a, 0xda, 0x83, 0x1b, 0xbf, 0xc7, 0xbe, 0x4d, 0x77, 0x0b,
+  0xde, 0x92, 0x5d, 0xdb, 0xb0, 0xb9, 0x99, 0xb9, 0xbf, 0x6d, 0x80, 0x90, 0x1a, 0x70, 0x74, 0xe6,
+  0x22, 0x40, 0x0b, 0x05, 0x8d, 0x1e, 0x35, 0x81, 0x59, 0x33, 0xa4, 0xe2, 0xf5, 0xeb, 0x4e, 0xef,
+  0x4b, 0x97, 0x3a, 0x6d, 0x4d, 0x25, 0xfa, 0x5b, 0x44, 0x8a, 0xed, 0xed, 0xd5, 0xca, 0x04, 0x8e,
+  0xdd, 0xbd, 0x20, 0x55, 0xfa, 0x74, 0x5b, 0xad, 0xda, 0xb7, 0x08, 0x58, 0x39, 0x5f, 0xa2, 0x36,
+  0x0b, 0x42, 0xfc, 0x4e, 0x89, 0x87, 0x74, 0x21, 0x77, 0xe7, 0x03, 0xda, 0xda, 0x63, 0xf6, 0x63,
+  0x4f, 0xeb, 0x22, 0x31, 0x61, 0x72, 0xdf, 0xfe, 0x2c, 0x72, 0x1f, 0x59, 0xb8, 0x95, 0x6d, 0xf6,
+  0x89, 0xf3, 0x97, 0x0d, 0x9a, 0xb0, 0x65, 0x39, 0x72, 0x84, 0x79, 0xe0, 0x9d, 0x29, 0x15, 0x86,
+  0x21, 0xa9, 0x15, 0xe5, 0xd9, 0x59, 0xe8, 0x58, 0xc9, 0xec, 0x4e, 0x61, 0xfa, 0xf8, 0xb6, 0x84,
+  0x2b, 0xb6, 0x33, 0xcb, 0xa2, 0x0d, 0x56, 0xfa, 0x3e, 0x62, 0xf4, 0xc3, 0x2c, 0x58, 0xfc, 0x3c,
+  0xbe, 0xe5, 0x13, 0x79, 0x61, 0xfc, 0x15, 0xbe, 0x58, 0x74, 0x39, 0xc4, 0xa8, 0x2f, 0xbd, 0x3c,
+  0xf8, 0x00, 0x0f, 0x13, 0xc3, 0xe2, 0xe3, 0xd9, 0x83, 0x57, 0xbc, 0x95, 0x8e, 0xf9, 0x65, 0xf8,
+  0xc9, 0xbd, 0xb2, 0xe8, 0xd7, 0xd3, 0xca, 0xa0, 0xb0, 0x36, 0xf6, 0x0c, 0x14, 0xd9, 0x66, 0x33,
+  0x40, 0xfc, 0x6b, 0x38, 0xfc, 0xa1, 0x00, 0x07, 0xb7, 0xcd, 0x5c, 0x0c, 0x64, 0xa7, 0x4e, 0x89,
+  0x89, 0x92, 0x77, 0xe5, 0x83, 0x9b, 0x04, 0x85, 0xdb, 0x0a, 0x4b, 0x91, 0xc9, 0xc0, 0xd2, 0x2f,
+  0x57, 0x6c, 0x60, 0xd2, 0xd2, 0xef, 0x37, 0xf0, 0xbd, 0xcf, 0x68, 0xe5, 0x96, 0x65, 0x43, 0xd3,
+  0x26, 0x7f, 0xc1, 0x21, 0x02, 0x13, 0x7d, 0x81, 0x40, 0x1d, 0x0d, 0xdd, 0x36, 0x30, 0x7f, 0x05,
+  0x38, 0xcf, 0x9f, 0x3d, 0x3d, 0x7e, 0xf6, 0x98, 0xc3, 0x79, 0xfe, 0xe4, 0x09, 0xbf, 0xbe, 0x7d,
+  0x4f, 0x76, 0x29, 0x4f, 0x9f, 0xfc, 0x75, 0x84, 0x0d, 0xb8, 0x2b, 0x1d, 0xea, 0x3c, 0xb8, 0x49,
+  0xd4, 0x7c, 0x73, 0xe2, 0x1f, 0x3d, 0x42, 0x99, 0xbd, 0x80, 0x3e, 0x9c, 0x4e, 0x91, 0xbe, 0xbb,
+  0xbb, 0x0b, 0x6c, 0xa9, 0x05, 0xc5, 0x15, 0x4f, 0x9e, 0x0d, 0xe1, 0xe0, 0x13, 0x7a, 0x45, 0xcc,
+  0xf6, 0xa0, 0xc3, 0x82, 0x23, 0xc8, 0x7c, 0x38, 0x4f, 0x75, 0xfd, 0xdd, 0xd8, 0xa9, 0x24, 0x9e,
+  0xa7, 0xf4, 0x89, 0x6a, 0x35, 0x75, 0x54, 0x1b, 0x48, 0x46, 0x6e, 0x2b, 0xdf, 0x40, 0x32, 0x52,
+  0x9b, 0xf7, 0x86, 0x9e, 0x58, 0x6e, 0xb9, 0x6e, 0x30, 0x55, 0x12, 0x26, 0x63, 0xc8, 0x40, 0x16,
+  0x5d, 0xfa, 0xb4, 0x20, 0x92, 0x66, 0x12, 0x69, 0x28, 0x95, 0x12, 0x12, 0x22, 0xd9, 0x9c, 0xf1,
+  0x3b, 0x34, 0x78, 0x77, 0x47, 0xff, 0x43, 0x61, 0xf2, 0x50, 0xc9, 0xe4, 0xe1, 0x0f, 0x80, 0xc9,
+  0xc3, 0xf7, 0x1a, 0x4d, 0xe5, 0x51, 0x90, 0x9b, 0xf3, 0x1f, 0xdc, 0x24, 0xae, 0xb1, 0xce, 0xfe,
+  0x88, 0x93, 0xb4, 0x88, 0x9f, 0x19, 0xff, 0x09, 0x41, 0xef, 0x5f, 0xd1, 0xe9, 0xcb, 0xc7, 0x2f,
+  0xce, 0x0f, 0xd1, 0xe1, 0x67, 0xc7, 0xec, 0x27, 0xe7, 0xe1, 0xf7, 0x5f, 0x7f, 0xf5, 0x3b, 0x74,
+  0x2a, 0x6a, 0x7a, 0xac, 0x7c, 0x83, 0x4d, 0xac, 0xdd, 0xe6, 0x0f, 0xd9, 0x2a, 0x84, 0x96, 0x2e,
+  0x12, 0x5b, 0xba, 0xe4, 0xc9, 0xab, 0x80, 0x3a, 0x73, 0xc2, 0xd2, 0x8a, 0x26, 0xb6, 0x4e, 0x13,
+  0xb8, 0xb7, 0x59, 0xf2, 0xa7, 0x84, 0x03, 0x72, 0x0f, 0x3a, 0x11, 0x66, 0x1c, 0xf5, 0x0a, 0xe1,
+  0xd7, 0x70, 0x3a, 0xef, 0x9f, 0x5e, 0xcb, 0xe5, 0x42, 0xa9, 0xe5, 0x28, 0xea, 0x38, 0x92, 0x0a,
+  0x88, 0xbc, 0x4a, 0x28, 0x3a, 0x8b, 0x78, 0x63, 0x51, 0x7a, 0xdc, 0xcf, 0xbf, 0x76, 0x51, 0x23,
+  0x9e, 0xef, 0xbf, 0xfe, 0xfd, 0xff, 0xc6, 0x8b, 0xfb, 0x41, 0x40, 0x6f, 0x91, 0xf9, 0xd9, 0xaa,
+  0x86, 0x88, 0xd7, 0x15, 0xa4, 0x96, 0x90, 0xf9, 0x3a, 0x17, 0x72, 0xaa, 0x22, 0xf5, 0xaa, 0xe8,
+  0x33, 0x13, 0xc9, 0xb1, 0xfd, 0xd7, 0x8d, 0x8a, 0x33, 0xf9, 0x28, 0x94, 0x65, 0x92, 0x1f, 0x46,
+  0x5c, 0x7c, 0xfb, 0x96, 0x47, 0x83, 0x68, 0x1a, 0xed, 0xdf, 0x4e, 0x1c, 0x32, 0x69, 0xea, 0x40,
+  0x98, 0xcd, 0xe5, 0x13, 0x0e, 0xa4, 0x72, 0x9c, 0x70, 0x74, 0x49, 0xef, 0x47, 0x0c, 0xf3, 0x00,
+  0xe9, 0x03, 0x23, 0x05, 0x18, 0xbf, 0x6f, 0x0e, 0x71, 0x85, 0xaf, 0x32, 0xc0, 0x76, 0x52, 0x60,
+  0x51, 0xfb, 0x4a, 0x0e, 0x56, 0xfc, 0x56, 0xab, 0xe4, 0x58, 0xae, 0x64, 0x27, 0xd7, 0xfd, 0xee,
+  0xab, 0x64, 0x27, 0x28, 0x29, 0xa9, 0x10, 0xa4, 0x45, 0xcc, 0x7b, 0x2f, 0xd9, 0x65, 0x4e, 0x85,
+  0x20, 0xcb, 0x11, 0xa1, 0xd0, 0x54, 0xc5, 0xd9, 0xc9, 0x5d, 0xa0, 0xb2, 0x83, 0x99, 0x0a, 0xb0,
+  0xb1, 0x88, 0x37, 0x86, 0x2d, 0xce, 0x47, 0xd4, 0x90, 0x57, 0xd4, 0x79, 0x65, 0xae, 0x7d, 0x1e,
+  0xc7, 0x6c, 0x0c, 0x38, 0x3a, 0xa7, 0x50, 0x43, 0xe6, 0xb6, 0xaa, 0xc0, 0x8a, 0x34, 0x23, 0x6d,
+  0x9a, 0x8d, 0x72, 0x15, 0x62, 0xcd, 0x54, 0x02, 0x36, 0x4f, 0x4e, 0x3b, 0x1b, 0x24, 0x90, 0x39,
+  0x85, 0x94, 0x4f, 0x23, 0x94, 0x09, 0xa4, 0x58, 0x86, 0x15, 0xc1, 0x0b, 0xe8, 0xc5, 0xd2, 0xdd,
+  0x63, 0xf5, 0xf8, 0x80, 0x3c, 0x01, 0xcc, 0xc2, 0xf6, 0x66, 0xea, 0xd2, 0xe9, 0xaa, 0xa1, 0xc6,
+  0xc2, 0xdd, 0x14, 0xb4, 0xac, 0x33, 0x0a, 0xd8, 0xb2, 0x78, 0x23, 0xd0, 0xc7, 0x4e, 0x2d, 0xe0,
+  0xac, 0xc2, 0x28, 0xc0, 0xc6, 0xb2, 0x6d, 0x0e, 0x32, 0xa7, 0x2a, 0x9d, 0xac, 0xfc, 0x2a, 0x32,
+  0x71, 0xb5, 0x95, 0x28, 0x35, 0x0a, 0xdd, 0x92, 0x02, 0xcb, 0x8a, 0x84, 0x4b, 0xd7, 0x04, 0xb7,
+  0x71, 0xfa, 0xfc, 0xec, 0x5c, 0xeb, 0x2a, 0xc7, 0x88, 0x74, 0x33, 0xd8, 0x43, 0x37, 0x48, 0x8b,
+  0x8a, 0xb0, 0xfa, 0xf9, 0xb5, 0x47, 0x34, 0x98, 0x86, 0x3d, 0xcf, 0xa6, 0x22, 0xdc, 0xef, 0x33,
+  0x4b, 0xa2, 0xa1, 0x5b, 0x35, 0x10, 0xd6, 0x91, 0xb6, 0x87, 0x7e, 0x7a, 0xf6, 0xfc, 0x59, 0x2f,
+  0xe0, 0xb5, 0x69, 0x6a, 0x5d, 0xb7, 0x05, 0x72, 0x9d, 0x62, 0xf9, 0xa6, 0xce, 0x86, 0x89, 0x9b,
+  0xc9, 0x07, 0xca, 0x7a, 0x51, 0x5b, 0xcb, 0x1d, 0xc0, 0x2f, 0xf8, 0xb1, 0x1a, 0x44, 0x2b, 0x9d,
+  0x4d, 0x36, 0x5d, 0x04, 0x4b, 0x6c, 0x36, 0xf0, 0x30, 0x02, 0x8a, 0xaf, 0xbd, 0xc3, 0x26, 0x93,
+  0xce, 0xe4, 0x1a, 0x19, 0xfd, 0xa2, 0x38, 0x19, 0x04, 0x5d, 0x94, 0x24, 0xba, 0xec, 0xb7, 0xa5,
+  0x64, 0xc4, 0xa7, 0xe4, 0x5b, 0x44, 0x86, 0x38, 0xf5, 0x63, 0xa7, 0x67, 0x9e, 0xbf, 0x26, 0x33,
+  0x8c, 0x88, 0x73, 0x41, 0xdf, 0x99, 0x27, 0x1c, 0x88, 0x1f, 0x9d, 0x58, 0xbf, 0x0b, 0x67, 0x32,
+  0x27, 0x5e, 0xf7, 0xe5, 0x10, 0xa3, 0x86, 0xa6, 0x4f, 0x59, 0x10, 0x35, 0x1d, 0x3c, 0xf2, 0x88,
+  0x4f, 0x5d, 0x73, 0xca, 0x4e, 0x0f, 0xee, 0xeb, 0x5c, 0x4b, 0x14, 0xdf, 0x8e, 0x58, 0xf3, 0x92,
+  0x38, 0x4d, 0x60, 0xff, 0x75, 0xee, 0xcd, 0xb4, 0x47, 0x04, 0x6c, 0x6c, 0xdb, 0x73, 0xc5, 0xc1,
+  0x14, 0xbf, 0x52, 0xd3, 0x1e, 0x75, 0x70, 0x57, 0x14, 0x08, 0xb3, 0x1d, 0x5a, 0x79, 0x06, 0xf2,
+  0xf0, 0x8e, 0xf3, 0x0e, 0x62, 0x27, 0xce, 0x89, 0xe8, 0xa4, 0x80, 0xc5, 0x78, 0x46, 0x09, 0xe1,
+  0x02, 0x54, 0xa6, 0x9e, 0xa8, 0xc9, 0xe1, 0xb5, 0x14, 0x3c, 0x47, 0xbf, 0x03, 0x88, 0x75, 0x55,
+  0xb3, 0x4e, 0x53, 0x87, 0xad, 0xe1, 0x06, 0x4c, 0x9d, 0x97, 0x71, 0x3b, 0x9a, 0x88, 0x70, 0xb5,
+  0x49, 0x49, 0x3d, 0xae, 0x8c, 0x7d, 0x05, 0xcb, 0x9a, 0x9c, 0x68, 0x9d, 0xf3, 0x18, 0x15, 0xe9,
+  0x5b, 0xc6, 0x44, 0x35, 0x00, 0x5f, 0x45, 0x03, 0x94, 0xaf, 0x7d, 0xec, 0x2c, 0x98, 0x56, 0xc6,
+  0xc3, 0xf4, 0x18, 0xe2, 0xa4, 0x72, 0x65, 0x05, 0x4b, 0x38, 0x37, 0x03, 0xb0, 0xb2, 0x84, 0x7d,
+  0xcd, 0x78, 0x60, 0x18, 0x9d, 0x9e, 0x4f, 0x2e, 0xc0, 0x20, 0xb3, 0x33, 0x3f, 0x56, 0x79, 0xe5,
+  0x5f, 0x9d, 0xaa, 0x2b, 0xbd, 0x02, 0x20, 0x3e, 0x8e, 0xc7, 0x4c, 0x13, 0xe5, 0x41, 0x4f, 0x49,
+  0x4c, 0xae, 0x35, 0x3f, 0x43, 0x14, 0x1d, 0xe1, 0xd1, 0x39, 0x20, 0xfb, 0xca, 0xe2, 0xb8, 0x8b,
+  0xda, 0x02, 0x6e, 0x42, 0x3f, 0x3b, 0x05, 0xe4, 0xcc, 0xe9, 0xa0, 0x1f, 0x71, 0x6a, 0x8a, 0xe0,
+  0xd9, 0xb9, 0xfb, 0x0c, 0x27, 0x15, 0x5e, 0x2d, 0x69, 0xf5, 0xd6, 0x2a, 0x10, 0x8f, 0x02, 0xff,
+  0x64, 0xde, 0xc7, 0x30, 0x11, 0x95, 0x84, 0xff, 0xec, 0xc3, 0x4f, 0x1d, 0x32, 0xb3, 0x77, 0xf2,
+  0xb3, 0xd5, 0xf1, 0x7e, 0x65, 0xcd, 0x37, 0x5b, 0xde, 0x8d, 0xc1, 0xdd, 0xb6, 0x62, 0x95, 0x8e,
+  0xbe, 0x14, 0xf1, 0xe0, 0x46, 0x5c, 0xdc, 0x3e, 0x6c, 0x21, 0x5e, 0x97, 0x65, 0xa3, 0x19, 0x22,
+  0x52, 0xf5, 0xe2, 0xf6, 0xdb, 0x6f, 0x8e, 0xe2, 0x46, 0xc8, 0x3b, 0xa6, 0x69, 0x72, 0x6b, 0x82,
+  0x64, 0x61, 0xbb, 0x68, 0x5b, 0xfa, 0xa5, 0x17, 0x90, 0x27, 0x47, 0x7d, 0x0f, 0xfb, 0x7d, 0xd1,
+  0x37, 0xbe, 0xdf, 0x17, 0xbf, 0x08, 0xf2, 0xff, 0x01, 0xbe, 0x71, 0xf6, 0xfe, 0x19, 0x52, 0x00,
+  0x00,
+};
+
+#define WEB_APP_MIME "text/html"
+#define WEB_APP_ETAG "\"dad9f5e0e8fc1599\""
+#define WEB_APP_GZ_LEN 3252
+const uint8_t WEB_APP_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x5a, 0xcd, 0x72, 0x1b, 0xc7,
+  0x11, 0xbe, 0xfb, 0x29, 0xc6, 0x90, 0x6d, 0x00, 0x29, 0xec, 0x72, 0x41, 0x0a, 0x0c, 0x0c, 0x90,
+  0x70, 0x20, 0x8a, 0x8a, 0x59, 0x11, 0x49, 0x15, 0x49, 0x2b, 0x4e, 0xb9, 0x5c, 0xd2, 0x60, 0x77,
+  0x16, 0x18, 0x71, 0x77, 0x67, 0x3d, 0x3b, 0x20, 0x09, 0xc3, 0x38, 0xa7, 0x2a, 0x17, 0x57, 0xa5,
+  0x7c, 0xf2, 0xc5, 0x39, 0xe7, 0x94, 0x63, 0xce, 0x79, 0x94, 0xbc, 0x40, 0xfc, 0x08, 0xe9, 0x99,
+  0xd9, 0x9f, 0xd9, 0x1f, 0x40, 0xb4, 0x4d, 0x95, 0x04, 0xec, 0xfc, 0xf4, 0xf4, 0x74, 0x7f, 0xfd,
+  0x75, 0xf7, 0x52, 0x47, 0x1f, 0x3e, 0xbf, 0x3c, 0xb9, 0xf9, 0xcb, 0xab, 0x53, 0xb4, 0x10, 0x61,
+  0x30, 0xf9, 0xe0, 0x48, 0x7e, 0xa0, 0x00, 0x47, 0xf3, 0xe3, 0x16, 0x49, 0x5a, 0x72, 0x80, 0x60,
+  0x6f, 0xf2, 0x01, 0x82, 0x9f, 0xa3, 0x90, 0x08, 0x8c, 0xdc, 0x05, 0xe6, 0x09, 0x11, 0xc7, 0xad,
+  0x2f, 0x6e, 0x5e, 0x58, 0xc3, 0x96, 0x39, 0x15, 0xe1, 0x90, 0x1c, 0xb7, 0xee, 0x28, 0xb9, 0x8f,
+  0x19, 0x17, 0x2d, 0xe4, 0xb2, 0x48, 0x90, 0x08, 0x96, 0xde, 0x53, 0x4f, 0x2c, 0x8e, 0x3d, 0x72,
+  0x47, 0x5d, 0x62, 0xa9, 0x87, 0x1e, 0xa2, 0x11, 0x15, 0x14, 0x07, 0x56, 0xe2, 0xe2, 0x80, 0x1c,
+  0xf7, 0x6d, 0xa7, 0x87, 0x42, 0xfc, 0x40, 0xc3, 0x65, 0x68, 0x0e, 0x2d, 0x13, 0xc2, 0xd5, 0x33,
+  0x9e, 0xc1, 0x50, 0xc4, 0x1a, 0xce, 0xc3, 0x71, 0x1c, 0x10, 0x2b, 0x64, 0x33, 0x0a, 0x1f, 0xf7,
+  0x64, 0x66, 0xc1, 0x80, 0xe5, 0xe2, 0x58, 0xee, 0x30, 0x74, 0x58, 0xa9, 0xeb, 0x3c, 0x6a, 0x73,
+  0x22, 0xb0, 0x58, 0x26, 0xd6, 0x0c, 0xc3, 0xd1, 0x62, 0x55, 0x92, 0x32, 0x0b, 0xb0, 0x7b, 0x6b,
+  0x09, 0x8e, 0xa3, 0x24, 0x58, 0xba, 0x30, 0xd4, 0x20, 0xf3, 0x57, 0xaa, 0x22, 0x16, 0x24, 0x24,
+  0x96, 0xcb, 0x02, 0xc6, 0x8d, 0xb5, 0x4f, 0xfa, 0xb8, 0x8f, 0xf7, 0x49, 0xb6, 0x5e, 0x50, 0x11,
+  0x90, 0xc9, 0xf4, 0xe5, 0xe9, 0xd5, 0xcd, 0x14, 0x5d, 0x9d, 0xbd, 0xb8, 0x39, 0xda, 0xd3, 0x43,
+  0x7a, 0x5a, 0xa9, 0xab, 0xbf, 0xcb, 0x9f, 0xdf, 0xad, 0x43, 0xcc, 0xe7, 0x34, 0x1a, 0x39, 0xe3,
+  0x18, 0x7b, 0x1e, 0x8d, 0xe6, 0xf0, 0x6d, 0xc6, 0x1e, 0xac, 0x84, 0x7e, 0x2b, 0x1f, 0x66, 0x8c,
+  0x7b, 0x60, 0x5f, 0x18, 0xd9, 0xe4, 0x7b, 0x24, 0x00, 0x7a, 0x33, 0xe6, 0xad, 0xd6, 0x0b, 0x42,
+  0xe7, 0x0b, 0x31, 0xea, 0x3b, 0xce, 0xc7, 0x63, 0x76, 0x47, 0xb8, 0x1f, 0xb0, 0xfb, 0xd1, 0x82,
+  0x7a, 0x1e, 0x89, 0x8a, 0xe5, 0x6a, 0xa5, 0x0f, 0xda, 0x5a, 0x3e, 0x0e, 0x69, 0xb0, 0x1a, 0x59,
+  0xda, 0xa4, 0xc9, 0x2a, 0x11, 0x24, 0xec, 0x3d, 0x0b, 0x68, 0x74, 0x7b, 0x8e, 0xdd, 0x6b, 0xf5,
+  0xf8, 0x02, 0xd6, 0xf5, 0x12, 0xb0, 0x9d, 0x05, 0x6e, 0xa5, 0xfe, 0x78, 0x06, 0xc6, 0x9c, 0x73,
+  0xb6, 0x8c, 0xbc, 0x51, 0x7a, 0xcf, 0xb1, 0xba, 0xff, 0xe8, 0x89, 0xef, 0xfb, 0xc5, 0x19, 0xf9,
+  0x97, 0x27, 0x12, 0x34, 0xd7, 0x2e, 0x27, 0x24, 0x5a, 0xc7, 0x2c, 0x01, 0x00, 0xb1, 0x68, 0xe4,
+  0xd3, 0x07, 0xe2, 0x8d, 0x69, 0x04, 0xa0, 0x94, 0xb7, 0xab, 0x8b, 0xf4, 0x68, 0x12, 0x07, 0x78,
+  0x35, 0xf2, 0x03, 0xf2, 0x30, 0x96, 0xff, 0x58, 0x1e, 0xe5, 0xc4, 0x55, 0x9b, 0xe1, 0xb8, 0x65,
+  0x18, 0x8d, 0x71, 0x40, 0xe7, 0x91, 0x45, 0x41, 0xc5, 0x64, 0x24, 0xbd, 0x4a, 0xf8, 0xf8, 0xdd,
+  0x32, 0x11, 0xd4, 0x5f, 0x59, 0xa9, 0x27, 0xb2, 0xe1, 0x6f, 0x2d, 0x1a, 0x79, 0xe4, 0x41, 0x5a,
+  0xc5, 0xd9, 0x34, 0x29, 0x86, 0x16, 0x7d, 0x6d, 0x0f, 0xb0, 0x31, 0x19, 0xf5, 0xed, 0x01, 0x09,
+  0xc7, 0xda, 0x0b, 0x60, 0x67, 0x21, 0x58, 0x38, 0xda, 0x77, 0xe2, 0x87, 0xe6, 0xad, 0xf1, 0x3a,
+  0xbd, 0xfe, 0x70, 0x38, 0xac, 0x6c, 0x3a, 0x80, 0x4d, 0x63, 0x41, 0x1e, 0x84, 0xa5, 0x74, 0xcd,
+  0xd4, 0xc9, 0xdd, 0x8a, 0x2a, 0x52, 0x01, 0xc3, 0x5c, 0x3c, 0x13, 0xd1, 0xda, 0x30, 0x08, 0xf8,
+  0x82, 0x00, 0xa6, 0xe7, 0x1c, 0x7b, 0x14, 0xb6, 0x77, 0xfa, 0x07, 0x03, 0x8f, 0xcc, 0x7b, 0x4f,
+  0x1c, 0xc7, 0xf7, 0x87, 0x43, 0xf9, 0x89, 0xf1, 0x60, 0xd0, 0x1d, 0x6b, 0x58, 0x8c, 0x22, 0x16,
+  0x91, 0xfc, 0x00, 0x29, 0x1e, 0x1d, 0x4a, 0x25, 0x52, 0xd0, 0x48, 0x21, 0xcb, 0x64, 0xd4, 0x1f,
+  0xc0, 0x50, 0xaa, 0x35, 0x98, 0x64, 0x6c, 0x5e, 0xfd, 0x00, 0xae, 0xae, 0x9e, 0xef, 0x35, 0x92,
+  0x66, 0x2c, 0xf0, 0xc6, 0xee, 0x92, 0x27, 0xb0, 0x38, 0x66, 0x54, 0x5e, 0xa0, 0xc9, 0xc9, 0x00,
+  0xa0, 0x75, 0xe6, 0x33, 0xa5, 0x83, 0x09, 0xc4, 0x46, 0xff, 0x6d, 0x4a, 0x9b, 0x6d, 0x0c, 0x73,
+  0x77, 0x64, 0x6d, 0xfa, 0xbd, 0xe1, 0x1c, 0x5b, 0x32, 0x1b, 0xe1, 0xbb, 0x0c, 0xf4, 0xa9, 0xa3,
+  0xed, 0xe3, 0x1f, 0x3c, 0x3d, 0x74, 0x7a, 0x4f, 0x06, 0x07, 0x07, 0x4f, 0x87, 0x07, 0xdd, 0xdc,
+  0x26, 0xfd, 0xfd, 0x26, 0x9f, 0x6c, 0xaa, 0x27, 0x54, 0x11, 0xd1, 0x27, 0x61, 0x93, 0x3a, 0x9a,
+  0x75, 0x4a, 0x5a, 0xd7, 0x40, 0x98, 0xc4, 0x18, 0x18, 0x74, 0x46, 0xc4, 0x3d, 0xc0, 0x25, 0xd7,
+  0x63, 0x08, 0xae, 0x51, 0x7e, 0x30, 0xae, 0xc2, 0xe7, 0x33, 0xdc, 0x71, 0x7a, 0xea, 0x8f, 0xfd,
+  0xb4, 0x6b, 0xf8, 0xc5, 0xb1, 0x87, 0xa6, 0x02, 0xb6, 0xc7, 0xc4, 0x5a, 0x71, 0x32, 0x18, 0x18,
+  0x64, 0xe4, 0xc6, 0xae, 0xb9, 0x7a, 0x00, 0xe6, 0xcf, 0xb4, 0xa3, 0x91, 0xb4, 0x95, 0x35, 0x0b,
+  0x98, 0x7b, 0x9b, 0x21, 0x95, 0xab, 0x8d, 0x03, 0x13, 0x86, 0x52, 0xb8, 0xcd, 0x6e, 0x4d, 0x1b,
+  0x83, 0x35, 0x9d, 0xca, 0x02, 0xc2, 0x4b, 0x5e, 0x78, 0xe2, 0x03, 0x8e, 0x70, 0x44, 0x43, 0xac,
+  0x5c, 0x3c, 0x93, 0x14, 0x82, 0xec, 0x83, 0x04, 0x52, 0x86, 0x2f, 0x83, 0x85, 0x14, 0xdb, 0xff,
+  0x70, 0x4b, 0x56, 0x3e, 0x07, 0xfa, 0x4c, 0x90, 0x5a, 0xb6, 0x06, 0x1d, 0xd7, 0x0c, 0x8c, 0x44,
+  0xc5, 0x6a, 0x64, 0xef, 0x6f, 0x1a, 0xe1, 0x15, 0x10, 0x2e, 0x5e, 0x2c, 0x83, 0xa0, 0x0c, 0xb2,
+  0x47, 0xf0, 0x89, 0x0f, 0x8a, 0x81, 0x6a, 0x06, 0x05, 0xfc, 0x66, 0x3a, 0x29, 0xae, 0xe9, 0x07,
+  0x38, 0x59, 0x20, 0x7b, 0xd0, 0x74, 0xcd, 0x42, 0xe7, 0xdd, 0xd8, 0x36, 0xcc, 0xa1, 0xc4, 0xad,
+  0x9d, 0x8f, 0x7b, 0x32, 0x6a, 0xd6, 0xf5, 0x5b, 0x6c, 0x06, 0x95, 0x61, 0xd7, 0x55, 0xc3, 0x4d,
+  0x87, 0x96, 0x01, 0x7c, 0xf0, 0x3e, 0x42, 0x2b, 0xf6, 0xd9, 0x61, 0x32, 0xaf, 0x91, 0xe1, 0x76,
+  0x12, 0xdb, 0x2a, 0x67, 0xb6, 0x84, 0x73, 0xa2, 0x34, 0x99, 0x59, 0x82, 0xc5, 0x9a, 0x0e, 0x4b,
+  0xdc, 0x34, 0x90, 0x23, 0xe6, 0x59, 0xfb, 0x70, 0x56, 0xf9, 0xde, 0xbe, 0x49, 0x54, 0x26, 0xc9,
+  0x55, 0x28, 0x2d, 0x97, 0x64, 0xf0, 0x56, 0x53, 0xc4, 0x86, 0x98, 0x46, 0x6b, 0xe9, 0x81, 0x51,
+  0x3f, 0x4f, 0x90, 0xd6, 0x6a, 0x84, 0x97, 0x82, 0x15, 0x1c, 0x51, 0xba, 0x93, 0xed, 0x62, 0xee,
+  0xad, 0xab, 0x61, 0xba, 0x3f, 0x18, 0xf4, 0xb2, 0xbf, 0x8e, 0xed, 0x0c, 0xbb, 0x4d, 0x0a, 0x95,
+  0x48, 0xa7, 0x6c, 0x7f, 0x23, 0x56, 0x47, 0x7d, 0x30, 0x45, 0xc2, 0x02, 0xea, 0xa1, 0x06, 0xd1,
+  0xfd, 0x6e, 0x45, 0x15, 0x5b, 0xd9, 0x78, 0x9d, 0x1e, 0x97, 0xe5, 0x5e, 0xc7, 0x19, 0x37, 0xa9,
+  0xa8, 0xb9, 0xa4, 0x3f, 0xa8, 0x0a, 0xb1, 0x24, 0xcd, 0xfd, 0x12, 0xde, 0x32, 0xb9, 0xe8, 0xd3,
+  0x1a, 0x9a, 0x86, 0x25, 0x83, 0xcd, 0xb0, 0x37, 0x27, 0xeb, 0xdc, 0xd3, 0x70, 0xbb, 0x61, 0x8d,
+  0x98, 0x86, 0x25, 0xcf, 0x3b, 0xf6, 0xef, 0x1b, 0xf2, 0x4e, 0x55, 0xa4, 0xcd, 0xa2, 0x2a, 0x2b,
+  0x19, 0xe8, 0xa8, 0xaf, 0xf6, 0xfd, 0xd2, 0xf2, 0xc3, 0xc3, 0x43, 0x63, 0x0d, 0x04, 0x7a, 0x6c,
+  0xe0, 0x7c, 0x5f, 0x32, 0x6c, 0x03, 0xce, 0x6b, 0xb9, 0xd0, 0x04, 0x09, 0x72, 0x2a, 0x02, 0x25,
+  0x6f, 0x66, 0x1a, 0xf9, 0xb5, 0xc9, 0x7b, 0xcc, 0xa3, 0x75, 0x5e, 0x2c, 0x7d, 0x3a, 0x74, 0x6a,
+  0x2b, 0x5c, 0x4e, 0xc5, 0xba, 0x70, 0xa9, 0x31, 0x0d, 0x04, 0xc3, 0x7e, 0xad, 0xbf, 0xe4, 0xcd,
+  0x8a, 0x22, 0xa5, 0x44, 0xe4, 0x8c, 0xaf, 0xb7, 0xc7, 0xf6, 0x61, 0x3d, 0x9d, 0x14, 0x38, 0x96,
+  0x11, 0x5d, 0x75, 0xe2, 0x70, 0x50, 0xc9, 0x52, 0x8c, 0xdb, 0xee, 0xba, 0x9e, 0xe1, 0x52, 0x64,
+  0x02, 0xb6, 0xc7, 0x8d, 0xd6, 0x52, 0x1b, 0x59, 0x63, 0xcc, 0xf5, 0x07, 0x1a, 0xd2, 0xfb, 0xdd,
+  0xf1, 0x16, 0x4b, 0x16, 0x62, 0x7c, 0x06, 0x69, 0xd2, 0x48, 0xb8, 0xdb, 0xdc, 0x9b, 0x41, 0x70,
+  0x50, 0xd8, 0x09, 0xb0, 0xb2, 0x35, 0x33, 0x1f, 0x74, 0x1b, 0x53, 0xd4, 0xd2, 0xa3, 0xec, 0x5a,
+  0xd7, 0x03, 0x95, 0xbc, 0x94, 0x06, 0x89, 0xaa, 0xc4, 0x02, 0xe2, 0x0b, 0x95, 0x95, 0x55, 0x3f,
+  0xe2, 0x33, 0x1e, 0x8e, 0x74, 0x67, 0x82, 0x05, 0xf9, 0xb2, 0x63, 0xc1, 0x4c, 0x77, 0xeb, 0xc1,
+  0xc3, 0x6e, 0xa9, 0x7c, 0xd8, 0xaf, 0xa7, 0xfb, 0x7d, 0xa7, 0xea, 0x11, 0xb8, 0x92, 0x99, 0x32,
+  0xb5, 0xe6, 0x47, 0x7b, 0x69, 0xd3, 0x71, 0xb4, 0xa7, 0x5b, 0xc5, 0x23, 0xd9, 0x12, 0xa4, 0xfd,
+  0x88, 0x47, 0xef, 0x10, 0xf5, 0x8e, 0x5b, 0x45, 0x8d, 0xdb, 0x2a, 0xba, 0x93, 0xa3, 0x45, 0x7f,
+  0xf2, 0xf3, 0x4f, 0xdf, 0xff, 0xf0, 0xbf, 0x7f, 0x7f, 0x8f, 0x5e, 0x4d, 0xaf, 0xa6, 0xe7, 0xa7,
+  0x37, 0x67, 0x27, 0xd3, 0x0b, 0x74, 0x7d, 0xf6, 0xf2, 0xf5, 0xe9, 0x15, 0x88, 0xeb, 0x1b, 0x6b,
+  0xe3, 0xc9, 0x29, 0x14, 0x48, 0x08, 0xca, 0x3b, 0x14, 0x32, 0x90, 0xc6, 0x38, 0xc1, 0x28, 0x60,
+  0x89, 0x6a, 0x82, 0x12, 0xb4, 0x42, 0x82, 0x20, 0x45, 0x66, 0x58, 0xf6, 0x4e, 0x40, 0x81, 0x11,
+  0xf5, 0x18, 0x0c, 0xdf, 0xd1, 0x19, 0x87, 0x72, 0x80, 0x45, 0xf6, 0xd1, 0x8c, 0x4f, 0xe4, 0xdf,
+  0x42, 0x66, 0x22, 0x38, 0x8b, 0xe6, 0x93, 0xb3, 0xf3, 0x57, 0x97, 0xd0, 0x4e, 0x5d, 0xdc, 0x9c,
+  0x8e, 0xe4, 0x65, 0xd4, 0x18, 0x7a, 0x4e, 0x66, 0x90, 0x45, 0x05, 0x03, 0x82, 0x43, 0x04, 0x32,
+  0x10, 0x83, 0x04, 0x84, 0x62, 0xcc, 0x41, 0x05, 0x99, 0x81, 0xf5, 0xa8, 0xf2, 0x13, 0xea, 0x70,
+  0xf2, 0xcd, 0x92, 0x82, 0x97, 0x18, 0xf2, 0x60, 0x30, 0xc2, 0x77, 0x64, 0x8e, 0x3d, 0xc6, 0xbb,
+  0xf6, 0xd1, 0x5e, 0x6c, 0x1c, 0xa7, 0xb3, 0x98, 0xb2, 0x47, 0x56, 0x9d, 0xb7, 0x10, 0x8b, 0xdc,
+  0x80, 0xba, 0xb7, 0xda, 0x44, 0xd3, 0x38, 0xee, 0x74, 0x5b, 0x60, 0x94, 0x1f, 0x7e, 0x40, 0xd3,
+  0x93, 0x9b, 0xb3, 0xd7, 0xd3, 0x2b, 0xa4, 0x7b, 0xbd, 0xeb, 0xa3, 0x3d, 0xbd, 0x3d, 0x35, 0xec,
+  0x1e, 0x58, 0x56, 0x7f, 0x2d, 0x1b, 0x1a, 0xec, 0x63, 0x5a, 0x58, 0x0e, 0xbb, 0x50, 0x09, 0x24,
+  0xc7, 0x2d, 0x5d, 0x8b, 0xb6, 0x26, 0xa6, 0xd5, 0xcf, 0x2f, 0x2f, 0xce, 0x6e, 0x2e, 0xaf, 0xd2,
+  0x46, 0x12, 0x26, 0x0c, 0xb9, 0xd5, 0xfd, 0xba, 0x3c, 0x35, 0x84, 0x6b, 0x13, 0xc6, 0x38, 0x9a,
+  0xa8, 0x7f, 0xb3, 0x75, 0x50, 0xd0, 0xb5, 0x94, 0x2a, 0xf2, 0x0b, 0x08, 0x34, 0x56, 0xc8, 0x51,
+  0x70, 0x4e, 0x74, 0xf3, 0x00, 0x33, 0xb6, 0x6d, 0x67, 0x93, 0xfa, 0xa3, 0x2e, 0x58, 0x6d, 0x10,
+  0x34, 0x84, 0xee, 0xd7, 0xb2, 0x46, 0x96, 0x55, 0x5d, 0xb8, 0x43, 0x5b, 0x99, 0x9a, 0xb5, 0x1a,
+  0x32, 0x43, 0x25, 0xad, 0x5d, 0x37, 0x93, 0xa1, 0xdd, 0x9a, 0xbc, 0x62, 0x01, 0x54, 0x90, 0x73,
+  0x04, 0x05, 0xd8, 0x77, 0xc6, 0xf1, 0xb0, 0x44, 0x7c, 0x11, 0x4b, 0x05, 0x72, 0x6d, 0x73, 0x41,
+  0xdb, 0xbd, 0x90, 0x55, 0x2e, 0x15, 0xb4, 0xff, 0xf7, 0xc7, 0x7f, 0x48, 0xb3, 0x6b, 0x97, 0x56,
+  0x00, 0x6e, 0x2a, 0x9f, 0xcc, 0x5b, 0x85, 0x9c, 0x73, 0x78, 0xaa, 0xa9, 0x9f, 0x62, 0x29, 0x47,
+  0x0f, 0x44, 0xf9, 0x54, 0x2e, 0x4e, 0xe1, 0xf3, 0x57, 0x19, 0x44, 0xa7, 0x17, 0x27, 0x67, 0xd3,
+  0xab, 0xc7, 0x02, 0xa7, 0xa0, 0x1c, 0x25, 0xe1, 0x6f, 0x68, 0xaa, 0xc0, 0xad, 0xd0, 0xce, 0x6a,
+  0xdb, 0x12, 0xc8, 0x2e, 0xb1, 0xd0, 0x23, 0x01, 0x11, 0x3a, 0x12, 0x4e, 0xc4, 0x43, 0x0f, 0xb1,
+  0xc4, 0xa5, 0x01, 0x30, 0x10, 0xe3, 0x3d, 0x34, 0x07, 0x2f, 0x5c, 0x30, 0x8f, 0x8c, 0x8b, 0x75,
+  0x52, 0xc9, 0xa9, 0xaa, 0x61, 0xd1, 0x31, 0xf2, 0x71, 0x90, 0x18, 0x93, 0x09, 0x0d, 0x48, 0xe4,
+  0x12, 0xaf, 0x3e, 0x73, 0x8f, 0x6f, 0xc9, 0x4b, 0x68, 0x35, 0x60, 0x26, 0x02, 0xb3, 0x8e, 0x0b,
+  0x4d, 0xfc, 0x65, 0xa4, 0x4a, 0x6f, 0x94, 0xc7, 0x0f, 0x5a, 0xe7, 0x66, 0xf2, 0x98, 0xbb, 0x0c,
+  0x81, 0x9c, 0xed, 0x39, 0x11, 0xa7, 0x01, 0x91, 0x5f, 0x9f, 0xad, 0xce, 0xbc, 0x4e, 0xbb, 0xe0,
+  0xa3, 0x76, 0xd7, 0x56, 0xfc, 0x65, 0xa7, 0xcc, 0x06, 0x27, 0xb4, 0x25, 0xb9, 0xb5, 0xc7, 0xef,
+  0x97, 0x02, 0xc1, 0x06, 0xdb, 0x95, 0xd3, 0x5e, 0xd2, 0x44, 0xd8, 0xc0, 0xa7, 0x30, 0xa8, 0x2e,
+  0xd7, 0xee, 0x8e, 0xeb, 0xbc, 0xbe, 0xb7, 0x87, 0x4e, 0x80, 0xb6, 0xb8, 0x7e, 0xbb, 0xf3, 0xa0,
+  0xf8, 0x22, 0xe3, 0x90, 0xe7, 0xa7, 0xcf, 0x4e, 0x51, 0x02, 0xcd, 0x22, 0x89, 0x10, 0x27, 0x49,
+  0xbc, 0x24, 0x8a, 0xee, 0x90, 0xf2, 0xaf, 0xe2, 0x95, 0x65, 0xb2, 0xc4, 0x9c, 0xb2, 0x6e, 0x2e,
+  0x2e, 0xb3, 0xb9, 0x34, 0x0a, 0xb9, 0x47, 0x9d, 0x7b, 0x68, 0x4b, 0xd8, 0xbd, 0xad, 0xfc, 0x76,
+  0xa2, 0x4f, 0x40, 0xdf, 0x7d, 0x87, 0xd2, 0xe1, 0x7b, 0x32, 0xbb, 0x05, 0x0b, 0x19, 0x93, 0xdd,
+  0xce, 0x16, 0x25, 0xcf, 0x19, 0xb0, 0xa0, 0x56, 0xd3, 0xa7, 0x3c, 0x54, 0xf4, 0x99, 0xcf, 0xc3,
+  0x60, 0x02, 0xae, 0x52, 0x48, 0x81, 0x93, 0xb7, 0x1b, 0xa7, 0x00, 0x94, 0x69, 0x0c, 0xbd, 0xb1,
+  0x6e, 0x73, 0xd5, 0x49, 0x1a, 0x46, 0x87, 0xee, 0xeb, 0x06, 0x22, 0x9f, 0x2d, 0x45, 0x07, 0x5c,
+  0x7a, 0x3c, 0xd9, 0xba, 0x51, 0x39, 0xab, 0x07, 0x09, 0xcc, 0x71, 0xb6, 0x5d, 0x07, 0xcb, 0xa2,
+  0x06, 0x4c, 0x0b, 0xe1, 0x2b, 0x30, 0x60, 0x13, 0x49, 0x94, 0x45, 0x1e, 0xf5, 0x70, 0xbe, 0x4c,
+  0x52, 0x38, 0x58, 0xfc, 0xcf, 0x29, 0xce, 0xb6, 0x59, 0xe6, 0x2c, 0xa2, 0x2e, 0x05, 0xcb, 0xc4,
+  0x9a, 0x2c, 0xf2, 0x29, 0x9f, 0x08, 0x77, 0xf1, 0x1c, 0x0b, 0x6c, 0x6e, 0x84, 0x2b, 0x9c, 0xc9,
+  0xc2, 0xe0, 0x0e, 0x07, 0x9d, 0x7c, 0x41, 0x0f, 0x1a, 0x95, 0xad, 0x9a, 0xbe, 0x96, 0xc9, 0x8a,
+  0xeb, 0x34, 0x93, 0x19, 0x9f, 0xe7, 0x0b, 0xa8, 0xdf, 0x81, 0xdc, 0x42, 0xe7, 0x32, 0xb6, 0x6c,
+  0x95, 0xd7, 0x04, 0xe9, 0xa2, 0xda, 0x50, 0x67, 0x3f, 0x97, 0xbf, 0x29, 0xe2, 0x04, 0x27, 0xab,
+  0xc8, 0x2d, 0xa2, 0xa5, 0x76, 0x5f, 0x23, 0x6a, 0x04, 0x5f, 0x19, 0x4f, 0xe9, 0xc9, 0xed, 0x2c,
+  0x04, 0xdb, 0x10, 0x69, 0xc5, 0xa1, 0xdd, 0xca, 0x4a, 0xf9, 0x63, 0x04, 0x2b, 0xbe, 0xc7, 0x54,
+  0x18, 0x2a, 0x66, 0x53, 0x76, 0x7a, 0x7e, 0xa7, 0x9d, 0xa4, 0x51, 0x38, 0x2e, 0x89, 0x29, 0x8a,
+  0xa2, 0x0d, 0x72, 0x31, 0x98, 0xae, 0x03, 0x37, 0x5d, 0x6f, 0xde, 0x73, 0x29, 0xc3, 0x0b, 0x3b,
+  0xaf, 0xa3, 0x21, 0xcc, 0x73, 0xfd, 0xd4, 0xbe, 0x4e, 0x7b, 0x0f, 0xc7, 0x74, 0x2f, 0xa9, 0x21,
+  0xb6, 0xd8, 0xe1, 0xe5, 0x3b, 0xb8, 0xfd, 0x0e, 0x2a, 0x8c, 0x4e, 0x65, 0x55, 0xe9, 0x61, 0x6b,
+  0x60, 0x40, 0x5e, 0xcc, 0x58, 0xe3, 0x02, 0x5a, 0x75, 0x89, 0x61, 0x18, 0x42, 0xcc, 0x44, 0xff,
+  0x4e, 0x01, 0x69, 0x0a, 0x05, 0x21, 0x32, 0x8a, 0x4f, 0x74, 0xc9, 0x2e, 0xc5, 0x5c, 0xfe, 0xe9,
+  0xb1, 0x22, 0x74, 0x56, 0xab, 0x49, 0x90, 0x34, 0xf2, 0x5c, 0x42, 0x08, 0x26, 0x18, 0xf8, 0x09,
+  0xd8, 0x5a, 0x06, 0xe1, 0xb5, 0xe0, 0x00, 0xf6, 0xea, 0x6d, 0x01, 0x14, 0x9e, 0xed, 0x2e, 0x39,
+  0x87, 0xbd, 0x6f, 0x64, 0x96, 0xee, 0x6e, 0x3f, 0x4f, 0x4e, 0xd7, 0x4e, 0x2b, 0xef, 0xb6, 0x21,
+  0xa2, 0x29, 0x00, 0x02, 0xb5, 0xbb, 0x5f, 0xf5, 0xbf, 0xde, 0x61, 0x58, 0xd8, 0x01, 0x85, 0xcc,
+  0x89, 0x4c, 0xeb, 0xa0, 0x00, 0xa7, 0xbe, 0x48, 0xaa, 0xde, 0x5a, 0x90, 0x34, 0x1d, 0x36, 0xad,
+  0x30, 0x11, 0xf5, 0x9b, 0x3c, 0x46, 0x38, 0xff, 0xcd, 0x2e, 0xbb, 0x3e, 0xbb, 0x40, 0x27, 0x97,
+  0x17, 0xa7, 0x5f, 0x9e, 0x5d, 0x5e, 0x18, 0xc2, 0x6a, 0x48, 0x37, 0x02, 0xb7, 0xb8, 0xbd, 0xbe,
+  0x99, 0x71, 0x0b, 0x0d, 0x53, 0x77, 0x17, 0x2d, 0xab, 0x72, 0xc8, 0x84, 0xb7, 0x0b, 0xed, 0x20,
+  0x90, 0xe3, 0xe7, 0x37, 0xe7, 0x2f, 0x61, 0x9f, 0x12, 0x69, 0xfb, 0x34, 0x00, 0xde, 0xea, 0xf0,
+  0xe3, 0x09, 0xb4, 0x4e, 0xea, 0x4d, 0x5f, 0xd7, 0x0e, 0x71, 0xdc, 0xe1, 0x92, 0x88, 0x9b, 0x62,
+  0x49, 0xc8, 0x33, 0xb9, 0xea, 0x3b, 0xdf, 0xe0, 0xbb, 0x39, 0x9a, 0x20, 0xab, 0xef, 0xa0, 0xcf,
+  0x50, 0x5b, 0x36, 0xa1, 0x6d, 0x34, 0xaa, 0xce, 0x0d, 0xe5, 0x9c, 0x6c, 0x61, 0xe5, 0x5c, 0xbb,
+  0x06, 0xfd, 0xf4, 0x1e, 0x5a, 0xa8, 0x2a, 0x19, 0xde, 0xe8, 0xb4, 0xaa, 0x44, 0xc2, 0x0d, 0x74,
+  0x1d, 0xa1, 0x36, 0xcb, 0xc7, 0xca, 0x76, 0x4e, 0xc4, 0x92, 0x47, 0xe8, 0xad, 0x59, 0x53, 0x7d,
+  0xb4, 0x76, 0xdd, 0x4d, 0xa5, 0x7a, 0xad, 0xd6, 0x5d, 0xf9, 0xcb, 0x8c, 0x96, 0x2e, 0x58, 0x27,
+  0x1f, 0xad, 0xb9, 0x2d, 0x7f, 0x39, 0xb3, 0x29, 0x95, 0xb1, 0xe9, 0x6a, 0xf5, 0x62, 0x00, 0x2a,
+  0xb0, 0xd6, 0xe4, 0xf2, 0xa2, 0x5e, 0x1b, 0x6e, 0x3b, 0x43, 0x9a, 0x01, 0x7d, 0xb4, 0x16, 0x52,
+  0x19, 0x29, 0x3e, 0x33, 0x0b, 0x04, 0xdc, 0x0b, 0xd9, 0xe0, 0x75, 0xfa, 0xdd, 0xcd, 0x7f, 0xfe,
+  0xf5, 0x08, 0x41, 0xb2, 0x89, 0x37, 0xf5, 0x84, 0xfc, 0xa9, 0x5e, 0x24, 0x96, 0x74, 0x55, 0x33,
+  0x3c, 0x49, 0xe8, 0xc6, 0x7b, 0x16, 0x3e, 0x5e, 0x49, 0xd9, 0x33, 0x23, 0xb9, 0x55, 0x7e, 0x79,
+  0xc3, 0x62, 0x12, 0x7d, 0xd6, 0x66, 0xed, 0x51, 0xdb, 0x6d, 0xa7, 0x5a, 0x1b, 0xe3, 0x3f, 0xff,
+  0xf4, 0xe3, 0x3f, 0xd1, 0xf4, 0xd9, 0x99, 0x2c, 0x69, 0x61, 0x09, 0x94, 0x8e, 0x7f, 0x47, 0x27,
+  0x10, 0x1a, 0xd8, 0xc3, 0xed, 0x4d, 0xc3, 0x59, 0x7a, 0xe8, 0xad, 0x81, 0xf5, 0xae, 0xfd, 0x8e,
+  0xd1, 0xa8, 0xd3, 0x6e, 0x77, 0x65, 0xb9, 0xd2, 0x56, 0x8a, 0xa8, 0x34, 0x2f, 0xad, 0x55, 0x6d,
+  0xb2, 0x8d, 0x9e, 0x3a, 0xeb, 0x5f, 0x9f, 0x42, 0xa3, 0xda, 0x9a, 0x5c, 0x43, 0x5a, 0x52, 0xbd,
+  0xa0, 0x3e, 0xa0, 0x3d, 0xde, 0x1a, 0x42, 0x26, 0x3d, 0x6c, 0x09, 0xa1, 0x05, 0x4e, 0xd4, 0x82,
+  0x3c, 0x22, 0x12, 0x16, 0x12, 0x0d, 0xff, 0x32, 0x20, 0xcd, 0x40, 0x52, 0x3b, 0xd5, 0xe4, 0x73,
+  0xb8, 0xc1, 0xae, 0xd2, 0x28, 0x6b, 0x0f, 0x1a, 0xab, 0x44, 0xe0, 0xd5, 0xfc, 0xf8, 0x4f, 0x3e,
+  0x41, 0x1f, 0x66, 0x55, 0x71, 0xb7, 0x9e, 0x94, 0x3f, 0x34, 0xca, 0xe9, 0xa6, 0x4c, 0x5c, 0xae,
+  0xb6, 0x05, 0x5f, 0x92, 0x71, 0xf3, 0x1a, 0x50, 0xf8, 0xfd, 0x75, 0x6c, 0x23, 0x1b, 0x17, 0x37,
+  0x87, 0xae, 0x25, 0x69, 0x64, 0x90, 0x92, 0xbd, 0x34, 0x8f, 0x1c, 0x4f, 0xde, 0xe6, 0xb1, 0x35,
+  0x52, 0x48, 0xd3, 0x8b, 0x42, 0x92, 0x24, 0x78, 0x4e, 0x36, 0x6f, 0x1b, 0x8e, 0xdd, 0x6d, 0x4e,
+  0xe8, 0x92, 0x80, 0x5d, 0x4d, 0x2a, 0x93, 0xfa, 0xa4, 0xc8, 0x92, 0x6d, 0xff, 0xa3, 0x6e, 0xa2,
+  0xfa, 0xf2, 0x69, 0x80, 0x79, 0xd8, 0x69, 0x58, 0x9e, 0x16, 0x58, 0x2f, 0x19, 0x8b, 0x3b, 0x3b,
+  0x0a, 0x16, 0x02, 0xad, 0x8b, 0xf2, 0x4e, 0xe6, 0xc6, 0xaa, 0x6b, 0xb6, 0x36, 0x41, 0xb9, 0x1a,
+  0x8d, 0x8d, 0xd0, 0x0e, 0x8f, 0x71, 0x12, 0xb2, 0x3b, 0xb2, 0xcd, 0x69, 0x89, 0x60, 0x71, 0xed,
+  0x52, 0xdb, 0x53, 0x8c, 0x69, 0x04, 0x43, 0x73, 0x85, 0xb7, 0xb4, 0xe5, 0xe8, 0xa6, 0x1c, 0x3b,
+  0xde, 0x51, 0x65, 0xe5, 0xdd, 0x8e, 0xea, 0x08, 0xe5, 0x0b, 0x11, 0x5d, 0xd8, 0x26, 0x14, 0x72,
+  0x18, 0x2e, 0x2d, 0x2d, 0x7a, 0x46, 0x59, 0x61, 0xa5, 0x67, 0xd8, 0x50, 0x19, 0x82, 0xb5, 0x2f,
+  0xf3, 0xb9, 0xaa, 0xcd, 0xb3, 0xee, 0xb2, 0xbe, 0xe7, 0x8f, 0x30, 0xb3, 0xb3, 0x38, 0x2b, 0x0e,
+  0xb4, 0x65, 0x6a, 0x26, 0xae, 0xe8, 0x64, 0xd2, 0xb6, 0x1c, 0x92, 0xaf, 0xcb, 0x8f, 0xf2, 0xa0,
+  0x7e, 0xa5, 0x91, 0xe2, 0xdc, 0x47, 0x1e, 0x25, 0x56, 0xb1, 0x2a, 0x1e, 0x92, 0x6f, 0xa0, 0x93,
+  0x23, 0x95, 0xa4, 0x65, 0xac, 0xf3, 0x55, 0x75, 0x1c, 0xb9, 0x2b, 0x1b, 0x5a, 0x87, 0xa5, 0xdc,
+  0x32, 0x74, 0x9c, 0x2d, 0x6a, 0xc9, 0x2f, 0xf9, 0x32, 0xc7, 0x3e, 0x78, 0x9c, 0x26, 0xca, 0xc5,
+  0x3b, 0x2d, 0xa4, 0xda, 0x40, 0x6f, 0x09, 0x28, 0x40, 0xa0, 0x8e, 0x2b, 0xd5, 0xa1, 0x58, 0x3b,
+  0x90, 0xf8, 0x60, 0x07, 0xd6, 0xe4, 0x47, 0x35, 0x54, 0x0d, 0x8f, 0x9d, 0x15, 0x7c, 0x01, 0xba,
+  0x62, 0x6b, 0x05, 0x73, 0x06, 0x38, 0x20, 0x3d, 0x98, 0x94, 0x27, 0x9f, 0x0b, 0x76, 0xac, 0x22,
+  0xd2, 0x6c, 0xac, 0xa6, 0x92, 0x8d, 0x22, 0xf9, 0xd2, 0x2e, 0x12, 0x9c, 0x48, 0x73, 0x7e, 0xfe,
+  0x2d, 0x5a, 0xa1, 0x43, 0xf9, 0x59, 0x21, 0x70, 0x69, 0x7c, 0x30, 0xe5, 0x2e, 0x77, 0x1c, 0x2b,
+  0x87, 0x40, 0x2d, 0x02, 0xfb, 0xa1, 0x04, 0x29, 0x39, 0xa7, 0x71, 0x1f, 0x74, 0x82, 0xaf, 0xe5,
+  0xd6, 0xa9, 0xea, 0x69, 0x3b, 0x72, 0xa2, 0x67, 0x60, 0x56, 0x57, 0xc1, 0x72, 0xaa, 0x29, 0x1f,
+  0x18, 0x9d, 0x70, 0x6e, 0x24, 0xd5, 0x45, 0x76, 0xc7, 0x3b, 0x42, 0x38, 0x8f, 0xf8, 0xf7, 0x35,
+  0x76, 0x85, 0xc2, 0x4d, 0x19, 0xa4, 0x84, 0x99, 0x3a, 0xed, 0x55, 0x96, 0x40, 0x5b, 0x9e, 0x85,
+  0xc9, 0xce, 0x85, 0xa5, 0xd7, 0x38, 0xbf, 0xb0, 0xe7, 0xcb, 0xef, 0x58, 0x62, 0xe3, 0x2a, 0x4f,
+  0x3d, 0x16, 0x24, 0xcd, 0x3d, 0x75, 0xd9, 0x0e, 0xf5, 0x0e, 0xfb, 0xab, 0x03, 0xc7, 0x91, 0xbf,
+  0x58, 0xed, 0x19, 0x9f, 0x5f, 0xd7, 0xb8, 0xb5, 0xe2, 0x3c, 0x43, 0xdf, 0xd2, 0xeb, 0x8a, 0xed,
+  0xfd, 0x6c, 0xf1, 0x52, 0xcf, 0xd0, 0xc8, 0xc8, 0x0d, 0xe5, 0x84, 0xde, 0xc8, 0xf2, 0x8f, 0xa9,
+  0x41, 0x1e, 0x95, 0x47, 0x76, 0x80, 0xa8, 0xde, 0x44, 0xcb, 0xff, 0x23, 0xa5, 0x2b, 0xf4, 0x1e,
+  0x5a, 0x87, 0x44, 0x2c, 0x98, 0x37, 0x6a, 0xbf, 0xba, 0xbc, 0xbe, 0x69, 0x6f, 0x76, 0x12, 0x43,
+  0xb5, 0x0e, 0x7a, 0xd4, 0xeb, 0x8e, 0x7e, 0x93, 0x25, 0x21, 0xe6, 0xaf, 0x08, 0x60, 0x11, 0xa0,
+  0x08, 0x51, 0x9f, 0xbf, 0x91, 0x48, 0x28, 0x78, 0x04, 0xc5, 0x94, 0x70, 0x8f, 0x7c, 0x50, 0xb2,
+  0x0f, 0xd4, 0x3c, 0xa7, 0x77, 0xf0, 0x45, 0x9a, 0x41, 0xbe, 0x2c, 0xea, 0xb4, 0xef, 0x68, 0x42,
+  0x67, 0x14, 0x7a, 0xd2, 0x95, 0xbb, 0xc0, 0xd1, 0x5c, 0xbe, 0x64, 0xd2, 0x6f, 0xa2, 0x4a, 0x50,
+  0xcb, 0x05, 0x14, 0xcb, 0xe5, 0x4b, 0x2f, 0xcd, 0x12, 0x5a, 0x46, 0x40, 0xda, 0xaa, 0x90, 0xcb,
+  0xb4, 0xa8, 0xe2, 0x6b, 0xc7, 0xbb, 0xa7, 0x14, 0xfd, 0xe9, 0x08, 0x14, 0xf0, 0xe9, 0x6b, 0xd7,
+  0xa3, 0x3d, 0xfd, 0x4b, 0x96, 0xa3, 0x3d, 0xfd, 0xdf, 0xf6, 0xfe, 0x0f, 0x66, 0x68, 0xbd, 0xdb,
+  0xc7, 0x27, 0x00, 0x00,
+};
+
+#endif
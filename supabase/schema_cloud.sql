@@ -176,3 +176,4 @@ LEFT JOIN LATERAL (
 ALTER PUBLICATION supabase_realtime ADD TABLE readings;
 ALTER PUBLICATION supabase_realtime ADD TABLE alerts;
 ALTER PUBLICATION supabase_realtime ADD TABLE devices;
+ALTER PUBLICATION supabase_realtime ADD TABLE commands;  -- Comandos por push al ESP32
@@ -0,0 +1,121 @@
+const http = require('http');
+
+// Mide la API local del firmware v2 (sin dependencias): tiempo al primer
+// byte (TTFB), tiempo total y tamaño por endpoint, y el piso de heap que
+// reporta el equipo en /api/status → web.heap_min / web.handler_us_max.
+//
+//   node api-bench.js --host reefer.local [--port 80] [--requests 200]
+//        [--concurrency 4] [--paths /api/status,/api/config,/api/sensors,/api/history]
+//        [--fields sensor.temp_avg,sensor.door_open,system.alert_active] [--msgpack]
+//
+// --fields agrega ?fields= a cada path y --msgpack pide MessagePack por
+// Accept: comparar la columna de bytes contra una corrida sin opciones.
+//
+// Correr antes y después de un cambio con el mismo equipo y la misma red:
+// heap_min es el mínimo desde el boot, así que conviene reiniciar antes.
+
+function parseArgs(argv) {
+  const args = {};
+  for (let i = 0; i < argv.length; i++) {
+    if (!argv[i].startsWith('--')) continue;
+    const next = argv[i + 1];
+    if (next === undefined || next.startsWith('--')) args[argv[i].slice(2)] = true;
+    else { args[argv[i].slice(2)] = next; i++; }
+  }
+  return args;
+}
+
+const args = parseArgs(process.argv.slice(2));
+const HOST = args.host || 'reefer.local';
+const PORT = parseInt(args.port || 80);
+const REQUESTS = parseInt(args.requests || 200);
+const CONCURRENCY = parseInt(args.concurrency || 4);
+const PATHS = (args.paths || '/api/status,/api/config,/api/sensors,/api/history').split(',');
+const FIELDS = typeof args.fields === 'string' ? args.fields : null;
+const HEADERS = args.msgpack ? { Accept: 'application/msgpack' } : {};
+
+const agent = new http.Agent({ keepAlive: false, maxSockets: CONCURRENCY });
+
+function withFields(path) {
+  if (!FIELDS) return path;
+  return path + (path.includes('?') ? '&' : '?') + 'fields=' + encodeURIComponent(FIELDS);
+}
+
+function get(path, headers = {}) {
+  return new Promise((resolve) => {
+    const start = process.hrtime.bigint();
+    const ms = () => Number(process.hrtime.bigint() - start) / 1e6;
+    let ttfb = null;
+    const req = http.request({ host: HOST, port: PORT, path, method: 'GET', headers, agent, timeout: 10000 }, (res) => {
+      let bytes = 0;
+      let body = '';
+      res.on('data', (c) => {
+        if (ttfb === null) ttfb = ms();
+        bytes += c.length;
+        body += c;
+      });
+      res.on('end', () => resolve({ status: res.statusCode, ttfb: ttfb === null ? ms() : ttfb, total: ms(), bytes, body }));
+    });
+    req.on('timeout', () => req.destroy(new Error('timeout')));
+    req.on('error', (e) => resolve({ status: 0, error: e.message, ttfb: ms(), total: ms(), bytes: 0 }));
+    req.end();
+  });
+}
+
+function percentile(sorted, p) {
+  if (!sorted.length) return 0;
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+async function deviceWeb() {
+  const r = await get('/api/status');
+  try {
+    return JSON.parse(r.body).web || null;
+  } catch (e) {
+    return null;
+  }
+}
+
+async function bench(path) {
+  const ttfb = [];
+  const total = [];
+  let bytes = 0;
+  let errors = 0;
+  let next = 0;
+
+  const worker = async () => {
+    while (next < REQUESTS) {
+      next++;
+      const r = await get(withFields(path), HEADERS);
+      if (r.status !== 200) { errors++; continue; }
+      ttfb.push(r.ttfb);
+      total.push(r.total);
+      bytes = r.bytes;
+    }
+  };
+  await Promise.all(Array.from({ length: CONCURRENCY }, worker));
+
+  ttfb.sort((a, b) => a - b);
+  total.sort((a, b) => a - b);
+  console.log(`  ${path.padEnd(14)} ${String(bytes).padStart(6)} B` +
+              `  TTFB p50 ${percentile(ttfb, 0.5).toFixed(1)} ms  p95 ${percentile(ttfb, 0.95).toFixed(1)} ms` +
+              `  total p50 ${percentile(total, 0.5).toFixed(1)} ms` +
+              (errors ? `  (errores ${errors})` : ''));
+}
+
+(async () => {
+  console.log(`[BENCH] ${HOST}:${PORT}, ${REQUESTS} requests por endpoint, ${CONCURRENCY} en paralelo` +
+              (FIELDS ? `, fields=${FIELDS}` : '') + (args.msgpack ? ', MessagePack' : ''));
+  const before = await deviceWeb();
+  for (const path of PATHS) await bench(path);
+  const after = await deviceWeb();
+
+  if (before && after) {
+    console.log(`\n  heap mínimo desde el boot  ${before.heap_min} → ${after.heap_min} bytes`);
+    if (after.handler_us_max !== undefined) {
+      console.log(`  handler más lento          ${after.handler_us_max} µs (hasta entregar a AsyncTCP)`);
+    }
+  } else {
+    console.log('\n  (el equipo no reporta web.heap_min en /api/status)');
+  }
+})();
@@ -0,0 +1,165 @@
+const http = require('http');
+
+// Generador de carga para la ingesta HTTP del receptor (sin dependencias)
+// Compara lecturas sueltas (/api/data) contra lotes (/api/data/batch) y
+// toma la cuenta del receptor de /api/status → ingest.processed.
+//
+//   node load-generator.js --host 192.168.1.100 [--port 80] [--mode both]
+//        [--rifts 6] [--batch 50] [--concurrency 2] [--seconds 15]
+//
+//   --mode single | batch | both
+//   --batch        lecturas por request en modo batch
+//   --concurrency  requests en vuelo a la vez (el WebServer del ESP32
+//                  atiende de a uno: más de 2-3 solo agrega colas de TCP)
+
+function parseArgs(argv) {
+  const args = {};
+  for (let i = 0; i < argv.length; i++) {
+    if (!argv[i].startsWith('--')) continue;
+    const next = argv[i + 1];
+    if (next === undefined || next.startsWith('--')) args[argv[i].slice(2)] = true;
+    else { args[argv[i].slice(2)] = next; i++; }
+  }
+  return args;
+}
+
+const args = parseArgs(process.argv.slice(2));
+const HOST = args.host || '192.168.1.100';
+const PORT = parseInt(args.port || 80);
+const RIFTS = parseInt(args.rifts || 6);
+const BATCH = parseInt(args.batch || 50);
+const CONCURRENCY = parseInt(args.concurrency || 2);
+const SECONDS = parseFloat(args.seconds || 15);
+const MODE = args.mode || 'both';
+
+// El ESP32 cierra la conexión en cada respuesta: sin keep-alive
+const agent = new http.Agent({ keepAlive: false, maxSockets: CONCURRENCY });
+
+// seq por RIFT compartido entre modos (el receptor descarta repetidos)
+const seq = new Array(RIFTS + 1).fill(0);
+const bootMs = Date.now();
+const temps = new Array(RIFTS + 1).fill(0).map(() => -20 - Math.random() * 3);
+
+function reading(riftId) {
+  temps[riftId] += (Math.random() - 0.5) * 0.2;
+  return {
+    rift_id: riftId,
+    seq: ++seq[riftId],
+    sender_ms: Date.now() - bootMs,
+    temp1: +(temps[riftId] + 0.1).toFixed(2),
+    temp2: +(temps[riftId] - 0.1).toFixed(2),
+    temp_avg: +temps[riftId].toFixed(2),
+    door_open: false,
+    door_open_since: 0,
+    sensor_count: 2,
+    rssi: -60
+  };
+}
+
+function request(method, path, body) {
+  return new Promise((resolve) => {
+    const start = process.hrtime.bigint();
+    const data = body ? JSON.stringify(body) : null;
+    const req = http.request({
+      host: HOST, port: PORT, path, method, agent, timeout: 10000,
+      headers: data ? { 'Content-Type': 'application/json', 'Content-Length': Buffer.byteLength(data) } : {}
+    }, (res) => {
+      let chunks = '';
+      res.on('data', (c) => chunks += c);
+      res.on('end', () => resolve({
+        status: res.statusCode, body: chunks,
+        ms: Number(process.hrtime.bigint() - start) / 1e6
+      }));
+    });
+    req.on('timeout', () => req.destroy(new Error('timeout')));
+    req.on('error', (e) => resolve({ status: 0, error: e.message, ms: Number(process.hrtime.bigint() - start) / 1e6 }));
+    if (data) req.write(data);
+    req.end();
+  });
+}
+
+async function receptorProcessed() {
+  const r = await request('GET', '/api/status');
+  try {
+    const ingest = JSON.parse(r.body).ingest;
+    return ingest ? ingest.processed : null;
+  } catch (e) {
+    return null;
+  }
+}
+
+function percentile(sorted, p) {
+  if (!sorted.length) return 0;
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+async function run(mode) {
+  const stats = { requests: 0, readings: 0, errors: 0, full: 0, latencies: [] };
+  const before = await receptorProcessed();
+  const deadline = Date.now() + SECONDS * 1000;
+  let nextRift = 1;
+
+  const worker = async () => {
+    while (Date.now() < deadline) {
+      let res, count;
+      if (mode === 'single') {
+        res = await request('POST', '/api/data', reading(nextRift));
+        count = 1;
+        nextRift = nextRift % RIFTS + 1;
+      } else {
+        const readings = [];
+        for (let i = 0; i < BATCH; i++) {
+          readings.push(reading(nextRift));
+          nextRift = nextRift % RIFTS + 1;
+        }
+        res = await request('POST', '/api/data/batch', { readings });
+        count = BATCH;
+      }
+      stats.requests++;
+      stats.latencies.push(res.ms);
+      if (res.status === 200) {
+        if (mode === 'batch') {
+          try { stats.readings += JSON.parse(res.body).queued; } catch (e) { stats.readings += count; }
+        } else {
+          stats.readings += count;
+        }
+      } else if (res.status === 503) {
+        stats.full++;
+      } else {
+        stats.errors++;
+      }
+    }
+  };
+
+  const start = Date.now();
+  await Promise.all(Array.from({ length: CONCURRENCY }, worker));
+  const elapsed = (Date.now() - start) / 1000;
+
+  // Dar tiempo al worker del receptor a vaciar la cola
+  await new Promise((r) => setTimeout(r, 1000));
+  const after = await receptorProcessed();
+
+  stats.latencies.sort((a, b) => a - b);
+  const rate = stats.readings / elapsed;
+  console.log(`\n[${mode.toUpperCase()}] ${elapsed.toFixed(1)} s, ${CONCURRENCY} en paralelo` +
+              (mode === 'batch' ? `, ${BATCH} lecturas/request` : ''));
+  console.log(`  requests   ${stats.requests}  (errores ${stats.errors}, cola llena ${stats.full})`);
+  console.log(`  lecturas   ${stats.readings}  →  ${rate.toFixed(1)} lecturas/s`);
+  console.log(`  latencia   p50 ${percentile(stats.latencies, 0.5).toFixed(1)} ms` +
+              `  p95 ${percentile(stats.latencies, 0.95).toFixed(1)} ms` +
+              `  p99 ${percentile(stats.latencies, 0.99).toFixed(1)} ms`);
+  if (before !== null && after !== null) {
+    console.log(`  receptor   ingest.processed +${after - before} (${((after - before) / elapsed).toFixed(1)}/s)`);
+  }
+  return rate;
+}
+
+(async () => {
+  console.log(`[LOAD] Receptor ${HOST}:${PORT}, ${RIFTS} RIFTs`);
+  const results = {};
+  if (MODE === 'single' || MODE === 'both') results.single = await run('single');
+  if (MODE === 'batch' || MODE === 'both') results.batch = await run('batch');
+  if (results.single && results.batch) {
+    console.log(`\nBatch / single: x${(results.batch / results.single).toFixed(1)}`);
+  }
+})();
@@ -0,0 +1,294 @@
+const net = require('net');
+const http = require('http');
+const url = require('url');
+
+// Broker MQTT 3.1.1 mínimo para pruebas de integración (sin dependencias)
+// Soporta lo que usa firmware_v2/mqtt_transport.h:
+// - QoS 0/1 (PUBACK), sesiones persistentes (cleanSession = false)
+// - Cola de QoS1 para clientes desconectados, mensajes retenidos, LWT
+// - Wildcards + y # en suscripciones
+//
+// Puerto 1883: MQTT
+// Puerto 1884: HTTP para inyectar comandos y ver estadísticas
+//   /pub?topic=reefer/REEFER_DEV_BHI/cmd&msg=toggle_relay
+//   /stats
+
+const MQTT_PORT = 1883;
+const HTTP_PORT = 1884;
+
+const sessions = new Map();   // clientId -> sesión
+const retained = new Map();   // topic -> { payload, qos }
+const stats = { connects: 0, published: 0, delivered: 0, queued: 0, bytesIn: 0, byTopic: {} };
+
+// ============================================
+// CODIFICACIÓN
+// ============================================
+function encodeLength(len) {
+  const bytes = [];
+  do {
+    let b = len % 128;
+    len = Math.floor(len / 128);
+    if (len > 0) b |= 0x80;
+    bytes.push(b);
+  } while (len > 0);
+  return Buffer.from(bytes);
+}
+
+function packet(type, flags, body) {
+  return Buffer.concat([Buffer.from([(type << 4) | flags]), encodeLength(body.length), body]);
+}
+
+function str(s) {
+  const b = Buffer.from(s);
+  const len = Buffer.alloc(2);
+  len.writeUInt16BE(b.length);
+  return Buffer.concat([len, b]);
+}
+
+function u16(n) {
+  const b = Buffer.alloc(2);
+  b.writeUInt16BE(n);
+  return b;
+}
+
+function readStr(buf, offset) {
+  const len = buf.readUInt16BE(offset);
+  return [buf.slice(offset + 2, offset + 2 + len).toString(), offset + 2 + len];
+}
+
+function topicMatches(filter, topic) {
+  const f = filter.split('/');
+  const t = topic.split('/');
+  for (let i = 0; i < f.length; i++) {
+    if (f[i] === '#') return true;
+    if (i >= t.length) return false;
+    if (f[i] !== '+' && f[i] !== t[i]) return false;
+  }
+  return f.length === t.length;
+}
+
+// ============================================
+// ENTREGA
+// ============================================
+function sendPublish(session, topic, payload, qos, retain, dup) {
+  let id = null;
+  const header = [str(topic)];
+  if (qos > 0) {
+    id = session.nextId = (session.nextId % 65535) + 1;
+    header.push(u16(id));
+    session.inflight.set(id, { topic, payload, qos });
+  }
+  const flags = (dup ? 0x08 : 0) | (qos << 1) | (retain ? 1 : 0);
+  session.sock.write(packet(3, flags, Buffer.concat([...header, payload])));
+  stats.delivered++;
+}
+
+function route(topic, payload, qos, retain) {
+  stats.published++;
+  stats.byTopic[topic] = (stats.byTopic[topic] || 0) + 1;
+
+  if (retain) {
+    if (payload.length === 0) retained.delete(topic);
+    else retained.set(topic, { payload, qos });
+  }
+
+  for (const session of sessions.values()) {
+    for (const [filter, subQos] of session.subs) {
+      if (!topicMatches(filter, topic)) continue;
+      const q = Math.min(qos, subQos);
+      if (session.sock) {
+        sendPublish(session, topic, payload, q, false, false);
+      } else if (q > 0) {
+        session.queue.push({ topic, payload, qos: q });
+        stats.queued++;
+      }
+      break;
+    }
+  }
+}
+
+// ============================================
+// CONEXIÓN DE CLIENTE
+// ============================================
+function handlePacket(sock, type, flags, body) {
+  const session = sock.session;
+
+  if (type === 1) {                                   // CONNECT
+    let [, o] = readStr(body, 0);
+    const connFlags = body[o + 1];
+    const keepAlive = body.readUInt16BE(o + 2);
+    let clientId;
+    [clientId, o] = readStr(body, o + 4);
+    let will = null;
+    if (connFlags & 0x04) {
+      let wt, wp;
+      [wt, o] = readStr(body, o);
+      const wl = body.readUInt16BE(o);
+      wp = body.slice(o + 2, o + 2 + wl);
+      o += 2 + wl;
+      will = { topic: wt, payload: wp, qos: (connFlags >> 3) & 3, retain: !!(connFlags & 0x20) };
+    }
+    const clean = !!(connFlags & 0x02);
+    if (!clientId) clientId = 'anon-' + Math.random().toString(16).slice(2, 8);
+
+    let s = sessions.get(clientId);
+    const present = !!s && !clean;
+    if (s && s.sock && s.sock !== sock) {
+      s.sock.takenOver = true;
+      s.sock.destroy();
+    }
+    if (!s || clean) {
+      s = { clientId, subs: new Map(), queue: [], inflight: new Map(), nextId: 0 };
+      sessions.set(clientId, s);
+    }
+    s.sock = sock;
+    s.clean = clean;
+    s.will = will;
+    sock.session = s;
+    stats.connects++;
+
+    sock.write(packet(2, 0, Buffer.from([present ? 1 : 0, 0])));
+    console.log('[MQTT] CONNECT ' + clientId + ' (clean=' + clean + ', sesión ' +
+                (present ? 'recuperada, ' + s.queue.length + ' en cola' : 'nueva') + ', keepalive ' + keepAlive + 's)');
+
+    // Reenviar QoS1 sin PUBACK y luego la cola offline
+    for (const m of s.inflight.values()) s.queue.unshift(m);
+    s.inflight.clear();
+    const pending = s.queue.splice(0);
+    for (const m of pending) sendPublish(s, m.topic, m.payload, m.qos, false, false);
+    return;
+  }
+
+  if (!session) { sock.destroy(); return; }
+
+  if (type === 3) {                                   // PUBLISH
+    const qos = (flags >> 1) & 3;
+    let [topic, o] = readStr(body, 0);
+    let id = null;
+    if (qos > 0) { id = body.readUInt16BE(o); o += 2; }
+    const payload = body.slice(o);
+    console.log('[MQTT] ' + session.clientId + ' → ' + topic + ' (qos' + qos + ', ' + payload.length + ' B) ' +
+                payload.toString().substring(0, 120));
+    if (qos === 1) sock.write(packet(4, 0, u16(id)));
+    route(topic, payload, qos, !!(flags & 1));
+  } else if (type === 4) {                            // PUBACK
+    session.inflight.delete(body.readUInt16BE(0));
+  } else if (type === 8) {                            // SUBSCRIBE
+    const id = body.readUInt16BE(0);
+    let o = 2;
+    const granted = [];
+    const filters = [];
+    while (o < body.length) {
+      let filter;
+      [filter, o] = readStr(body, o);
+      const q = Math.min(body[o++] & 3, 1);
+      session.subs.set(filter, q);
+      granted.push(q);
+      filters.push(filter);
+    }
+    sock.write(packet(9, 0, Buffer.concat([u16(id), Buffer.from(granted)])));
+    console.log('[MQTT] SUBSCRIBE ' + session.clientId + ' ' + filters.join(', '));
+    for (const [topic, m] of retained) {
+      if (filters.some(f => topicMatches(f, topic))) sendPublish(session, topic, m.payload, m.qos, true, false);
+    }
+  } else if (type === 10) {                           // UNSUBSCRIBE
+    const id = body.readUInt16BE(0);
+    let o = 2;
+    while (o < body.length) {
+      let filter;
+      [filter, o] = readStr(body, o);
+      session.subs.delete(filter);
+    }
+    sock.write(packet(11, 0, u16(id)));
+  } else if (type === 12) {                           // PINGREQ
+    sock.write(packet(13, 0, Buffer.alloc(0)));
+  } else if (type === 14) {                           // DISCONNECT
+    session.will = null;
+    sock.end();
+  }
+}
+
+const broker = net.createServer(sock => {
+  let buf = Buffer.alloc(0);
+
+  sock.on('data', chunk => {
+    stats.bytesIn += chunk.length;
+    buf = Buffer.concat([buf, chunk]);
+    while (buf.length >= 2) {
+      let len = 0, mult = 1, i = 1, b;
+      do {
+        if (i >= buf.length) return;
+        b = buf[i++];
+        len += (b & 0x7f) * mult;
+        mult *= 128;
+      } while (b & 0x80);
+      if (buf.length < i + len) return;
+      const type = buf[0] >> 4;
+      const flags = buf[0] & 0x0f;
+      const body = buf.slice(i, i + len);
+      buf = buf.slice(i + len);
+      handlePacket(sock, type, flags, body);
+    }
+  });
+
+  sock.on('close', () => {
+    const s = sock.session;
+    if (!s || s.sock !== sock) return;
+    s.sock = null;
+    console.log('[MQTT] Desconectado ' + s.clientId + (sock.takenOver ? ' (reemplazado)' : ''));
+    if (s.will) {
+      route(s.will.topic, s.will.payload, s.will.qos, s.will.retain);
+      s.will = null;
+    }
+    if (s.clean) sessions.delete(s.clientId);
+  });
+  sock.on('error', () => {});
+});
+
+// ============================================
+// HTTP DE CONTROL
+// ============================================
+const control = http.createServer((req, res) => {
+  const parsed = url.parse(req.url, true);
+
+  if (parsed.pathname === '/pub') {
+    const topic = parsed.query.topic;
+    if (!topic) {
+      res.writeHead(400);
+      res.end('Falta topic');
+      return;
+    }
+    route(topic, Buffer.from(parsed.query.msg || ''), parseInt(parsed.query.qos || '1'), parsed.query.retain === '1');
+    console.log('[HTTP] Publicado ' + topic + ': ' + (parsed.query.msg || ''));
+    res.writeHead(200, { 'Content-Type': 'application/json' });
+    res.end('{"success":true}');
+  } else if (parsed.pathname === '/stats') {
+    const list = [];
+    for (const s of sessions.values()) {
+      list.push({ client_id: s.clientId, connected: !!s.sock, subs: [...s.subs.keys()], queued: s.queue.length, inflight: s.inflight.size });
+    }
+    res.writeHead(200, { 'Content-Type': 'application/json' });
+    res.end(JSON.stringify({ ...stats, sessions: list, retained: [...retained.keys()] }, null, 2));
+  } else {
+    res.writeHead(404);
+    res.end('Not found');
+  }
+});
+
+broker.listen(MQTT_PORT, '0.0.0.0');
+control.listen(HTTP_PORT, '0.0.0.0', () => {
+  console.log('');
+  console.log('========================================================');
+  console.log('     BROKER MQTT - Servidor de Prueba Local');
+  console.log('========================================================');
+  console.log('');
+  console.log('  MQTT:    puerto ' + MQTT_PORT + ' (MQTT_BROKER_HOST en config.h)');
+  console.log('  Control: http://localhost:' + HTTP_PORT);
+  console.log('');
+  console.log('  Comandos de simulacion:');
+  console.log('    /pub?topic=reefer/REEFER_DEV_BHI/cmd&msg=toggle_relay');
+  console.log('    /stats   -> Sesiones, colas y mensajes por topico');
+  console.log('');
+  console.log('========================================================');
+  console.log('');
+});
@@ -0,0 +1,239 @@
+const http = require('http');
+const crypto = require('crypto');
+const url = require('url');
+
+// Sustituto local de Supabase para probar comandos por push:
+// - REST:     GET/PATCH/POST /rest/v1/commands (subset de PostgREST)
+// - Realtime: /realtime/v1/websocket (protocolo Phoenix vsn 1.0.0)
+// En firmware/config.h: SUPABASE_URL "http://<IP>:4000"
+
+const PORT = 4000;
+
+let commands = [];
+let nextId = 1;
+const sockets = new Set();
+
+// Métricas: latencia insert -> ACK y cantidad de requests REST
+const stats = { inserted: 0, acked: 0, restGets: 0, restPatches: 0, latencies: [] };
+
+// ============================================
+// WEBSOCKET (RFC 6455, solo lo necesario)
+// ============================================
+function wsEncode(text) {
+  const payload = Buffer.from(text);
+  let header;
+  if (payload.length < 126) {
+    header = Buffer.from([0x81, payload.length]);
+  } else {
+    header = Buffer.alloc(4);
+    header[0] = 0x81;
+    header[1] = 126;
+    header.writeUInt16BE(payload.length, 2);
+  }
+  return Buffer.concat([header, payload]);
+}
+
+function wsDecode(sock, chunk) {
+  sock.buf = Buffer.concat([sock.buf, chunk]);
+  const messages = [];
+
+  while (sock.buf.length >= 2) {
+    const opcode = sock.buf[0] & 0x0f;
+    const masked = (sock.buf[1] & 0x80) !== 0;
+    let len = sock.buf[1] & 0x7f;
+    let offset = 2;
+    if (len === 126) {
+      if (sock.buf.length < 4) break;
+      len = sock.buf.readUInt16BE(2);
+      offset = 4;
+    } else if (len === 127) {
+      if (sock.buf.length < 10) break;
+      len = Number(sock.buf.readBigUInt64BE(2));
+      offset = 10;
+    }
+    const maskLen = masked ? 4 : 0;
+    if (sock.buf.length < offset + maskLen + len) break;
+
+    const mask = sock.buf.slice(offset, offset + maskLen);
+    const data = Buffer.from(sock.buf.slice(offset + maskLen, offset + maskLen + len));
+    if (masked) for (let i = 0; i < data.length; i++) data[i] ^= mask[i % 4];
+    sock.buf = sock.buf.slice(offset + maskLen + len);
+
+    if (opcode === 0x8) { sock.end(); break; }
+    if (opcode === 0x9) { sock.write(Buffer.concat([Buffer.from([0x8a, data.length]), data])); continue; }
+    if (opcode === 0x1) messages.push(data.toString());
+  }
+  return messages;
+}
+
+function phxSend(sock, topic, event, payload, ref) {
+  sock.write(wsEncode(JSON.stringify({ topic, event, payload, ref: ref || null })));
+}
+
+function handlePhoenix(sock, text) {
+  let msg;
+  try { msg = JSON.parse(text); } catch (e) { return; }
+
+  if (msg.event === 'heartbeat') {
+    phxSend(sock, 'phoenix', 'phx_reply', { status: 'ok', response: {} }, msg.ref);
+  } else if (msg.event === 'phx_join') {
+    const changes = (msg.payload.config && msg.payload.config.postgres_changes) || [];
+    const filter = changes.length ? changes[0].filter || '' : '';
+    sock.topic = msg.topic;
+    sock.deviceId = filter.startsWith('device_id=eq.') ? filter.substring(13) : null;
+    phxSend(sock, msg.topic, 'phx_reply', { status: 'ok', response: { postgres_changes: changes } }, msg.ref);
+    console.log('[WS] Suscripto ' + msg.topic + ' (device ' + sock.deviceId + ')');
+  }
+}
+
+function pushInsert(record) {
+  for (const sock of sockets) {
+    if (!sock.topic || (sock.deviceId && sock.deviceId !== record.device_id)) continue;
+    phxSend(sock, sock.topic, 'postgres_changes', {
+      ids: [record.id],
+      data: { type: 'INSERT', schema: 'public', table: 'commands', record, commit_timestamp: record.created_at }
+    });
+  }
+}
+
+// ============================================
+// REST (subset de PostgREST)
+// ============================================
+function matches(cmd, query) {
+  for (const [key, value] of Object.entries(query)) {
+    if (key === 'id' && value.startsWith('in.(')) {
+      const ids = value.slice(4, -1).split(',').map(Number);
+      if (!ids.includes(cmd.id)) return false;
+    } else if (value.startsWith('eq.')) {
+      const expected = value.substring(3);
+      if (String(cmd[key]) !== expected) return false;
+    }
+  }
+  return true;
+}
+
+function insertCommand(deviceId, command) {
+  const record = {
+    id: nextId++,
+    device_id: deviceId,
+    command,
+    payload: {},
+    executed: false,
+    executed_at: null,
+    created_at: new Date().toISOString(),
+    _t: process.hrtime.bigint()
+  };
+  commands.push(record);
+  stats.inserted++;
+  const { _t, ...pub } = record;
+  pushInsert(pub);
+  console.log('[DB] INSERT comando #' + record.id + ' ' + command + ' -> ' + deviceId);
+  return pub;
+}
+
+function readBody(req, cb) {
+  let body = '';
+  req.on('data', chunk => body += chunk);
+  req.on('end', () => cb(body));
+}
+
+const server = http.createServer((req, res) => {
+  const parsed = url.parse(req.url, true);
+  const path = parsed.pathname;
+
+  if (path === '/rest/v1/commands' && req.method === 'GET') {
+    stats.restGets++;
+    let rows = commands.filter(c => matches(c, parsed.query));
+    if (parsed.query.limit) rows = rows.slice(0, parseInt(parsed.query.limit));
+    res.writeHead(200, { 'Content-Type': 'application/json' });
+    res.end(JSON.stringify(rows.map(({ _t, ...pub }) => pub)));
+  } else if (path === '/rest/v1/commands' && req.method === 'PATCH') {
+    stats.restPatches++;
+    readBody(req, body => {
+      const changes = JSON.parse(body || '{}');
+      const now = process.hrtime.bigint();
+      for (const cmd of commands.filter(c => matches(c, parsed.query))) {
+        if (changes.executed && !cmd.executed) {
+          const ms = Number(now - cmd._t) / 1e6;
+          stats.acked++;
+          stats.latencies.push(ms);
+          console.log('[DB] ACK comando #' + cmd.id + ' en ' + ms.toFixed(0) + ' ms');
+        }
+        Object.assign(cmd, changes);
+      }
+      res.writeHead(204);
+      res.end();
+    });
+  } else if (path === '/rest/v1/commands' && req.method === 'POST') {
+    readBody(req, body => {
+      const data = JSON.parse(body || '{}');
+      const record = insertCommand(data.device_id, data.command);
+      res.writeHead(201, { 'Content-Type': 'application/json' });
+      res.end(JSON.stringify([record]));
+    });
+  } else if (path.startsWith('/rest/v1/')) {
+    // readings, alerts, devices: se aceptan y se descartan
+    readBody(req, () => {
+      res.writeHead(req.method === 'GET' ? 200 : 201, { 'Content-Type': 'application/json' });
+      res.end('[]');
+    });
+  } else if (path === '/sim/command') {
+    // /sim/command?device=REEFER-01&cmd=toggle_relay
+    const record = insertCommand(parsed.query.device || 'REEFER-01', parsed.query.cmd || 'stop_alert');
+    res.writeHead(200, { 'Content-Type': 'application/json' });
+    res.end(JSON.stringify(record));
+  } else if (path === '/sim/stats') {
+    const lat = stats.latencies.slice().sort((a, b) => a - b);
+    const pct = p => lat.length ? lat[Math.min(lat.length - 1, Math.floor(lat.length * p))].toFixed(0) : null;
+    res.writeHead(200, { 'Content-Type': 'application/json' });
+    res.end(JSON.stringify({
+      inserted: stats.inserted,
+      acked: stats.acked,
+      rest_gets: stats.restGets,
+      rest_patches: stats.restPatches,
+      websockets: sockets.size,
+      latency_ms: { p50: pct(0.5), p95: pct(0.95), max: lat.length ? lat[lat.length - 1].toFixed(0) : null }
+    }));
+  } else {
+    res.writeHead(404);
+    res.end('Not found');
+  }
+});
+
+server.on('upgrade', (req, sock) => {
+  if (!req.url.startsWith('/realtime/v1/websocket')) {
+    sock.destroy();
+    return;
+  }
+
+  const accept = crypto.createHash('sha1')
+    .update(req.headers['sec-websocket-key'] + '258EAFA5-E914-47DA-95CA-C5AB0DC85B11')
+    .digest('base64');
+  sock.write('HTTP/1.1 101 Switching Protocols\r\n' +
+             'Upgrade: websocket\r\nConnection: Upgrade\r\n' +
+             'Sec-WebSocket-Accept: ' + accept + '\r\n\r\n');
+
+  sock.buf = Buffer.alloc(0);
+  sockets.add(sock);
+  console.log('[WS] Cliente conectado (' + sockets.size + ')');
+
+  sock.on('data', chunk => wsDecode(sock, chunk).forEach(text => handlePhoenix(sock, text)));
+  sock.on('close', () => { sockets.delete(sock); console.log('[WS] Cliente desconectado'); });
+  sock.on('error', () => sockets.delete(sock));
+});
+
+server.listen(PORT, '0.0.0.0', () => {
+  console.log('');
+  console.log('========================================================');
+  console.log('     SUPABASE LOCAL - Comandos por push (Realtime)');
+  console.log('========================================================');
+  console.log('');
+  console.log('  SUPABASE_URL: http://<IP>:' + PORT);
+  console.log('');
+  console.log('  Comandos de simulacion:');
+  console.log('    /sim/command?device=REEFER-01&cmd=toggle_relay');
+  console.log('    /sim/stats   -> Latencia insert->ACK y requests');
+  console.log('');
+  console.log('========================================================');
+  console.log('');
+});
@@ -0,0 +1,663 @@
+const dgram = require('dgram');
+
+// Simulador de paquetes emisor ↔ receptor (sin radios ni dependencias)
+// Implementa el formato de emisor/rift_protocol.h byte a byte.
+//
+// Modos:
+//   node rift-packet-sim.js emit --host 192.168.1.100 [--rifts 6] [--rate 5]
+//        [--loss 5] [--dup 2] [--reorder 5] [--restart 0] [--seconds 60]
+//     N emisores falsos mandan frames UDP al receptor real con pérdida,
+//     duplicados, desorden y reinicios (%); mide ACKs y latencia.
+//     Comparar con /api/status → rifts[].link del receptor.
+//
+//   node rift-packet-sim.js receptor [--port 4210]
+//     Hace de receptor UDP: valida CRC, lleva la secuencia por RIFT y
+//     responde ACK. Para probar un emisor real sin ESP32.
+//
+//   node rift-packet-sim.js air [--rifts 6] [--minutes 60] [--loss 2] [--seed 1]
+//        [--interval 30] [--no-persist]
+//     Simula ESP-NOW en memoria con reloj virtual: emparejamiento por
+//     barrido de canales, pares cifrados, ACK, corte del AP, reinicio del
+//     receptor y vuelta del AP en otro canal. Imprime entrega por RIFT.
+//
+//   node rift-packet-sim.js pair [--mac 24:6F:28:00:00:01] [--receptor-mac ...] [--rift 1]
+//     Vectores del emparejamiento (PAIR_REQ / PAIR_ACK en hex + LMK) para
+//     comparar contra el Serial del firmware.
+
+// Debe coincidir con RIFT_SITE_KEY de emisor.ino y receptor.ino
+const SITE_KEY = Buffer.from([
+  0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x69,
+  0x63, 0x61, 0x6E, 0x2D, 0x52, 0x49, 0x46, 0x54
+]);
+
+const RIFT_UDP_PORT = 4210;
+const RIFT_MAGIC = 0xA7;
+const RIFT_VERSION = 1;
+const TYPE_READING = 1, TYPE_ACK = 2, TYPE_PAIR_REQ = 3, TYPE_PAIR_ACK = 4;
+const FLAG_DOOR_OPEN = 0x01, FLAG_ACK_REQ = 0x02, FLAG_RETRY = 0x04;
+const TEMP_NONE = -32768;
+const SEQ_WINDOW = 32;
+const SIZES = { [TYPE_READING]: 32, [TYPE_ACK]: 14, [TYPE_PAIR_REQ]: 20, [TYPE_PAIR_ACK]: 20 };
+
+// ============================================
+// CODIFICACIÓN (igual que rift_protocol.h)
+// ============================================
+function crc16(buf, len = buf.length) {
+  let crc = 0xFFFF;
+  for (let i = 0; i < len; i++) {
+    crc ^= buf[i] << 8;
+    for (let b = 0; b < 8; b++) crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) & 0xFFFF : (crc << 1) & 0xFFFF;
+  }
+  return crc;
+}
+
+function encodeTemp(t) {
+  if (t === null || t <= -999 || Number.isNaN(t)) return TEMP_NONE;
+  return Math.max(-32767, Math.min(32767, Math.round(t * 100)));
+}
+
+function decodeTemp(v) {
+  return v === TEMP_NONE ? -999 : v / 100;
+}
+
+function finalize(buf) {
+  buf[0] = RIFT_MAGIC;
+  buf[1] = RIFT_VERSION;
+  buf.writeUInt16LE(crc16(buf, buf.length - 2), buf.length - 2);
+  return buf;
+}
+
+function frameValid(buf, type) {
+  if (!buf || buf.length !== SIZES[type]) return false;
+  if (buf[0] !== RIFT_MAGIC || buf[1] !== RIFT_VERSION || buf[2] !== type) return false;
+  return buf.readUInt16LE(buf.length - 2) === crc16(buf, buf.length - 2);
+}
+
+function encodeFrame(f) {
+  const b = Buffer.alloc(32);
+  b[2] = TYPE_READING;
+  b[3] = f.riftId;
+  b.writeUInt32LE(f.seq >>> 0, 4);
+  b.writeUInt32LE(f.senderMs >>> 0, 8);
+  b.writeInt16LE(encodeTemp(f.temp1), 12);
+  b.writeInt16LE(encodeTemp(f.temp2), 14);
+  b.writeInt16LE(encodeTemp(f.tempAvg), 16);
+  b[18] = f.flags || 0;
+  b[19] = f.sensorCount || 0;
+  b.writeUInt16LE(Math.min(65535, f.doorOpenSec || 0), 20);
+  b.writeInt8(Math.max(-128, Math.min(127, f.rssi || 0)), 22);
+  b.writeUInt32LE(f.uptimeSec >>> 0, 24);
+  b.writeUInt16LE(Math.min(65535, f.sendFailures || 0), 28);
+  return finalize(b);
+}
+
+function decodeFrame(b) {
+  if (!frameValid(b, TYPE_READING)) return null;
+  return {
+    riftId: b[3], seq: b.readUInt32LE(4), senderMs: b.readUInt32LE(8),
+    temp1: decodeTemp(b.readInt16LE(12)), temp2: decodeTemp(b.readInt16LE(14)),
+    tempAvg: decodeTemp(b.readInt16LE(16)), flags: b[18], sensorCount: b[19],
+    doorOpenSec: b.readUInt16LE(20), rssi: b.readInt8(22), uptimeSec: b.readUInt32LE(24),
+    sendFailures: b.readUInt16LE(28)
+  };
+}
+
+function encodeAck(riftId, seq, senderMs) {
+  const b = Buffer.alloc(14);
+  b[2] = TYPE_ACK;
+  b[3] = riftId;
+  b.writeUInt32LE(seq >>> 0, 4);
+  b.writeUInt32LE(senderMs >>> 0, 8);
+  return finalize(b);
+}
+
+function decodeAck(b) {
+  if (!frameValid(b, TYPE_ACK)) return null;
+  return { riftId: b[3], seq: b.readUInt32LE(4), senderMs: b.readUInt32LE(8) };
+}
+
+// ============================================
+// SIPHASH-2-4 / EMPAREJAMIENTO
+// ============================================
+const M64 = (1n << 64n) - 1n;
+const rotl = (x, b) => ((x << BigInt(b)) | (x >> BigInt(64 - b))) & M64;
+
+function sipHash(key, msg) {
+  const k0 = key.readBigUInt64LE(0), k1 = key.readBigUInt64LE(8);
+  let v0 = k0 ^ 0x736f6d6570736575n, v1 = k1 ^ 0x646f72616e646f6dn;
+  let v2 = k0 ^ 0x6c7967656e657261n, v3 = k1 ^ 0x7465646279746573n;
+  const round = () => {
+    v0 = (v0 + v1) & M64; v1 = rotl(v1, 13); v1 ^= v0; v0 = rotl(v0, 32);
+    v2 = (v2 + v3) & M64; v3 = rotl(v3, 16); v3 ^= v2;
+    v0 = (v0 + v3) & M64; v3 = rotl(v3, 21); v3 ^= v0;
+    v2 = (v2 + v1) & M64; v1 = rotl(v1, 17); v1 ^= v2; v2 = rotl(v2, 32);
+  };
+  const full = msg.length - (msg.length % 8);
+  for (let i = 0; i < full; i += 8) {
+    const m = msg.readBigUInt64LE(i);
+    v3 ^= m; round(); round(); v0 ^= m;
+  }
+  let b = BigInt(msg.length & 0xFF) << 56n;
+  for (let i = 0; i < msg.length % 8; i++) b |= BigInt(msg[full + i]) << BigInt(8 * i);
+  v3 ^= b; round(); round(); v0 ^= b;
+  v2 ^= 0xFFn;
+  for (let i = 0; i < 4; i++) round();
+  return (v0 ^ v1 ^ v2 ^ v3) & M64;
+}
+
+function pairTag(buf, mac) {
+  return sipHash(SITE_KEY, Buffer.concat([buf.subarray(0, 10), mac]));
+}
+
+function encodePair(type, riftId, nonce, channel, senderMac) {
+  const b = Buffer.alloc(20);
+  b[0] = RIFT_MAGIC;
+  b[1] = RIFT_VERSION;
+  b[2] = type;
+  b[3] = riftId;
+  b.writeUInt32LE(nonce >>> 0, 4);
+  b[8] = channel;
+  b.writeBigUInt64LE(pairTag(b, senderMac), 10);
+  return finalize(b);
+}
+
+function decodePair(b, type, senderMac) {
+  if (!frameValid(b, type)) return null;
+  if (b.readBigUInt64LE(10) !== pairTag(b, senderMac)) return null;
+  return { riftId: b[3], nonce: b.readUInt32LE(4), channel: b[8] };
+}
+
+function deriveLmk(emisorMac) {
+  const out = Buffer.alloc(16);
+  for (let half = 0; half < 2; half++) {
+    const msg = Buffer.concat([Buffer.from([0x4C + half]), emisorMac]);
+    out.writeBigUInt64LE(sipHash(SITE_KEY, msg), half * 8);
+  }
+  return out;
+}
+
+// ============================================
+// SECUENCIA (igual que riftSeqAccept)
+// ============================================
+class SeqTracker {
+  constructor() {
+    this.started = false;
+    this.received = this.lost = this.reordered = this.duplicates = this.restarts = 0;
+  }
+
+  reset(seq, senderMs) {
+    this.started = true;
+    this.highest = seq;
+    this.window = 1;
+    this.lastSenderMs = senderMs;
+    this.firstSenderMs = senderMs;
+  }
+
+  accept(seq, senderMs) {
+    if (!this.started) { this.reset(seq, senderMs); this.received++; return 'new'; }
+    if (seq > this.highest) {
+      const gap = seq - this.highest;
+      this.lost += gap - 1;
+      this.window = gap >= SEQ_WINDOW ? 1 : ((this.window << gap) | 1) >>> 0;
+      this.highest = seq;
+      this.lastSenderMs = senderMs;
+      this.received++;
+      return 'new';
+    }
+    const diff = this.highest - seq;
+    if (senderMs < this.lastSenderMs && (diff >= SEQ_WINDOW || senderMs < this.firstSenderMs)) {
+      this.restarts++;
+      this.reset(seq, senderMs);
+      this.received++;
+      return 'restart';
+    }
+    if (diff < SEQ_WINDOW) {
+      const bit = (1 << diff) >>> 0;
+      if (this.window & bit) { this.duplicates++; return 'duplicate'; }
+      this.window = (this.window | bit) >>> 0;
+      if (this.lost > 0) this.lost--;
+      this.reordered++;
+      this.received++;
+      return 'late';
+    }
+    this.duplicates++;
+    return 'duplicate';
+  }
+
+  lossPct() {
+    const expected = this.received + this.lost;
+    return expected ? 100 * this.lost / expected : 0;
+  }
+}
+
+// ============================================
+// UTILIDADES
+// ============================================
+function parseArgs(argv) {
+  const args = { _: [] };
+  for (let i = 0; i < argv.length; i++) {
+    if (!argv[i].startsWith('--')) { args._.push(argv[i]); continue; }
+    const key = argv[i].slice(2);
+    const next = argv[i + 1];
+    if (next === undefined || next.startsWith('--')) args[key] = true;
+    else { args[key] = next; i++; }
+  }
+  return args;
+}
+
+function parseMac(s) {
+  return Buffer.from(s.split(':').map(h => parseInt(h, 16)));
+}
+
+function macStr(b) {
+  return [...b].map(x => x.toString(16).padStart(2, '0').toUpperCase()).join(':');
+}
+
+// PRNG con semilla: las corridas de "air" son reproducibles
+function mulberry32(seed) {
+  return () => {
+    seed = (seed + 0x6D2B79F5) | 0;
+    let t = Math.imul(seed ^ (seed >>> 15), 1 | seed);
+    t = (t + Math.imul(t ^ (t >>> 7), 61 | t)) ^ t;
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+}
+
+// ============================================
+// MODO emit: emisores falsos contra el receptor real
+// ============================================
+function runEmit(args) {
+  const host = args.host || '192.168.1.100';
+  const port = parseInt(args.port || RIFT_UDP_PORT);
+  const riftCount = parseInt(args.rifts || 6);
+  const rate = parseFloat(args.rate || 5);            // frames/seg por RIFT
+  const lossPct = parseFloat(args.loss || 0);
+  const dupPct = parseFloat(args.dup || 0);
+  const reorderPct = parseFloat(args.reorder || 0);
+  const restartPct = parseFloat(args.restart || 0);
+  const seconds = parseFloat(args.seconds || 60);
+
+  const sock = dgram.createSocket('udp4');
+  const start = Date.now();
+  const rifts = [];
+  for (let i = 1; i <= riftCount; i++) {
+    rifts.push({ id: i, seq: 0, boot: Date.now(), held: null, temp: -20 - Math.random() * 3,
+                 sent: 0, dropped: 0, acked: 0, latencySum: 0 });
+  }
+  const pending = new Map();   // "rift:seq" -> hora de envío
+
+  sock.on('message', (msg) => {
+    const ack = decodeAck(msg);
+    if (!ack) return;
+    const key = ack.riftId + ':' + ack.seq;
+    if (!pending.has(key)) return;
+    const r = rifts[ack.riftId - 1];
+    r.acked++;
+    r.latencySum += Date.now() - pending.get(key);
+    pending.delete(key);
+  });
+
+  const send = (r, buf) => sock.send(buf, port, host);
+
+  const tick = () => {
+    for (const r of rifts) {
+      if (Math.random() * 100 < restartPct) {
+        r.seq = 0;
+        r.boot = Date.now();
+        console.log(`[SIM] RIFT-${r.id} reinicia`);
+      }
+      r.temp += (Math.random() - 0.5) * 0.2;
+      const senderMs = Date.now() - r.boot;
+      const buf = encodeFrame({
+        riftId: r.id, seq: ++r.seq, senderMs, temp1: r.temp + 0.1, temp2: r.temp - 0.1,
+        tempAvg: r.temp, flags: FLAG_ACK_REQ, sensorCount: 2, rssi: -60,
+        uptimeSec: Math.floor(senderMs / 1000)
+      });
+      r.sent++;
+      pending.set(r.id + ':' + r.seq, Date.now());
+
+      if (Math.random() * 100 < lossPct) { r.dropped++; continue; }
+      if (Math.random() * 100 < reorderPct && !r.held) { r.held = buf; continue; }
+      send(r, buf);
+      if (Math.random() * 100 < dupPct) send(r, buf);
+      if (r.held) { send(r, r.held); r.held = null; }
+    }
+  };
+
+  const report = () => {
+    const secs = ((Date.now() - start) / 1000).toFixed(0);
+    console.log(`--- ${secs} s ---`);
+    for (const r of rifts) {
+      const lat = r.acked ? (r.latencySum / r.acked).toFixed(1) : '-';
+      console.log(`  RIFT-${String(r.id).padStart(2, '0')}  enviados ${r.sent}  perdidos(sim) ${r.dropped}` +
+                  `  ACK ${r.acked} (${(100 * r.acked / Math.max(1, r.sent)).toFixed(1)}%)  latencia ${lat} ms`);
+    }
+  };
+
+  console.log(`[SIM] ${riftCount} emisores → ${host}:${port} a ${rate} frames/s c/u ` +
+              `(pérdida ${lossPct}%, dup ${dupPct}%, desorden ${reorderPct}%)`);
+  const timer = setInterval(tick, 1000 / rate);
+  const stats = setInterval(report, 5000);
+  setTimeout(() => {
+    clearInterval(timer);
+    clearInterval(stats);
+    setTimeout(() => { report(); sock.close(); }, 500);
+  }, seconds * 1000);
+}
+
+// ============================================
+// MODO receptor: reemplaza al ESP32
+// ============================================
+function runReceptor(args) {
+  const port = parseInt(args.port || RIFT_UDP_PORT);
+  const sock = dgram.createSocket('udp4');
+  const trackers = new Map();
+  let frames = 0, invalid = 0;
+
+  sock.on('message', (msg, rinfo) => {
+    const f = decodeFrame(msg);
+    if (!f) { invalid++; return; }
+    frames++;
+    if (!trackers.has(f.riftId)) trackers.set(f.riftId, { seq: new SeqTracker(), last: null });
+    const t = trackers.get(f.riftId);
+    const res = t.seq.accept(f.seq, f.senderMs);
+    if (res === 'new' || res === 'restart') t.last = f;
+    if (res !== 'new') console.log(`[RX] RIFT-${f.riftId} seq ${f.seq}: ${res}`);
+    if (f.flags & FLAG_ACK_REQ) sock.send(encodeAck(f.riftId, f.seq, f.senderMs), rinfo.port, rinfo.address);
+  });
+
+  setInterval(() => {
+    console.log(`--- frames ${frames}  inválidos ${invalid} ---`);
+    for (const [id, t] of [...trackers].sort((a, b) => a[0] - b[0])) {
+      const s = t.seq;
+      console.log(`  RIFT-${String(id).padStart(2, '0')}  ${t.last ? t.last.tempAvg.toFixed(2) + '°C' : '-'}` +
+                  `  seq ${s.highest}  recibidos ${s.received}  perdidos ${s.lost} (${s.lossPct().toFixed(1)}%)` +
+                  `  desorden ${s.reordered}  dup ${s.duplicates}  reinicios ${s.restarts}`);
+    }
+  }, 5000);
+
+  sock.bind(port, () => console.log(`[SIM] Receptor UDP escuchando en :${port}`));
+}
+
+// ============================================
+// MODO pair: vectores de emparejamiento
+// ============================================
+function runPair(args) {
+  const emisorMac = parseMac(args.mac || '24:6F:28:00:00:01');
+  const receptorMac = parseMac(args['receptor-mac'] || '24:6F:28:AA:BB:CC');
+  const riftId = parseInt(args.rift || 1);
+  const nonce = parseInt(args.nonce || 0x12345678);
+  const channel = parseInt(args.channel || 6);
+
+  const req = encodePair(TYPE_PAIR_REQ, riftId, nonce, channel, emisorMac);
+  const ack = encodePair(TYPE_PAIR_ACK, riftId, nonce, channel, receptorMac);
+  console.log('PAIR_REQ ', req.toString('hex'), decodePair(req, TYPE_PAIR_REQ, emisorMac) ? '(firma OK)' : '(firma MAL)');
+  console.log('PAIR_ACK ', ack.toString('hex'), decodePair(ack, TYPE_PAIR_ACK, receptorMac) ? '(firma OK)' : '(firma MAL)');
+  console.log('LMK      ', deriveLmk(emisorMac).toString('hex'));
+  console.log('Firma con MAC ajena:', decodePair(req, TYPE_PAIR_REQ, receptorMac) ? 'ACEPTADA (error)' : 'rechazada');
+}
+
+// ============================================
+// MODO air: ESP-NOW en memoria con reloj virtual
+// ============================================
+class EventQueue {
+  constructor() { this.now = 0; this.q = []; }
+  at(t, fn) {
+    let lo = 0, hi = this.q.length;
+    while (lo < hi) { const mid = (lo + hi) >> 1; if (this.q[mid].t <= t) lo = mid + 1; else hi = mid; }
+    this.q.splice(lo, 0, { t, fn });
+  }
+  after(dt, fn) { this.at(this.now + dt, fn); }
+  run(until) {
+    while (this.q.length && this.q[0].t <= until) {
+      const ev = this.q.shift();
+      this.now = ev.t;
+      ev.fn();
+    }
+    this.now = until;
+  }
+}
+
+const BROADCAST = Buffer.alloc(6, 0xFF);
+
+// Medio de radio: entrega a nodos en el mismo canal. Unicast cifrado solo se
+// descifra si el receptor tiene al remitente como par con la misma LMK; la
+// capa MAC confirma igual (como en el hardware real)
+class Air {
+  constructor(ev, rand, lossPct) {
+    this.ev = ev; this.rand = rand; this.lossPct = lossPct; this.nodes = [];
+  }
+  add(node) { this.nodes.push(node); }
+  send(src, dst, buf) {
+    let macAck = false;
+    for (const n of this.nodes) {
+      if (n === src || n.channel !== src.channel || !n.powered) continue;
+      const bcast = dst.equals(BROADCAST);
+      if (!bcast && !dst.equals(n.mac)) continue;
+      const rssi = Math.round(Math.min(src.rssiBase, n.rssiBase) + (this.rand() - 0.5) * 8);
+      const loss = this.lossPct + Math.max(0, -80 - rssi) * 3;
+      if (this.rand() * 100 < loss) continue;
+      if (!bcast) {
+        macAck = true;
+        const srcLmk = src.lmkFor(n.mac), dstLmk = n.lmkFor(src.mac);
+        if (!srcLmk || !dstLmk || !srcLmk.equals(dstLmk)) continue;   // No descifra
+      }
+      const copy = Buffer.from(buf);
+      this.ev.after(1 + Math.floor(this.rand() * 3), () => n.powered && n.onRecv(src.mac, copy, rssi));
+    }
+    return macAck;
+  }
+}
+
+class SimReceptor {
+  constructor(ev, air, opts) {
+    this.ev = ev; this.air = air; this.opts = opts;
+    this.mac = parseMac('24:6F:28:AA:BB:CC');
+    this.rssiBase = -40;
+    this.powered = true;
+    this.channel = opts.apChannel;
+    this.stored = new Map();   // Preferences: riftId -> mac
+    this.boot();
+  }
+  boot() {
+    this.peers = new Map();    // riftId -> { mac, frames, rssiAvg }
+    this.seq = new Map();
+    if (this.opts.persist) {
+      for (const [id, mac] of this.stored) this.peers.set(id, { mac, frames: 0, rssiAvg: 0 });
+    }
+  }
+  lmkFor(mac) {
+    for (const p of this.peers.values()) if (p.mac.equals(mac)) return deriveLmk(mac);
+    return null;
+  }
+  onRecv(srcMac, buf, rssi) {
+    const req = decodePair(buf, TYPE_PAIR_REQ, srcMac);
+    if (req) {
+      this.peers.set(req.riftId, { mac: srcMac, frames: 0, rssiAvg: 0 });
+      this.stored.set(req.riftId, srcMac);
+      this.air.send(this, BROADCAST, encodePair(TYPE_PAIR_ACK, req.riftId, req.nonce, this.channel, this.mac));
+      return;
+    }
+    const f = decodeFrame(buf);
+    if (!f) return;
+    const p = this.peers.get(f.riftId);
+    if (!p || !p.mac.equals(srcMac)) return;
+    p.frames++;
+    p.rssiAvg = p.rssiAvg ? p.rssiAvg * 0.8 + rssi * 0.2 : rssi;
+    if (!this.seq.has(f.riftId)) this.seq.set(f.riftId, new SeqTracker());
+    this.seq.get(f.riftId).accept(f.seq, f.senderMs);
+    if (f.flags & FLAG_ACK_REQ) this.air.send(this, srcMac, encodeAck(f.riftId, f.seq, f.senderMs));
+  }
+}
+
+// Misma lógica que emisor.ino: barrido de canales, ACK con 2 reintentos,
+// 3 lecturas sin ACK → re-emparejar
+class SimEmisor {
+  constructor(ev, air, rand, id, opts) {
+    this.ev = ev; this.air = air; this.rand = rand; this.id = id; this.opts = opts;
+    this.mac = Buffer.from([0x24, 0x6F, 0x28, 0x00, 0x00, id]);
+    this.rssiBase = -55 - Math.floor(rand() * 30);
+    this.powered = true;
+    this.channel = opts.apChannel;
+    this.paired = false;
+    this.receptorMac = null;
+    this.espnowChannel = 1;
+    this.hop = 1;
+    this.nonce = Math.floor(rand() * 0xFFFFFFFF);
+    this.seq = 0;
+    this.pending = null;
+    this.misses = 0;
+    this.stats = { readings: 0, acked: 0, lost: 0, pairings: 0, latencySum: 0 };
+  }
+  lmkFor(mac) {
+    return this.paired && this.receptorMac.equals(mac) ? deriveLmk(this.mac) : null;
+  }
+  wifiUp() { return this.opts.ap.up; }
+  tune() {
+    if (this.wifiUp()) this.channel = this.opts.ap.channel;
+    else if (this.paired) this.channel = this.espnowChannel;
+  }
+  start() {
+    this.ev.after(Math.floor(this.rand() * 1000), () => this.pairTick());
+    this.ev.after(this.opts.intervalMs + Math.floor(this.rand() * 5000), () => this.readingTick());
+  }
+  pairTick() {
+    if (!this.paired) {
+      let ch;
+      if (this.wifiUp()) ch = this.channel = this.opts.ap.channel;
+      else { ch = this.channel = this.hop; this.hop = this.hop % 13 + 1; }
+      this.air.send(this, BROADCAST, encodePair(TYPE_PAIR_REQ, this.id, this.nonce, ch, this.mac));
+    }
+    this.ev.after(this.wifiUp() ? 1000 : 250, () => this.pairTick());
+  }
+  readingTick() {
+    this.ev.after(this.opts.intervalMs, () => this.readingTick());
+    this.stats.readings++;
+    if (this.pending) { this.stats.lost++; this.pending = null; }
+    if (!this.paired) { this.stats.lost++; return; }
+    this.tune();
+    const f = { riftId: this.id, seq: ++this.seq, senderMs: this.ev.now, temp1: -20, temp2: -20,
+                tempAvg: -20, flags: FLAG_ACK_REQ, sensorCount: 2, uptimeSec: this.ev.now / 1000 };
+    this.pending = { frame: f, retries: 0, sentAt: this.ev.now };
+    this.transmit();
+  }
+  transmit() {
+    const p = this.pending;
+    this.air.send(this, this.receptorMac, encodeFrame(p.frame));
+    const seq = p.frame.seq;
+    this.ev.after(300, () => this.ackTimeout(seq));
+  }
+  ackTimeout(seq) {
+    const p = this.pending;
+    if (!p || p.frame.seq !== seq) return;
+    if (p.retries < 2) {
+      p.retries++;
+      p.frame.flags |= FLAG_RETRY;
+      this.transmit();
+      return;
+    }
+    this.pending = null;
+    this.stats.lost++;
+    if (++this.misses >= 3) {
+      this.paired = false;
+      this.misses = 0;
+      this.nonce = Math.floor(this.rand() * 0xFFFFFFFF);
+    }
+  }
+  onRecv(srcMac, buf) {
+    const pa = decodePair(buf, TYPE_PAIR_ACK, srcMac);
+    if (pa) {
+      if (pa.riftId !== this.id || pa.nonce !== this.nonce) return;
+      this.paired = true;
+      this.receptorMac = srcMac;
+      this.espnowChannel = pa.channel;
+      this.misses = 0;
+      this.nonce = Math.floor(this.rand() * 0xFFFFFFFF);
+      this.stats.pairings++;
+      this.tune();
+      return;
+    }
+    const ack = decodeAck(buf);
+    if (!ack || !this.pending || ack.seq !== this.pending.frame.seq) return;
+    this.stats.acked++;
+    this.stats.latencySum += this.ev.now - this.pending.sentAt;
+    this.pending = null;
+    this.misses = 0;
+  }
+}
+
+function runAir(args) {
+  const riftCount = parseInt(args.rifts || 6);
+  const minutes = parseFloat(args.minutes || 60);
+  const rand = mulberry32(parseInt(args.seed || 1));
+  const ap = { up: true, channel: 6 };
+  const opts = { apChannel: ap.channel, ap, intervalMs: parseFloat(args.interval || 30) * 1000,
+                 persist: !args['no-persist'] };
+
+  const ev = new EventQueue();
+  const air = new Air(ev, rand, parseFloat(args.loss || 2));
+  const receptor = new SimReceptor(ev, air, opts);
+  air.add(receptor);
+  const emisores = [];
+  for (let i = 1; i <= riftCount; i++) {
+    const e = new SimEmisor(ev, air, rand, i, opts);
+    air.add(e);
+    emisores.push(e);
+    e.start();
+  }
+
+  // Guion: el AP se cae, el receptor reinicia, el AP vuelve en otro canal
+  const total = minutes * 60000;
+  const log = (msg) => console.log(`[${(ev.now / 60000).toFixed(1).padStart(5)} min] ${msg}`);
+  ev.at(total * 0.2, () => { ap.up = false; log('AP caído (receptor y emisores quedan en canal ' + receptor.channel + ')'); });
+  ev.at(total * 0.4, () => {
+    receptor.powered = false;
+    log('Receptor reinicia' + (opts.persist ? ' (pares guardados)' : ' (sin pares guardados)'));
+    ev.after(5000, () => { receptor.boot(); receptor.powered = true; });
+  });
+  ev.at(total * 0.6, () => {
+    ap.up = true;
+    ap.channel = 11;
+    log('AP vuelve en canal 11');
+    // El receptor lo encuentra en el barrido completo (1 de cada 6 intentos)
+    ev.after(60000, () => { receptor.channel = 11; log('Receptor reconectado en canal 11'); });
+  });
+
+  ev.run(total);
+
+  console.log('');
+  console.log('RIFT      lecturas  confirmadas  perdidas  emparej.  latencia  RSSI(rx)  pérdida seq');
+  let readings = 0, acked = 0;
+  for (const e of emisores) {
+    const s = e.stats;
+    const p = receptor.peers.get(e.id);
+    const t = receptor.seq.get(e.id);
+    readings += s.readings;
+    acked += s.acked;
+    console.log(`RIFT-${String(e.id).padStart(2, '0')}   ${String(s.readings).padStart(8)}  ${String(s.acked).padStart(11)}` +
+                `  ${String(s.lost).padStart(8)}  ${String(s.pairings).padStart(8)}` +
+                `  ${(s.acked ? (s.latencySum / s.acked).toFixed(1) : '-').padStart(6)} ms` +
+                `  ${(p && p.rssiAvg ? p.rssiAvg.toFixed(0) : '-').padStart(8)}` +
+                `  ${(t ? t.lossPct().toFixed(1) + '%' : '-').padStart(11)}`);
+  }
+  console.log(`\nEntregadas ${acked}/${readings} (${(100 * acked / Math.max(1, readings)).toFixed(1)}%)`);
+}
+
+// ============================================
+// MAIN
+// ============================================
+if (require.main === module) {
+  const args = parseArgs(process.argv.slice(2));
+  switch (args._[0]) {
+    case 'emit': runEmit(args); break;
+    case 'receptor': runReceptor(args); break;
+    case 'pair': runPair(args); break;
+    case 'air': runAir(args); break;
+    default:
+      console.log('Uso: node rift-packet-sim.js <emit|receptor|pair|air> [opciones]');
+      console.log('Ver el encabezado del archivo para las opciones de cada modo.');
+  }
+}
+
+module.exports = { crc16, encodeFrame, decodeFrame, encodeAck, decodeAck, encodePair, decodePair,
+                   sipHash, deriveLmk, SeqTracker };
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+Genera los web_assets.h de cada sketch: las páginas web comprimidas con
+gzip como arrays PROGMEM, con su ETag (hash del contenido).
+
+El ESP32 las sirve tal cual desde flash con Content-Encoding: gzip, sin
+copiarlas a heap ni subir nada a SPIFFS.
+
+    python3 tools/gen_web_assets.py           # regenerar
+    python3 tools/gen_web_assets.py --check   # falla si algún header quedó viejo
+
+Correr después de editar cualquier página de la tabla SOURCES. Sin
+dependencias; la salida es reproducible (gzip sin fecha ni nombre).
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# header de salida → [(símbolo, fuente, tipo MIME)]
+# Si la fuente es un .h se toma el R"rawliteral(...)rawliteral" que contiene
+SOURCES = {
+    'firmware/web_assets.h': [
+        ('WEB_INDEX', 'firmware/data/index.html', 'text/html'),
+    ],
+    'firmware_v2/web_assets.h': [
+        ('WEB_INDEX', 'firmware_v2/html_ui.h', 'text/html'),
+    ],
+    'receptor/web_assets.h': [
+        ('WEB_INDEX', 'receptor/data/index.html', 'text/html'),
+        ('WEB_APP', 'receptor/data/app.html', 'text/html'),
+    ],
+}
+
+RAWLITERAL = re.compile(r'R"rawliteral\((.*?)\)rawliteral"', re.S)
+
+
+def read_source(path):
+    with open(os.path.join(ROOT, path), 'rb') as f:
+        data = f.read()
+    if path.endswith('.h'):
+        m = RAWLITERAL.search(data.decode('utf-8'))
+        if not m:
+            sys.exit('[ASSETS] ✗ %s: no hay R"rawliteral(...)"' % path)
+        data = m.group(1).encode('utf-8')
+    return data
+
+
+def compress(data):
+    # mtime=0 y sin nombre: mismo contenido → mismos bytes → mismo ETag
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(data, indent='  ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x%02x' % b for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def render(out_path, assets):
+    guard = os.path.basename(out_path).upper().replace('.', '_')
+    summary = []
+    body = []
+    for symbol, src, mime in assets:
+        raw = read_source(src)
+        gz = compress(raw)
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        summary.append(' *   %-10s %-28s %6d → %5d bytes gzip' % (symbol, src, len(raw), len(gz)))
+        body.append('#define %s_MIME "%s"' % (symbol, mime))
+        body.append('#define %s_ETAG "\\"%s\\""' % (symbol, etag))
+        body.append('#define %s_GZ_LEN %d' % (symbol, len(gz)))
+        body.append('const uint8_t %s_GZ[] PROGMEM = {' % symbol)
+        body.append(c_array(gz))
+        body.append('};')
+        body.append('')
+
+    return '\n'.join([
+        '/*',
+        ' * %s - Páginas web comprimidas (GENERADO, no editar)' % os.path.basename(out_path).upper(),
+        ' *',
+        ' * Regenerar con: python3 tools/gen_web_assets.py',
+        ' *',
+    ] + summary + [
+        ' */',
+        '',
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include <Arduino.h>',
+        '',
+    ] + body + [
+        '#endif',
+        '',
+    ])
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Genera web_assets.h (gzip + ETag en PROGMEM)')
+    parser.add_argument('--check', action='store_true', help='no escribe; sale con 1 si hay headers viejos')
+    args = parser.parse_args()
+
+    stale = 0
+    for out_path, assets in SOURCES.items():
+        text = render(out_path, assets)
+        full = os.path.join(ROOT, out_path)
+        try:
+            with open(full, encoding='utf-8') as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+
+        if current == text:
+            print('[ASSETS] ✓ %s al día' % out_path)
+        elif args.check:
+            print('[ASSETS] ✗ %s desactualizado' % out_path)
+            stale += 1
+        else:
+            with open(full, 'w', encoding='utf-8', newline='\n') as f:
+                f.write(text)
+            print('[ASSETS] ✓ %s generado' % out_path)
+
+    return 1 if stale else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
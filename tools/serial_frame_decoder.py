@@ -0,0 +1,358 @@
+#!/usr/bin/env python3
+"""
+Decodifica las tramas binarias del serial del firmware v2 (serial_frame.h):
+COBS + CRC16, separadas por 0x00. Captura en vivo y reproduce capturas.
+
+    python3 tools/serial_frame_decoder.py capture --port /dev/ttyUSB0 --hz 50 --out captura.bin
+    python3 tools/serial_frame_decoder.py capture --port COM5 --command PROFILE
+    python3 tools/serial_frame_decoder.py replay captura.bin [--json] [--text]
+
+capture pone el equipo en modo tramas (STREAM a --hz), manda PING cada
+2 s como keepalive y guarda los bytes crudos tal cual llegan: replay
+los vuelve a decodificar igual. Al salir (Ctrl+C o --seconds) devuelve
+el equipo a modo texto.
+
+Por trama una línea legible, o un objeto JSON por línea con --json. Los
+logs de texto que el equipo intercala entre tramas se muestran con
+--text. Al final: tramas por tipo, perdidas (saltos de seq), errores de
+CRC y muestras por segundo.
+
+replay no tiene dependencias; capture necesita pyserial.
+"""
+
+import argparse
+import binascii
+import json
+import struct
+import sys
+import time
+
+# Mismos valores que serial_frame.h
+PROTO_VERSION = 1
+
+FRAME_HELLO = 0x01
+FRAME_SAMPLE = 0x02
+FRAME_DOOR = 0x03
+FRAME_STATE = 0x04
+FRAME_RESPONSE = 0x05
+
+CMD_PING = 0x80
+CMD_STREAM = 0x81
+CMD_COMMAND = 0x82
+CMD_TEXT = 0x83
+
+TYPE_NAMES = {
+    FRAME_HELLO: 'HELLO', FRAME_SAMPLE: 'SAMPLE', FRAME_DOOR: 'DOOR',
+    FRAME_STATE: 'STATE', FRAME_RESPONSE: 'RESPONSE',
+    CMD_PING: 'PING', CMD_STREAM: 'STREAM', CMD_COMMAND: 'COMMAND', CMD_TEXT: 'TEXT',
+}
+
+# SystemStateEnum (config.h, sección 4)
+STATE_NAMES = ['NORMAL', 'EN_DESCONGELAMIENTO', 'ESPERA_POST_DESCONGELADO',
+               'CARGANDO_CONFIG', 'ALERTA', 'OFFLINE', 'INICIALIZANDO']
+
+STATUS_NAMES = ['OK', 'largo inválido', 'desconocido', 'no disponible', 'argumento inválido']
+
+TEMP_INVALID = -32768
+CURRENT_ABSENT = 0xFFFF
+
+
+# ============================================================================
+# CRC16 Y COBS
+# ============================================================================
+def crc16(data):
+    # CRC-16/CCITT-FALSE: poli 0x1021, inicio 0xFFFF
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at = 0
+    code = 1
+    for b in data:
+        if b:
+            out.append(b)
+            code += 1
+        if not b or code == 0xFF:
+            out[code_at] = code
+            code_at = len(out)
+            out.append(0)
+            code = 1
+    out[code_at] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_frame(ftype, seq, payload=b''):
+    raw = bytes([ftype, seq & 0xFF]) + payload
+    raw += struct.pack('<H', crc16(raw))
+    return b'\x00' + cobs_encode(raw) + b'\x00'
+
+
+# ============================================================================
+# DECODIFICADOR
+# ============================================================================
+class Decoder:
+    """Recibe bytes en cualquier partición y devuelve eventos completos."""
+
+    def __init__(self):
+        self.pending = bytearray()
+        self.last_seq = None
+        self.counts = {}
+        self.lost = 0
+        self.errors = 0
+        self.text_blocks = 0
+        self.first_t = None
+        self.last_t = None
+        self.samples = 0
+
+    def feed(self, data):
+        events = []
+        self.pending += data
+        while True:
+            end = self.pending.find(b'\x00')
+            if end < 0:
+                break
+            chunk = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if chunk:
+                events.append(self._chunk(chunk))
+        return events
+
+    def flush(self):
+        """Lo que quedó sin 0x00 final (el último log de texto)."""
+        chunk = bytes(self.pending)
+        self.pending.clear()
+        return [self._chunk(chunk)] if chunk else []
+
+    def _chunk(self, chunk):
+        raw = cobs_decode(chunk)
+        if raw is not None and len(raw) >= 4 and crc16(raw[:-2]) == struct.unpack('<H', raw[-2:])[0]:
+            return self._frame(raw[0], raw[1], raw[2:-2])
+
+        # Texto del equipo entre tramas (logs) o basura
+        text = chunk.decode('utf-8', errors='replace')
+        printable = sum(1 for ch in text if ch.isprintable() or ch in '\r\n\t')
+        if printable >= len(text) * 0.9:
+            self.text_blocks += 1
+            return {'kind': 'text', 'text': text}
+        self.errors += 1
+        return {'kind': 'error', 'bytes': len(chunk)}
+
+    def _frame(self, ftype, seq, payload):
+        if self.last_seq is not None:
+            self.lost += (seq - self.last_seq - 1) & 0xFF
+        self.last_seq = seq
+        name = TYPE_NAMES.get(ftype, '0x%02x' % ftype)
+        self.counts[name] = self.counts.get(name, 0) + 1
+
+        event = {'kind': 'frame', 'type': name, 'seq': seq}
+        try:
+            event.update(parse_payload(ftype, payload))
+        except struct.error:
+            self.errors += 1
+            return {'kind': 'error', 'type': name, 'bytes': len(payload)}
+
+        if ftype == FRAME_HELLO and event['proto'] != PROTO_VERSION:
+            print('[FRAMES] ⚠️ El equipo habla el protocolo %d, este decodificador el %d'
+                  % (event['proto'], PROTO_VERSION), file=sys.stderr)
+        if ftype == FRAME_SAMPLE:
+            self.samples += 1
+            if self.first_t is None:
+                self.first_t = event['t_ms']
+            self.last_t = event['t_ms']
+        return event
+
+
+def parse_payload(ftype, p):
+    if ftype == FRAME_HELLO:
+        proto, max_hz, hz, sent, dropped, rx_ok, rx_err = struct.unpack_from('<BBBIIII', p)
+        return {'proto': proto, 'max_hz': max_hz, 'hz': hz, 'sent': sent, 'dropped': dropped,
+                'rx_ok': rx_ok, 'rx_errors': rx_err, 'firmware': p[19:].decode('utf-8', 'replace')}
+
+    if ftype == FRAME_SAMPLE:
+        t_ms, t_read, st, flags, doors, current, n = struct.unpack_from('<IIBBBHB', p)
+        temps = struct.unpack_from('<%dh' % n, p, 14)
+        return {
+            't_ms': t_ms,
+            'read_age_ms': (t_ms - t_read) & 0xFFFFFFFF,
+            'state': state_name(st),
+            'alert': bool(flags & 0x01),
+            'critical': bool(flags & 0x02),
+            'defrost_signal': bool(flags & 0x04),
+            'wifi': bool(flags & 0x08),
+            'doors_open': [i for i in range(8) if doors & (1 << i)],
+            'current_a': None if current == CURRENT_ABSENT else current / 100.0,
+            'temps': [None if t == TEMP_INVALID else t / 100.0 for t in temps],
+        }
+
+    if ftype == FRAME_DOOR:
+        t_ms, door, is_open = struct.unpack_from('<IBB', p)
+        return {'t_ms': t_ms, 'door': door, 'open': bool(is_open)}
+
+    if ftype == FRAME_STATE:
+        t_ms, src, dst = struct.unpack_from('<IBB', p)
+        return {'t_ms': t_ms, 'from': state_name(src), 'to': state_name(dst)}
+
+    if ftype == FRAME_RESPONSE:
+        req, req_seq, status = struct.unpack_from('<BBB', p)
+        return {'request': TYPE_NAMES.get(req, '0x%02x' % req), 'request_seq': req_seq,
+                'status': STATUS_NAMES[status] if status < len(STATUS_NAMES) else status,
+                'text': p[3:].decode('utf-8', 'replace')}
+
+    return {'payload': p.hex()}
+
+
+def state_name(value):
+    return STATE_NAMES[value] if value < len(STATE_NAMES) else str(value)
+
+
+# ============================================================================
+# SALIDA
+# ============================================================================
+def describe(e):
+    kind = e['type']
+    if kind == 'SAMPLE':
+        temps = ' '.join('—' if t is None else '%.2f' % t for t in e['temps'])
+        flags = ','.join(f for f in ('alert', 'critical', 'defrost_signal', 'wifi') if e[f]) or '-'
+        current = '—' if e['current_a'] is None else '%.2f A' % e['current_a']
+        doors = ','.join(str(d + 1) for d in e['doors_open']) or '-'
+        return '%10.3f s  SAMPLE  %-24s temps [%s] (lectura hace %.1f s)  puertas %s  I %s  %s' % (
+            e['t_ms'] / 1000, e['state'], temps, e['read_age_ms'] / 1000, doors, current, flags)
+    if kind == 'DOOR':
+        return '%10.3f s  DOOR    puerta %d %s' % (e['t_ms'] / 1000, e['door'] + 1,
+                                                'ABIERTA' if e['open'] else 'CERRADA')
+    if kind == 'STATE':
+        return '%10.3f s  STATE   %s → %s' % (e['t_ms'] / 1000, e['from'], e['to'])
+    if kind == 'HELLO':
+        return '            HELLO   %s  proto %d  %d/%d Hz  enviadas %d  descartadas %d  rx %d ok / %d err' % (
+            e['firmware'], e['proto'], e['hz'], e['max_hz'], e['sent'], e['dropped'], e['rx_ok'], e['rx_errors'])
+    if kind == 'RESPONSE':
+        text = e['text'].rstrip()
+        return '            RESP    %s #%d: %s%s' % (e['request'], e['request_seq'], e['status'],
+                                                   '\n' + text if text else '')
+    return '            %s' % json.dumps(e, ensure_ascii=False)
+
+
+def emit(events, args):
+    for e in events:
+        if e['kind'] == 'text':
+            if args.text:
+                sys.stdout.write(e['text'] if not args.json else json.dumps(e, ensure_ascii=False) + '\n')
+            continue
+        if e['kind'] == 'error':
+            if args.json:
+                print(json.dumps(e))
+            continue
+        print(json.dumps(e, ensure_ascii=False) if args.json else describe(e))
+    sys.stdout.flush()
+
+
+def summary(d):
+    out = sys.stderr
+    print('\n[FRAMES] %s' % ('  '.join('%s %d' % kv for kv in sorted(d.counts.items())) or 'sin tramas'), file=out)
+    print('[FRAMES] perdidas (seq) %d  errores %d  bloques de texto %d' % (d.lost, d.errors, d.text_blocks), file=out)
+    if d.samples > 1 and d.last_t > d.first_t:
+        print('[FRAMES] %.1f muestras/s en %.1f s' % (
+            (d.samples - 1) * 1000.0 / (d.last_t - d.first_t), (d.last_t - d.first_t) / 1000.0), file=out)
+
+
+# ============================================================================
+# COMANDOS
+# ============================================================================
+def replay(args):
+    d = Decoder()
+    with open(args.file, 'rb') as f:
+        while True:
+            data = f.read(4096)
+            if not data:
+                break
+            emit(d.feed(data), args)
+    emit(d.flush(), args)
+    summary(d)
+    return 0
+
+
+def capture(args):
+    try:
+        import serial
+    except ImportError:
+        sys.exit('[FRAMES] ✗ capture necesita pyserial (pip install pyserial)')
+
+    port = serial.Serial(args.port, args.baud, timeout=0.05)
+    out = open(args.out, 'wb') if args.out else None
+    d = Decoder()
+    seq = 0
+
+    def send(ftype, payload=b''):
+        nonlocal seq
+        port.write(encode_frame(ftype, seq, payload))
+        seq += 1
+
+    send(CMD_PING)
+    send(CMD_STREAM, bytes([args.hz]))
+    if args.command:
+        send(CMD_COMMAND, args.command.encode('utf-8'))
+
+    start = time.monotonic()
+    last_ping = start
+    try:
+        while not args.seconds or time.monotonic() - start < args.seconds:
+            data = port.read(4096)
+            if data:
+                if out:
+                    out.write(data)
+                emit(d.feed(data), args)
+            if time.monotonic() - last_ping >= 2:
+                send(CMD_PING)
+                last_ping = time.monotonic()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        send(CMD_TEXT)
+        port.close()
+        if out:
+            out.close()
+    summary(d)
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Tramas COBS + CRC16 del serial del firmware v2')
+    sub = parser.add_subparsers(dest='mode', required=True)
+
+    cap = sub.add_parser('capture', help='capturar en vivo desde el puerto serie')
+    cap.add_argument('--port', required=True)
+    cap.add_argument('--baud', type=int, default=115200)
+    cap.add_argument('--hz', type=int, default=50, help='muestras por segundo (0 = solo eventos)')
+    cap.add_argument('--out', help='guardar los bytes crudos para replay')
+    cap.add_argument('--seconds', type=float, default=0, help='cortar después de N segundos')
+    cap.add_argument('--command', help='comando de texto a mandar por trama (ej. PROFILE)')
+
+    rep = sub.add_parser('replay', help='decodificar una captura guardada')
+    rep.add_argument('file')
+
+    for p in (cap, rep):
+        p.add_argument('--json', action='store_true', help='un objeto JSON por línea')
+        p.add_argument('--text', action='store_true', help='mostrar también los logs de texto')
+
+    args = parser.parse_args()
+    return capture(args) if args.mode == 'capture' else replay(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())